@@ -11,6 +11,9 @@
 #include <stdnoreturn.h>
 #include <stdarg.h>
 #include <setjmp.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/stat.h>
 
 
 
@@ -86,6 +89,7 @@ B   0   Extension of the ModR/M r/m field, SIB base field, or Opcode reg field
 #define is_general_reg(r) (r >= OPERAND_R8 && r <= OPERAND_R64)
 #define is_mem(m) (m >= OPERAND_M8 && m <= OPERAND_M80)
 #define is_relative(x) (x >= OPERAND_REL8 && x <= OPERAND_REL32)
+#define is_rm_operand(r) ((r >= OPERAND_RM8 && r <= OPERAND_RM64) || r == OPERAND_MMM32 || r == OPERAND_MMM64 || (r >= OPERAND_XMMM8 && r <= OPERAND_YMMM256))
 
 
 #define is_int32(n) ((int64_t)n <= INT32_MAX && (int64_t)n >= INT32_MIN)
@@ -106,7 +110,121 @@ typedef struct {
 
 
 
-static FileBuffer* current_fb = NULL;
+//a constant already stored in a merge section
+typedef struct {
+    uint64_t hash;
+    uint64_t offset;
+    uint64_t size;
+    uint8_t section; //SECTION_EXTERN if the slot is empty
+} MergedConstant;
+
+
+//a symbol instance of an instruction --align-branches could still move
+typedef struct {
+    uint32_t symbol;
+    uint32_t instance;
+} MovedInstance;
+
+
+//where the cfa is, --auto-cfi also keeps track of rsp
+typedef struct {
+    uint8_t cfa_register; //dwarf number
+    int64_t cfa_offset;
+    int64_t rsp_offset; //cfa - rsp
+} CfiState;
+
+
+/*
+ * Holds everything needed to assemble one program
+ * so many programs can be assembled at the same time on different threads
+ */
+struct BasmContext {
+    Program program;
+    FileBuffer* fb;
+    ScratchBuffer scratch;
+    ArrayList tokens;
+    ArrayList names; //copies of the names passed to the builder
+    const char* input_name;
+    const char* directory; //relative paths are in it and -g names it, NULL for the current directory
+    int line_offset; //added to the line numbers of errors when the tokens don't start at line 1
+    const char* line_text; //the line the incremental linker is parsing again, errors show it since there's no file buffer
+    Stats* stats; //NULL unless the stats are being collected
+    ArrayList* listing; //ListingLine of every line, NULL unless a listing is written
+
+    uint32_t options; //BasmOption bits
+
+    //--align-branches moves the instruction before a jcc along with it since the two can fuse
+    uint64_t fusible_start; //MAX_OFFSET if the last instruction can't fuse
+    ArrayList moved_instances; //MovedInstance of the symbols the pending cmp/test and the instruction after it use
+
+    uint8_t label_reloc; //SymbolReloc of the last memory label that was encoded
+
+    //the cfi frame the code is in, from .cfi_startproc or one --auto-cfi opened at a global label
+    struct {
+        bool open;
+        bool automatic;
+        bool in_prologue; //--auto-cfi hasn't seen a local label or an instruction that isn't a push, sub rsp or mov rbp, rsp
+        int line_number; //of .cfi_startproc
+        CfiState state;
+        CfiState body; //after the prologue, --auto-cfi goes back to it after a ret or jmp
+        int64_t rbp_offset; //rsp_offset when the prologue set rbp to rsp
+        CfiState remembered[8]; //.cfi_remember_state
+        int remembered_count;
+    } cfi;
+
+    //hash set of the constants in merge sections so every one is only stored once, open addressing
+    MergedConstant* constants;
+    uint32_t constant_capacity; //power of 2
+    uint32_t constant_count;
+
+    //fatal errors jump back to the public function that was called 
+    jmp_buf error_jmp;
+    bool has_error;
+    char error[512];
+};
+
+
+
+static void context_verror(BasmContext* ctx, const char* fmt, va_list list){
+    int size = snprintf(ctx->error, sizeof(ctx->error), "Error: ");
+    vsnprintf(ctx->error + size, sizeof(ctx->error) - size, fmt, list);
+    ctx->has_error = true;
+}
+
+
+static void context_error_append(BasmContext* ctx, const char* fmt, ...){
+    size_t size = strlen(ctx->error);
+    va_list list;
+    va_start(list, fmt);
+    vsnprintf(ctx->error + size, sizeof(ctx->error) - size, fmt, list);
+    va_end(list);
+}
+
+
+//points out where the error happened in the source
+static void context_error_line(BasmContext* ctx, int line_number, int col){
+    const char* line = ctx->line_text;
+    if(ctx->fb != NULL) line = file_get_line(ctx->fb, line_number);
+    if(line == NULL) return;
+    context_error_append(ctx, "Line %d, Col %d\n", line_number + ctx->line_offset, col);
+    //file_get_line cuts off the comment too
+    context_error_append(ctx, "%.*s\n", (int)strcspn(line, ";"), line);
+    context_error_append(ctx, "%*s\n", col, "^");
+}
+
+
+noreturn static void program_fatal_error(BasmContext* ctx, const char* fmt, ...){
+    va_list list;
+    va_start(list, fmt);
+    context_verror(ctx, fmt, list);
+    va_end(list);
+    longjmp(ctx->error_jmp, 1);
+}
+
+
+
+
+
 
 static int string_cmp_lower(const void* a, const void* b) {
     const char* s1 = (const char*)a;
@@ -127,15 +245,15 @@ static int string_cmp_lower(const void* a, const void* b) {
 }
 
 
-static inline void get_literal(int* col){
+static inline void get_literal(BasmContext* ctx, int* col){
     while(true){
-        char next = file_buffer_peek_char(current_fb);
+        char next = file_buffer_peek_char(ctx->fb);
         //TODO: add more valid labels 
         if(!isalnum(next) && next != '_' && next != '.'){
             break;
         }
-        char c =file_buffer_get_char(current_fb);
-        scratch_buffer_append_char(c); 
+        char c =file_buffer_get_char(ctx->fb);
+        scratch_buffer_append_char(&ctx->scratch, c); 
         (*col)++;
     }
 }
@@ -144,10 +262,10 @@ static inline void get_literal(int* col){
 /** 
  * Determine if the String is a keyword or identifier 
  */
-static Token id_or_kw(int* col){
-    get_literal(col);
-    char* str = scratch_buffer_as_str();
-    uint32_t str_size = scratch_buffer_offset();
+static Token id_or_kw(BasmContext* ctx, int* col){
+    get_literal(ctx, col);
+    char* str = scratch_buffer_as_str(&ctx->scratch);
+    uint32_t str_size = scratch_buffer_offset(&ctx->scratch);
 
 
     const struct Keyword* kw = find_keyword(str, str_size); 
@@ -171,71 +289,76 @@ static Token id_or_kw(int* col){
 
 
 
-static void get_string(uint32_t line, int col){
+static void get_string(BasmContext* ctx, uint32_t line, int col){
+    const char* program_error = NULL;
     while(true){
-        char next = file_buffer_peek_char(current_fb);
+        char next = file_buffer_peek_char(ctx->fb);
         if(next == '\"'){
-            file_buffer_get_char(current_fb);
-            scratch_buffer_append_char(0);
+            file_buffer_get_char(ctx->fb);
+            scratch_buffer_append_char(&ctx->scratch, 0);
             return;
         }
 
-        if(next == '\n'){
-            fprintf(stderr, "Error: String doesn't close\nLine %d, Col %d\n", line, col);
+        if(next == '\n' || file_buffer_eof(ctx->fb)){
+            program_error = "String doesn't close";
             goto error;
         }
-        char c = file_buffer_get_char(current_fb);
+        char c = file_buffer_get_char(ctx->fb);
         if(c == '\\'){
-            c = file_buffer_get_char(current_fb);
+            c = file_buffer_get_char(ctx->fb);
             switch (c) {
                 case 'b':
-                    scratch_buffer_append_char(8); 
+                    scratch_buffer_append_char(&ctx->scratch, 8); 
                     break;
                 case 't':
-                    scratch_buffer_append_char(9); 
+                    scratch_buffer_append_char(&ctx->scratch, 9); 
                     break;
                 case 'n':
-                    scratch_buffer_append_char(10); 
+                    scratch_buffer_append_char(&ctx->scratch, 10); 
                     break;
                 case 'f':
-                    scratch_buffer_append_char(12); 
+                    scratch_buffer_append_char(&ctx->scratch, 12); 
                     break;
                 case 'r':
-                    scratch_buffer_append_char(13); 
+                    scratch_buffer_append_char(&ctx->scratch, 13); 
                     break;
                 case '\"':
-                    scratch_buffer_append_char(34); 
+                    scratch_buffer_append_char(&ctx->scratch, 34); 
                     break;
                 case '\'':
-                    scratch_buffer_append_char(39); 
+                    scratch_buffer_append_char(&ctx->scratch, 39); 
                     break;
                 case '\\':
-                    scratch_buffer_append_char(92); 
+                    scratch_buffer_append_char(&ctx->scratch, 92); 
                     break;
                 default:
-                    fprintf(stderr, "Error: Invalid Escape Sequence\nLine %d, Col %d\n", line, col); 
+                    program_error = "Invalid Escape Sequence";
                     goto error;
             }  
         } else{
-            scratch_buffer_append_char(c); 
+            scratch_buffer_append_char(&ctx->scratch, c); 
         }
     }
 
 error:
-    fprintf(stderr, "%s\n", file_get_line(current_fb, line));
-    fprintf(stderr,"%*s\n", col, "^");
-    exit(EXIT_FAILURE);
+    snprintf(ctx->error, sizeof(ctx->error), "Error: %s\n", program_error);
+    ctx->has_error = true;
+    context_error_line(ctx, line, col);
+    longjmp(ctx->error_jmp, 1);
 
 }
 
 
 
 
-static ArrayList tokenize_file(){
-    init_scratch_buffer(); 
-
-    ArrayList tokens;
-    array_list_create_cap(tokens, Token, 256);
+//appends the tokens of the current file to the tokens of the context 
+static void tokenize_file(BasmContext* ctx){
+    if(ctx->tokens.data == NULL){
+        array_list_create_cap(ctx->tokens, Token, 256);
+    }
+    int first_token = ctx->tokens.size;
+    //the object writers leave their string tables in the scratch buffer
+    scratch_buffer_clear(&ctx->scratch);
 
     int line_number = 1;
     int col = 1;
@@ -243,14 +366,15 @@ static ArrayList tokenize_file(){
     char prev_newline = '\n';
 
     do{
-        char c = file_buffer_get_char(current_fb);
+        char c = file_buffer_get_char(ctx->fb);
    
         while(isspace(c) && c != '\n'){
             col++;
-            c = file_buffer_get_char(current_fb);
+            c = file_buffer_get_char(ctx->fb);
         }
 
-        if(file_buffer_eof(current_fb)) break;
+        //EOF is also a valid byte so check that the file actually ended
+        if(c == EOF && file_buffer_eof(ctx->fb)) break;
 
         Token token;
         token.type = TOK_MAX;
@@ -274,7 +398,7 @@ static ArrayList tokenize_file(){
                 token.type = TOK_COMMA;
                 break;
             case '\"':
-                get_string(line_number, col);
+                get_string(ctx, line_number, col);
                 token.type = TOK_STRING;
                 col++;
                 break;
@@ -294,18 +418,26 @@ static ArrayList tokenize_file(){
                 col++;
                 token.type = TOK_MULTIPLY;
                 break;
+            case '=':
+                col++;
+                token.type = TOK_EQUAL;
+                break;
+            case '@':
+                col++;
+                token.type = TOK_AT;
+                break;
             case ';':
                 while(true){
-                    c = file_buffer_get_char(current_fb); 
-                    if(c == '\n' || file_buffer_eof(current_fb)){
+                    c = file_buffer_get_char(ctx->fb); 
+                    if(c == '\n' || file_buffer_eof(ctx->fb)){
                         //if there are other tokens on the line 
                         // we want to put a new line
-                        if(tokens.size > 1 && prev_newline != '\n'){
-                            Token last_token = array_list_get(tokens, Token, tokens.size - 1);
+                        if(ctx->tokens.size > first_token + 1 && prev_newline != '\n'){
+                            Token last_token = array_list_get(ctx->tokens, Token, ctx->tokens.size - 1);
                             if(last_token.line_number == line_number){
                                 prev_newline = '\n';
                                 token.type = TOK_NEW_LINE;
-                                array_list_append(tokens, Token, token);
+                                array_list_append(ctx->tokens, Token, token);
                             }
                         }
                         col = 1;
@@ -318,22 +450,22 @@ static ArrayList tokenize_file(){
                 if (isalpha(c) || c == '_' || c == '.'){
                     int temp = col;
                     col++;
-                    scratch_buffer_append_char(c);
-                    token = id_or_kw( &col);
+                    scratch_buffer_append_char(&ctx->scratch, c);
+                    token = id_or_kw(ctx,  &col);
                     token.line_number = line_number;
                     token.col = temp;
-                    if(token.type != TOK_IDENTIFIER) scratch_buffer_clear();
+                    if(token.type != TOK_IDENTIFIER) scratch_buffer_clear(&ctx->scratch);
 
                 }else if(isdigit(c)){
                     token.type = TOK_UINT;
                     col++;
-                    scratch_buffer_append_char(c);
-                    get_literal(&col); 
+                    scratch_buffer_append_char(&ctx->scratch, c);
+                    get_literal(ctx, &col); 
                 }else if(c == '-'){
                     col++;
-                    scratch_buffer_append_char(c);
+                    scratch_buffer_append_char(&ctx->scratch, c);
                     token.type = TOK_INT;
-                    get_literal( &col); 
+                    get_literal(ctx,  &col); 
                 }
                 else{
                     //unkown token
@@ -344,39 +476,38 @@ static ArrayList tokenize_file(){
             } 
         }
 
-        char* id = scratch_buffer_as_str();
+        char* id = scratch_buffer_as_str(&ctx->scratch);
 
         //add the identifier to the token 
         if(id != NULL){
             char* dyn_id = strdup(id);
             if(dyn_id == NULL){
-                fprintf(stderr, "Failed to alloc memory\n");
-                exit(EXIT_FAILURE);
+                program_fatal_error(ctx, "Failed to alloc memory\n");
             }
             token.literal = dyn_id; 
         }
 
         prev_newline = c;
 
-        array_list_append(tokens, Token, token);
+        array_list_append(ctx->tokens, Token, token);
         comment:
-        scratch_buffer_clear();
-    } while(!file_buffer_eof(current_fb));
+        scratch_buffer_clear(&ctx->scratch);
+    } while(!file_buffer_eof(ctx->fb));
 
     
     //append new line after last token if there isn't one already 
-    if(tokens.size != 0){
-        Token temp = array_list_get(tokens, Token, tokens.size - 1);
+    if(ctx->tokens.size != first_token){
+        Token temp = array_list_get(ctx->tokens, Token, ctx->tokens.size - 1);
         if(temp.type != TOK_NEW_LINE){
             Token new_tok = {TOK_NEW_LINE, 0, line_number, col};
-            array_list_append(tokens, Token, new_tok);
+            array_list_append(ctx->tokens, Token, new_tok);
         }
 
     }
     
     /* 
-    for(int i = 0; i < tokens.size; i++){
-        Token t = array_list_get(tokens, Token, i);
+    for(int i = 0; i < ctx->tokens.size; i++){
+        Token t = array_list_get(ctx->tokens, Token, i);
         if(t.type == TOK_IDENTIFIER || t.type == TOK_UINT || t.type == TOK_INT){
             printf("%s, %s, %d\n", token_to_string(t.type), t.literal, t.line_number);
         } 
@@ -395,15 +526,14 @@ static ArrayList tokenize_file(){
        
  
    
-    scratch_buffer_clear();
-    return tokens;
+    scratch_buffer_clear(&ctx->scratch);
 }
 
 
-static Program program = {0};
 
 
 typedef struct {
+    BasmContext* ctx;
     ArrayList* tokens; 
     Token currentToken; 
     uint32_t tokenIndex;
@@ -412,35 +542,26 @@ typedef struct {
 
 
 
-noreturn void program_fatal_error(const char* fmt, ...){
-    fprintf(stderr,"Error: ");
-    va_list list;
-    va_start(list, fmt);
-    vfprintf(stderr, fmt, list);
-    va_end(list);
-    exit(EXIT_FAILURE);
-}
-
-
-
-void symbol_table_add(char* name, uint64_t offset, uint8_t section, uint8_t visibility){
-    for(int i = 0; i < program.symTable.symbols.size; i++){
-        SymbolTableEntry* e = &array_list_get(program.symTable.symbols, SymbolTableEntry, i);
+//returns the entry of the symbol, it stays valid until the next symbol is added
+static SymbolTableEntry* symbol_table_add(BasmContext* ctx, char* name, uint64_t offset, uint8_t section, uint8_t visibility){
+    for(int i = 0; i < ctx->program.symTable.symbols.size; i++){
+        SymbolTableEntry* e = &array_list_get(ctx->program.symTable.symbols, SymbolTableEntry, i);
         if(strcmp(e->name, name) == 0 && section != SECTION_UNDEFINED && visibility != VISIBILITY_UNDEFINED){
             //if we come across a label after declaring it global
             if(e->visibility == VISIBILITY_GLOBAL && visibility == VISIBILITY_LOCAL){
                 e->section_offset = offset; 
-                return;
+                e->section = section;
+                return e;
             } else if(e->visibility == VISIBILITY_LOCAL && visibility == VISIBILITY_GLOBAL){
                 e->visibility = VISIBILITY_GLOBAL;
-                return;
+                return e;
             } else if (e->section == SECTION_UNDEFINED && e->visibility == VISIBILITY_UNDEFINED) {
                 e->visibility = visibility;
                 e->section_offset= offset;
                 e->section = section;
-                return;
+                return e;
             } 
-           program_fatal_error("Many definitions of symbol: %s\n", name); 
+           program_fatal_error(ctx, "Many definitions of symbol: %s\n", name); 
         }
     }
     SymbolTableEntry e = {0};
@@ -449,32 +570,42 @@ void symbol_table_add(char* name, uint64_t offset, uint8_t section, uint8_t visi
     e.section = section;
     e.visibility = visibility;
 
-    if(section == SECTION_TEXT){
-        e.section_offset = program.text.size;
-    }
-    else if (section == SECTION_DATA){
-        e.section_offset = program.data.size;
-    }
-    else{ 
-        e.section_offset = program.bss.size;
-    }
+    Section* output = program_section(&ctx->program, section);
+    e.section_offset = (output != NULL) ? output->size : 0;
+
+
+    array_list_append(ctx->program.symTable.symbols, SymbolTableEntry, e);
+    return &array_list_get(ctx->program.symTable.symbols, SymbolTableEntry, ctx->program.symTable.symbols.size - 1);
+}
+
+static inline void track_moved_instance(BasmContext* ctx, uint32_t symbol, uint32_t instance){
+    if(!(ctx->options & BASM_OPTION_ALIGN_BRANCHES)) return;
+    if(ctx->moved_instances.data == NULL) array_list_create_cap(ctx->moved_instances, MovedInstance, 8);
+    array_list_append(ctx->moved_instances, MovedInstance, ((MovedInstance){symbol, instance}));
+}
 
 
-    array_list_append(program.symTable.symbols, SymbolTableEntry, e);
+//nothing before this point can move with the next instruction
+static inline void stop_branch_fusing(BasmContext* ctx){
+    ctx->fusible_start = MAX_OFFSET;
+    ctx->moved_instances.size = 0;
 }
 
+
 //TODO: MAKE IT A MULTIPASS ASSEMBLER
-void symbol_table_add_instance(char* symbol_name, uint32_t offset, bool is_relative){
-    for(int i = 0; i < program.symTable.symbols.size; i++){
-        SymbolTableEntry* e = &array_list_get(program.symTable.symbols, SymbolTableEntry, i);
+//size is the bytes of the field, the relative ones are always the 4 bytes before offset in the text section
+static void symbol_table_add_instance(BasmContext* ctx, char* symbol_name, uint32_t offset, bool is_relative, uint8_t section, uint8_t size, uint8_t reloc){
+    for(int i = 0; i < ctx->program.symTable.symbols.size; i++){
+        SymbolTableEntry* e = &array_list_get(ctx->program.symTable.symbols, SymbolTableEntry, i);
 
         if(strcmp(e->name, symbol_name) == 0){
             if(e->instances.data == NULL){
                 array_list_create_cap(e->instances, SymbolInstance, 2);
             }
 
-            SymbolInstance current_instance = {offset, is_relative};
+            SymbolInstance current_instance = {offset, is_relative, section, size, reloc};
             array_list_append(e->instances, SymbolInstance, current_instance); 
+            track_moved_instance(ctx, i, e->instances.size - 1);
             return;
         }
          
@@ -487,23 +618,20 @@ void symbol_table_add_instance(char* symbol_name, uint32_t offset, bool is_relat
     e.section = SECTION_UNDEFINED;
     e.visibility = VISIBILITY_UNDEFINED;
     array_list_create_cap(e.instances, SymbolInstance, 2);
-    SymbolInstance c = {offset, is_relative};
+    SymbolInstance c = {offset, is_relative, section, size, reloc};
     array_list_append(e.instances, SymbolInstance, c); 
-    array_list_append(program.symTable.symbols, SymbolTableEntry, e);
+    array_list_append(ctx->program.symTable.symbols, SymbolTableEntry, e);
+    track_moved_instance(ctx, ctx->program.symTable.symbols.size - 1, 0);
 }
 
 
-noreturn void parser_fatal_error(Parser *p, const char* fmt, ...){
-    fprintf(stderr,"Error: ");
+noreturn static void parser_fatal_error(Parser *p, const char* fmt, ...){
     va_list list;
     va_start(list, fmt);
-    vfprintf(stderr, fmt, list);
+    context_verror(p->ctx, fmt, list);
     va_end(list);
-    char* line = file_get_line(current_fb, p->currentToken.line_number);
-    fprintf(stderr, "Line %d, Col %d\n", p->currentToken.line_number, p->currentToken.col);
-    fprintf(stderr, "%s\n", line);
-    fprintf(stderr,"%*s\n", p->currentToken.col, "^");
-    exit(EXIT_FAILURE);
+    context_error_line(p->ctx, p->currentToken.line_number, p->currentToken.col);
+    longjmp(p->ctx->error_jmp, 1);
 }
 
 
@@ -585,21 +713,21 @@ static inline bool is_float(char* literal){
 }
 
 
-static inline void init_section(Section* section, uint64_t start_size){
+static inline void init_section(BasmContext* ctx, Section* section, uint64_t start_size){
     if(section->data == NULL){
         section->capacity = start_size;
         section->data= malloc(section->capacity);
-        if(section->data == NULL) program_fatal_error("Out of memory\n");
+        if(section->data == NULL) program_fatal_error(ctx, "Out of memory\n");
     }
 }
 
 
-static void section_realloc(Section* section){
+static void section_realloc(BasmContext* ctx, Section* section){
    //TODO: CHECK FOR OVERFLOW
    uint64_t new_capacity = section->capacity * 2;
    section->data = realloc(section->data, new_capacity);
    if(section->data == NULL){
-        program_fatal_error("Out of memory\n");
+        program_fatal_error(ctx, "Out of memory\n");
    }
    section->capacity = new_capacity;
 }
@@ -608,11 +736,11 @@ static void section_realloc(Section* section){
 
 
 #define check_section_size(section_ptr, bytes_to_add)\
-    if(section->size + bytes_to_add >= section->capacity) section_realloc(section)
+    while(section->size + bytes_to_add >= section->capacity) section_realloc(ctx, section)
     
 
 
-static inline void section_add_data(Section* section, void* data, size_t size){
+static inline void section_add_data(BasmContext* ctx, Section* section, void* data, size_t size){
     check_section_size(section, size);
     memcpy(section->data + section->size,data,size);  
     section->size += size;
@@ -643,16 +771,252 @@ static uint64_t string_to_int(char* string, TokenType sign){
 }
 
 
+static inline void listing_add_line(BasmContext* ctx, int line_number, uint8_t section, uint64_t start, uint64_t end){
+    if(ctx->listing == NULL) return;
+    ListingLine line = {line_number + ctx->line_offset, section, start, end};
+    array_list_append((*ctx->listing), ListingLine, line);
+}
+
+
+
+static void write_nops(uint8_t* data, uint64_t padding){
+    while(padding > 0){
+        uint64_t size = (padding > MAX_NOP_SIZE) ? MAX_NOP_SIZE : padding;
+        memcpy(data, NOP_PADDING[size - 1], size);
+        data += size;
+        padding -= size;
+    }
+}
+
+
+//pads the section to a multiple of alignment with the fill byte, or with nops if fill is -1
+static void section_align(BasmContext* ctx, Section* section, uint64_t alignment, int fill){
+    if(alignment > section->alignment) section->alignment = alignment;
+    uint64_t padding = (alignment - section->size % alignment) % alignment;
+    check_section_size(section, padding);
+
+    if(fill >= 0) memset(section->data + section->size, fill, padding);
+    else write_nops(section->data + section->size, padding);
+    section->size += padding;
+}
+
+
+static inline void bss_align(Section* bss, uint64_t alignment){
+    if(alignment > bss->alignment) bss->alignment = alignment;
+    bss->size = (bss->size + alignment - 1) / alignment * alignment;
+}
+
+
+//directives that aren't in the keyword table are identifiers that aren't followed by a colon
+static bool parser_match_directive(Parser* p, const char* name){
+    if(p->currentToken.type != TOK_IDENTIFIER || string_cmp_lower(p->currentToken.literal, name) != 0) return false;
+    return parser_peek_token(p).type != TOK_COLON;
+}
+
+
+//a power of 2, K, M or G after the number multiply it by 1024, 1024^2 or 1024^3 so huge pages can be written as 2M
+static uint64_t parse_alignment(Parser* p){
+    parser_expect_token(p, TOK_UINT);
+    char* literal = p->currentToken.literal;
+    char* end;
+    uint64_t alignment = strtoull(literal, &end, (literal[0] == '0' && literal[1] == 'x') ? 16 : 10);
+    const char* suffix = strchr("KMG", toupper(*end));
+    if(*end != 0 && suffix != NULL){
+        alignment <<= 10 * (suffix - "KMG" + 1);
+        end++;
+    }
+    if(*end != 0) parser_fatal_error(p, "Invalid alignment: %s\n", literal);
+    if(alignment == 0 || (alignment & (alignment - 1)) != 0){
+        parser_fatal_error(p, "Alignment has to be a power of 2: %lu\n", alignment);
+    }
+    parser_next_token(p);
+    return alignment;
+}
+
+
+// align N [, fill] pads with nops in the text section and zeros everywhere else
+// alignb N is the same as align N outside the text section, the name nasm uses in the bss
+static void parse_align(Parser* p, uint8_t section){
+    BasmContext* ctx = p->ctx;
+    int line_number = p->currentToken.line_number;
+    parser_next_token(p);
+    uint64_t alignment = parse_alignment(p);
+
+    int fill = (section == SECTION_TEXT) ? -1 : 0;
+    bool nobits = program_section_flags(&ctx->program, section) & SECTION_FLAG_NOBITS;
+    if(parser_match_consume_token(p, TOK_COMMA)){
+        parser_expect_token(p, TOK_UINT);
+        uint64_t value = string_to_int(p->currentToken.literal, TOK_UINT);
+        if(value > UINT8_MAX) parser_fatal_error(p, "Invalid Size: %ld\n", value);
+        if(nobits) parser_fatal_error(p, "The %s section can't be filled\n", program_section_name(&ctx->program, section));
+        fill = value;
+        parser_next_token(p);
+    }
+    Section* output = program_section(&ctx->program, section);
+    uint64_t start = output->size;
+    if(nobits) bss_align(output, alignment);
+    else section_align(ctx, output, alignment, fill);
+    //the code align placed stays where it is
+    if(section == SECTION_TEXT) stop_branch_fusing(ctx);
+    listing_add_line(ctx, line_number, section, start, output->size);
+    parser_expect_consume_token(p, TOK_NEW_LINE);
+}
+
+
+
+static char* context_copy_name(BasmContext* ctx, const char* name){
+    char* copy = strdup(name);
+    if(copy == NULL) program_fatal_error(ctx, "Out of memory\n");
+    array_list_append(ctx->names, char*, copy);
+    return copy;
+}
+
+
+//the path to open for a file name of the source or the command line
+static const char* context_path(BasmContext* ctx, const char* path){
+    if(ctx->directory == NULL || path[0] == '/') return path;
+    scratch_buffer_clear(&ctx->scratch);
+    return context_copy_name(ctx, scratch_buffer_fmt(&ctx->scratch, "%s/%s", ctx->directory, path));
+}
+
+
+//the id of the user section with the name, SECTION_UNDEFINED if it wasn't declared
+static uint8_t program_find_section(Program* program, const char* name){
+    for(int i = 0; i < program->sections.size; i++){
+        if(strcmp(array_list_get(program->sections, ProgramSection, i).name, name) == 0) return SECTION_USER + i;
+    }
+    return SECTION_UNDEFINED;
+}
+
+
+static uint8_t program_add_section(BasmContext* ctx, const char* name, uint32_t flags, uint64_t entry_size){
+    Program* program = &ctx->program;
+    if(program_section_count(program) >= SECTION_UNDEFINED) program_fatal_error(ctx, "Too many sections\n");
+    if(program->sections.data == NULL) array_list_create_cap(program->sections, ProgramSection, 4);
+    ProgramSection section = {context_copy_name(ctx, name), flags, entry_size, {0}};
+    if(!(flags & SECTION_FLAG_NOBITS)) init_section(ctx, &section.bytes, 64);
+    array_list_append(program->sections, ProgramSection, section);
+    return SECTION_USER + program->sections.size - 1;
+}
+
+
+//.rodata.str1.1 holds nul terminated strings and .rodata.cst<N> constants of N bytes, the same names gcc uses
+//returns the size of the entries or 0 if it isn't a merge section
+static uint64_t merge_entry_size(const char* name){
+    if(strcmp(name, ".rodata.str1.1") == 0) return 1;
+    if(strncmp(name, ".rodata.cst", 11) != 0) return 0;
+    char* end;
+    uint64_t size = strtoull(name + 11, &end, 10);
+    if(*end != 0 || (size != 4 && size != 8 && size != 16 && size != 32)) return 0;
+    return size;
+}
+
+
+//the merge section for strings (entry_size 1) or constants of entry_size bytes, declared if it isn't there yet
+static uint8_t merge_section(BasmContext* ctx, uint64_t entry_size){
+    char name[32];
+    if(entry_size == 1) snprintf(name, sizeof(name), ".rodata.str1.1");
+    else snprintf(name, sizeof(name), ".rodata.cst%lu", entry_size);
+
+    uint8_t section = program_find_section(&ctx->program, name);
+    if(section != SECTION_UNDEFINED) return section;
+    uint32_t flags = SECTION_FLAG_MERGE | ((entry_size == 1) ? SECTION_FLAG_STRINGS : 0);
+    section = program_add_section(ctx, name, flags, entry_size);
+    program_section(&ctx->program, section)->alignment = entry_size;
+    return section;
+}
+
+
+//fnv-1a of the bytes, with the section mixed in so equal constants of different sections don't collide
+static uint64_t constant_hash(uint8_t section, const uint8_t* data, uint64_t size){
+    uint64_t hash = 14695981039346656037ULL ^ section;
+    for(uint64_t i = 0; i < size; i++){
+        hash ^= data[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+
+static void constant_set_grow(BasmContext* ctx){
+    uint32_t capacity = (ctx->constant_capacity == 0) ? 64 : ctx->constant_capacity * 2;
+    MergedConstant* constants = calloc(capacity, sizeof(MergedConstant));
+    if(constants == NULL) program_fatal_error(ctx, "Out of memory\n");
+    for(uint32_t i = 0; i < ctx->constant_capacity; i++){
+        if(ctx->constants[i].section == SECTION_EXTERN) continue;
+        uint32_t slot = ctx->constants[i].hash & (capacity - 1);
+        while(constants[slot].section != SECTION_EXTERN) slot = (slot + 1) & (capacity - 1);
+        constants[slot] = ctx->constants[i];
+    }
+    free(ctx->constants);
+    ctx->constants = constants;
+    ctx->constant_capacity = capacity;
+}
+
+
+//returns the offset of the constant with the same bytes in the merge section
+//if there isn't one it is added at offset, its bytes have to be there before the next lookup
+static uint64_t constant_set_insert(BasmContext* ctx, uint8_t section, const uint8_t* data, uint64_t size, uint64_t offset){
+    if((ctx->constant_count + 1) * 2 > ctx->constant_capacity) constant_set_grow(ctx);
+    const uint8_t* bytes = program_section(&ctx->program, section)->data;
+    uint64_t hash = constant_hash(section, data, size);
+    uint32_t mask = ctx->constant_capacity - 1;
+    uint32_t slot = hash & mask;
+    while(ctx->constants[slot].section != SECTION_EXTERN){
+        MergedConstant* c = &ctx->constants[slot];
+        if(c->hash == hash && c->section == section && c->size == size && memcmp(bytes + c->offset, data, size) == 0) return c->offset;
+        slot = (slot + 1) & mask;
+    }
+    ctx->constants[slot] = (MergedConstant){hash, offset, size, section};
+    ctx->constant_count++;
+    return offset;
+}
+
+
+/*
+ * Moves the constant a line added to the end of section (from start) into the merge section along with the label of the line
+ * If the merge section already has the same bytes the label points at those and nothing is added
+ * Returns the offset of the constant in the merge section
+ */
+static uint64_t merge_constant(BasmContext* ctx, const char* label, uint8_t section, uint64_t start, uint8_t merge_section){
+    Section* from = program_section(&ctx->program, section);
+    Section* to = program_section(&ctx->program, merge_section);
+    uint64_t size = from->size - start;
+    uint64_t offset = (section == merge_section) ? start : to->size;
+
+    uint64_t existing = constant_set_insert(ctx, merge_section, from->data + start, size, offset);
+    if(section != merge_section && existing == offset) section_add_data(ctx, to, from->data + start, size);
+    if(section != merge_section || existing != offset) from->size = start;
+
+    for(int i = 0; i < ctx->program.symTable.symbols.size; i++){
+        SymbolTableEntry* e = &array_list_get(ctx->program.symTable.symbols, SymbolTableEntry, i);
+        if(strcmp(e->name, label) == 0){
+            e->section = merge_section;
+            e->section_offset = existing;
+            break;
+        }
+    }
+    return existing;
+}
+
+
 //TODO: ALLOW PSUEDOINSTRUCTIONS WITHOUT LABELS 
-static void parse_bss_section(Parser* p){
+//the bss or a nobits user section
+static void parse_bss_section(Parser* p, uint8_t section){
+    BasmContext* ctx = p->ctx;
+    Section* output = program_section(&ctx->program, section);
     while(p->currentToken.type != TOK_SECTION){
+        if(parser_match_directive(p, "align") || parser_match_directive(p, "alignb")){
+            parse_align(p, section);
+            continue;
+        }
         parser_expect_token(p, TOK_IDENTIFIER); 
         Token id = p->currentToken;
         parser_next_token(p);
         parser_expect_consume_token(p, TOK_COLON); 
 
 
-        symbol_table_add(id.literal, program.bss.size, SECTION_BSS, VISIBILITY_LOCAL);
+        symbol_table_add(ctx, id.literal, output->size, section, VISIBILITY_LOCAL);
 
         int num = 1;
         switch (p->currentToken.type) {
@@ -682,7 +1046,9 @@ static void parse_bss_section(Parser* p){
         }
         parser_next_token(p); 
         parser_expect_token(p, TOK_UINT);
-        program.bss.size += num * string_to_int(p->currentToken.literal, TOK_UINT); 
+        uint64_t start = output->size;
+        output->size += num * string_to_int(p->currentToken.literal, TOK_UINT); 
+        listing_add_line(ctx, id.line_number, section, start, output->size);
         parser_next_token(p);
         parser_expect_consume_token(p, TOK_NEW_LINE);
 
@@ -691,16 +1057,29 @@ static void parse_bss_section(Parser* p){
 
 
 
-static void parse_data_section(Parser* p){ 
+//the data or a user section with bytes
+static void parse_data_section(Parser* p, uint8_t section){ 
+    BasmContext* ctx = p->ctx;
+    Section* output = program_section(&ctx->program, section);
+    uint32_t flags = program_section_flags(&ctx->program, section);
+    bool merge = flags & SECTION_FLAG_MERGE;
+    //--merge-constants only moves constants out of sections nothing can write to
+    bool move_constants = (ctx->options & BASM_OPTION_MERGE_CONSTANTS) && !(flags & (SECTION_FLAG_WRITE | SECTION_FLAG_NOALLOC)) && !merge;
     while(p->currentToken.type != TOK_SECTION){
+        if(parser_match_directive(p, "align") || parser_match_directive(p, "alignb")){
+            //the padding would end up between the entries
+            if(merge) parser_fatal_error(p, "Merge sections can't be aligned, their constants already are\n");
+            parse_align(p, section);
+            continue;
+        }
         parser_expect_token(p, TOK_IDENTIFIER); 
         Token id = p->currentToken;
         parser_next_token(p);
         parser_expect_consume_token(p, TOK_COLON); 
 
 
-        symbol_table_add(id.literal, program.data.size, SECTION_DATA, VISIBILITY_LOCAL);
-
+        symbol_table_add(ctx, id.literal, output->size, section, VISIBILITY_LOCAL);
+        uint64_t start = output->size;
 
         if(!match(p, TOK_DB, TOK_DW, TOK_DD, TOK_DQ,TOK_DT)){
             parser_fatal_error(p, "Invalid Data Section Instruction\n");
@@ -709,7 +1088,11 @@ static void parse_data_section(Parser* p){
         TokenType psuedo_instr = p->currentToken.type;
         parser_next_token(p);
 
+        bool has_label = false;
+        int strings = 0;
+        int operands = 0;
         do{
+            operands++;
             if(p->currentToken.type == TOK_UINT || p->currentToken.type == TOK_INT){
                 switch (psuedo_instr) {
                     case TOK_DB: {
@@ -723,7 +1106,7 @@ static void parse_data_section(Parser* p){
                             if(!is_int8(num)) parser_fatal_error(p, "Invalid Size: %ld\n", num);
                             temp = num;
                         }
-                        section_add_data(&program.data,&temp, 1);
+                        section_add_data(ctx, output,&temp, 1);
                         break;
                     }
                     case TOK_DW: {
@@ -737,7 +1120,7 @@ static void parse_data_section(Parser* p){
                             if(!is_int16(num)) parser_fatal_error(p, "Invalid Size: %ld\n", num);
                             temp = num;
                         }
-                        section_add_data(&program.data,&temp, 2);
+                        section_add_data(ctx, output,&temp, 2);
                         break;
                     }
                     case TOK_DD: {
@@ -745,7 +1128,7 @@ static void parse_data_section(Parser* p){
                         if(is_float(p->currentToken.literal)){
                             float num = strtof(p->currentToken.literal, NULL); 
                             //TODO: CHECK FOR ERRORS
-                            section_add_data(&program.data,&num, 4);
+                            section_add_data(ctx, output,&num, 4);
                             break;
                         }
                         else if(p->currentToken.type == TOK_UINT){
@@ -757,17 +1140,17 @@ static void parse_data_section(Parser* p){
                             if(!is_int32(num)) parser_fatal_error(p, "Invalid Size: %ld\n", num);
                             temp = num;
                         }
-                        section_add_data(&program.data,&temp, 4);
+                        section_add_data(ctx, output,&temp, 4);
                         break;
                     }
                     case TOK_DQ: {
                         if(is_float(p->currentToken.literal)){
                             double num = strtod(p->currentToken.literal, NULL); 
                             //TODO: CHECK FOR ERRORS
-                            section_add_data(&program.data,&num, 8);
+                            section_add_data(ctx, output,&num, 8);
                         } else{
                             uint64_t num = string_to_int(p->currentToken.literal, p->currentToken.type);
-                            section_add_data(&program.data,&num, 8);
+                            section_add_data(ctx, output,&num, 8);
                         }
                         break;
                     }
@@ -776,21 +1159,53 @@ static void parse_data_section(Parser* p){
                             parser_fatal_error(p, "Error: Don't support machines that don't have 128 bit floats yet");
                         }
                         long double num = strtold(p->currentToken.literal, NULL);
-                        section_add_data(&program.data,&num, 10);
+                        section_add_data(ctx, output,&num, 10);
                         break;
                     }
                     default:
                         parser_fatal_error(p, "Unreachable"); 
                 }
+            } else if(p->currentToken.type == TOK_IDENTIFIER && (psuedo_instr == TOK_DD || psuedo_instr == TOK_DQ)){
+                //the address of a label, filled in by the linker like the ones in the text section
+                if(merge) parser_fatal_error(p, "Labels can't be used in the merge section %s\n", program_section_name(&ctx->program, section));
+                has_label = true;
+                uint8_t size = (psuedo_instr == TOK_DQ) ? 8 : 4;
+                symbol_table_add_instance(ctx, p->currentToken.literal, output->size, false, section, size, SYMBOL_RELOC_DEFAULT);
+                uint64_t zero = 0;
+                section_add_data(ctx, output, &zero, size);
             } else if(p->currentToken.type == TOK_STRING){
                 if(psuedo_instr != TOK_DB) parser_fatal_error(p, "Only byte size strings are allowed\n");
-                section_add_data(&program.data, p->currentToken.literal, strlen(p->currentToken.literal) + 1);
+                section_add_data(ctx, output, p->currentToken.literal, strlen(p->currentToken.literal) + 1);
+                strings++;
             } else{
                 parser_fatal_error(p, "Invalid for operand\n");
             } 
             parser_next_token(p);
         } while(parser_match_consume_token(p, TOK_COMMA));
 
+        //every line of a merge section is one constant the linker can fold with the same one of other objects
+        uint64_t size = output->size - start;
+        uint8_t line_section = section;
+        if(merge){
+            uint64_t entry_size = array_list_get(ctx->program.sections, ProgramSection, section - SECTION_USER).entry_size;
+            if(flags & SECTION_FLAG_STRINGS){
+                if(size == 0 || memchr(output->data + start, 0, size) != output->data + start + size - 1){
+                    parser_fatal_error(p, "Lines in %s have to be a single nul terminated string\n", program_section_name(&ctx->program, section));
+                }
+            } else if(size != entry_size){
+                parser_fatal_error(p, "Constants in %s have to be %lu bytes\n", program_section_name(&ctx->program, section), entry_size);
+            }
+        } else if(move_constants && !has_label){
+            if(psuedo_instr == TOK_DB && strings == 1 && operands == 1) line_section = merge_section(ctx, 1);
+            else if(strings == 0 && (size == 4 || size == 8 || size == 16)) line_section = merge_section(ctx, size);
+        }
+        if(merge || line_section != section){
+            start = merge_constant(ctx, id.literal, section, start, line_section);
+            //adding the merge section can move the sections
+            output = program_section(&ctx->program, section);
+        }
+
+        listing_add_line(ctx, id.line_number, line_section, start, start + size);
         parser_expect_consume_token(p, TOK_NEW_LINE);
 
     }
@@ -830,6 +1245,8 @@ typedef struct {
             //1 == label,0 == offset
             //next bit indicates if we need address size override prefix
             uint8_t scale;         
+            uint8_t segment; //override prefix, 0x64 for fs and 0x65 for gs, 0 if there is none
+            uint8_t reloc; //SymbolReloc of the label
 
             //if value is zero, we aren't using either 
             union{
@@ -845,12 +1262,71 @@ typedef struct {
 
 
 
-static Operand parse_memory(Parser* p, OperandType mem_type){
+static Operand memory_operand(OperandType mem_type){
     Operand result = {0};
     result.mem.base = REG_MAX;
     result.mem.index = REG_MAX;
     result.mem.rex = REX_PREFIX(0, 0, 0, 0);
     result.type = mem_type;
+    return result;
+}
+
+
+//returns false if the register can't be used for addressing
+static bool memory_set_register(Operand* result, RegisterType reg_type, bool is_index, OperandType* size){
+    uint8_t reg = REG_MAX;
+
+    if(is_r64(reg_type)){
+        *size = OPERAND_R64;
+        reg = reg_type - REG_RAX;
+    } else if(is_r32(reg_type)){
+        *size = OPERAND_R32;
+        reg = reg_type - REG_EAX;
+        mem_set_prefix(result->mem);
+    } else{
+        return false;
+    }
+
+    if(!is_index){
+        if(is_extended_reg(reg)){
+            result->mem.rex |= REX_B;
+            reg -= 8;
+        }
+        result->mem.base = reg;
+    } else{
+        if(is_extended_reg(reg)){
+            result->mem.rex |= REX_X;
+            reg -= 8;
+        }
+        result->mem.index = reg;
+    }
+    return true;
+}
+
+
+static bool memory_set_scale(Operand* result, int scale){
+    switch (scale) {
+        case 1:
+            break;
+        case 2:
+            result->mem.scale |= 1; 
+            break;
+        case 4:
+            result->mem.scale |= 2;
+            break;
+        case 8:
+            result->mem.scale |= 3;
+            break;
+        default:
+            return false;
+    } 
+    return true;
+}
+
+
+
+static Operand parse_memory(Parser* p, OperandType mem_type){
+    Operand result = memory_operand(mem_type);
 
     OperandType base_size = OPERAND_NOP;
     OperandType index_size = OPERAND_NOP;
@@ -859,67 +1335,51 @@ static Operand parse_memory(Parser* p, OperandType mem_type){
 
     Token t = parser_next_token(p);
 
+    //[fs:...] and [gs:...] address relative to the segment base, the thread pointer for fs
+    if(t.type == TOK_IDENTIFIER && parser_peek_token(p).type == TOK_COLON){
+        if(string_cmp_lower(t.literal, "fs") == 0) result.mem.segment = 0x64;
+        else if(string_cmp_lower(t.literal, "gs") == 0) result.mem.segment = 0x65;
+        else parser_fatal_error(p, "Invalid segment: %s\n", t.literal);
+        parser_next_token(p);
+        t = parser_next_token(p);
+    }
+
     while(t.type != TOK_CLOSING_BRACKET){
         switch (t.type) {
             case TOK_IDENTIFIER:
                 result.mem.label = p->currentToken.literal;
                 //TODO ALLOW BOTH LABEL AND INTEGER OFFSET 
                 mem_set_label(result.mem);
+                if(parser_peek_token(p).type == TOK_AT){
+                    parser_next_token(p);
+                    parser_next_token(p);
+                    parser_expect_token(p, TOK_IDENTIFIER);
+                    if(string_cmp_lower(p->currentToken.literal, "tpoff") == 0) result.mem.reloc = SYMBOL_RELOC_TPOFF;
+                    else if(string_cmp_lower(p->currentToken.literal, "gottpoff") == 0) result.mem.reloc = SYMBOL_RELOC_GOTTPOFF;
+                    else parser_fatal_error(p, "Unknown relocation: %s\n", p->currentToken.literal);
+                }
                 break;
             case TOK_REG: {
-                    OperandType size = OPERAND_NOP;
-                    uint8_t reg = REG_MAX;
-
-                    
-                    if(is_r64(p->currentToken.reg)){
-                        result.mem.rex |= REX_W;
-                        size = OPERAND_R64;
-                        reg = p->currentToken.reg - REG_RAX;
-                    } else if(is_r32(p->currentToken.reg)){
-                        size = OPERAND_R32;
-                        reg = p->currentToken.reg - REG_EAX;
-                        mem_set_prefix(result.mem);
-                    } else{
+                    bool is_index = result.mem.base != REG_MAX || parser_peek_token(p).type == TOK_MULTIPLY;
+                    OperandType* size = (is_index) ? &index_size : &base_size;
+                    if(is_index && result.mem.index != REG_MAX){
+                        parser_fatal_error(p, "Invalid address\n");
+                    }
+                    //an index of 100 in the sib byte means there is no index
+                    if(is_index && (p->currentToken.reg == REG_RSP || p->currentToken.reg == REG_ESP)){
+                        parser_fatal_error(p, "rsp can't be used as an index\n");
+                    }
+                    if(!memory_set_register(&result, p->currentToken.reg, is_index, size)){
                         //In 64 bit mode these registers need to be 32 or 64 bit
                         parser_fatal_error(p, "Invalid Size\n");
                     }
- 
-                    if(result.mem.base == REG_MAX && parser_peek_token(p).type != TOK_MULTIPLY){
-                        if(is_extended_reg(reg)){
-                            result.mem.rex |= REX_B;
-                            reg -= 8;
-                        }
-                        base_size = size;
-                        result.mem.base = reg;
-                    } else if(result.mem.index == REG_MAX){
-                        if(is_extended_reg(reg)){
-                            result.mem.rex |= REX_X;
-                            reg -= 8;
-                        }
-                        index_size = size;
-                        result.mem.index = reg;
-                    } else{
-                        parser_fatal_error(p, "Invalid address\n");
-                    } 
                 }
                 break;
             case TOK_UINT:{
                 int temp = (int)string_to_int(p->currentToken.literal, TOK_UINT);
                 if(check_scale){
-                    switch (temp) {
-                        case 1:
-                            break;
-                        case 2:
-                            result.mem.scale |= 1; 
-                            break;
-                        case 4:
-                            result.mem.scale |= 2;
-                            break;
-                        case 8:
-                            result.mem.scale |= 3;
-                            break;
-                        default:
-                            parser_fatal_error(p, "Invalid Scale Factor: %i\n", temp);
+                    if(!memory_set_scale(&result, temp)){
+                        parser_fatal_error(p, "Invalid Scale Factor: %i\n", temp);
                     } 
                 } else{
                     result.mem.offset = temp; 
@@ -971,6 +1431,10 @@ static Operand parse_memory(Parser* p, OperandType mem_type){
     if(base_size != OPERAND_NOP && index_size != OPERAND_NOP && base_size != index_size){ 
         parser_fatal_error(p, "Invalid: Registers must be the same size\n");
     }
+    //the got entry is found relative to rip, which can't be combined with registers
+    if(result.mem.reloc == SYMBOL_RELOC_GOTTPOFF && (result.mem.base != REG_MAX || result.mem.index != REG_MAX || result.mem.segment != 0)){
+        parser_fatal_error(p, "label@gottpoff can't be used with registers or a segment\n");
+    }
 
     return result;
 }
@@ -979,41 +1443,48 @@ static Operand parse_memory(Parser* p, OperandType mem_type){
 
 
 
+static Operand register_operand(RegisterType reg){
+    Operand result = {0};
+    uint8_t w = 0;
+    
+    if(is_r256(reg)){
+        result.type = OPERAND_YMM;
+        result.reg.registerIndex = reg - REG_YMM0;
+    }
+    else if(is_r128(reg)){
+        result.type = OPERAND_XMM;
+        result.reg.registerIndex = reg - REG_XMM0;
+    } else if(is_mmx(reg)){
+        result.type = OPERAND_MM;
+        result.reg.registerIndex = reg - REG_MM0;
+    }
+    else if(is_r64(reg)){
+        w = 1;
+        result.type = OPERAND_R64;
+        result.reg.registerIndex = reg - REG_RAX;
+    } else if(is_r32(reg)){
+        result.type = OPERAND_R32;
+        result.reg.registerIndex = reg - REG_EAX;
+    } else if(is_r16(reg)){
+        result.type = OPERAND_R16;
+        result.reg.registerIndex = reg - REG_AX;
+    } else{
+        result.type = OPERAND_R8;
+        result.reg.registerIndex = reg - REG_AL;
+    }
+    result.reg.rex = REX_PREFIX(w, 0, 0, 0);
+    return result;
+}
+
+
+
 static Operand parse_operand(Parser* p){
+    BasmContext* ctx = p->ctx;
     Operand result = {0};
 
     switch (p->currentToken.type) {
-        case TOK_REG: {
-            uint8_t w = 0;
-            
-            if(is_r256(p->currentToken.reg)){
-                result.type = OPERAND_YMM;
-                result.reg.registerIndex = p->currentToken.reg - REG_YMM0;
-            }
-            else if(is_r128(p->currentToken.reg)){
-                result.type = OPERAND_XMM;
-                result.reg.registerIndex = p->currentToken.reg - REG_XMM0;
-            } else if(is_mmx(p->currentToken.reg)){
-                result.type = OPERAND_MM;
-                result.reg.registerIndex = p->currentToken.reg - REG_MM0;
-            }
-            else if(is_r64(p->currentToken.reg)){
-                w = 1;
-                result.type = OPERAND_R64;
-                result.reg.registerIndex = p->currentToken.reg - REG_RAX;
-            } else if(is_r32(p->currentToken.reg)){
-                result.type = OPERAND_R32;
-                result.reg.registerIndex = p->currentToken.reg - REG_EAX;
-            } else if(is_r16(p->currentToken.reg)){
-                result.type = OPERAND_R16;
-                result.reg.registerIndex = p->currentToken.reg - REG_AX;
-            } else{
-                result.type = OPERAND_R8;
-                result.reg.registerIndex = p->currentToken.reg - REG_AL;
-            }
-            result.reg.rex = REX_PREFIX(w, 0, 0, 0);
-            return result;
-        }
+        case TOK_REG:
+            return register_operand(p->currentToken.reg);
 
         case TOK_UINT:
             result.imm64 = string_to_int(p->currentToken.literal, TOK_UINT);
@@ -1076,7 +1547,7 @@ static Operand parse_operand(Parser* p){
         case TOK_OPENING_BRACKET:
             return parse_memory(p, OPERAND_MEM_ANY); 
         default:
-            program_fatal_error("Operand Type not supported yet: %s\n",token_to_string(p->currentToken.type));
+            program_fatal_error(ctx, "Operand Type not supported yet: %s\n",token_to_string(p->currentToken.type));
 
     
     }
@@ -1132,7 +1603,14 @@ static bool check_operand_type(OperandType table_instr, OperandType input_instr,
 
 
 
-static Instruction* find_instruction(uint64_t instr, Operand operand[4]){
+//register index with the extension bit match_operand_* moved into REX.R or REX.B
+static uint8_t extended_register_index(Operand* op){
+    return op->reg.registerIndex | ((op->reg.rex & (REX_R | REX_B)) ? 8 : 0);
+}
+
+
+//probes is set to the number of variants that were checked
+static Instruction* find_instruction(uint64_t instr, Operand operand[4], int* probes){
     //get the location in the instruction instruction variant table
     uint64_t op_table_index = KEYWORD_TABLE[instr].value;    
     int instruction_variant_count = INSTRUCTION_TABLE[op_table_index].variant_count;
@@ -1140,12 +1618,13 @@ static Instruction* find_instruction(uint64_t instr, Operand operand[4]){
 
     // loop through each variant of the instruction check if the operands match 
     for(int i = op_table_index + 1; i < op_table_index + instruction_variant_count + 1; i++){ 
+        (*probes)++;
         Instruction instruct_var = INSTRUCTION_TABLE[i];
-        bool op1_bool = check_operand_type(instruct_var.op1, operand[0].type, operand[0].reg.registerIndex);
+        bool op1_bool = check_operand_type(instruct_var.op1, operand[0].type, extended_register_index(&operand[0]));
         if(!op1_bool) continue;
-        bool op2_bool = check_operand_type(instruct_var.op2, operand[1].type, operand[1].reg.registerIndex); 
+        bool op2_bool = check_operand_type(instruct_var.op2, operand[1].type, extended_register_index(&operand[1])); 
         if(!op2_bool) continue;
-        bool op3_bool = check_operand_type(instruct_var.op3, operand[2].type, operand[2].reg.registerIndex);
+        bool op3_bool = check_operand_type(instruct_var.op3, operand[2].type, extended_register_index(&operand[2]));
         if(!op3_bool)continue;;
         if(operand[3].type != OPERAND_NOP){
             if(instruct_var.ib & INSTR_OP4_IS_REG){
@@ -1163,24 +1642,79 @@ static Instruction* find_instruction(uint64_t instr, Operand operand[4]){
     return NULL;
 }
 
+static uint8_t operand_size_32(uint8_t type){
+    switch(type){
+        case OPERAND_R16: return OPERAND_R32;
+        case OPERAND_M16: return OPERAND_M32;
+        case OPERAND_RM16: return OPERAND_RM32;
+        case OPERAND_AX: return OPERAND_EAX;
+        case OPERAND_IMM16: return OPERAND_IMM32;
+        default: return type;
+    }
+}
+
+static uint8_t operand_size_64(uint8_t type){
+    switch(type){
+        case OPERAND_R16: return OPERAND_R64;
+        case OPERAND_M16: return OPERAND_M64;
+        case OPERAND_RM16: return OPERAND_RM64;
+        case OPERAND_AX: return OPERAND_RAX;
+        case OPERAND_IMM16: return OPERAND_IMM32;
+        default: return type;
+    }
+}
+
+static bool is_word_operand(uint8_t type){
+    return type == OPERAND_R16 || type == OPERAND_M16 || type == OPERAND_RM16 || type == OPERAND_AX;
+}
+
+//a word form needs the operand size prefix if it has the opcode of a dword or qword form,
+//the ones that only take words (lldt, fild m16, movzx r32, rm16...) have their own opcode
+static bool needs_operand_size_prefix(uint64_t instr, Instruction* found){
+    if(found->r & (INSTR_USES_2VEX | INSTR_USES_3VEX)) return false;
+    if(!is_word_operand(found->op1) && !is_word_operand(found->op2) && !is_word_operand(found->op3)) return false;
+    uint64_t op_table_index = KEYWORD_TABLE[instr].value;
+    uint64_t instruction_variant_count = INSTRUCTION_TABLE[op_table_index].variant_count;
+    for(uint64_t i = op_table_index + 1; i < op_table_index + instruction_variant_count + 1; i++){
+        const Instruction* other = &INSTRUCTION_TABLE[i];
+        if(other == found || other->size != found->size || other->digit != found->digit) continue;
+        if(memcmp(other->bytes, found->bytes, found->size) != 0) continue;
+        if(other->op1 == operand_size_32(found->op1) && other->op2 == operand_size_32(found->op2) && other->op3 == operand_size_32(found->op3)) return true;
+        if(other->op1 == operand_size_64(found->op1) && other->op2 == operand_size_64(found->op2) && other->op3 == operand_size_64(found->op3)) return true;
+    }
+    return false;
+}
+
 
 
 #define MODRM_INDEX 0
 #define SIB_INDEX 1
 #define DISPLACEMENT_SIZE 4
 
-static int modrm_sib_fields(Operand* op, uint8_t *data, char** label){
+//register indices (without the rex bit) that can't be encoded as a plain base
+#define RM_NEEDS_SIB 4 //rsp and r12
+#define RM_NEEDS_DISPLACEMENT 5 //rbp and r13
+
+//the label of the memory operand is returned in label and its SymbolReloc in ctx->label_reloc
+static int modrm_sib_fields(BasmContext* ctx, Operand* op, uint8_t *data, char** label){
     uint8_t ADDRESS_OVERRIDE_PREFIX = 0x67;
     int size = 1;
     int32_t offset = (int32_t)op->mem.offset;
 
     if(mem_is_label(op->mem)){
         (*label) = op->mem.label;
+        ctx->label_reloc = op->mem.reloc;
         offset = 0;
     }
-    if(mem_op_prefix(op->mem)) section_add_data(&program.text, &ADDRESS_OVERRIDE_PREFIX, 1);
+    if(op->mem.segment != 0) section_add_data(ctx, &ctx->program.text, &op->mem.segment, 1);
+    if(mem_op_prefix(op->mem)) section_add_data(ctx, &ctx->program.text, &ADDRESS_OVERRIDE_PREFIX, 1);
 
-    if(op->mem.base == REG_MAX && op->mem.index == REG_MAX){
+    if(mem_is_label(op->mem) && op->mem.reloc == SYMBOL_RELOC_GOTTPOFF){
+        //mod 00 with r/m 101 is rip relative
+        data[MODRM_INDEX] |= 0x5;
+        size += DISPLACEMENT_SIZE;
+        memcpy(data + 1, &offset, DISPLACEMENT_SIZE);
+    } else if(op->mem.base == REG_MAX && op->mem.index == REG_MAX){
         //TODO: FIGURE OUT WHEN THE R/M FIELD IS 101  
         data[MODRM_INDEX] |= 0x4;
         data[SIB_INDEX] = 0x25;
@@ -1190,32 +1724,24 @@ static int modrm_sib_fields(Operand* op, uint8_t *data, char** label){
     } else if (op->mem.base != REG_MAX && op->mem.index == REG_MAX) {
         //TODO: FIGURE OUT WHEN 8 bit displacements are used 
         data[MODRM_INDEX] |= op->mem.base;
+        int displacement_index = 1;
+        // the rsp and r12 registers require a sib byte
+        if(op->mem.base == RM_NEEDS_SIB){
+            data[SIB_INDEX] = 0x24;
+            size++;
+            displacement_index++;
+        }
         //check if we have an offset
         if(op->mem.label != 0){
             // we want a 32 bit displacement
-            data[MODRM_INDEX] += 0x80;
+            data[MODRM_INDEX] |= 0x80;
             size += DISPLACEMENT_SIZE;
-            // the esp register requires a sib byte
-            if(op->mem.base == REG_ESP){
-                data[SIB_INDEX] = 0x24;
-                size++;
-                memcpy(data + 2, &offset, DISPLACEMENT_SIZE);
-            } else{
-                memcpy(data + 1, &offset, DISPLACEMENT_SIZE);
-            }
-        } else{
-            // the esp register requires a sib byte
-            if(op->mem.base == REG_ESP){
-                data[SIB_INDEX] = 0x24; 
-                size += 1 + DISPLACEMENT_SIZE;
-                memcpy(data + 2, &offset, DISPLACEMENT_SIZE);
-            } else if(op->mem.base == REG_EBP){
-                // in this case we have to just do an 8 bit displacement of zeros 
-                data[MODRM_INDEX] |= 1 << 6;
-                size++;
-                uint8_t zero = 0;
-                memcpy(data + 1, &zero, 1);
-            }
+            memcpy(data + displacement_index, &offset, DISPLACEMENT_SIZE);
+        } else if(op->mem.base == RM_NEEDS_DISPLACEMENT){
+            // in this case we have to just do an 8 bit displacement of zeros 
+            data[MODRM_INDEX] |= 1 << 6;
+            data[displacement_index] = 0;
+            size++;
         }
     } else if (op->mem.base == REG_MAX && op->mem.index != REG_MAX) {
         //need an sib byte
@@ -1235,11 +1761,16 @@ static int modrm_sib_fields(Operand* op, uint8_t *data, char** label){
         data[SIB_INDEX] |= op->mem.base;
         size++;
 
-        if(op->mem.offset != 0){
+        if(op->mem.label != 0){
             //SIB PLUS DIS 32
             data[MODRM_INDEX] |= 1 << 7;
             memcpy(data+2, &offset, DISPLACEMENT_SIZE);
             size += DISPLACEMENT_SIZE;
+        } else if(op->mem.base == RM_NEEDS_DISPLACEMENT){
+            //a base of 101 without a displacement means there is no base 
+            data[MODRM_INDEX] |= 1 << 6;
+            data[2] = 0;
+            size++;
         }
     } 
     
@@ -1247,6 +1778,17 @@ static int modrm_sib_fields(Operand* op, uint8_t *data, char** label){
     return size;
 }
 
+//the displacement of a memory label is the last field written, a rip relative one is resolved from its end like a jump
+static void memory_label_instance(BasmContext* ctx, char* label){
+    uint64_t end = ctx->program.text.size;
+    if(ctx->label_reloc == SYMBOL_RELOC_GOTTPOFF){
+        symbol_table_add_instance(ctx, label, end, true, SECTION_TEXT, DISPLACEMENT_SIZE, ctx->label_reloc);
+    } else {
+        symbol_table_add_instance(ctx, label, end - DISPLACEMENT_SIZE, false, SECTION_TEXT, DISPLACEMENT_SIZE, ctx->label_reloc);
+    }
+}
+
+
 /*
 W   3   0 = Operand size determined by CS.D
         1 = 64 Bit Operand Size
@@ -1268,159 +1810,89 @@ Three byte
 
 */
 
-#define VEX_TWO_BYTE_R 0x8000
-#define VEX_TWO_BYTE_X 0x4000
-#define VEX_TWO_BYTE_B 0x2000
-#define VEX_UNUSED_REG 0x78
-
-
 
-//R bit gets inverted 
-#define REX_TO_ONE_BYTE_VEX(rex) ((~(rex >> 2)) << 7)
 
-#define ONE_VEX_TO_TWO_BYTE_VEX(vex) (((VEX_TWO_BYTE_R) & ((vex & 0x80) << 8)) | vex & 0x7F7F)
-#define VEX_REGISTER(reg) (((~(reg)) & 0xF) << 3)
-
-
-static void emit_vex_instruction(Instruction* instruction, Operand operand[4]){
-    uint16_t vex = 0xE000;
 
+static void emit_vex_instruction(BasmContext* ctx, Instruction* instruction, Operand operand[4]){
     uint8_t modrm_sib[6] = {0};
-    uint8_t modrm_size = 0;
+    uint8_t modrm_size = 1;
     char* lbl = NULL;
-    int imm_index = 1;
 
-    
-    if(is_reg32_or_64(operand[0].type)){
-        if(operand[0].reg.rex & REX_B) operand[0].reg.rex |= REX_R; 
+    //the operands of the variant that go into ModRM.reg, VEX.vvvv and ModRM.r/m, -1 for none
+    uint8_t types[3] = {instruction->op1, instruction->op2, instruction->op3};
+    int count = 0;
+    while(count < 3 && types[count] != OPERAND_NOP && !is_immediate(types[count])) count++;
+    int reg = -1, vvvv = -1, rm = -1;
+    if(instruction->digit != -1){
+        //vpsrlw xmm, xmm, imm8 and blsr have the destination in vvvv and the digit in reg
+        if(count == 1) rm = 0;
+        else if(count >= 2) { vvvv = 0; rm = 1; }
+    } else if(count == 1){
+        rm = 0;
+    } else if(count == 2){
+        //vextracti128 xmm/m128, ymm and the stores put the first operand in r/m
+        if(is_rm_operand(types[0]) || is_mem(types[0])) { rm = 0; reg = 1; }
+        else { reg = 0; rm = 1; }
+    } else if(count == 3){
+        //vmaskmovps m, xmm, xmm is MVR, bextr r, r/m, r is RMV, the rest are RVM
+        if(is_rm_operand(types[0]) || is_mem(types[0])) { rm = 0; vvvv = 1; reg = 2; }
+        else if(is_rm_operand(types[1]) || is_mem(types[1])) { reg = 0; rm = 1; vvvv = 2; }
+        else { reg = 0; vvvv = 1; rm = 2; }
+    }
 
-        //these few instructions have a different operand order encoding then all the other ones
-        // so we just swap the second and third operand to keep it consistent
-        if(instruction->op2 == OPERAND_RM32 || instruction->op2 == OPERAND_RM64){
-            Operand tmp = operand[1];
-            operand[1] = operand[2];
-            operand[2] = tmp;
-        } else if (instruction->op2 == OPERAND_XMM) {
-            if(operand[0].reg.rex & REX_R) operand[0].reg.rex |= REX_B; 
-            //swap rex prefixes as well
-            Operand tmp = operand[0];
-            operand[0] = operand[1];
-            operand[1] = tmp; 
-        }
+    uint8_t r = 0, x = 0, b = 0;
+    uint8_t reg_field = instruction->digit != -1 ? instruction->digit : 0;
+    if(reg != -1){
+        uint8_t index = extended_register_index(&operand[reg]);
+        r = index >> 3;
+        reg_field = index & 7;
+    }
+    uint8_t vvvv_field = vvvv != -1 ? extended_register_index(&operand[vvvv]) : 0;
+
+    if(rm == -1){
+        modrm_size = 0;
+    } else if(is_mem(operand[rm].type) || operand[rm].type == OPERAND_MEM_ANY){
+        x = (operand[rm].mem.rex & REX_X) != 0;
+        b = (operand[rm].mem.rex & REX_B) != 0;
+        modrm_sib[MODRM_INDEX] |= reg_field << 3;
+        modrm_size = modrm_sib_fields(ctx, &operand[rm], modrm_sib, &lbl);
+    } else {
+        uint8_t index = extended_register_index(&operand[rm]);
+        b = index >> 3;
+        modrm_sib[MODRM_INDEX] = 0xC0 | (reg_field << 3) | (index & 7);
     }
 
+    //the variant has W, L and pp in the low byte and the map in the high byte, 0 for 0F
+    uint8_t w = (instruction->three_vex >> 7) & 1;
+    uint8_t l_pp = instruction->three_vex & 0x7;
+    uint8_t map = instruction->three_vex >> 8;
+    if(map == 0) map = 1;
 
+    //the two byte vex can only have R, so it's used when the rest are the defaults
+    if(x == 0 && b == 0 && w == 0 && map == 1){
+        uint8_t vex[2] = {0xC5, (uint8_t)((!r << 7) | ((~vvvv_field & 0xF) << 3) | l_pp)};
+        section_add_data(ctx, &ctx->program.text, vex, 2);
+    } else {
+        uint8_t vex[3] = {0xC4, (uint8_t)((!r << 7) | (!x << 6) | (!b << 5) | map), (uint8_t)((w << 7) | ((~vvvv_field & 0xF) << 3) | l_pp)};
+        section_add_data(ctx, &ctx->program.text, vex, 3);
+    }
 
-    if(is_advanced_reg(operand[0].type) || is_reg32_or_64(operand[0].type)){
-        vex |= (uint8_t)REX_TO_ONE_BYTE_VEX(operand[0].reg.rex);
-        if(is_advanced_reg(operand[1].type) || is_reg32_or_64(operand[1].type)){
-            imm_index++;
-            uint8_t reg_portion_modrm = 0;
-            uint8_t rm_portion_modrm = 0;
-
-            if(is_advanced_reg(operand[2].type) || is_reg32_or_64(operand[2].type)){
-                imm_index++;
-                if(operand[1].reg.rex & REX_B){
-                    operand[1].reg.registerIndex += 8;
-                }
-                rm_portion_modrm = 2;
-                vex |= VEX_REGISTER(operand[1].reg.registerIndex);
-            } else if(is_mem(operand[2].type)){
-                imm_index++;
-                vex ^= operand[2].mem.rex << 13;
-                if(operand[1].reg.rex & REX_B){
-                    operand[1].reg.registerIndex += 8;
-                }
-                vex |= VEX_REGISTER(operand[1].reg.registerIndex);
-                modrm_sib[MODRM_INDEX] |= (operand[0].reg.registerIndex << 3);
-                modrm_size = modrm_sib_fields(&operand[2], modrm_sib, &lbl);
-                goto encode_vex;
-            } else{
-                vex |= VEX_UNUSED_REG; 
-                rm_portion_modrm = 1;
-            }
-
-            //if this is set we need to use 3 byte vex
-            if(operand[rm_portion_modrm].reg.rex & REX_B){
-                vex ^= VEX_TWO_BYTE_B;
-            }
- 
-            modrm_size = 1;
-            modrm_sib[MODRM_INDEX] |= 192;
-            modrm_sib[MODRM_INDEX] |=(operand[reg_portion_modrm].reg.registerIndex << 3);
-            modrm_sib[MODRM_INDEX] |= operand[rm_portion_modrm].reg.registerIndex; 
-        } else if (is_mem(operand[1].type)){
-            imm_index++;
-            vex ^= (uint8_t)(operand[0].reg.rex << 7);
-            vex ^= operand[1].mem.rex << 13;
-
-            // for most vex instructions if second operand
-            // is a memory address then its only a 2 operand instruction
-            // but for some instructions that operate on rm32/64 like BEXTR this is not the case
-            if(operand[2].type != OPERAND_NOP){
-                if(operand[2].reg.rex & REX_B){
-                    operand[2].reg.registerIndex += 8;
-                }
-                vex |= VEX_REGISTER(operand[2].reg.registerIndex);
-            } else{
-                vex |= VEX_UNUSED_REG; 
-            }
-
-            modrm_sib[MODRM_INDEX] |= (operand[0].reg.registerIndex << 3);
-            modrm_size = modrm_sib_fields(&operand[1], modrm_sib, &lbl);
-        }
-    } else if(is_mem(operand[0].type)){
-        vex |= 0x80;
-        if(operand[1].reg.rex & REX_R) operand[1].reg.rex |= REX_B; 
-        vex ^= (uint8_t)(operand[1].reg.rex << 7);
-        vex ^= operand[0].mem.rex << 13;
-        vex |= VEX_UNUSED_REG; 
-        modrm_sib[MODRM_INDEX] |= (operand[1].reg.registerIndex << 3);
-        modrm_size = modrm_sib_fields(&operand[0], modrm_sib, &lbl);
-    }
-
-
-    encode_vex:
-    if((instruction->r & INSTR_USES_2VEX) && ((vex & 0xE000) == 0xE000)){
-        vex |= instruction->three_vex;
-        uint8_t tmp = 0xC5;
-        section_add_data(&program.text, &tmp, 1); 
-        section_add_data(&program.text, &vex, 1); 
-    } else {
-        vex = ONE_VEX_TO_TWO_BYTE_VEX(vex);
-        vex |= instruction->three_vex;
-        //instruction that can be encoded with 2 byte
-        //needs to be encoded with 3 byte vex
-        //set mmmmm part to 1
-        if(((vex >> 8) & 0x1F) == 0){
-            vex |= (1 << 8);
-        }
-        uint8_t tmp = 0xC4;
-        section_add_data(&program.text, &tmp, 1); 
-
-        //on little endian lsb goes first
-        //need to put the upper 16 bits in first though
-        uint8_t upper = vex >> 8;
-        uint8_t lower = (0x00FF & vex);
-        section_add_data(&program.text, &upper, 1);  
-        section_add_data(&program.text, &lower, 1);  
-    }
-
-
-    section_add_data(&program.text, instruction->bytes, instruction->size); 
-    if(modrm_size != 0) section_add_data(&program.text, modrm_sib, modrm_size);
+    section_add_data(ctx, &ctx->program.text, instruction->bytes, instruction->size); 
+    if(modrm_size != 0) section_add_data(ctx, &ctx->program.text, modrm_sib, modrm_size);
 
     if(lbl != NULL){
-        symbol_table_add_instance(lbl, program.text.size - DISPLACEMENT_SIZE, false);
+        memory_label_instance(ctx, lbl);
     }
 
     
     if(instruction->ib != -1){
         if(instruction->ib & INSTR_OP4_IS_REG){
-            uint8_t payload = (operand[3].reg.registerIndex) << 4; 
-            section_add_data(&program.text, &payload, 1); 
+            uint8_t payload = extended_register_index(&operand[3]) << 4; 
+            section_add_data(ctx, &ctx->program.text, &payload, 1); 
         } else{ 
-            section_add_data(&program.text, &operand[imm_index].imm8, 1); 
+            int imm_index = 0;
+            while(imm_index < 3 && !is_immediate(operand[imm_index].type)) imm_index++;
+            section_add_data(ctx, &ctx->program.text, &operand[imm_index].imm8, 1); 
         }
     }
 
@@ -1430,11 +1902,11 @@ static void emit_vex_instruction(Instruction* instruction, Operand operand[4]){
 
 
 
-static void emit_instruction(Instruction* instruction, Operand operand[4]){
+static void emit_instruction(BasmContext* ctx, Instruction* instruction, Operand operand[4]){
     uint8_t rex = instruction->rex;
 
     if((instruction->r & INSTR_USES_2VEX) || (instruction->r & INSTR_USES_3VEX)){
-        emit_vex_instruction(instruction, operand);
+        emit_vex_instruction(ctx, instruction, operand);
         return;
     }
 
@@ -1457,19 +1929,21 @@ static void emit_instruction(Instruction* instruction, Operand operand[4]){
 
     // Instruction takes no operands
     if(operand[0].type == OPERAND_NOP){
-        section_add_data(&program.text, opcode, instruction->size); 
+        //cqo, stosq and iretq only have the REX.W of the variant
+        if(rex > 0x40) section_add_data(ctx, &ctx->program.text, &rex, 1);
+        section_add_data(ctx, &ctx->program.text, opcode, instruction->size); 
         return;
     }
 
     if(operand[1].type == OPERAND_NOP){
         // handle call, jmp, jcc instructions
         if(operand[0].type == OPERAND_L64){
-            section_add_data(&program.text, opcode, instruction->size); 
+            section_add_data(ctx, &ctx->program.text, opcode, instruction->size); 
             //assume its a relative address
             uint32_t zero = 0;
             //add some temp zeros
-            section_add_data(&program.text, &zero, 4);
-            symbol_table_add_instance(operand[0].label, program.text.size, true); 
+            section_add_data(ctx, &ctx->program.text, &zero, 4);
+            symbol_table_add_instance(ctx, operand[0].label, ctx->program.text.size, true, SECTION_TEXT, 4, SYMBOL_RELOC_DEFAULT);
             return;
         } else if (is_general_reg(operand[0].type) && is_extended_reg(operand[0].reg.registerIndex)) {
             operand[0].reg.rex |= REX_B;
@@ -1484,26 +1958,37 @@ static void emit_instruction(Instruction* instruction, Operand operand[4]){
         rex |= operand[0].reg.rex;
         //indicates we add register to the opcode
         if((instruction->r & ADD_REG_TO_OPCODE)){
-            opcode[instruction->size - 1] += operand[0].reg.registerIndex; 
+            //xchg with the accumulator first adds the other register, which was given REX.R as the second operand
+            if(instruction->op1 >= OPERAND_AL && instruction->op1 <= OPERAND_RAX && is_general_reg(operand[1].type)){
+                rex |= operand[1].reg.rex & REX_R ? (operand[1].reg.rex & ~REX_R) | REX_B : operand[1].reg.rex;
+                opcode[instruction->size - 1] += operand[1].reg.registerIndex;
+            } else {
+                opcode[instruction->size - 1] += operand[0].reg.registerIndex; 
+            }
         } 
         //if we encode both operands in the modrm byte
         else if ((instruction->r & MODRM_CONTAINS_REG_AND_MEM)) {
-            if(is_general_reg(operand[1].type)){
-                rex |= operand[1].reg.rex;
-                modrm_size = 1;
-                modrm_sib[MODRM_INDEX] |= 192;
-                modrm_sib[MODRM_INDEX] |=(operand[1].reg.registerIndex << 3);
-                modrm_sib[MODRM_INDEX] |= operand[0].reg.registerIndex; 
-            } else if(is_advanced_reg(operand[1].type)){
-                rex |= operand[1].reg.rex;  
+            if(is_general_reg(operand[1].type) || is_advanced_reg(operand[1].type)){
+                //the r/m operand of the variant goes into r/m, without one a general register second goes into reg
+                bool first_in_rm;
+                if(is_rm_operand(instruction->op1)) first_in_rm = true;
+                else if(is_rm_operand(instruction->op2)) first_in_rm = false;
+                else first_in_rm = is_general_reg(operand[1].type);
+                Operand* reg = first_in_rm ? &operand[1] : &operand[0];
+                Operand* rm = first_in_rm ? &operand[0] : &operand[1];
+                //the extended registers got REX.R or REX.B from where match_operand_* guessed they go
+                rex &= ~(REX_R | REX_B);
+                rex |= (reg->reg.rex | rm->reg.rex) & ~(REX_R | REX_B);
+                if(reg->reg.rex & (REX_R | REX_B)) rex |= REX_R;
+                if(rm->reg.rex & (REX_R | REX_B)) rex |= REX_B;
                 modrm_size = 1;
                 modrm_sib[MODRM_INDEX] |= 192;
-                modrm_sib[MODRM_INDEX] |=(operand[0].reg.registerIndex << 3);
-                modrm_sib[MODRM_INDEX] |= operand[1].reg.registerIndex; 
+                modrm_sib[MODRM_INDEX] |= (reg->reg.registerIndex << 3);
+                modrm_sib[MODRM_INDEX] |= rm->reg.registerIndex; 
             }else{
                rex |= operand[1].mem.rex;
                modrm_sib[MODRM_INDEX] |= (operand[0].reg.registerIndex << 3);
-               modrm_size = modrm_sib_fields(&operand[1], modrm_sib, &lbl);
+               modrm_size = modrm_sib_fields(ctx, &operand[1], modrm_sib, &lbl);
             }
             imm_index++;
         } 
@@ -1513,37 +1998,45 @@ static void emit_instruction(Instruction* instruction, Operand operand[4]){
             //11    000      000
             modrm_sib[MODRM_INDEX] |= 0xC0;
             modrm_sib[MODRM_INDEX] |= operand[0].reg.registerIndex; 
+            if(is_rm_operand(instruction->op1)) modrm_size = 1;
         }
 
-    } else if(is_mem(operand[0].type)){
+    } else if((is_mem(operand[0].type) || operand[0].type == OPERAND_MEM_ANY) &&
+              (instruction->digit != -1 || (instruction->r & MODRM_CONTAINS_REG_AND_MEM) || is_rm_operand(instruction->op1))){
+        //the string instructions only name their memory operand, it isn't encoded (setcc r/m8 has no /0 in the table)
         rex |= operand[0].mem.rex;
-        if(is_general_reg(operand[1].type)){
+        //a fixed register (shl r/m8, cl) isn't encoded either
+        bool fixed_register = instruction->op2 >= OPERAND_AL && instruction->op2 <= OPERAND_RAX;
+        if((is_general_reg(operand[1].type) && !fixed_register) || is_advanced_reg(operand[1].type)){
             rex |= operand[1].reg.rex;
             modrm_size = 1;
             modrm_sib[MODRM_INDEX] |= operand[1].reg.registerIndex << 3; 
-            modrm_size = modrm_sib_fields(&operand[0], modrm_sib, &lbl);
+            modrm_size = modrm_sib_fields(ctx, &operand[0], modrm_sib, &lbl);
             imm_index++;
-        } else if(is_immediate(operand[1].type) || operand[1].type == OPERAND_NOP){
-            modrm_size = modrm_sib_fields(&operand[0], modrm_sib, &lbl);
+        } else if(is_immediate(operand[1].type) || operand[1].type == OPERAND_NOP || fixed_register){
+            modrm_size = modrm_sib_fields(ctx, &operand[0], modrm_sib, &lbl);
         }   
     }     
 
 
+    //jmp/push r64 and invpcid take 64 bit registers without REX.W, their variants have no REX
+    //(a plain REX in the table can still need the W of a 64 bit register, adcx and lfs do)
+    if(instruction->rex == 0) rex &= ~REX_W;
     if(rex > 0x40){
         //rex prefix must come right before escape prefix
         if(opcode[1] == 0x0f){ 
-            section_add_data(&program.text, &opcode[0], 1);
+            section_add_data(ctx, &ctx->program.text, &opcode[0], 1);
             opcode[0] = rex;
         } else{
-            section_add_data(&program.text, &rex, 1);
+            section_add_data(ctx, &ctx->program.text, &rex, 1);
         }
     }
          
-    section_add_data(&program.text, opcode, instruction->size); 
-    if(modrm_size != 0) section_add_data(&program.text, modrm_sib, modrm_size);
+    section_add_data(ctx, &ctx->program.text, opcode, instruction->size); 
+    if(modrm_size != 0) section_add_data(ctx, &ctx->program.text, modrm_sib, modrm_size);
 
     if(lbl != NULL){
-        symbol_table_add_instance(lbl, program.text.size - DISPLACEMENT_SIZE, false);
+        memory_label_instance(ctx, lbl);
     } 
 
 
@@ -1554,36 +2047,34 @@ static void emit_instruction(Instruction* instruction, Operand operand[4]){
         case -1:
             break;
         case 1: 
-            section_add_data(&program.text, &operand[imm_index].imm8, 1);
+            section_add_data(ctx, &ctx->program.text, &operand[imm_index].imm8, 1);
             break;
         case 2: {
-            section_add_data(&program.text, &operand[imm_index].imm16, 2);
+            section_add_data(ctx, &ctx->program.text, &operand[imm_index].imm16, 2);
             break;
         }
         case 4: {
-            section_add_data(&program.text, &operand[imm_index].imm32, 4);
+            section_add_data(ctx, &ctx->program.text, &operand[imm_index].imm32, 4);
             break;
         }
        case 8: {
-            section_add_data(&program.text, &operand[imm_index].imm64, 8);
+            section_add_data(ctx, &ctx->program.text, &operand[imm_index].imm64, 8);
             break;
         }
         default:
-            program_fatal_error("Unreachable\n");
+            program_fatal_error(ctx, "Unreachable\n");
         
     }
         
 }
 
-static void match_operand_pairs(Operand* op1, Operand *op2){
-    uint16_t operand_override_prefix = 0x66;
-
+static void match_operand_pairs(BasmContext* ctx, uint64_t instr, Operand* op1, Operand *op2){
     //if we have extended registers r8-r15
     //convert them to their respected index  and set the REX prefix accordingly
     if((is_general_reg(op1->type) || is_advanced_reg(op1->type)) && is_extended_reg(op1->reg.registerIndex)){
         //if op2 is a memory address, the first operand goes into  
         // the reg portion of modrm instead of the r/m portion
-        if(op2->type >= OPERAND_MEM_ANY && op2->type <= OPERAND_M64 || is_advanced_reg(op2->type)){
+        if(op2->type == OPERAND_MEM_ANY || is_mem(op2->type) || is_advanced_reg(op2->type)){
             op1->reg.rex |= REX_R;
         } else{
             op1->reg.rex |= REX_B;
@@ -1591,7 +2082,7 @@ static void match_operand_pairs(Operand* op1, Operand *op2){
         op1->reg.registerIndex -= 8;
     }
     if((is_general_reg(op2->type) || is_advanced_reg(op2->type)) && is_extended_reg(op2->reg.registerIndex)){
-        if((op1->type >= OPERAND_MEM_ANY && op1->type <= OPERAND_M64) || is_general_reg(op1->type)){
+        if(op1->type == OPERAND_MEM_ANY || is_mem(op1->type) || is_general_reg(op1->type)){
             op2->reg.rex |= REX_R;
         } else{
             op2->reg.rex |= REX_B;
@@ -1604,7 +2095,12 @@ static void match_operand_pairs(Operand* op1, Operand *op2){
     if(op2->type == OPERAND_IMM64 || op2->type == OPERAND_SIGNED){
         switch (op1->type) {
             case OPERAND_R64:
-                if(op2->type == OPERAND_IMM64 && op2->imm64 <= UINT32_MAX){
+                //only mov has a 64 bit immediate, the rest sign extend an imm32 like gas
+                if(strcmp(KEYWORD_TABLE[instr].name, "MOV") != 0){
+                    if(op2->type == OPERAND_SIGNED ? !is_int32(op2->imm64) : op2->imm64 > INT32_MAX) program_fatal_error(ctx, "Invalid Operand Size\n");
+                    op2->type = OPERAND_IMM32;
+                    op2->imm32 = (uint32_t)op2->imm64;
+                } else if(op2->type == OPERAND_IMM64 && op2->imm64 <= UINT32_MAX){
                     op1->reg.rex = REX_CLEAR_OP_SIZE(op1->reg.rex);
                     op1->type = OPERAND_R32;
                     op2->type = OPERAND_IMM32;
@@ -1618,9 +2114,9 @@ static void match_operand_pairs(Operand* op1, Operand *op2){
             case OPERAND_R32:
             case OPERAND_M32:
                 if(op2->type == OPERAND_SIGNED){
-                    if(!is_int32(op2->imm64)) program_fatal_error("Invalid Operand Size\n"); 
+                    if(!is_int32(op2->imm64)) program_fatal_error(ctx, "Invalid Operand Size\n"); 
                 } else{
-                    if(!(op2->imm64 <= UINT32_MAX))program_fatal_error("Invalid Operand Size\n"); 
+                    if(!(op2->imm64 <= UINT32_MAX))program_fatal_error(ctx, "Invalid Operand Size\n"); 
                 }
                 op2->type = OPERAND_IMM32;
                 op2->imm32 = (uint32_t)op2->imm64;
@@ -1628,26 +2124,25 @@ static void match_operand_pairs(Operand* op1, Operand *op2){
             case OPERAND_M16:
             case OPERAND_R16:
                 if(op2->type == OPERAND_SIGNED){
-                    if(!is_int16(op2->imm64)) program_fatal_error("Invalid Operand Size\n"); 
+                    if(!is_int16(op2->imm64)) program_fatal_error(ctx, "Invalid Operand Size\n"); 
                 } else{
-                    if(!(op2->imm64 <= UINT16_MAX))program_fatal_error("Invalid Operand Size\n"); 
+                    if(!(op2->imm64 <= UINT16_MAX))program_fatal_error(ctx, "Invalid Operand Size\n"); 
                 }
-                section_add_data(&program.text,&operand_override_prefix, 1);
                 op2->type = OPERAND_IMM16;
                 op2->imm16 = (uint16_t)op2->imm64;
                 break;
             case OPERAND_M8:
             case OPERAND_R8:
                 if(op2->type == OPERAND_SIGNED){
-                    if(!is_int8(op2->imm64)) program_fatal_error("Invalid Operand Size\n"); 
+                    if(!is_int8(op2->imm64)) program_fatal_error(ctx, "Invalid Operand Size\n"); 
                 } else{
-                    if(!(op2->imm64 <= UINT8_MAX))program_fatal_error("Invalid Operand Size\n"); 
+                    if(!(op2->imm64 <= UINT8_MAX))program_fatal_error(ctx, "Invalid Operand Size\n"); 
                 }
                 op2->type = OPERAND_IMM8;
                 op2->imm8 = (uint8_t)op2->imm64;
                 break;
             case OPERAND_MEM_ANY:
-                program_fatal_error("Expected Size specifier\n");
+                program_fatal_error(ctx, "Expected Size specifier\n");
                 break;
         
             default:
@@ -1666,10 +2161,7 @@ static void match_operand_pairs(Operand* op1, Operand *op2){
             if (op2->type == OPERAND_MEM_ANY)op2->type = OPERAND_M32;
             return;
         case OPERAND_R16:
-            if (op2->type == OPERAND_MEM_ANY){
-                section_add_data(&program.text,&operand_override_prefix, 1);
-                op2->type = OPERAND_M32;
-            }
+            if (op2->type == OPERAND_MEM_ANY) op2->type = OPERAND_M16;
             return;
         case OPERAND_R8:
             if(op2->type == OPERAND_MEM_ANY) op2->type = OPERAND_M8;
@@ -1678,9 +2170,6 @@ static void match_operand_pairs(Operand* op1, Operand *op2){
         case OPERAND_MEM_ANY:
             if(is_general_reg(op2->type)){
                 op1->type = op2->type + (OPERAND_M8 - OPERAND_R8);
-                if(op2->type == OPERAND_R16){
-                    section_add_data(&program.text,&operand_override_prefix, 1);
-                }
             }
             return;
         //TODO: TURN THIS SWITCH INTO IF STATEMENTS
@@ -1694,7 +2183,7 @@ static void match_operand_pairs(Operand* op1, Operand *op2){
         case OPERAND_MM:
             return;
         default:
-            program_fatal_error("Operand Combo not supported yet: %s, %s\n", 
+            program_fatal_error(ctx, "Operand Combo not supported yet: %s, %s\n", 
                     operand_to_string(op1->type), operand_to_string(op2->type));
 
     }
@@ -1704,7 +2193,7 @@ static void match_operand_pairs(Operand* op1, Operand *op2){
 
 
 
-static void match_operand_triples(Operand* op1, Operand *op2, Operand* op3){
+static void match_operand_triples(BasmContext* ctx, Operand* op1, Operand *op2, Operand* op3){
     if(op3->type == OPERAND_IMM64){
          if (op3->imm64 <= UINT8_MAX) {
             op3->type = OPERAND_IMM8;
@@ -1729,20 +2218,12 @@ static void match_operand_triples(Operand* op1, Operand *op2, Operand* op3){
         }  
     }
 
-    if(is_general_reg(op1->type) && is_general_reg(op2->type) && is_immediate(op3->type)){
-        uint8_t tmp = op1->reg.registerIndex;        
-        // the order of how 2 registers is packed into modrm is different 
-        // for instructions with three parameters so we just swap them 
-        op1->reg.registerIndex = op2->reg.registerIndex;
-        op2->reg.registerIndex = tmp;
-    }
-
     //if we have extended registers r/xmm/ymm8-r/xmm/ymm15
     //convert them to their respected index  and set the REX prefix accordingly
     if((is_general_reg(op1->type) || is_advanced_reg(op1->type)) && is_extended_reg(op1->reg.registerIndex)){
         //if op2 is a memory address, the first operand goes into  
         // the reg portion of modrm instead of the r/m portion
-        if((op2->type >= OPERAND_MEM_ANY && op2->type <= OPERAND_M64) || is_advanced_reg(op2->type)){
+        if(op2->type == OPERAND_MEM_ANY || is_mem(op2->type) || is_advanced_reg(op2->type)){
             op1->reg.rex |= REX_R;
         } else{
             op1->reg.rex |= REX_B;
@@ -1750,7 +2231,7 @@ static void match_operand_triples(Operand* op1, Operand *op2, Operand* op3){
         op1->reg.registerIndex -= 8;
     }
     if((is_general_reg(op2->type) || is_advanced_reg(op2->type)) && is_extended_reg(op2->reg.registerIndex)){
-        if((op1->type >= OPERAND_MEM_ANY && op1->type <= OPERAND_M64)){
+        if(op1->type == OPERAND_MEM_ANY || is_mem(op1->type)){
             op2->reg.rex |= REX_R;
         } else{
             op2->reg.rex |= REX_B;
@@ -1768,16 +2249,522 @@ static void match_operand_triples(Operand* op1, Operand *op2, Operand* op3){
 
 
 //temp function
-static void print_text_section(){
-    for(int i = 0; i < program.text.size; i++){
-        printf("%02x ", program.text.data[i]);
+static void print_text_section(BasmContext* ctx){
+    for(int i = 0; i < ctx->program.text.size; i++){
+        printf("%02x ", ctx->program.text.data[i]);
+    }
+}
+
+
+
+
+//returns false if there is no variant of the instruction that takes these operands
+static bool assemble_instruction(BasmContext* ctx, uint64_t instr, Operand operands[4], int operand_count){
+    if(operand_count == 2)match_operand_pairs(ctx, instr, &operands[0], &operands[1]);
+    else if(operand_count == 3) match_operand_triples(ctx, &operands[0], &operands[1], &operands[2]);
+    else if (operand_count == 4){
+        if(operands[3].type == OPERAND_IMM64){
+            operands[3].type = OPERAND_IMM8;
+        }
+        match_operand_triples(ctx, &operands[0], &operands[1], &operands[2]);
+    }
+
+    int probes = 0;
+    Instruction* found_instruction = find_instruction(instr, operands, &probes);
+    if(ctx->stats != NULL){
+        ctx->stats->instructions++;
+        ctx->stats->instruction_probes += probes;
+    }
+    if(found_instruction == NULL) return false;
+
+    if(needs_operand_size_prefix(instr, found_instruction)){
+        uint8_t operand_size_prefix = 0x66;
+        section_add_data(ctx, &ctx->program.text, &operand_size_prefix, 1);
+    }
+    emit_instruction(ctx, found_instruction, operands);
+    return true;
+}
+
+
+
+
+#define BRANCH_BOUNDARY 32
+
+typedef enum {
+    BRANCH_NONE,
+    BRANCH_FUSIBLE, //can fuse with a jcc that follows it
+    BRANCH_JCC,
+    BRANCH_OTHER,
+} BranchKind;
+
+
+static BranchKind branch_kind(uint64_t instr, Operand operands[4], int operand_count){
+    const char* name = KEYWORD_TABLE[instr].name;
+    if(strcmp(name, "JMP") == 0 || strcmp(name, "CALL") == 0 || strncmp(name, "RET", 3) == 0) return BRANCH_OTHER;
+    //the loops and the jumps on (e|r)cx are branches that never fuse
+    if(strncmp(name, "LOOP", 4) == 0 || strcmp(name, "JCXZ") == 0 || strcmp(name, "JECXZ") == 0 || strcmp(name, "JRCXZ") == 0) return BRANCH_OTHER;
+    if(name[0] == 'J') return BRANCH_JCC;
+
+    static const char* FUSIBLE[] = {"CMP", "TEST", "ADD", "SUB", "AND", "INC", "DEC"};
+    for(size_t i = 0; i < sizeof(FUSIBLE) / sizeof(FUSIBLE[0]); i++){
+        if(strcmp(name, FUSIBLE[i]) != 0) continue;
+        //a memory operand together with an immediate doesn't fuse
+        bool has_mem = false;
+        bool has_imm = false;
+        for(int j = 0; j < operand_count; j++){
+            has_mem |= is_mem(operands[j].type);
+            has_imm |= is_immediate(operands[j].type);
+        }
+        return (has_mem && has_imm) ? BRANCH_NONE : BRANCH_FUSIBLE;
+    }
+    return BRANCH_NONE;
+}
+
+
+//moves everything from start on forward and fills the gap with nops, the symbols the moved bytes use move with them
+static void text_insert_padding(BasmContext* ctx, uint64_t start, uint64_t padding){
+    Section* section = &ctx->program.text;
+    check_section_size(section, padding);
+    memmove(section->data + start + padding, section->data + start, section->size - start);
+    write_nops(section->data + start, padding);
+    section->size += padding;
+
+    for(int i = 0; i < ctx->moved_instances.size; i++){
+        MovedInstance moved = array_list_get(ctx->moved_instances, MovedInstance, i);
+        SymbolTableEntry* e = &array_list_get(ctx->program.symTable.symbols, SymbolTableEntry, moved.symbol);
+        SymbolInstance* instance = &array_list_get(e->instances, SymbolInstance, moved.instance);
+        //a relative instance of the instruction before ends at start and doesn't move
+        if(instance->offset > start) instance->offset += padding;
+    }
+    //so do the --auto-cfi rules of the instruction before, only the last rules of the frame can be past start
+    for(int i = ctx->program.cfi_rules.size - 1; i >= 0; i--){
+        CfiRule* rule = &array_list_get(ctx->program.cfi_rules, CfiRule, i);
+        if(rule->offset <= start) break;
+        rule->offset += padding;
+    }
+}
+
+
+/*
+ * Branches are always encoded with rel32 so their size doesn't depend on the layout and one pass is enough:
+ * a branch (or a fused cmp/test + jcc pair) that would cross or end on a 32 byte boundary is moved to the boundary
+ * Returns where the listing line of the instruction starts
+ */
+static uint64_t align_branch(BasmContext* ctx, BranchKind kind, uint64_t start){
+    uint64_t end = ctx->program.text.size;
+    uint64_t first = (kind == BRANCH_JCC && ctx->fusible_start != MAX_OFFSET) ? ctx->fusible_start : start;
+    uint64_t listing_start = start;
+    //the boundaries only line up in memory if the section starts on one
+    if(ctx->program.text.alignment < BRANCH_BOUNDARY) ctx->program.text.alignment = BRANCH_BOUNDARY;
+
+    if((kind == BRANCH_JCC || kind == BRANCH_OTHER) && first / BRANCH_BOUNDARY != end / BRANCH_BOUNDARY){
+        uint64_t padding = BRANCH_BOUNDARY - first % BRANCH_BOUNDARY;
+        text_insert_padding(ctx, first, padding);
+        //the padding goes to the listing line of the cmp, which is the last one since a label would have stopped the fusing
+        if(first != start){
+            listing_start += padding;
+            if(ctx->listing != NULL) array_list_get((*ctx->listing), ListingLine, ctx->listing->size - 1).end += padding;
+        }
+    }
+
+    if(kind != BRANCH_FUSIBLE){
+        stop_branch_fusing(ctx);
+        return listing_start;
+    }
+    //a new cmp/test, only its own symbols can move with the jcc after it
+    ctx->fusible_start = start;
+    int kept = 0;
+    for(int i = 0; i < ctx->moved_instances.size; i++){
+        MovedInstance moved = array_list_get(ctx->moved_instances, MovedInstance, i);
+        SymbolTableEntry* e = &array_list_get(ctx->program.symTable.symbols, SymbolTableEntry, moved.symbol);
+        if(array_list_get(e->instances, SymbolInstance, moved.instance).offset > start) array_list_get(ctx->moved_instances, MovedInstance, kept++) = moved;
+    }
+    ctx->moved_instances.size = kept;
+    return listing_start;
+}
+
+
+
+//the dwarf row of an instruction for -g, relative to the start of .text
+//it starts where the listing line does, the padding align_branch puts in front of a fused pair stays with the cmp
+static void line_program_add(BasmContext* ctx, int line_number, uint64_t address){
+    if(!(ctx->options & BASM_OPTION_DEBUG_LINES)) return;
+    Program* program = &ctx->program;
+    //the registers a sequence starts with
+    if(program->line_program.size == 0) program->line_state = (LineProgramState){0, 1};
+    if(program->line_program.data == NULL) init_section(ctx, &program->line_program, 256);
+
+    uint8_t row[LINE_PROGRAM_MAX_ROW];
+    int size = line_program_row(row, &program->line_state, address, line_number + ctx->line_offset);
+    section_add_data(ctx, &program->line_program, row, size);
+}
+
+
+static void cfi_add_rule(BasmContext* ctx, uint8_t op, uint8_t reg, int64_t value){
+    Program* program = &ctx->program;
+    CfiRule rule = {program->text.size, op, reg, value};
+    array_list_append(program->cfi_rules, CfiRule, rule);
+    array_list_get(program->cfi_frames, CfiFrame, program->cfi_frames.size - 1).rule_count++;
+}
+
+
+static void cfi_open_frame(BasmContext* ctx, bool automatic, int line_number){
+    Program* program = &ctx->program;
+    if(program->cfi_frames.data == NULL) array_list_create_cap(program->cfi_frames, CfiFrame, 8);
+    if(program->cfi_rules.data == NULL) array_list_create_cap(program->cfi_rules, CfiRule, 32);
+    CfiFrame frame = {program->text.size, program->text.size, program->cfi_rules.size, 0};
+    array_list_append(program->cfi_frames, CfiFrame, frame);
+
+    //the state the cie starts every frame with, right after the call
+    ctx->cfi.state = (CfiState){DWARF_REG_RSP, 8, 8};
+    ctx->cfi.body = ctx->cfi.state;
+    ctx->cfi.open = true;
+    ctx->cfi.automatic = automatic;
+    ctx->cfi.in_prologue = true;
+    ctx->cfi.line_number = line_number + ctx->line_offset;
+    ctx->cfi.remembered_count = 0;
+}
+
+
+static void cfi_close_frame(BasmContext* ctx){
+    Program* program = &ctx->program;
+    CfiFrame* frame = &array_list_get(program->cfi_frames, CfiFrame, program->cfi_frames.size - 1);
+    frame->end = program->text.size;
+    //a label right before another one or a section line
+    if(frame->end == frame->start){
+        program->cfi_rules.size = frame->first_rule;
+        program->cfi_frames.size--;
+    }
+    ctx->cfi.open = false;
+}
+
+
+//--auto-cfi: the state the prologue leaves behind is the one the rest of the function goes back to
+static void cfi_end_prologue(BasmContext* ctx){
+    if(!ctx->cfi.in_prologue) return;
+    ctx->cfi.in_prologue = false;
+    ctx->cfi.body = ctx->cfi.state;
+}
+
+
+//--auto-cfi gives every function a frame of its own, from its label to the next function
+static void cfi_label(BasmContext* ctx, SymbolTableEntry* e){
+    if(!(ctx->options & BASM_OPTION_AUTO_CFI)) return;
+    //code in a .cfi_startproc frame keeps its rules
+    if(ctx->cfi.open && !ctx->cfi.automatic) return;
+    if(e->visibility == VISIBILITY_GLOBAL){
+        if(ctx->cfi.open) cfi_close_frame(ctx);
+        cfi_open_frame(ctx, true, 0);
+    } else if(ctx->cfi.open){
+        //a local label is a jump target, the pushes after it aren't the prologue anymore
+        cfi_end_prologue(ctx);
+    }
+}
+
+
+typedef enum {
+    STACK_OTHER, //leaves rsp alone, or moves it in a way --auto-cfi can't follow
+    STACK_PUSH,
+    STACK_POP,
+    STACK_ALLOCATE, //sub rsp, imm or add rsp, imm
+    STACK_SET_FRAME, //mov rbp, rsp
+    STACK_RESTORE_FRAME, //mov rsp, rbp
+    STACK_LEAVE,
+    STACK_EXIT, //ret or jmp, the code after it is reached from somewhere else in the function
+} StackEffectKind;
+
+
+#define CFI_NO_REGISTER 0xff
+
+typedef struct {
+    uint8_t kind; //StackEffectKind
+    uint8_t reg; //dwarf number of the 64 bit register a push or pop takes, CFI_NO_REGISTER if it isn't one
+    int64_t size; //bytes rsp goes down by
+} StackEffect;
+
+
+//what an instruction does to rsp, it has to be worked out before assembling since matching narrows the operands
+static StackEffect stack_effect(uint64_t instr, Operand operands[4], int operand_count){
+    const char* name = KEYWORD_TABLE[instr].name;
+    StackEffect effect = {STACK_OTHER, CFI_NO_REGISTER, 0};
+    bool is_reg64[2] = {false, false};
+    uint8_t reg[2] = {0, 0};
+    for(int i = 0; i < operand_count && i < 2; i++){
+        is_reg64[i] = operands[i].type == OPERAND_R64;
+        reg[i] = operands[i].reg.registerIndex;
+    }
+
+    if((strcmp(name, "PUSH") == 0 || strcmp(name, "POP") == 0) && operand_count == 1){
+        effect.kind = (name[1] == 'U') ? STACK_PUSH : STACK_POP;
+        if(is_reg64[0]) effect.reg = DWARF_REGISTERS[reg[0]];
+        effect.size = (operands[0].type == OPERAND_R16) ? 2 : 8;
+        if(effect.kind == STACK_POP) effect.size = -effect.size;
+    } else if((strcmp(name, "SUB") == 0 || strcmp(name, "ADD") == 0) && operand_count == 2 && is_reg64[0] && reg[0] == REG_RSP - REG_RAX &&
+              (operands[1].type == OPERAND_IMM64 || operands[1].type == OPERAND_SIGNED)){
+        effect.kind = STACK_ALLOCATE;
+        effect.size = (name[0] == 'S') ? (int64_t)operands[1].imm64 : -(int64_t)operands[1].imm64;
+    } else if(strcmp(name, "MOV") == 0 && operand_count == 2 && is_reg64[0] && is_reg64[1]){
+        if(reg[0] == REG_RBP - REG_RAX && reg[1] == REG_RSP - REG_RAX) effect.kind = STACK_SET_FRAME;
+        if(reg[0] == REG_RSP - REG_RAX && reg[1] == REG_RBP - REG_RAX) effect.kind = STACK_RESTORE_FRAME;
+    } else if(strcmp(name, "LEAVE") == 0){
+        effect.kind = STACK_LEAVE;
+    } else if(strncmp(name, "RET", 3) == 0 || strcmp(name, "JMP") == 0){
+        effect.kind = STACK_EXIT;
+    }
+    return effect;
+}
+
+
+/*
+ * --auto-cfi: the rules for the code after an instruction of a function
+ * Pushes, sub rsp and mov rbp, rsp at the start are the prologue, up to the first other instruction or local label
+ * The registers it pushes are saved there for the rest of the frame
+ * As long as the cfa is based on rsp every push, pop and add/sub rsp moves it, after mov rbp, rsp it stays at rbp until leave or pop rbp
+ * The code after a ret or jmp is reached from the body of the function, so it gets the state the prologue left behind again
+ */
+static void cfi_auto_instruction(BasmContext* ctx, StackEffect effect){
+    CfiState* state = &ctx->cfi.state;
+    bool prologue = effect.kind == STACK_PUSH || (effect.kind == STACK_ALLOCATE && effect.size > 0) || effect.kind == STACK_SET_FRAME;
+    if(!prologue) cfi_end_prologue(ctx);
+
+    CfiState before = *state;
+    switch(effect.kind){
+        case STACK_PUSH:
+        case STACK_POP:
+        case STACK_ALLOCATE:
+            state->rsp_offset += effect.size;
+            break;
+        case STACK_SET_FRAME:
+            if(state->cfa_register != DWARF_REG_RSP) break;
+            state->cfa_register = DWARF_REG_RBP;
+            ctx->cfi.rbp_offset = state->rsp_offset;
+            break;
+        case STACK_RESTORE_FRAME:
+            state->rsp_offset = ctx->cfi.rbp_offset;
+            break;
+        case STACK_LEAVE:
+            state->rsp_offset = ctx->cfi.rbp_offset - 8;
+            break;
+        case STACK_EXIT:
+            *state = ctx->cfi.body;
+            break;
+    }
+    //the frame pointer is gone once it's popped
+    bool pops_rbp = (effect.kind == STACK_POP && effect.reg == DWARF_REG_RBP) || effect.kind == STACK_LEAVE;
+    if(pops_rbp && state->cfa_register == DWARF_REG_RBP) state->cfa_register = DWARF_REG_RSP;
+    if(state->cfa_register == DWARF_REG_RSP) state->cfa_offset = state->rsp_offset;
+
+    bool moved_register = state->cfa_register != before.cfa_register;
+    bool moved_offset = state->cfa_offset != before.cfa_offset;
+    if(moved_register && moved_offset) cfi_add_rule(ctx, CFI_DEF_CFA, state->cfa_register, state->cfa_offset);
+    else if(moved_register) cfi_add_rule(ctx, CFI_DEF_CFA_REGISTER, state->cfa_register, 0);
+    else if(moved_offset) cfi_add_rule(ctx, CFI_DEF_CFA_OFFSET, 0, state->cfa_offset);
+
+    if(ctx->cfi.in_prologue && effect.kind == STACK_PUSH && effect.reg != CFI_NO_REGISTER){
+        cfi_add_rule(ctx, CFI_OFFSET, effect.reg, -state->rsp_offset);
+    }
+}
+
+
+//the .cfi_* directives of gas, the ones with an op add that rule where the code is
+static const struct {
+    const char* name;
+    uint8_t op; //CfiOp, 0 for the ones that start or end a frame
+    bool has_register;
+    bool has_offset;
+} CFI_DIRECTIVES[] = {
+    {".cfi_startproc", 0, false, false},
+    {".cfi_endproc", 0, false, false},
+    {".cfi_def_cfa", CFI_DEF_CFA, true, true},
+    {".cfi_def_cfa_register", CFI_DEF_CFA_REGISTER, true, false},
+    {".cfi_def_cfa_offset", CFI_DEF_CFA_OFFSET, false, true},
+    {".cfi_adjust_cfa_offset", CFI_DEF_CFA_OFFSET, false, true},
+    {".cfi_offset", CFI_OFFSET, true, true},
+    {".cfi_restore", CFI_RESTORE, true, false},
+    {".cfi_remember_state", CFI_REMEMBER_STATE, false, false},
+    {".cfi_restore_state", CFI_RESTORE_STATE, false, false},
+};
+
+#define CFI_DIRECTIVE_COUNT (int)(sizeof(CFI_DIRECTIVES) / sizeof(CFI_DIRECTIVES[0]))
+
+
+//index in CFI_DIRECTIVES of the directive at the current token, -1 if it isn't one
+static int parser_match_cfi_directive(Parser* p){
+    if(p->currentToken.type != TOK_IDENTIFIER || p->currentToken.literal[0] != '.') return -1;
+    for(int i = 0; i < CFI_DIRECTIVE_COUNT; i++){
+        if(parser_match_directive(p, CFI_DIRECTIVES[i].name)) return i;
+    }
+    return -1;
+}
+
+
+//a 64 bit register or its dwarf number
+static uint8_t parse_cfi_register(Parser* p){
+    uint8_t reg = 0;
+    if(p->currentToken.type == TOK_REG && is_r64(p->currentToken.reg)){
+        reg = DWARF_REGISTERS[p->currentToken.reg - REG_RAX];
+    } else if(p->currentToken.type == TOK_UINT && string_to_int(p->currentToken.literal, TOK_UINT) <= DWARF_REG_RETURN_ADDRESS){
+        reg = string_to_int(p->currentToken.literal, TOK_UINT);
+    } else {
+        parser_fatal_error(p, "Expected a 64 bit register or a dwarf register number got %s\n", token_to_string(p->currentToken.type));
+    }
+    parser_next_token(p);
+    return reg;
+}
+
+
+static int64_t parse_cfi_offset(Parser* p){
+    if(p->currentToken.type != TOK_UINT && p->currentToken.type != TOK_INT){
+        parser_fatal_error(p, "Expected an offset got %s\n", token_to_string(p->currentToken.type));
     }
+    int64_t offset = (int64_t)string_to_int(p->currentToken.literal, TOK_INT);
+    parser_next_token(p);
+    return offset;
+}
+
+
+//the rest of a .cfi_* line, they work like in gas with nasm register names
+static void parse_cfi_directive(Parser* p, int directive){
+    BasmContext* ctx = p->ctx;
+    const char* name = CFI_DIRECTIVES[directive].name;
+    uint8_t op = CFI_DIRECTIVES[directive].op;
+    bool starts_frame = strcmp(name, ".cfi_startproc") == 0;
+    if(starts_frame && ctx->cfi.open && !ctx->cfi.automatic){
+        parser_fatal_error(p, ".cfi_startproc inside the frame that started on line %d\n", ctx->cfi.line_number);
+    }
+    if(!starts_frame && (!ctx->cfi.open || ctx->cfi.automatic)) parser_fatal_error(p, "%s without .cfi_startproc\n", name);
+    int line_number = p->currentToken.line_number;
+    parser_next_token(p);
+
+    uint8_t reg = 0;
+    int64_t offset = 0;
+    if(CFI_DIRECTIVES[directive].has_register) reg = parse_cfi_register(p);
+    if(CFI_DIRECTIVES[directive].has_register && CFI_DIRECTIVES[directive].has_offset) parser_expect_consume_token(p, TOK_COMMA);
+    if(CFI_DIRECTIVES[directive].has_offset) offset = parse_cfi_offset(p);
+    parser_expect_token(p, TOK_NEW_LINE);
+
+    //nothing can move in front of the rule, it holds from here on
+    stop_branch_fusing(ctx);
+
+    CfiState* state = &ctx->cfi.state;
+    if(starts_frame){
+        //takes over from the frame --auto-cfi opened at the label
+        if(ctx->cfi.open) cfi_close_frame(ctx);
+        cfi_open_frame(ctx, false, line_number);
+    } else if(op == 0){
+        cfi_close_frame(ctx);
+    } else if(op == CFI_DEF_CFA || op == CFI_DEF_CFA_REGISTER || op == CFI_DEF_CFA_OFFSET){
+        if(strcmp(name, ".cfi_adjust_cfa_offset") == 0) offset += state->cfa_offset;
+        if(op == CFI_DEF_CFA_REGISTER) offset = state->cfa_offset;
+        if(offset < 0) parser_fatal_error(p, "The cfa offset can't be negative: %ld\n", offset);
+        if(op != CFI_DEF_CFA_OFFSET) state->cfa_register = reg;
+        state->cfa_offset = offset;
+        //adjust is a def_cfa_offset with the sum, def_cfa_register keeps the offset
+        cfi_add_rule(ctx, op, reg, (op == CFI_DEF_CFA_REGISTER) ? 0 : offset);
+    } else if(op == CFI_OFFSET){
+        if(offset % 8 != 0) parser_fatal_error(p, "The save offset has to be a multiple of 8: %ld\n", offset);
+        cfi_add_rule(ctx, op, reg, offset);
+    } else if(op == CFI_REMEMBER_STATE){
+        if(ctx->cfi.remembered_count == 8) parser_fatal_error(p, "More than 8 states remembered\n");
+        ctx->cfi.remembered[ctx->cfi.remembered_count++] = *state;
+        cfi_add_rule(ctx, op, 0, 0);
+    } else if(op == CFI_RESTORE_STATE){
+        if(ctx->cfi.remembered_count == 0) parser_fatal_error(p, ".cfi_restore_state without .cfi_remember_state\n");
+        *state = ctx->cfi.remembered[--ctx->cfi.remembered_count];
+        cfi_add_rule(ctx, op, 0, 0);
+    } else {
+        cfi_add_rule(ctx, op, reg, 0);
+    }
+}
+
+
+//the rest of global name:function|data|object [size], like in nasm
+static void parse_symbol_type(Parser* p, SymbolTableEntry* e){
+    parser_expect_token(p, TOK_IDENTIFIER);
+    uint8_t type = SYMBOL_TYPE_AUTO;
+    if(string_cmp_lower(p->currentToken.literal, "function") == 0) type = SYMBOL_TYPE_FUNCTION;
+    else if(string_cmp_lower(p->currentToken.literal, "data") == 0 || string_cmp_lower(p->currentToken.literal, "object") == 0) type = SYMBOL_TYPE_OBJECT;
+    else parser_fatal_error(p, "Unknown symbol type: %s\n", p->currentToken.literal);
+    parser_next_token(p);
+
+    uint64_t size = 0;
+    if(p->currentToken.type == TOK_UINT){
+        char* end;
+        char* literal = p->currentToken.literal;
+        size = strtoull(literal, &end, (literal[0] == '0' && literal[1] == 'x') ? 16 : 10);
+        if(*end != 0 || size == 0) parser_fatal_error(p, "Invalid symbol size: %s\n", literal);
+        parser_next_token(p);
+    }
+    e->type = type;
+    e->size = size;
+}
+
+
+//what placing an instruction needs to know about it, incremental assembly keeps it with the bytes
+typedef struct {
+    int line_number;
+    uint8_t branch; //BranchKind
+    StackEffect effect;
+} InstructionInfo;
+
+
+//parses and encodes the instruction at the current token, up to the new line
+static InstructionInfo parse_instruction(Parser* p){
+    BasmContext* ctx = p->ctx;
+    Operand operands[4] = {0};
+    int operand_count = 0;
+    uint64_t instr = p->currentToken.instruction;
+    InstructionInfo info = {p->currentToken.line_number, BRANCH_NONE, {STACK_OTHER, CFI_NO_REGISTER, 0}};
+    while(p->currentToken.type != TOK_NEW_LINE){
+        Token op = parser_next_token(p);
+        if(op.type == TOK_NEW_LINE) break;
+        operands[operand_count++] = parse_operand(p);
+
+        parser_next_token(p);
+
+        if(!match(p, TOK_COMMA, TOK_NEW_LINE)){
+            parser_fatal_error(p, "Expected comma or new line after operand got %s\n", token_to_string(p->currentToken.type));
+
+        }
+
+    }
+
+    if(ctx->options & BASM_OPTION_AUTO_CFI) info.effect = stack_effect(instr, operands, operand_count);
+    if(!assemble_instruction(ctx, instr, operands, operand_count)){
+        for(int i = 0; i < operand_count; i++){
+            scratch_buffer_fmt(&ctx->scratch, "%s ", operand_to_string(operands[i].type));
+        }
+        char* temp = scratch_buffer_as_str(&ctx->scratch);
+        parser_fatal_error(p,"Couldn't find instruction for nmemonic: %s %s", KEYWORD_TABLE[instr].name, temp); 
+    }
+    if(ctx->options & BASM_OPTION_ALIGN_BRANCHES) info.branch = branch_kind(instr, operands, operand_count);
+    return info;
+}
+
+
+//the instruction was just appended to .text at start, pads it for --align-branches and adds its listing line, dwarf row and --auto-cfi rules
+static void place_instruction(BasmContext* ctx, const InstructionInfo* info, uint64_t start){
+    if(ctx->options & BASM_OPTION_ALIGN_BRANCHES){
+        start = align_branch(ctx, info->branch, start);
+    }
+    listing_add_line(ctx, info->line_number, SECTION_TEXT, start, ctx->program.text.size);
+    line_program_add(ctx, info->line_number, start);
+    if(ctx->cfi.open && ctx->cfi.automatic) cfi_auto_instruction(ctx, info->effect);
 }
 
 
+//the label starts a .text.<label> section of --function-sections, with --align-branches it has to start on a boundary like the other subsections
+static bool text_function_start(BasmContext* ctx, const SymbolTableEntry* e){
+    uint32_t both = BASM_OPTION_ALIGN_BRANCHES | BASM_OPTION_FUNCTION_SECTIONS;
+    if((ctx->options & both) != both || e->visibility != VISIBILITY_GLOBAL) return false;
+    ArrayList* subsections = &ctx->program.subsections;
+    return subsections->size == 0 || strcmp(array_list_get((*subsections), TextSubsection, subsections->size - 1).name, ".text") == 0;
+}
 
 
 static void parse_text_section(Parser* p){
+    BasmContext* ctx = p->ctx;
+    int directive;
     while(p->currentToken.type != TOK_SECTION){
         if(p->currentToken.type == TOK_SECTION) break;
 
@@ -1788,74 +2775,307 @@ static void parse_text_section(Parser* p){
 
             Token id = p->currentToken;
             //TODO: ALLOW MANY GLOBAL DECLARATIONS AT ONCE
-            symbol_table_add(id.literal, 0, section, VISIBILITY_GLOBAL);
+            SymbolTableEntry* e = symbol_table_add(ctx, id.literal, 0, section, VISIBILITY_GLOBAL);
             parser_next_token(p);
+            if(parser_match_consume_token(p, TOK_COLON)) parse_symbol_type(p, e);
+            parser_expect_consume_token(p, TOK_NEW_LINE);
+        }
+        else if(parser_match_directive(p, "align")){
+            parse_align(p, SECTION_TEXT);
+        }
+        else if((directive = parser_match_cfi_directive(p)) >= 0){
+            parse_cfi_directive(p, directive);
             parser_expect_consume_token(p, TOK_NEW_LINE);
         }
         else if(p->currentToken.type == TOK_IDENTIFIER){
             Token id = p->currentToken;
             parser_next_token(p);
             parser_expect_consume_token(p, TOK_COLON); 
+            //added before moving on since a label can be the last token of the file
+            SymbolTableEntry* e = symbol_table_add(ctx, id.literal, ctx->program.text.size, SECTION_TEXT, VISIBILITY_LOCAL);
+            if(text_function_start(ctx, e)){
+                section_align(ctx, &ctx->program.text, BRANCH_BOUNDARY, -1);
+                e->section_offset = ctx->program.text.size;
+            }
+            cfi_label(ctx, e);
+            listing_add_line(ctx, id.line_number, SECTION_TEXT, ctx->program.text.size, ctx->program.text.size);
+            //nothing can move in front of a label
+            stop_branch_fusing(ctx);
             parser_next_token(p);
-            symbol_table_add(id.literal, program.text.size, SECTION_TEXT, VISIBILITY_LOCAL);
         } else if (p->currentToken.type == TOK_INSTRUCTION) {
-                Operand operands[4] = {0};
-                int operand_count = 0;
-                uint64_t instr = p->currentToken.instruction; 
-                while(p->currentToken.type != TOK_NEW_LINE){
-                    Token op = parser_next_token(p);
-                    if(op.type == TOK_NEW_LINE) break;
-                    operands[operand_count++] = parse_operand(p);
+            uint64_t start = ctx->program.text.size;
+            InstructionInfo info = parse_instruction(p);
+            place_instruction(ctx, &info, start);
+            parser_expect_consume_token(p, TOK_NEW_LINE);
+        } else{
+            parser_fatal_error(p, "Invalid token found in text section\n");
+        }
+    }
 
-                    parser_next_token(p);
+}
 
-                    if(!match(p, TOK_COMMA, TOK_NEW_LINE)){
-                        parser_fatal_error(p, "Expected comma or new line after operand got %s\n", token_to_string(p->currentToken.type));
 
-                    }
+//code after a section line is appended to the text section, a new subsection starts there if the name changed
+static void text_subsection_start(BasmContext* ctx, const char* name){
+    Program* program = &ctx->program;
+    //a cmp/test of another subsection doesn't fuse with the code here
+    stop_branch_fusing(ctx);
+    if(program->subsections.size == 0){
+        if(strcmp(name, ".text") == 0) return;
+        if(program->subsections.data == NULL) array_list_create_cap(program->subsections, TextSubsection, 4);
+        //the code so far was in .text
+        if(program->text.size > 0) array_list_append(program->subsections, TextSubsection, ((TextSubsection){".text", 0}));
+    }
 
-                }
+    int count = program->subsections.size;
+    TextSubsection* last = (count > 0) ? &array_list_get(program->subsections, TextSubsection, count - 1) : NULL;
+    if(last != NULL && strcmp(last->name, name) == 0) return;
 
-                if(operand_count == 2)match_operand_pairs(&operands[0], &operands[1]);
-                else if(operand_count == 3) match_operand_triples(&operands[0], &operands[1], &operands[2]);
-                else if (operand_count == 4){
-                    if(operands[3].type == OPERAND_IMM64){
-                        operands[3].type = OPERAND_IMM8;
-                    }
-                    match_operand_triples(&operands[0], &operands[1], &operands[2]);
-                }
+    //nothing was added since the last section line
+    if(last != NULL && last->start == program->text.size){
+        TextSubsection* prev = (count > 1) ? &array_list_get(program->subsections, TextSubsection, count - 2) : NULL;
+        if(prev != NULL && strcmp(prev->name, name) == 0) program->subsections.size--;
+        else last->name = context_copy_name(ctx, name);
+        return;
+    }
+    //each subsection is a section of its own, --align-branches only lines up the boundaries if it starts on one
+    if(ctx->options & BASM_OPTION_ALIGN_BRANCHES) section_align(ctx, &program->text, BRANCH_BOUNDARY, -1);
+    TextSubsection subsection = {context_copy_name(ctx, name), program->text.size};
+    array_list_append(program->subsections, TextSubsection, subsection);
+}
 
-                Instruction* found_instruction = find_instruction(instr, operands);
-                
-                if(found_instruction == NULL){
-                    for(int i = 0; i < operand_count; i++){
-                        scratch_buffer_fmt("%s ", operand_to_string(operands[i].type));
-                    }
-                    char* temp = scratch_buffer_as_str();
-                    parser_fatal_error(p,"Couldn't find instruction for nmemonic: %s %s", KEYWORD_TABLE[instr].name, temp); 
-                } else{
-                    emit_instruction(found_instruction, operands);
-                }
 
-                parser_expect_consume_token(p, TOK_NEW_LINE);
+//splits .text at every global label so each function ends up in a .text.<label> section of its own
+//functions in a named subsection stay in it, with --align-branches so do the ones declared global after their label
+static void text_function_sections(BasmContext* ctx){
+    Program* program = &ctx->program;
+    if(program->subsections.data == NULL) array_list_create_cap(program->subsections, TextSubsection, 4);
+    if(program->subsections.size == 0) array_list_append(program->subsections, TextSubsection, ((TextSubsection){".text", 0}));
+
+    //picked before splitting anything, the labels after the first one in a piece of .text would be in .text.<first> by then
+    ArrayList functions;
+    array_list_create_cap(functions, int, 16);
+    for(int i = 0; i < program->symTable.symbols.size; i++){
+        SymbolTableEntry* e = &array_list_get(program->symTable.symbols, SymbolTableEntry, i);
+        if(e->section != SECTION_TEXT || e->visibility != VISIBILITY_GLOBAL) continue;
+        if((ctx->options & BASM_OPTION_ALIGN_BRANCHES) && e->section_offset % BRANCH_BOUNDARY != 0) continue;
+        if(strcmp(text_subsection(&program->subsections, e->section_offset)->name, ".text") == 0) array_list_append(functions, int, i);
+    }
 
-        } else{
-            parser_fatal_error(p, "Invalid token found in text section\n");
+    for(int i = 0; i < functions.size; i++){
+        SymbolTableEntry* e = &array_list_get(program->symTable.symbols, SymbolTableEntry, array_list_get(functions, int, i));
+        TextSubsection* subsection = text_subsection(&program->subsections, e->section_offset);
+
+        scratch_buffer_clear(&ctx->scratch);
+        char* name = context_copy_name(ctx, scratch_buffer_fmt(&ctx->scratch, ".text.%s", e->name));
+        scratch_buffer_clear(&ctx->scratch);
+        if(subsection->start == e->section_offset){
+            subsection->name = name;
+            continue;
+        }
+
+        int index = subsection - (TextSubsection*)program->subsections.data + 1;
+        array_list_append(program->subsections, TextSubsection, ((TextSubsection){0}));
+        TextSubsection* subsections = program->subsections.data;
+        memmove(&subsections[index + 1], &subsections[index], (program->subsections.size - index - 1) * sizeof(TextSubsection));
+        subsections[index] = (TextSubsection){name, e->section_offset};
+    }
+    free(functions.data);
+}
+
+
+//flags and alignment of the sections that start with these names, the rest are progbits alloc noexec nowrite align=1 like in nasm
+static const struct {
+    const char* prefix;
+    uint32_t flags;
+    uint64_t alignment;
+} SECTION_DEFAULTS[] = {
+    {".text.", SECTION_FLAG_EXEC, 1},
+    {".rodata", 0, 4},
+    {".data.", SECTION_FLAG_WRITE, 4},
+    {".bss.", SECTION_FLAG_WRITE | SECTION_FLAG_NOBITS, 4},
+    {".tdata", SECTION_FLAG_WRITE | SECTION_FLAG_TLS, 4},
+    {".tbss", SECTION_FLAG_WRITE | SECTION_FLAG_NOBITS | SECTION_FLAG_TLS, 4},
+};
+
+
+static const struct {
+    const char* name;
+    uint32_t set;
+    uint32_t clear;
+} SECTION_ATTRIBUTES[] = {
+    {"progbits", 0, SECTION_FLAG_NOBITS},
+    {"nobits", SECTION_FLAG_NOBITS, 0},
+    {"alloc", 0, SECTION_FLAG_NOALLOC},
+    {"noalloc", SECTION_FLAG_NOALLOC, 0},
+    {"exec", SECTION_FLAG_EXEC, 0},
+    {"noexec", 0, SECTION_FLAG_EXEC},
+    {"write", SECTION_FLAG_WRITE, 0},
+    {"nowrite", 0, SECTION_FLAG_WRITE},
+    {"tls", SECTION_FLAG_TLS, 0},
+};
+
+
+// align=N after the name of a section, the section is aligned to at least N in the object
+static uint64_t parse_align_attribute(Parser* p){
+    parser_next_token(p);
+    parser_expect_consume_token(p, TOK_EQUAL);
+    return parse_alignment(p);
+}
+
+
+//the rest of a .text, .data or .bss line, their flags are fixed so they only take an alignment
+static void parse_builtin_section_line(Parser* p, uint8_t section){
+    Section* output = program_section(&p->ctx->program, section);
+    parser_next_token(p);
+    while(parser_match_directive(p, "align")){
+        uint64_t alignment = parse_align_attribute(p);
+        if(alignment > output->alignment) output->alignment = alignment;
+    }
+    parser_expect_consume_token(p, TOK_NEW_LINE);
+}
+
+
+/*
+ * section <name> [progbits|nobits] [alloc|noalloc] [exec|noexec] [write|nowrite] [tls] [align=N]
+ * Returns the section the lines after it go to, SECTION_TEXT for code which ends up in a text subsection
+ * A section declared again keeps its flags so they can be left out the next time
+ */
+static uint8_t parse_section_declaration(Parser* p){
+    BasmContext* ctx = p->ctx;
+    Program* program = &ctx->program;
+    const char* name = p->currentToken.literal;
+
+    uint32_t flags = 0;
+    uint64_t alignment = 1;
+    uint64_t entry_size = merge_entry_size(name);
+    if(entry_size != 0){
+        flags = SECTION_FLAG_MERGE | ((entry_size == 1) ? SECTION_FLAG_STRINGS : 0);
+        alignment = entry_size;
+    }
+    for(size_t i = 0; entry_size == 0 && i < sizeof(SECTION_DEFAULTS) / sizeof(SECTION_DEFAULTS[0]); i++){
+        if(strncmp(name, SECTION_DEFAULTS[i].prefix, strlen(SECTION_DEFAULTS[i].prefix)) == 0){
+            flags = SECTION_DEFAULTS[i].flags;
+            alignment = SECTION_DEFAULTS[i].alignment;
+            break;
+        }
+    }
+
+    uint8_t id = program_find_section(program, name);
+    bool declared = id != SECTION_UNDEFINED;
+    if(declared) flags = program_section_flags(program, id);
+    for(int i = 0; !declared && i < program->subsections.size; i++){
+        if(strcmp(array_list_get(program->subsections, TextSubsection, i).name, name) == 0){
+            flags = SECTION_FLAG_EXEC;
+            declared = true;
+        }
+    }
+    uint32_t declared_flags = flags;
+
+    parser_next_token(p);
+    while(p->currentToken.type == TOK_IDENTIFIER){
+        if(parser_match_directive(p, "align")){
+            alignment = parse_align_attribute(p);
+            continue;
         }
+
+        size_t i = 0;
+        while(i < sizeof(SECTION_ATTRIBUTES) / sizeof(SECTION_ATTRIBUTES[0]) && string_cmp_lower(p->currentToken.literal, SECTION_ATTRIBUTES[i].name) != 0) i++;
+        if(i == sizeof(SECTION_ATTRIBUTES) / sizeof(SECTION_ATTRIBUTES[0])){
+            parser_fatal_error(p, "Unknown section attribute %s\n", p->currentToken.literal);
+        }
+        flags = (flags | SECTION_ATTRIBUTES[i].set) & ~SECTION_ATTRIBUTES[i].clear;
+        parser_next_token(p);
+    }
+    parser_expect_consume_token(p, TOK_NEW_LINE);
+
+    if(declared && flags != declared_flags){
+        parser_fatal_error(p, "Section %s was declared with different flags\n", name);
+    }
+
+    if(flags & SECTION_FLAG_EXEC){
+        if(flags != SECTION_FLAG_EXEC) parser_fatal_error(p, "Code section %s can't be nobits, noalloc or writable\n", name);
+        init_section(ctx, &program->text, 256);
+        //padded before the subsection starts so its code is aligned in objects too
+        if(alignment > 1) section_align(ctx, &program->text, alignment, -1);
+        text_subsection_start(ctx, name);
+        return SECTION_TEXT;
+    }
+
+    if((flags & SECTION_FLAG_MERGE) && (flags & (SECTION_FLAG_WRITE | SECTION_FLAG_NOBITS))){
+        parser_fatal_error(p, "Merge section %s can't be nobits or writable\n", name);
+    }
+
+    if(!declared) id = program_add_section(ctx, name, flags, entry_size);
+    Section* bytes = program_section(program, id);
+    if(alignment > bytes->alignment) bytes->alignment = alignment;
+    return id;
+}
+
+
+/*
+ * The rest of a section line, the current token is the name after section
+ * Returns the section the lines after it go to
+ */
+static uint8_t parse_section_line(Parser* p){
+    BasmContext* ctx = p->ctx;
+    //the code after a section line isn't part of the function before it, unless a .cfi_startproc says so
+    if(ctx->cfi.open && ctx->cfi.automatic) cfi_close_frame(ctx);
+
+    switch (p->currentToken.type) {
+        case TOK_TEXT:
+            init_section(ctx, &ctx->program.text, 256);
+            text_subsection_start(ctx, ".text");
+            parse_builtin_section_line(p, SECTION_TEXT);
+            return SECTION_TEXT;
+
+        //.rodata, .text.hot or any other section declared with its flags
+        case TOK_IDENTIFIER:
+            return parse_section_declaration(p);
+
+        case TOK_BSS:
+            parse_builtin_section_line(p, SECTION_BSS);
+            return SECTION_BSS;
+
+        case TOK_DATA:
+            init_section(ctx, &ctx->program.data, 64);
+            parse_builtin_section_line(p, SECTION_DATA);
+            return SECTION_DATA;
+
+        default:
+            parser_fatal_error(p, "Expected Section Name got %s\n", token_to_string(p->currentToken.type));
     }
+}
 
+
+//the lines after a section line up to the next one
+static void parse_section_body(Parser* p, uint8_t section){
+    if(section == SECTION_TEXT) parse_text_section(p);
+    else if(program_section_flags(&p->ctx->program, section) & SECTION_FLAG_NOBITS) parse_bss_section(p, section);
+    else parse_data_section(p, section);
+}
+
+
+//the frames that are still open when the source ends
+static void cfi_close_program(BasmContext* ctx){
+    if(ctx->cfi.open && ctx->cfi.automatic) cfi_close_frame(ctx);
+    if(ctx->cfi.open) program_fatal_error(ctx, ".cfi_startproc on line %d has no .cfi_endproc\n", ctx->cfi.line_number);
 }
 
 
-static void parse_tokens(ArrayList* tokens){
+static void parse_tokens(BasmContext* ctx, uint32_t first_token){
     Parser p ={0};
-    p.tokens = tokens;
+    p.ctx = ctx;
+    p.tokens = &ctx->tokens;
+    p.tokenIndex = first_token;
     p.currentToken.type = TOK_MAX;
-    array_list_create_cap(program.symTable.symbols, SymbolTableEntry, 16);
+
+    //a section ends at the next section or when the tokens run out and jump back to the setjmp
+    volatile TraceSpan span = {0};
  
     while(p.tokenIndex < p.tokens->size){
         if(setjmp(p.jmp) == 1){
-            //print_text_section();        
+            //print_text_section(ctx);        
             break;
         }
 
@@ -1870,90 +3090,1006 @@ static void parse_tokens(ArrayList* tokens){
 
 
         parser_next_token(&p); 
-
+        trace_end(span);
         switch (p.currentToken.type) {
             case TOK_TEXT:
-                init_section(&program.text, 256);
-                parser_next_token(&p);
-                parser_expect_consume_token(&p, TOK_NEW_LINE);      
-                parse_text_section(&p); 
+                span = trace_begin("section .text", NULL);
                 break;
-
             case TOK_BSS:
-                parser_next_token(&p);
-                parser_expect_consume_token(&p, TOK_NEW_LINE);      
-                parse_bss_section(&p);
+                span = trace_begin("section .bss", NULL);
                 break;
-
             case TOK_DATA:
-                init_section(&program.data, 64);
-                parser_next_token(&p);
-                parser_expect_consume_token(&p, TOK_NEW_LINE);       
-                parse_data_section(&p);
+                span = trace_begin("section .data", NULL);
                 break;
-
             default:
-                parser_fatal_error(&p, "Expected Section Name got %s\n", token_to_string(p.currentToken.type));     
-                        
+                span = trace_begin("section", (p.currentToken.type == TOK_IDENTIFIER) ? p.currentToken.literal : NULL);
         }
+
+        uint8_t section = parse_section_line(&p);
+        parse_section_body(&p, section);
     }
+    trace_end(span);
+    cfi_close_program(ctx);
+}
 
 
 
+static void tokens_delete(ArrayList* tokens){
+    for(int i = 0; i < tokens->size; i++){
+        Token t = array_list_get((*tokens), Token, i);
+        if(t.type == TOK_IDENTIFIER || t.type == TOK_UINT || t.type == TOK_INT || t.type == TOK_STRING){
+            free(t.literal);
+        }
+    }
+    free(tokens->data);
+    memset(tokens, 0, sizeof(ArrayList));
 }
 
 
+static void program_delete(BasmContext* ctx){
+    for(int i = 0; i < ctx->program.symTable.symbols.size; i++){
+        SymbolTableEntry e = array_list_get(ctx->program.symTable.symbols, SymbolTableEntry, i);
+        if(e.instances.data != NULL) free(e.instances.data);
+    }
+    free(ctx->program.symTable.symbols.data);
+    free(ctx->program.text.data);
+    free(ctx->program.data.data);
+    free(ctx->program.subsections.data);
+    for(int i = 0; i < ctx->program.sections.size; i++){
+        free(array_list_get(ctx->program.sections, ProgramSection, i).bytes.data);
+    }
+    free(ctx->program.sections.data);
+    free(ctx->program.line_program.data);
+    free(ctx->program.section_addresses.data);
+    free(ctx->program.cfi_frames.data);
+    free(ctx->program.cfi_rules.data);
+    memset(&ctx->program, 0, sizeof(Program));
+    memset(&ctx->cfi, 0, sizeof(ctx->cfi));
+    free(ctx->constants);
+    ctx->constants = NULL;
+    ctx->constant_capacity = 0;
+    ctx->constant_count = 0;
+}
 
-bool basm_assemble_program(AssemblerFlags* flags){
-     current_fb = file_buffer_create(flags->input_file);
-
-     if(current_fb == NULL) return false;
-   
 
-     ArrayList tokens = tokenize_file(); 
-     parse_tokens(&tokens);
+static void resolve_symbols(BasmContext* ctx){
+     StatsTimer timer;
+     if(ctx->stats != NULL) timer = stats_timer_start();
+     TraceSpan span = trace_begin("resolve_symbols", ctx->input_name);
 
-     for(int i = 0; i < program.symTable.symbols.size; i++){
-         SymbolTableEntry* e = &array_list_get(program.symTable.symbols, SymbolTableEntry, i);
+     uint64_t relocations = 0;
+     for(int i = 0; i < ctx->program.symTable.symbols.size; i++){
+         SymbolTableEntry* e = &array_list_get(ctx->program.symTable.symbols, SymbolTableEntry, i);
          if(e->section == SECTION_UNDEFINED && e->visibility == VISIBILITY_UNDEFINED){
-             program_fatal_error("Symbol %s used but never defined\n", e->name);
+             program_fatal_error(ctx, "Symbol %s used but never defined\n", e->name);
+         }
+
+         //externs get resolved by the linker or the jit 
+         if(e->section == SECTION_EXTERN){
+             relocations += e->instances.size;
+             continue;
          }
 
          for(int j = 0; j < e->instances.size; j++){
              SymbolInstance* instance =  &array_list_get(e->instances, SymbolInstance, j);
+             if(!instance->is_relative || instance->reloc != SYMBOL_RELOC_DEFAULT) relocations++;
 
              //NOTE WE ONLY ALLOW USING SYMBOLS 
              //IN THE TEXT SECTION FOR NOW 
-             if(instance->is_relative){
-                 //want the linker to handle relocation
-                 if(e->section == SECTION_EXTERN){
-                     instance->is_relative = false;
-                     continue;
-                 } 
+             //the thread pointer offsets are only known to the linker
+             if(instance->is_relative && instance->reloc == SYMBOL_RELOC_DEFAULT){
                  //assume size of 4   
                  uint64_t next_instruction = instance->offset;
                  uint64_t rip_addr = e->section_offset;
                  //not sure if this is supposed to be signed or unsigned
                  int32_t rel_addr = (int32_t)(rip_addr - next_instruction);
-                 memcpy(&program.text.data[instance->offset - 4], &rel_addr, 4);
+                 memcpy(&ctx->program.text.data[instance->offset - 4], &rel_addr, 4);
              }
 
          }
      }
 
-     file_buffer_delete(current_fb);
+     trace_end(span);
+     if(ctx->stats != NULL){
+         ctx->stats->symbols += ctx->program.symTable.symbols.size;
+         ctx->stats->relocations += relocations;
+         stats_timer_stop(ctx->stats, STATS_RESOLVE, timer);
+     }
+}
+
+
+
+//checked before the output is opened so a bad type doesn't leave a stream behind
+static void check_file_type(BasmContext* ctx, BasmFileType ftype){
+    if(ftype != BASM_FILE_ELF && ftype != BASM_FILE_PE && ftype != BASM_FILE_ELF_EXEC){
+        program_fatal_error(ctx, "Unknown output file type\n");
+    }
+}
 
-     if(flags->ftype == BASM_FILE_ELF){
-        return write_elf(flags->input_file, flags->output_file, &program);
-     } else if(flags->ftype == BASM_FILE_PE){
-        return write_pe(flags->input_file, flags->output_file, &program);
+
+static bool program_write_format(BasmContext* ctx, const char* input_file, FILE* output_stream, BasmFileType ftype){
+     bool result = false;
+     TraceSpan span;
+     //executables have a single text section anyway
+     if((ctx->options & BASM_OPTION_FUNCTION_SECTIONS) && ftype != BASM_FILE_ELF_EXEC) text_function_sections(ctx);
+
+     if(ftype == BASM_FILE_ELF){
+        span = trace_begin("write_elf", input_file);
+        //only there while the object is written so writing it again gives the same sections
+        int section_count = ctx->program.sections.size;
+        result = !(ctx->options & BASM_OPTION_DEBUG_LINES) || program_add_debug_sections(&ctx->program, input_file, ctx->directory);
+        if(result) result = program_add_unwind_section(&ctx->program);
+        if(result) result = write_elf(&ctx->scratch, input_file, output_stream, &ctx->program);
+        program_remove_debug_sections(&ctx->program, section_count);
+     } else if(ftype == BASM_FILE_PE){
+        span = trace_begin("write_pe", input_file);
+        result = write_pe(&ctx->scratch, input_file, output_stream, &ctx->program);
+     } else if(ftype == BASM_FILE_ELF_EXEC){
+        span = trace_begin("write_elf_exec", input_file);
+        result = write_elf_exec(output_stream, &ctx->program);
      } else{
-        fprintf(stderr, "Unknown output file type\n");
         return false;
      }
+     trace_end(span);
+     return result;
+}
+
+
+static bool program_write(BasmContext* ctx, const char* input_file, FILE* output_stream, BasmFileType ftype){
+     if(ctx->stats == NULL) return program_write_format(ctx, input_file, output_stream, ftype);
+
+     StatsTimer timer = stats_timer_start();
+     bool result = program_write_format(ctx, input_file, output_stream, ftype);
+     stats_timer_stop(ctx->stats, STATS_WRITE, timer);
+
+     ctx->stats->text_bytes += ctx->program.text.size;
+     ctx->stats->data_bytes += ctx->program.data.size;
+     ctx->stats->bss_bytes += ctx->program.bss.size;
+     for(int i = 0; i < ctx->program.sections.size; i++){
+         ProgramSection* section = &array_list_get(ctx->program.sections, ProgramSection, i);
+         if(section->flags & SECTION_FLAG_NOBITS) ctx->stats->bss_bytes += section->bytes.size;
+         else ctx->stats->data_bytes += section->bytes.size;
+     }
+     return result;
+}
+
+
+
+//every public function has to set where fatal errors jump back to
+#define context_catch_errors(ctx, result) if(setjmp((ctx)->error_jmp) != 0) return result
+
+//and starts without the error of the call before
+#define context_enter(ctx, result) (ctx)->has_error = false; (ctx)->error[0] = '\0'; context_catch_errors(ctx, result)
+
+
+BasmContext* basm_context_create(){
+    BasmContext* ctx = calloc(1, sizeof(BasmContext));
+    if(ctx == NULL) return NULL;
+
+    if(!init_scratch_buffer(&ctx->scratch)){
+        free(ctx);
+        return NULL;
+    }
+
+    context_catch_errors(ctx, ctx);
+    array_list_create_cap(ctx->names, char*, 16);
+    array_list_create_cap(ctx->program.symTable.symbols, SymbolTableEntry, 16);
+    init_section(ctx, &ctx->program.text, 256);
+    ctx->input_name = "basm";
+    ctx->fusible_start = MAX_OFFSET;
+    return ctx;
+}
+
+
+void basm_context_delete(BasmContext* ctx){
+    if(ctx == NULL) return;
+    program_delete(ctx);
+    tokens_delete(&ctx->tokens);
+    file_buffer_delete(ctx->fb);
+    for(int i = 0; i < ctx->names.size; i++){
+        free(array_list_get(ctx->names, char*, i));
+    }
+    free(ctx->names.data);
+    free(ctx->moved_instances.data);
+    scratch_buffer_delete(&ctx->scratch);
+    free(ctx);
+}
+
+
+void basm_context_set_options(BasmContext* ctx, uint32_t options){
+    ctx->options = options;
+}
+
+
+bool context_set_directory(BasmContext* ctx, const char* directory){
+    context_enter(ctx, false);
+    ctx->directory = context_copy_name(ctx, directory);
+    return true;
+}
+
+
+const char* basm_context_error(BasmContext* ctx){
+    return (ctx->has_error) ? ctx->error : NULL;
+}
+
+
+//the file buffer has to be set before calling this
+static bool context_assemble_file(BasmContext* ctx){
+    context_catch_errors(ctx, false);
+
+    uint32_t first_token = ctx->tokens.size;
+    StatsTimer timer;
+    if(ctx->stats != NULL) timer = stats_timer_start();
+
+    TraceSpan span = trace_begin("tokenize_file", ctx->input_name);
+    tokenize_file(ctx); 
+    trace_end(span);
+
+    if(ctx->stats != NULL){
+        stats_timer_stop(ctx->stats, STATS_TOKENIZE, timer);
+        ctx->stats->tokens += ctx->tokens.size - first_token;
+        timer = stats_timer_start();
+    }
+
+    span = trace_begin("parse_tokens", ctx->input_name);
+    parse_tokens(ctx, first_token);
+    trace_end(span);
+
+    if(ctx->stats != NULL) stats_timer_stop(ctx->stats, STATS_PARSE, timer);
+
+    file_buffer_delete(ctx->fb);
+    ctx->fb = NULL;
+    return true;
+}
+
+
+bool basm_assemble_source(BasmContext* ctx, const char* name, const char* source, size_t size){
+    context_enter(ctx, false);
+    ctx->input_name = context_copy_name(ctx, name);
+    ctx->fb = file_buffer_create_from_memory(name, source, size);
+    if(ctx->fb == NULL) program_fatal_error(ctx, "Failed to read %s\n", name);
+    return context_assemble_file(ctx);
+}
+
+
+bool basm_assemble_file(BasmContext* ctx, const char* input_file){
+    context_enter(ctx, false);
+    ctx->input_name = context_copy_name(ctx, input_file);
+    ctx->fb = file_buffer_create(context_path(ctx, input_file));
+    if(ctx->fb == NULL) program_fatal_error(ctx, "Failed to open file: %s\n", input_file);
+    return context_assemble_file(ctx);
+}
+
+
+static bool assemble_file_uncached(AssemblerFlags* flags, const char* input_file, const char* output_file){
+     if(flags->client_socket != NULL){
+         return client_assemble_file(flags->client_socket, input_file, output_file, flags->ftype, flags->options);
+     }
+
+     BasmContext* ctx = basm_context_create();
+     if(ctx == NULL) return false;
+     basm_context_set_options(ctx, flags->options);
+
+     TraceSpan span = trace_begin("assemble_file", input_file);
+     Stats stats = {0};
+     if(flags->stats) ctx->stats = &stats;
+     ArrayList listing = {0};
+     if(flags->listing_file != NULL){
+         array_list_create_cap(listing, ListingLine, 256);
+         ctx->listing = &listing;
+     }
+
+     bool result = basm_assemble_file(ctx, input_file);
+     if(result){
+         result = basm_write_object(ctx, flags->ftype, output_file) ;
+     }
+     if(result && flags->listing_file != NULL){
+         result = write_listing(flags->listing_file, input_file, &ctx->program, &listing);
+     }
+     free(listing.data);
+
+     if(ctx->has_error) fprintf(stderr, "%s", ctx->error);
+     basm_context_delete(ctx);
+     trace_end(span);
+
+     if(flags->stats){
+         stats.files = 1;
+         stats_add(&stats);
+     }
+     return result;
+}
+
+
+#define DEFAULT_CACHE_SIZE (1024ULL * 1024 * 1024)
+
+static bool assemble_file(AssemblerFlags* flags, const char* input_file, const char* output_file){
+    //a cache hit wouldn't have the lines of the listing
+    if(flags->cache_dir == NULL || flags->listing_file != NULL) return assemble_file_uncached(flags, input_file, output_file);
+
+    size_t size;
+    char* source = read_file(input_file, &size);
+    if(source == NULL){
+        fprintf(stderr, "Failed to open file: %s\n", input_file);
+        return false;
+    }
+
+    CacheKey key = cache_key(flags, input_file, source, size);
+    free(source);
+
+    bool executable = flags->ftype == BASM_FILE_ELF_EXEC;
+    TraceSpan span = trace_begin("cache_fetch", input_file);
+    bool hit = cache_fetch(flags->cache_dir, key, output_file, executable);
+    trace_end(span);
+    if(hit){
+        if(flags->stats){
+            Stats stats = {.files = 1, .cache_hits = 1};
+            stats_add(&stats);
+        }
+        return true;
+    }
+
+    if(!assemble_file_uncached(flags, input_file, output_file)) return false;
+
+    //read back what was written, it's still in the page cache
+    char* object = read_file(output_file, &size);
+    if(object != NULL){
+        uint64_t max_size = (flags->cache_size != 0) ? flags->cache_size : DEFAULT_CACHE_SIZE;
+        cache_store(flags->cache_dir, key, object, size, max_size);
+        free(object);
+    }
+    return true;
+}
+
+
+
+typedef struct {
+    AssemblerFlags* flags;
+    char** outputs;
+    bool* results;
+} BatchJob;
+
+
+static void batch_assemble_file(void* arg, uint32_t task){
+    BatchJob* job = arg;
+    job->results[task] = assemble_file(job->flags, job->flags->input_files[task], job->outputs[task]);
+}
+
+
+//output_dir/name.o for input/dir/name.asm
+static char* batch_output_name(const char* output_dir, const char* input_file, BasmFileType ftype){
+    const char* name = strrchr(input_file, '/');
+    name = (name != NULL) ? name + 1 : input_file;
+
+    const char* ext = strrchr(name, '.');
+    int name_len = (ext != NULL && ext != name) ? (int)(ext - name) : (int)strlen(name);
+
+    const char* new_ext = "";
+    if(ftype == BASM_FILE_ELF) new_ext = ".o";
+    if(ftype == BASM_FILE_PE) new_ext = ".obj";
+
+    if(output_dir == NULL) output_dir = ".";
+    size_t size = strlen(output_dir) + name_len + strlen(new_ext) + 2;
+    char* output = malloc(size);
+    if(output != NULL) snprintf(output, size, "%s/%.*s%s", output_dir, name_len, name, new_ext);
+    return output;
+}
+
+
+static int compare_names(const void* p1, const void* p2){
+    return strcmp(*(char* const*)p1, *(char* const*)p2);
+}
+
+
+//two inputs with the same name would be written to the same object at the same time
+static bool batch_has_duplicate_outputs(char** outputs, int count){
+    char** sorted = malloc(sizeof(char*) * count);
+    if(sorted == NULL) return true;
+    memcpy(sorted, outputs, sizeof(char*) * count);
+    qsort(sorted, count, sizeof(char*), compare_names);
+
+    bool duplicate = false;
+    for(int i = 1; i < count; i++){
+        if(strcmp(sorted[i - 1], sorted[i]) == 0){
+            fprintf(stderr, "Error: More than one input is written to %s\n", sorted[i]);
+            duplicate = true;
+        }
+    }
+    free(sorted);
+    return duplicate;
+}
+
+
+
+static bool assemble_batch(AssemblerFlags* flags){
+    if(flags->output_dir != NULL && mkdir(flags->output_dir, 0755) != 0 && errno != EEXIST){
+        fprintf(stderr, "Error: Failed to create directory %s\n", flags->output_dir);
+        return false;
+    }
+
+    int count = flags->input_count;
+    BatchJob job = {flags, calloc(count, sizeof(char*)), calloc(count, sizeof(bool))};
+    bool result = job.outputs != NULL && job.results != NULL;
+
+    for(int i = 0; result && i < count; i++){
+        job.outputs[i] = batch_output_name(flags->output_dir, flags->input_files[i], flags->ftype);
+        result = job.outputs[i] != NULL;
+    }
+
+    if(result && !batch_has_duplicate_outputs(job.outputs, count)){
+        int jobs = flags->jobs;
+        if(jobs <= 0) jobs = (int)sysconf(_SC_NPROCESSORS_ONLN);
+
+        result = thread_pool_run(jobs, count, batch_assemble_file, &job);
+        for(int i = 0; i < count; i++){
+            result = result && job.results[i];
+        }
+    } else{
+        result = false;
+    }
+
+    if(job.outputs != NULL){
+        for(int i = 0; i < count; i++) free(job.outputs[i]);
+    }
+    free(job.outputs);
+    free(job.results);
+    return result;
+}
+
+
+
+bool basm_assemble_program(AssemblerFlags* flags){
+    if(flags->disasm) return basm_disassemble_file(flags->input_file, flags->output_file, flags->stats);
+
+    StatsTimer run = stats_timer_start();
+    if(flags->trace_file != NULL) trace_start();
+
+    bool result;
+    if(flags->input_count > 1 || (flags->input_count == 1 && flags->output_dir != NULL)){
+        result = assemble_batch(flags);
+    } else{
+        result = assemble_file(flags, flags->input_file, flags->output_file);
+    }
+
+    if(flags->stats) stats_report(stderr, run, flags->stats_json);
+    if(flags->trace_file != NULL){
+        if(!trace_write(flags->trace_file)) result = false;
+        trace_stop();
+    }
+    return result;
+}
+
+
+
+BasmJit* basm_jit_assemble(const char* source, size_t size, BasmJitOptions* options){
+     BasmContext* ctx = basm_context_create();
+     if(ctx == NULL) return NULL;
+
+     BasmJit* jit = NULL;
+     if(basm_assemble_source(ctx, "jit", source, size)){
+         jit = basm_jit_load(ctx, options);
+     }
+
+     if(ctx->has_error && options != NULL) snprintf(options->error, sizeof(options->error), "%s", ctx->error);
+     basm_context_delete(ctx);
+     return jit;
+}
+
+
+
+
+_Static_assert((int)BASM_REG_MAX == (int)REG_MAX, "BasmRegister doesn't match RegisterType");
+
+
+BasmMnemonic basm_mnemonic(const char* name){
+    const struct Keyword* kw = find_keyword(name, strlen(name));
+    if(kw == NULL || kw->type != TOK_INSTRUCTION) return -1;
+    return (BasmMnemonic)(kw - KEYWORD_TABLE);
+}
+
+
+static void builder_operand(BasmContext* ctx, const BasmOperand* op, Operand* result){
+    switch (op->kind) {
+        case BASM_OPERAND_REG:
+            if(op->reg >= BASM_REG_MAX) break;
+            *result = register_operand((RegisterType)op->reg);
+            return;
+        case BASM_OPERAND_IMM:
+            result->type = (op->imm < 0) ? OPERAND_SIGNED : OPERAND_IMM64;
+            result->imm64 = (uint64_t)op->imm;
+            return;
+        case BASM_OPERAND_LABEL:
+            result->type = OPERAND_L64;
+            result->label = context_copy_name(ctx, op->label);
+            return;
+        case BASM_OPERAND_MEM: {
+            OperandType mem_type = OPERAND_MEM_ANY;
+            switch (op->size) {
+                case 0: mem_type = OPERAND_MEM_ANY; break;
+                case 1: mem_type = OPERAND_M8; break;
+                case 2: mem_type = OPERAND_M16; break;
+                case 4: mem_type = OPERAND_M32; break;
+                case 8: mem_type = OPERAND_M64; break;
+                case 10: mem_type = OPERAND_M80; break;
+                case 16: mem_type = OPERAND_M128; break;
+                case 32: mem_type = OPERAND_M256; break;
+                default: 
+                    program_fatal_error(ctx, "Invalid memory size: %d\n", op->size);
+            }
+            *result = memory_operand(mem_type);
+
+            if(op->label != NULL){
+                result->mem.label = context_copy_name(ctx, op->label);
+                mem_set_label(result->mem);
+            } else{
+                result->mem.offset = op->offset;
+            }
+
+            OperandType base_size = OPERAND_NOP;
+            OperandType index_size = OPERAND_NOP;
+            if(op->reg != BASM_REG_MAX && !memory_set_register(result, (RegisterType)op->reg, false, &base_size)) break;
+            if(op->index != BASM_REG_MAX){
+                if(!memory_set_register(result, (RegisterType)op->index, true, &index_size)) break;
+                if(!memory_set_scale(result, op->scale == 0 ? 1 : op->scale)) break;
+            }
+            if(base_size != OPERAND_NOP && index_size != OPERAND_NOP && base_size != index_size) break;
+            return;
+        }
+        default:
+            break;
+    }
+    program_fatal_error(ctx, "Invalid operand\n");
 }
 
 
+bool basm_emit(BasmContext* ctx, BasmMnemonic mnemonic, int operand_count, const BasmOperand* operands){
+    context_enter(ctx, false);
+
+    if(mnemonic < 0 || mnemonic > MAX_HASH_VALUE || KEYWORD_TABLE[mnemonic].type != TOK_INSTRUCTION){
+        program_fatal_error(ctx, "Invalid mnemonic\n");
+    }
+    if(operand_count > 4){
+        program_fatal_error(ctx, "Too many operands\n");
+    }
+
+    Operand ops[4] = {0};
+    for(int i = 0; i < operand_count; i++){
+        builder_operand(ctx, &operands[i], &ops[i]);
+    }
+
+    if(!assemble_instruction(ctx, mnemonic, ops, operand_count)){
+        program_fatal_error(ctx, "Couldn't find instruction for nmemonic: %s\n", KEYWORD_TABLE[mnemonic].name);
+    }
+    return true;
+}
+
+
+bool basm_label(BasmContext* ctx, const char* name){
+    context_enter(ctx, false);
+    symbol_table_add(ctx, context_copy_name(ctx, name), ctx->program.text.size, SECTION_TEXT, VISIBILITY_LOCAL);
+    return true;
+}
+
+
+bool basm_global(BasmContext* ctx, const char* name){
+    context_enter(ctx, false);
+    symbol_table_add(ctx, context_copy_name(ctx, name), 0, SECTION_TEXT, VISIBILITY_GLOBAL);
+    return true;
+}
+
+
+bool basm_extern(BasmContext* ctx, const char* name){
+    context_enter(ctx, false);
+    symbol_table_add(ctx, context_copy_name(ctx, name), 0, SECTION_EXTERN, VISIBILITY_GLOBAL);
+    return true;
+}
+
+
+bool basm_data(BasmContext* ctx, const char* name, const void* data, size_t size){
+    context_enter(ctx, false);
+    init_section(ctx, &ctx->program.data, 64);
+    symbol_table_add(ctx, context_copy_name(ctx, name), ctx->program.data.size, SECTION_DATA, VISIBILITY_LOCAL);
+    section_add_data(ctx, &ctx->program.data, (void*)data, size);
+    return true;
+}
+
+
+bool basm_bss(BasmContext* ctx, const char* name, size_t size){
+    context_enter(ctx, false);
+    symbol_table_add(ctx, context_copy_name(ctx, name), ctx->program.bss.size, SECTION_BSS, VISIBILITY_LOCAL);
+    ctx->program.bss.size += size;
+    return true;
+}
+
+
+bool basm_write_object(BasmContext* ctx, BasmFileType ftype, const char* output_file){
+    context_enter(ctx, false);
+    check_file_type(ctx, ftype);
+    resolve_symbols(ctx);
+
+    const char* path = context_path(ctx, output_file);
+    FILE* output_stream = fopen(path, "wb");
+    if(output_stream == NULL) program_fatal_error(ctx, "Failed to create file %s\n", output_file);
+
+    bool result = program_write(ctx, ctx->input_name, output_stream, ftype);
+    if(fclose(output_stream) != 0) result = false;
+    if(result && ftype == BASM_FILE_ELF_EXEC) chmod(path, 0755);
+    return result;
+}
+
+
+bool basm_write_object_memory(BasmContext* ctx, BasmFileType ftype, uint8_t** data, size_t* size){
+    context_enter(ctx, false);
+    check_file_type(ctx, ftype);
+    resolve_symbols(ctx);
+
+    char* buffer = NULL;
+    size_t buffer_size = 0;
+    FILE* output_stream = open_memstream(&buffer, &buffer_size);
+    if(output_stream == NULL) program_fatal_error(ctx, "Out of memory\n");
+
+    bool result = program_write(ctx, ctx->input_name, output_stream, ftype);
+    if(fclose(output_stream) != 0) result = false;
+    if(!result){
+        free(buffer);
+        return false;
+    }
+    *data = (uint8_t*)buffer;
+    *size = buffer_size;
+    return true;
+}
+
+
+BasmJit* basm_jit_load(BasmContext* ctx, BasmJitOptions* options){
+    context_enter(ctx, NULL);
+    resolve_symbols(ctx);
+    BasmJit* jit = jit_load_program(&ctx->program, options, ctx->error, sizeof(ctx->error));
+    if(jit == NULL) ctx->has_error = true;
+    return jit;
+}
+
+
+
+/*
+ * Incremental assembly keeps the tokens of every source line, and the bytes and label uses of the instructions
+ * An instruction is encoded on its own at offset 0, so its bytes and the offsets of its fixups
+ * don't depend on where the line ends up (branches are always rel32 and memory labels disp32)
+ * What the other lines do depends on the lines before them (the section they are in, the merged
+ * constants, the flags of a section declared again) and they are cheap to parse, so they are parsed again
+ * with the same functions as a full assemble while the program is relinked
+ * After an update only the lines that changed are lexed and encoded again, then the program is relinked
+ * in source order by appending the bytes of every instruction and parsing the other lines
+ * The appended instructions go through place_instruction, so --align-branches pads them where they end up
+ * and --auto-cfi follows them in the frame the labels parsed before them opened
+ */
+typedef struct {
+    char* name; //points into the tokens of the line
+    uint64_t offset; //from the start of the line
+    bool is_relative;
+    uint8_t size; //of the field
+    uint8_t reloc; //SymbolReloc
+} LineSymbol;
+
+
+typedef struct {
+    char* text;
+    uint32_t length;
+    bool encoded;
+    bool is_instruction; //the line starts with an instruction, its bytes are kept
+
+    ArrayList tokens;
+    uint8_t* bytes;
+    uint64_t size;
+    ArrayList uses; //LineSymbol of the labels the instruction uses
+    InstructionInfo info;
+} IncrementalLine;
+
+
+struct BasmIncremental {
+    BasmContext* ctx;
+    char* name;
+    ArrayList lines;
+};
+
+
+
+static void incremental_line_clear(IncrementalLine* line){
+    tokens_delete(&line->tokens);
+    free(line->bytes);
+    free(line->uses.data);
+    line->bytes = NULL;
+    line->size = 0;
+    memset(&line->uses, 0, sizeof(ArrayList));
+    line->encoded = false;
+    line->is_instruction = false;
+}
+
+
+static void incremental_line_delete(IncrementalLine* line){
+    incremental_line_clear(line);
+    free(line->text);
+}
+
+
+//empties the program but keeps the memory of .text and .data around for the next line
+static void program_clear(BasmContext* ctx){
+    Program* program = &ctx->program;
+    for(int i = 0; i < program->symTable.symbols.size; i++){
+        SymbolTableEntry e = array_list_get(program->symTable.symbols, SymbolTableEntry, i);
+        free(e.instances.data);
+    }
+    program->symTable.symbols.size = 0;
+    program->subsections.size = 0;
+    program->text.size = 0;
+    program->data.size = 0;
+    program->bss.size = 0;
+    program->text.alignment = 0;
+    program->data.alignment = 0;
+    program->bss.alignment = 0;
+    init_section(ctx, &program->text, 256);
+    init_section(ctx, &program->data, 64);
+
+    //the user sections and the names of the sections come back when their section lines are parsed again
+    for(int i = 0; i < program->sections.size; i++){
+        free(array_list_get(program->sections, ProgramSection, i).bytes.data);
+    }
+    program->sections.size = 0;
+    for(int i = 0; i < ctx->names.size; i++){
+        free(array_list_get(ctx->names, char*, i));
+    }
+    ctx->names.size = 0;
+
+    program->line_program.size = 0;
+    program->cfi_frames.size = 0;
+    program->cfi_rules.size = 0;
+    memset(&ctx->cfi, 0, sizeof(ctx->cfi));
+    if(ctx->constants != NULL) memset(ctx->constants, 0, ctx->constant_capacity * sizeof(MergedConstant));
+    ctx->constant_count = 0;
+    stop_branch_fusing(ctx);
+}
+
+
+//copies the labels the instruction used out of the scratch symbol table
+static void incremental_line_uses(BasmContext* ctx, IncrementalLine* line){
+    array_list_create_cap(line->uses, LineSymbol, 2);
+    for(int i = 0; i < ctx->program.symTable.symbols.size; i++){
+        SymbolTableEntry e = array_list_get(ctx->program.symTable.symbols, SymbolTableEntry, i);
+        for(int j = 0; j < e.instances.size; j++){
+            SymbolInstance instance = array_list_get(e.instances, SymbolInstance, j);
+            LineSymbol use = {e.name, instance.offset, instance.is_relative, instance.size, instance.reloc};
+            array_list_append(line->uses, LineSymbol, use);
+        }
+    }
+}
+
+
+static bool incremental_encode_line(BasmIncremental* inc, IncrementalLine* line, uint32_t line_index){
+    BasmContext* ctx = inc->ctx;
+    incremental_line_clear(line);
+    context_catch_errors(ctx, false);
+
+    //left behind if the last line failed
+    tokens_delete(&ctx->tokens);
+    file_buffer_delete(ctx->fb);
+
+    program_clear(ctx);
+    ctx->line_offset = line_index;
+    ctx->fb = file_buffer_create_from_memory(inc->name, line->text, line->length);
+    if(ctx->fb == NULL) program_fatal_error(ctx, "Out of memory\n");
+
+    array_list_create_cap(ctx->tokens, Token, 8);
+    tokenize_file(ctx);
+    line->tokens = ctx->tokens;
+    memset(&ctx->tokens, 0, sizeof(ArrayList));
+
+    if(line->tokens.size > 0){
+        line->is_instruction = array_list_get(line->tokens, Token, 0).type == TOK_INSTRUCTION;
+        //stops the section parsers at the end of the line
+        Token end = {TOK_SECTION, 0, 0, 0};
+        array_list_append(line->tokens, Token, end);
+    }
+
+    if(line->is_instruction){
+        Parser p = {0};
+        p.ctx = ctx;
+        p.tokens = &line->tokens;
+        p.currentToken.type = TOK_MAX;
+        if(setjmp(p.jmp) == 0){
+            parser_next_token(&p);
+            line->info = parse_instruction(&p);
+            parser_expect_consume_token(&p, TOK_NEW_LINE);
+        }
+
+        line->size = ctx->program.text.size;
+        line->bytes = malloc(line->size);
+        if(line->bytes == NULL) program_fatal_error(ctx, "Out of memory\n");
+        memcpy(line->bytes, ctx->program.text.data, line->size);
+        incremental_line_uses(ctx, line);
+    }
+
+    file_buffer_delete(ctx->fb);
+    ctx->fb = NULL;
+    line->encoded = true;
+    return true;
+}
+
+
+//parses a line that isn't an instruction into the program linked so far, returns the section the next line is in
+static uint8_t incremental_parse_line(BasmContext* ctx, IncrementalLine* line, uint8_t section){
+    Parser p = {0};
+    p.ctx = ctx;
+    p.tokens = &line->tokens;
+    p.currentToken.type = TOK_MAX;
+
+    volatile uint8_t next = section;
+    if(setjmp(p.jmp) == 0){
+        parser_next_token(&p);
+        if(p.currentToken.type == TOK_SECTION){
+            parser_next_token(&p);
+            next = parse_section_line(&p);
+        } else if(section == SECTION_UNDEFINED){
+            parser_fatal_error(&p, "Expected Section got %s\n", token_to_string(p.currentToken.type));
+        } else{
+            parse_section_body(&p, section);
+        }
+    }
+    return next;
+}
+
+
+//lines from line_count on are left out, the frames still open at the end are only checked when all of them are linked
+static void incremental_link(BasmIncremental* inc, int line_count){
+    BasmContext* ctx = inc->ctx;
+    program_clear(ctx);
+
+    uint8_t section = SECTION_UNDEFINED;
+    for(int i = 0; i < line_count; i++){
+        IncrementalLine* line = &array_list_get(inc->lines, IncrementalLine, i);
+        if(line->tokens.size == 0) continue;
+        ctx->line_offset = i;
+
+        //an instruction outside of a text section is parsed again for the error
+        if(line->is_instruction && section == SECTION_TEXT){
+            uint64_t start = ctx->program.text.size;
+            for(int j = 0; j < line->uses.size; j++){
+                LineSymbol use = array_list_get(line->uses, LineSymbol, j);
+                symbol_table_add_instance(ctx, use.name, start + use.offset, use.is_relative, SECTION_TEXT, use.size, use.reloc);
+            }
+            section_add_data(ctx, &ctx->program.text, line->bytes, line->size);
+            place_instruction(ctx, &line->info, start);
+            continue;
+        }
+
+        ctx->line_text = line->text;
+        section = incremental_parse_line(ctx, line, section);
+        ctx->line_text = NULL;
+    }
+
+    ctx->line_offset = 0;
+    if(line_count == inc->lines.size) cfi_close_program(ctx);
+}
+
+
+
+BasmIncremental* basm_incremental_create(const char* name){
+    BasmIncremental* inc = calloc(1, sizeof(BasmIncremental));
+    if(inc == NULL) return NULL;
+
+    inc->ctx = basm_context_create();
+    inc->name = strdup(name);
+    if(inc->ctx == NULL || inc->name == NULL){
+        basm_incremental_delete(inc);
+        return NULL;
+    }
+    inc->ctx->input_name = inc->name;
+    array_list_create_cap(inc->lines, IncrementalLine, 64);
+    return inc;
+}
+
+
+void basm_incremental_delete(BasmIncremental* inc){
+    if(inc == NULL) return;
+    for(int i = 0; i < inc->lines.size; i++){
+        incremental_line_delete(&array_list_get(inc->lines, IncrementalLine, i));
+    }
+    free(inc->lines.data);
+    basm_context_delete(inc->ctx);
+    free(inc->name);
+    free(inc);
+}
+
+
+BasmContext* basm_incremental_context(BasmIncremental* inc){
+    return inc->ctx;
+}
+
+
+static bool line_equals(IncrementalLine* line, const char* text, uint32_t length){
+    return line->length == length && memcmp(line->text, text, length) == 0;
+}
+
+
+bool basm_incremental_update(BasmIncremental* inc, const char* source, size_t size){
+    BasmContext* ctx = inc->ctx;
+    ctx->line_text = NULL;
+    context_enter(ctx, false);
+
+    //split the new source into lines
+    ArrayList new_lines;
+    array_list_create_cap(new_lines, IncrementalLine, inc->lines.size + 16);
+    for(size_t start = 0; start < size;){
+        const char* end = memchr(source + start, '\n', size - start);
+        size_t length = (end != NULL) ? (size_t)(end - source) - start : size - start;
+        IncrementalLine line = {0};
+        line.text = (char*)source + start;
+        line.length = length;
+        array_list_append(new_lines, IncrementalLine, line);
+        start += length + 1;
+    }
+
+    //lines before and after the edit keep their records
+    int old_count = inc->lines.size;
+    int new_count = new_lines.size;
+    int prefix = 0;
+    while(prefix < old_count && prefix < new_count){
+        IncrementalLine* line = &array_list_get(new_lines, IncrementalLine, prefix);
+        if(!line_equals(&array_list_get(inc->lines, IncrementalLine, prefix), line->text, line->length)) break;
+        prefix++;
+    }
+    int suffix = 0;
+    while(suffix < old_count - prefix && suffix < new_count - prefix){
+        IncrementalLine* line = &array_list_get(new_lines, IncrementalLine, new_count - suffix - 1);
+        if(!line_equals(&array_list_get(inc->lines, IncrementalLine, old_count - suffix - 1), line->text, line->length)) break;
+        suffix++;
+    }
+
+    //copy the changed lines before touching the old records so running out of memory leaves them intact
+    for(int i = prefix; i < new_count - suffix; i++){
+        IncrementalLine* line = &array_list_get(new_lines, IncrementalLine, i);
+        char* text = malloc(line->length + 1);
+        if(text == NULL){
+            for(int j = prefix; j < i; j++) free(array_list_get(new_lines, IncrementalLine, j).text);
+            free(new_lines.data);
+            program_fatal_error(ctx, "Out of memory\n");
+        }
+        memcpy(text, line->text, line->length);
+        text[line->length] = '\0';
+        line->text = text;
+    }
+
+    for(int i = prefix; i < old_count - suffix; i++){
+        incremental_line_delete(&array_list_get(inc->lines, IncrementalLine, i));
+    }
+    for(int i = 0; i < prefix; i++){
+        array_list_get(new_lines, IncrementalLine, i) = array_list_get(inc->lines, IncrementalLine, i);
+    }
+    for(int i = 0; i < suffix; i++){
+        array_list_get(new_lines, IncrementalLine, new_count - suffix + i) = array_list_get(inc->lines, IncrementalLine, old_count - suffix + i);
+    }
+    free(inc->lines.data);
+    inc->lines = new_lines;
+
+    int failed_line = -1;
+    for(int i = 0; i < inc->lines.size && failed_line < 0; i++){
+        IncrementalLine* line = &array_list_get(inc->lines, IncrementalLine, i);
+        if(!line->encoded && !incremental_encode_line(inc, line, i)) failed_line = i;
+    }
+
+    //the lines parsed while linking report their errors from here
+    context_catch_errors(ctx, false);
+    if(failed_line < 0){
+        incremental_link(inc, inc->lines.size);
+        return true;
+    }
+
+    //an error in an earlier line is what a full assemble would have reported
+    char error[sizeof(ctx->error)];
+    memcpy(error, ctx->error, sizeof(error));
+    incremental_link(inc, failed_line);
+    memcpy(ctx->error, error, sizeof(error));
+    ctx->has_error = true;
+    return false;
+}
+
 
 
 bool basm_parse_flags(AssemblerFlags* flags, int argc, char** argv){
@@ -1962,6 +4098,10 @@ bool basm_parse_flags(AssemblerFlags* flags, int argc, char** argv){
         return false;
     }
     flags->output_file = "a.out";
+    flags->input_files = malloc(sizeof(char*) * argc);
+    flags->input_count = 0;
+    if(flags->input_files == NULL) return false;
+    bool has_output = false;
 
     for(int i = 1; i < argc; i++){
         if(strcmp("-f", argv[i]) == 0){
@@ -1974,6 +4114,8 @@ bool basm_parse_flags(AssemblerFlags* flags, int argc, char** argv){
                 flags->ftype = BASM_FILE_PE;
             } else if (strcmp("elf", argv[i]) == 0) { 
                 flags->ftype = BASM_FILE_ELF;
+            } else if (strcmp("elfexe", argv[i]) == 0) { 
+                flags->ftype = BASM_FILE_ELF_EXEC;
             } else{
                 fprintf(stderr, "Invalid File Type: %s\n", argv[i]);
                 return false;
@@ -1985,20 +4127,143 @@ bool basm_parse_flags(AssemblerFlags* flags, int argc, char** argv){
                 return false;
             }
             flags->output_file = argv[i];
+            has_output = true;
              
+        } else if (strcmp("-l", argv[i]) == 0) {
+            i++;
+            if(i == argc){
+                fprintf(stderr, "Listing file not specified\n");
+                return false;
+            }
+            flags->listing_file = argv[i];
+
+        } else if (strcmp("-j", argv[i]) == 0) {
+            i++;
+            if(i == argc || atoi(argv[i]) <= 0){
+                fprintf(stderr, "Invalid job count\n");
+                return false;
+            }
+            flags->jobs = atoi(argv[i]);
+
+        } else if (strcmp("--outdir", argv[i]) == 0) {
+            i++;
+            if(i == argc){
+                fprintf(stderr, "Output directory not specified\n");
+                return false;
+            }
+            flags->output_dir = argv[i];
+
+        } else if (strcmp("--serve", argv[i]) == 0) {
+            i++;
+            if(i == argc){
+                fprintf(stderr, "Socket path not specified\n");
+                return false;
+            }
+            flags->serve_socket = argv[i];
+
+        } else if (strcmp("--client", argv[i]) == 0) {
+            i++;
+            if(i == argc){
+                fprintf(stderr, "Socket path not specified\n");
+                return false;
+            }
+            flags->client_socket = argv[i];
+
+        } else if (strcmp("--cache-dir", argv[i]) == 0) {
+            i++;
+            if(i == argc){
+                fprintf(stderr, "Cache directory not specified\n");
+                return false;
+            }
+            flags->cache_dir = argv[i];
+
+        } else if (strcmp("--cache-size", argv[i]) == 0) {
+            i++;
+            if(i == argc || atoll(argv[i]) <= 0){
+                fprintf(stderr, "Invalid cache size\n");
+                return false;
+            }
+            flags->cache_size = (uint64_t)atoll(argv[i]) * 1024 * 1024;
+
+        } else if (strcmp("--trace", argv[i]) == 0) {
+            i++;
+            if(i == argc){
+                fprintf(stderr, "Trace file not specified\n");
+                return false;
+            }
+            flags->trace_file = argv[i];
+
+        } else if (strcmp("--align-branches", argv[i]) == 0) {
+            flags->options |= BASM_OPTION_ALIGN_BRANCHES;
+
+        } else if (strcmp("--function-sections", argv[i]) == 0) {
+            flags->options |= BASM_OPTION_FUNCTION_SECTIONS;
+
+        } else if (strcmp("--merge-constants", argv[i]) == 0) {
+            flags->options |= BASM_OPTION_MERGE_CONSTANTS;
+
+        } else if (strcmp("-g", argv[i]) == 0) {
+            flags->options |= BASM_OPTION_DEBUG_LINES;
+
+        } else if (strcmp("--auto-cfi", argv[i]) == 0) {
+            flags->options |= BASM_OPTION_AUTO_CFI;
+
+        } else if (strcmp("--disasm", argv[i]) == 0) {
+            flags->disasm = true;
+
+        } else if (strcmp("--stats", argv[i]) == 0) {
+            flags->stats = true;
+
+        } else if (strcmp("--stats=json", argv[i]) == 0) {
+            flags->stats = true;
+            flags->stats_json = true;
+
         } else if(string_cmp_lower("--help", argv[i]) == 0){
             basm_help();
             return false;
         }else{
-            flags->input_file = argv[i];
+            flags->input_files[flags->input_count++] = argv[i];
         }
     }
+
+    if(flags->serve_socket != NULL) return true;
+
+    if(flags->input_count == 0){
+        fprintf(stderr, "Input file not specified\n");
+        return false;
+    }
+    if(has_output && (flags->input_count > 1 || flags->output_dir != NULL)){
+        fprintf(stderr, "-o only works with a single input file, use --outdir instead\n");
+        return false;
+    }
+    if(flags->listing_file != NULL && (flags->input_count > 1 || flags->output_dir != NULL || flags->client_socket != NULL)){
+        fprintf(stderr, "-l only works with a single input file assembled in this process\n");
+        return false;
+    }
+    flags->input_file = flags->input_files[0];
+    //the listing goes to stdout unless there is an output file
+    if(flags->disasm && !has_output) flags->output_file = NULL;
     return true;
 }
 
 void basm_help(){
-    printf("./basm input_file\n");
+    printf("./basm input_file...\n");
     printf("Flags: \n");
-    printf("-f (file type)        -> win | elf\n");
+    printf("-f (file type)        -> win | elf | elfexe\n");
     printf("-o (output file name) -> output file\n");
+    printf("-l (listing file)     -> write the source with the offset and bytes of every line\n");
+    printf("-g                    -> add a dwarf .debug_line to elf objects that maps the code to the source lines\n");
+    printf("-j (jobs)             -> number of files assembled at the same time, defaults to the core count\n");
+    printf("--outdir (directory)  -> directory for the objects when assembling more than one file\n");
+    printf("--serve (socket)      -> run as a server that assembles files for basm --client, the socket is only open to the user\n");
+    printf("--client (socket)     -> send the files to a basm server instead of assembling them here\n");
+    printf("--cache-dir (dir)     -> reuse the objects of files that haven't changed\n");
+    printf("--cache-size (MB)     -> size limit of the cache, defaults to 1024\n");
+    printf("--stats[=json]        -> print the time spent in each phase and counters to stderr\n");
+    printf("--trace (file)        -> write a chrome trace of the phases of every file\n");
+    printf("--align-branches      -> keep branches and fused cmp/test + jcc pairs inside 32 byte blocks\n");
+    printf("--function-sections   -> put the code of every global label in .text in its own .text.<label> section\n");
+    printf("--merge-constants     -> move strings and constants out of read only sections into ones the linker merges\n");
+    printf("--auto-cfi            -> give every global label in .text an .eh_frame entry worked out from its prologue\n");
+    printf("--disasm              -> write an elf object or executable back as basm source\n");
 }
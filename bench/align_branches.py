@@ -0,0 +1,240 @@
+"""
+Checks that --align-branches keeps every branch and fused cmp/test + jcc pair inside 32 bytes without changing what the code does
+
+Functions with runs of nops, runs of cmp/test against memory labels that end in a jcc, branches to local labels,
+calls to other functions and externs, `align` directives and switches to a named subsection are assembled with and
+without --align-branches (and the same again with --function-sections). In the padded object no branch or fused pair
+may cross or end on a 32 byte boundary of its section, every instruction has to keep the bytes of the plain one,
+every relocation has to be at the same place in the same instruction, and every branch has to go to the same line.
+Each section of the object is placed on its own by the linker, so the boundaries are counted from the start of the section
+"""
+import argparse
+import os
+import random
+import struct
+import subprocess
+import sys
+import tempfile
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import debug_line
+
+FLAG_SETS = [[], ["--function-sections"]]
+BOUNDARY = 32
+JCC = ["je", "jne", "jl", "jg", "jle", "jge", "jb", "ja"]
+TABLES = 16
+EXTERNS = 4
+
+
+#lines of (text, kind), kind is "fusible" for cmp/test, "branch" for a jcc, jmp, call or ret, "align" for align and None for the rest
+def write_function(rng, lines, index, functions):
+    name = "func_%d" % index
+    if index % 4 == 0:
+        lines.append(("global %s" % name, None))
+    lines.append(("%s:" % name, None))
+    #declared after its label it stays in the section before with --function-sections and --align-branches
+    if index % 4 == 2:
+        lines.append(("global %s" % name, None))
+    blocks = rng.randint(3, 8)
+    for b in range(blocks):
+        lines.append(("%s_l%d:" % (name, b), None))
+        for _ in range(rng.randint(1, 4)):
+            roll = rng.random()
+            if roll < 0.25:
+                lines += [("    nop", None)] * rng.randint(1, 20)
+            elif roll < 0.45:
+                #a run of cmps that each could fuse with the jcc, only the last one does
+                for _ in range(rng.randint(1, 12)):
+                    lines.append(("    cmp rax, [x%d]" % rng.randrange(TABLES), "fusible"))
+                lines.append(("    %s %s_l%d" % (rng.choice(JCC), name, rng.randrange(blocks)), "branch"))
+            elif roll < 0.6:
+                lines.append(("    test rcx, rdx", "fusible"))
+                lines.append(("    %s %s_l%d" % (rng.choice(JCC), name, rng.randrange(blocks)), "branch"))
+            elif roll < 0.7:
+                #what align placed can't move
+                lines.append(("    cmp rax, rbx", "fusible"))
+                lines.append(("    align %d" % rng.choice([4, 8, 16]), "align"))
+                lines.append(("    %s %s_l%d" % (rng.choice(JCC), name, rng.randrange(blocks)), "branch"))
+            elif roll < 0.8:
+                lines.append(("    mov rax, [x%d]" % rng.randrange(TABLES), None))
+                lines.append(("    call %s" % rng.choice(["ext_%d" % rng.randrange(EXTERNS), "func_%d" % rng.randrange(functions)]), "branch"))
+            elif roll < 0.9:
+                lines.append(("    lea rsi, [rdi + %d]" % rng.randrange(1, 200), None))
+                lines.append(("    jmp %s_l%d" % (name, rng.randrange(blocks)), "branch"))
+            else:
+                lines.append(("    add rax, 1", None))
+    lines.append(("    ret", "branch"))
+
+
+def write_corpus(rng, path, functions):
+    lines = [("section .data", None)] + [("x%d: dq %d" % (i, i), None) for i in range(TABLES)]
+    lines += [("section .text", None)] + [("extern ext_%d" % i, None) for i in range(EXTERNS)]
+    for i in range(functions):
+        #a cmp at the end of one subsection doesn't fuse with a jcc at the start of the next
+        if i % 7 == 3:
+            lines.append(("section .text.hot", None))
+            lines.append(("    cmp rax, rbx", "fusible"))
+            lines.append(("section .text", None))
+            lines.append(("    jne func_%d_l0" % i, "jump_in"))
+        write_function(rng, lines, i, functions)
+    with open(path, "w") as out:
+        out.write("".join(text + "\n" for text, _ in lines))
+    #source line -> kind, the jump_in line of above is a branch that can't fuse
+    return {number: ("branch" if kind == "jump_in" else kind) for number, (text, kind) in enumerate(lines, 1) if text.startswith("    ")}, \
+           {number for number, (text, kind) in enumerate(lines, 1) if lines[number - 2][1] == "fusible" and kind == "branch"}
+
+
+#line -> (merged .text offset, bytes) of the listing, the padding in front of an instruction is part of its line
+def read_listing(listing, lines):
+    offsets = {}
+    with open(listing) as f:
+        for line in f:
+            fields = line.split()
+            if line.startswith("label "):
+                break
+            if len(fields) < 2 or not fields[0].isdigit() or int(fields[0]) not in lines:
+                continue
+            #long instructions go on in rows with the same line number
+            size = len(line[18:40].strip().rstrip("-")) // 2
+            start, previous = offsets.get(int(fields[0]), (int(fields[1], 16), 0))
+            offsets[int(fields[0])] = (start, previous + size)
+    return offsets
+
+
+#the .text sections in the order they were split from the merged text, their start in it and the relocations by merged offset
+def read_object(obj):
+    sections = debug_line.elf_section_list(obj)
+    by_name = dict(sections)
+    symtab, strtab = by_name[".symtab"], by_name[".strtab"]
+    symbols = []
+    for i in range(0, len(symtab), 24):
+        name, _, _, shndx = struct.unpack_from("<IBBH", symtab, i)
+        symbols.append((strtab[name:strtab.index(b"\0", name)].decode() or sections[shndx][0], shndx))
+    #every piece of a section switched back to has its own .rela with the same name, sh_info says which one it is for
+    with open(obj, "rb") as f:
+        data = f.read()
+    shoff, = struct.unpack_from("<Q", data, 0x28)
+    shentsize, = struct.unpack_from("<H", data, 0x3A)
+    rela_of = {}
+    for index, (name, rela) in enumerate(sections):
+        if name.startswith(".rela"):
+            rela_of[struct.unpack_from("<I", data, shoff + index * shentsize + 0x2C)[0]] = rela
+
+    text, starts, piece_start, fixups = b"", [], {}, []
+    for index, (name, data) in enumerate(sections):
+        if not name.startswith(".text"):
+            continue
+        starts.append((len(text), name))
+        piece_start[index] = len(text)
+        rela = rela_of.get(index, b"")
+        for i in range(0, len(rela), 24):
+            offset, info, addend = struct.unpack_from("<QQq", rela, i)
+            fixups.append((len(text) + offset, info & 0xFFFFFFFF, info >> 32, addend))
+        text += data
+
+    #a relocation against the text itself is the merged offset it points to, the addend moves with the padding
+    relocations = {}
+    for offset, kind, symbol, addend in fixups:
+        name, shndx = symbols[symbol]
+        if shndx in piece_start:
+            relocations[offset] = (kind, name, None, piece_start[shndx] + addend + (4 if kind in (2, 4) else 0))
+        else:
+            relocations[offset] = (kind, name, addend, None)
+    return text, starts, relocations
+
+
+#(line, offset in the instruction) -> relocation, the bytes of every instruction and the line every branch goes to
+def describe(text, offsets, relocations, lines, lengths):
+    order = sorted(offsets, key=lambda line: (offsets[line][0], line))
+    ends = {line: sum(offsets[line]) for line in order}
+    #align fills a different gap once branches are padded
+    starts = {line: offsets[line][0] if lines[line] == "align" else ends[line] - lengths[line] for line in order}
+    first_at = {}
+    for line in order:
+        first_at.setdefault(offsets[line][0], line)
+
+    #a branch to another section of the text has a relocation, the same branch inside one doesn't
+    fields, instructions, targets = {}, {}, {}
+    for line in order:
+        code = bytearray(text[starts[line]:ends[line]])
+        relative = lines[line] != "align" and len(code) >= 5 and (code[0] in (0xE8, 0xE9) or (code[0] == 0x0F and 0x80 <= code[1] <= 0x8F))
+        for offset in range(starts[line], ends[line]):
+            if offset not in relocations:
+                continue
+            kind, name, addend, target = relocations[offset]
+            code[offset - starts[line]:offset - starts[line] + 4] = bytes(4)
+            if target is None:
+                fields[(line, offset - starts[line])] = (kind, name, addend)
+            elif relative and offset == ends[line] - 4:
+                targets[line] = first_at.get(target, "0x%x" % target)
+            else:
+                fields[(line, offset - starts[line])] = (kind, ".text", "line %s" % first_at.get(target, "0x%x" % target))
+        if relative and ends[line] - 4 not in relocations:
+            rel, = struct.unpack_from("<i", code, len(code) - 4)
+            targets[line] = first_at.get(ends[line] + rel, "0x%x" % (ends[line] + rel))
+            code[-4:] = bytes(4)
+        instructions[line] = bytes(code)
+    return starts, ends, fields, instructions, targets
+
+
+def check(basm, tmp, source, lines, fused, flags):
+    results = {}
+    for padded in (False, True):
+        obj, listing = os.path.join(tmp, "corpus.o"), os.path.join(tmp, "corpus.lst")
+        subprocess.run([basm, "-f", "elf"] + flags + (["--align-branches"] if padded else []) + [source, "-o", obj, "-l", listing], check=True)
+        results[padded] = read_object(obj) + (read_listing(listing, lines),)
+
+    text, _, relocations, offsets = results[False]
+    lengths = {line: size for line, (_, size) in offsets.items()}
+    _, _, plain_fields, plain_code, plain_targets = describe(text, offsets, relocations, lines, lengths)
+
+    text, sections, relocations, offsets = results[True]
+    starts, ends, fields, code, targets = describe(text, offsets, relocations, lines, lengths)
+
+    errors = []
+    for line in sorted(lines):
+        #align fills up to a different place with the padding in front of it
+        if lines[line] != "align" and code[line] != plain_code[line]:
+            errors.append("line %d is %s, without --align-branches %s" % (line, code[line].hex(), plain_code[line].hex()))
+        if targets.get(line) != plain_targets.get(line):
+            errors.append("line %d branches to line %s, without --align-branches to %s" % (line, targets.get(line), plain_targets.get(line)))
+    for key in sorted(set(fields) | set(plain_fields), key=str):
+        if fields.get(key) != plain_fields.get(key):
+            errors.append("relocation %s at line %s + %s, without --align-branches %s" % (fields.get(key), key[0], key[1], plain_fields.get(key)))
+
+    crossing = 0
+    for line in sorted(lines):
+        if lines[line] != "branch" or lengths[line] == 0:
+            continue
+        first = starts[line - 1] if line in fused else starts[line]
+        section_start, name = [section for section in sections if section[0] <= starts[line]][-1]
+        if (first - section_start) // BOUNDARY != (ends[line] - section_start) // BOUNDARY:
+            crossing += 1
+            errors.append("line %d%s in %s goes from 0x%x to 0x%x" % (line, " (fused)" if line in fused else "", name, first - section_start, ends[line] - section_start))
+
+    print("%-22s %4d sections, %6d bytes (%d without --align-branches), %5d branches, %4d fused, %s" %
+          (" ".join(flags) or "default", len(sections), len(text), len(results[False][0]), sum(kind == "branch" for kind in lines.values()), len(fused),
+           "%d errors (%d crossing)" % (len(errors), crossing) if errors else "all inside 32 bytes, same code"))
+    for error in errors[:20]:
+        print("    " + error)
+    return not errors
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--basm", default="bin/basm")
+    parser.add_argument("--functions", type=int, default=300)
+    args = parser.parse_args()
+    basm = os.path.abspath(args.basm.strip())
+
+    with tempfile.TemporaryDirectory() as tmp:
+        source = os.path.join(tmp, "corpus.asm")
+        lines, fused = write_corpus(random.Random(1), source, args.functions)
+        results = [check(basm, tmp, source, lines, fused, flags) for flags in FLAG_SETS]
+
+    if not all(results):
+        sys.exit("align branches check failed")
+
+
+if __name__ == "__main__":
+    main()
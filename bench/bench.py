@@ -0,0 +1,127 @@
+"""
+End to end benchmark of basm on synthetic corpora from gen_corpus.py
+
+Every case is assembled a few times with --stats=json and the fastest run is kept
+The results are compared with a saved baseline and the script fails if the throughput
+dropped or the peak RSS grew by more than the threshold
+"""
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+BENCH_DIR = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_BASELINE = os.path.join(BENCH_DIR, "baseline.json")
+
+#name, number of files, generator arguments
+CASES = [
+    ("small", 1, ["--functions", "100", "--tables", "50", "--externs", "50"]),
+    ("large", 1, ["--functions", "2000", "--tables", "1000", "--externs", "500"]),
+    ("batch", 16, ["--functions", "400", "--tables", "200", "--externs", "100"]),
+]
+
+#higher is better for these, lower is better for the rest
+THROUGHPUT = {"mb_per_s", "instructions_per_s"}
+COMPARED = ["mb_per_s", "instructions_per_s", "peak_rss_kb"]
+
+
+
+def generate(basm, workdir, name, count, gen_args, seed):
+    inputs = []
+    for i in range(count):
+        path = os.path.join(workdir, "%s_%d.asm" % (name, i))
+        subprocess.run([sys.executable, os.path.join(BENCH_DIR, "gen_corpus.py"), "--basm", basm,
+                        "--seed", str(seed + i), "-o", path] + gen_args, check=True)
+        inputs.append(path)
+    return inputs
+
+
+def run_case(basm, workdir, inputs, repeat):
+    out = os.path.join(workdir, "out")
+    best = None
+    for _ in range(repeat):
+        result = subprocess.run([basm, "-f", "elf", "--outdir", out, "--stats=json"] + inputs,
+                                capture_output=True, text=True)
+        if result.returncode != 0:
+            sys.exit("basm failed:\n" + result.stderr)
+        stats = json.loads(result.stderr)
+        if best is None or stats["wall_ns"] < best["wall_ns"]:
+            best = stats
+
+    size = sum(os.path.getsize(path) for path in inputs)
+    seconds = best["wall_ns"] / 1e9
+    result = {
+        "source_bytes": size,
+        "wall_ms": round(best["wall_ns"] / 1e6, 3),
+        "mb_per_s": round(size / seconds / 1e6, 3),
+        "instructions_per_s": round(best["instructions"] / seconds),
+        "peak_rss_kb": best["peak_rss_kb"],
+    }
+    for phase, times in best["phases"].items():
+        result[phase + "_ms"] = round(times["wall_ns"] / 1e6, 3)
+    return result
+
+
+
+def compare(results, baseline, threshold):
+    regressions = []
+    for name, result in results.items():
+        if name not in baseline:
+            continue
+        for metric in COMPARED:
+            old = baseline[name][metric]
+            new = result[metric]
+            change = new / old - 1
+            regressed = (change < -threshold) if metric in THROUGHPUT else (change > threshold)
+            mark = "REGRESSION" if regressed else ""
+            print("%-6s %-20s %14s -> %14s  %+7.1f%%  %s" % (name, metric, old, new, change * 100, mark))
+            if regressed:
+                regressions.append((name, metric))
+    return regressions
+
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--basm", default="bin/basm")
+    parser.add_argument("--baseline", default=DEFAULT_BASELINE)
+    parser.add_argument("--threshold", type=float, default=0.10, help="allowed change before it counts as a regression")
+    parser.add_argument("--repeat", type=int, default=5)
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("--save", action="store_true", help="write the results as the new baseline")
+    args = parser.parse_args()
+
+    basm = os.path.abspath(args.basm.strip())
+    results = {}
+    with tempfile.TemporaryDirectory() as workdir:
+        for name, count, gen_args in CASES:
+            inputs = generate(basm, workdir, name, count, gen_args, args.seed)
+            results[name] = run_case(basm, workdir, inputs, args.repeat)
+            r = results[name]
+            print("%-6s %8.2f MB/s %12d instructions/s %8d KB peak rss  (tokenize %.1f ms, parse %.1f ms, resolve %.1f ms, write %.1f ms)" %
+                  (name, r["mb_per_s"], r["instructions_per_s"], r["peak_rss_kb"],
+                   r["tokenize_ms"], r["parse_ms"], r["resolve_ms"], r["write_ms"]))
+
+    if args.save:
+        with open(args.baseline, "w") as f:
+            json.dump(results, f, indent=2)
+            f.write("\n")
+        print("saved baseline to %s" % args.baseline)
+        return
+
+    if not os.path.exists(args.baseline):
+        print("no baseline at %s, run with --save to create one" % args.baseline)
+        return
+
+    with open(args.baseline) as f:
+        baseline = json.load(f)
+    print()
+    regressions = compare(results, baseline, args.threshold)
+    if regressions:
+        sys.exit("%d metrics regressed by more than %d%%" % (len(regressions), args.threshold * 100))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,284 @@
+"""
+Decodes the DWARF .debug_line basm -g writes and checks it against the listing of the same file
+
+A corpus of the golden lines is assembled with -g -l, plain, with --align-branches (which moves instructions
+after they were encoded) and with --function-sections (a sequence per function). The line program is decoded
+with its own reader that follows the DWARF 5 spec, set_address is resolved through .rela.debug_line,
+and every instruction has to have exactly one row at the offset and line the listing gives it,
+with every sequence ending where its section ends. The object bin/incremental (bench/incremental.c) links
+through the incremental api is checked against the same listing
+"""
+import argparse
+import os
+import random
+import struct
+import subprocess
+import sys
+import tempfile
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import encoding
+import gen_corpus
+
+FLAG_SETS = [[], ["--align-branches"], ["--function-sections"]]
+
+DW_FORM_STRING = 0x08
+DW_FORM_LINE_STRP = 0x1f
+DW_FORM_UDATA = 0x0f
+DW_FORM_DATA1 = 0x0b
+DW_FORM_DATA2 = 0x05
+DW_FORM_DATA16 = 0x1e
+DW_LNCT_PATH = 1
+
+#standard opcodes
+DW_LNS_COPY, DW_LNS_ADVANCE_PC, DW_LNS_ADVANCE_LINE, DW_LNS_CONST_ADD_PC, DW_LNS_FIXED_ADVANCE_PC = 1, 2, 3, 8, 9
+#extended opcodes
+DW_LNE_END_SEQUENCE, DW_LNE_SET_ADDRESS = 1, 2
+
+
+#(name, bytes) of every section in header order, the index is the section number
+def elf_section_list(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    shoff, = struct.unpack_from("<Q", data, 0x28)
+    shentsize, shnum, shstrndx = struct.unpack_from("<HHH", data, 0x3A)
+    headers = [struct.unpack_from("<IIQQQQ", data, shoff + i * shentsize) for i in range(shnum)]
+    strtab = headers[shstrndx][4]
+    sections = []
+    for name, kind, _, _, offset, size in headers:
+        end = data.index(b"\0", strtab + name)
+        #nobits sections have no bytes in the file
+        sections.append((data[strtab + name:end].decode(), data[offset:offset + size] if kind != 8 else bytes(size)))
+    return sections
+
+
+#offset of the field in the section -> (name of the section the symbol is in, addend)
+def section_relocations(sections, name):
+    by_name = dict(sections)
+    symtab, rela = by_name.get(".symtab", b""), by_name.get(".rela" + name, b"")
+    symbol_sections = []
+    for i in range(0, len(symtab), 24):
+        shndx, = struct.unpack_from("<H", symtab, i + 6)
+        symbol_sections.append(sections[shndx][0] if 0 < shndx < len(sections) else None)
+    relocations = {}
+    for i in range(0, len(rela), 24):
+        offset, info, addend = struct.unpack_from("<QQq", rela, i)
+        relocations[offset] = (symbol_sections[info >> 32], addend)
+    return relocations
+
+
+class Reader:
+    def __init__(self, data, offset=0):
+        self.data = data
+        self.offset = offset
+
+    def fixed(self, fmt):
+        values = struct.unpack_from("<" + fmt, self.data, self.offset)
+        self.offset += struct.calcsize("<" + fmt)
+        return values[0]
+
+    def uleb(self):
+        value, shift = 0, 0
+        while True:
+            byte = self.data[self.offset]
+            self.offset += 1
+            value |= (byte & 0x7f) << shift
+            shift += 7
+            if not byte & 0x80:
+                return value
+
+    def sleb(self):
+        value, shift = 0, 0
+        while True:
+            byte = self.data[self.offset]
+            self.offset += 1
+            value |= (byte & 0x7f) << shift
+            shift += 7
+            if not byte & 0x80:
+                return value - (1 << shift) if byte & 0x40 else value
+
+    def string(self):
+        end = self.data.index(b"\0", self.offset)
+        value = self.data[self.offset:end].decode()
+        self.offset = end + 1
+        return value
+
+
+def read_form(reader, form):
+    if form == DW_FORM_STRING:
+        return reader.string()
+    if form == DW_FORM_UDATA:
+        return reader.uleb()
+    size = {DW_FORM_LINE_STRP: 4, DW_FORM_DATA1: 1, DW_FORM_DATA2: 2, DW_FORM_DATA16: 16}.get(form)
+    if size is None:
+        sys.exit("unexpected form 0x%x in the line table header" % form)
+    reader.offset += size
+    return None
+
+
+def read_entries(reader):
+    formats = [(reader.uleb(), reader.uleb()) for _ in range(reader.fixed("B"))]
+    entries = []
+    for _ in range(reader.uleb()):
+        entries.append({content: read_form(reader, form) for content, form in formats})
+    return entries
+
+
+#returns the file names and a list of sequences: (section, [(offset, line)], end offset)
+def decode_line_program(data, relocations):
+    reader = Reader(data)
+    unit_length = reader.fixed("I")
+    unit_end = reader.offset + unit_length
+    version = reader.fixed("H")
+    if version != 5:
+        sys.exit("line table version %d, expected 5" % version)
+    reader.fixed("B")  # address size
+    reader.fixed("B")  # segment selector size
+    header_length = reader.fixed("I")
+    program = reader.offset + header_length
+    min_length = reader.fixed("B")
+    reader.fixed("B")  # operations per instruction
+    reader.fixed("B")  # default is_stmt
+    line_base = reader.fixed("b")
+    line_range = reader.fixed("B")
+    opcode_base = reader.fixed("B")
+    lengths = [reader.fixed("B") for _ in range(opcode_base - 1)]
+    read_entries(reader)
+    files = [entry.get(DW_LNCT_PATH) for entry in read_entries(reader)]
+    if reader.offset != program:
+        sys.exit("header length says the program starts at %d, the header ends at %d" % (program, reader.offset))
+
+    sequences = []
+    section, address, line, rows = None, 0, 1, []
+    while reader.offset < unit_end:
+        opcode = reader.fixed("B")
+        if opcode >= opcode_base:
+            adjusted = opcode - opcode_base
+            address += (adjusted // line_range) * min_length
+            line += line_base + adjusted % line_range
+            rows.append((address, line))
+        elif opcode == 0:
+            length = reader.uleb()
+            end = reader.offset + length
+            extended = reader.fixed("B")
+            if extended == DW_LNE_SET_ADDRESS:
+                if reader.offset not in relocations:
+                    sys.exit("set_address at %d has no relocation" % reader.offset)
+                section, address = relocations[reader.offset]
+            elif extended == DW_LNE_END_SEQUENCE:
+                sequences.append((section, rows, address))
+                section, address, line, rows = None, 0, 1, []
+            reader.offset = end
+        elif opcode == DW_LNS_COPY:
+            rows.append((address, line))
+        elif opcode == DW_LNS_ADVANCE_PC:
+            address += reader.uleb() * min_length
+        elif opcode == DW_LNS_ADVANCE_LINE:
+            line += reader.sleb()
+        elif opcode == DW_LNS_CONST_ADD_PC:
+            address += ((255 - opcode_base) // line_range) * min_length
+        elif opcode == DW_LNS_FIXED_ADVANCE_PC:
+            address += reader.fixed("H")
+        else:
+            for _ in range(lengths[opcode - 1]):
+                reader.uleb()
+    return files, sequences
+
+
+#line -> text offset of every instruction in the listing, and the offset of every label in .text
+def read_listing(source, listing):
+    with open(source) as f:
+        text_lines, in_text = set(), False
+        for number, line in enumerate(f, 1):
+            if line.startswith("section"):
+                in_text = line.split()[1].startswith(".text")
+            elif in_text and line.startswith("    ") and line.strip():
+                text_lines.add(number)
+
+    offsets, labels = {}, {}
+    with open(listing) as f:
+        in_labels = False
+        for line in f:
+            fields = line.split()
+            if line.startswith("label "):
+                in_labels = True
+            elif line.startswith("section "):
+                in_labels = False
+            elif in_labels and len(fields) == 4 and fields[1] == ".text":
+                labels[fields[0]] = int(fields[2], 16)
+            elif not in_labels and len(fields) >= 3 and fields[0].isdigit():
+                number = int(fields[0])
+                if number in text_lines and number not in offsets:
+                    offsets[number] = int(fields[1], 16)
+    return offsets, labels
+
+
+#with incremental the line table is the one of the object it writes, the listing is still basm's
+def check(basm, incremental, tmp, source, flags):
+    obj, listing = os.path.join(tmp, "corpus.o"), os.path.join(tmp, "corpus.lst")
+    subprocess.run([basm, "-g", "-f", "elf"] + flags + [source, "-o", obj, "-l", listing], check=True)
+    if incremental is not None:
+        subprocess.run([incremental, "-g", "-f", "elf"] + flags + [source, "-o", obj], check=True)
+    sections = elf_section_list(obj)
+    by_name = dict(sections)
+    files, sequences = decode_line_program(by_name[".debug_line"], section_relocations(sections, ".debug_line"))
+    offsets, labels = read_listing(source, listing)
+
+    errors = []
+    if files[1:2] != [source]:
+        errors.append("file 1 is %s, not %s" % (files[1:2], source))
+    rows = {}
+    for section, sequence, end in sequences:
+        #a .text.<label> section starts at the label
+        start = 0 if section == ".text" else labels[section[len(".text."):]]
+        if end != len(by_name[section]):
+            errors.append("sequence of %s ends at %d, the section is %d bytes" % (section, end, len(by_name[section])))
+        for (address, line), (next_address, _) in zip(sequence, sequence[1:]):
+            if next_address <= address:
+                errors.append("rows of %s go from 0x%x back to 0x%x" % (section, address, next_address))
+        for address, line in sequence:
+            if line in rows:
+                errors.append("line %d has more than one row" % line)
+            rows[line] = start + address
+
+    for line, offset in sorted(offsets.items()):
+        if rows.get(line) != offset:
+            errors.append("line %d is at 0x%x in the listing, the line table has %s" %
+                          (line, offset, "no row" if line not in rows else "0x%x" % rows[line]))
+    errors += ["line %d has a row but isn't an instruction" % line for line in sorted(set(rows) - set(offsets))]
+
+    program_size = len(by_name[".debug_line"])
+    print("%-12s %-22s %6d rows in %4d sequences, %d bytes of .debug_line (%.2f per row), %s" %
+          ("full" if incremental is None else "incremental", " ".join(flags) or "default", len(rows), len(sequences), program_size, program_size / max(1, len(rows)),
+           "%d errors" % len(errors) if errors else "matches the listing"))
+    for error in errors[:20]:
+        print("    " + error)
+    return not errors
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--basm", default="bin/basm")
+    parser.add_argument("--incremental", default="bin/incremental")
+    parser.add_argument("--golden", default=encoding.DEFAULT_GOLDEN)
+    parser.add_argument("--functions", type=int, default=500)
+    args = parser.parse_args()
+    basm = os.path.abspath(args.basm.strip())
+    incremental = os.path.abspath(args.incremental.strip())
+
+    variants = [(asm, [], "") for _, asm, encoded in encoding.read_golden(args.golden) if encoded != encoding.ERROR]
+    with tempfile.TemporaryDirectory() as tmp:
+        source = os.path.join(tmp, "corpus.asm")
+        rng = random.Random(1)
+        with open(source, "w") as out:
+            gen_corpus.write_data(rng, out, 100)
+            gen_corpus.write_bss(rng, out, 10)
+            gen_corpus.write_text(rng, out, variants, args.functions, 50, 100)
+        results = [check(basm, inc, tmp, source, flags) for flags in FLAG_SETS for inc in [None, incremental]]
+
+    if not all(results):
+        sys.exit("line table check failed")
+
+
+if __name__ == "__main__":
+    main()
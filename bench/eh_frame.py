@@ -0,0 +1,336 @@
+"""
+Decodes the .eh_frame basm writes and checks the cfa of every instruction against a model of the generated code
+
+Functions with random prologues (push rbp/mov rbp, rsp, pushes of callee saved registers, sub rsp), pushes in the body,
+early returns and leave or pop epilogues are generated twice: once bare for --auto-cfi and once with the .cfi_* directives
+gcc would write. Both are assembled plain, with --align-branches (which moves instructions after their rules were recorded)
+and with --function-sections (an fde per section). The cie and fdes are run with their own reader, the start of every fde
+is resolved through .rela.eh_frame, and the cfa and saved registers from the first to the last byte of every instruction
+have to be the model's, and add/sub rsp has to be encoded with REX.W. The object bin/incremental (bench/incremental.c) links through the incremental api
+is checked against the same model
+"""
+import argparse
+import os
+import random
+import re
+import subprocess
+import sys
+import tempfile
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import debug_line
+import encoding
+
+FLAG_SETS = [[], ["--align-branches"], ["--function-sections"]]
+
+DWARF_REGISTERS = {"rax": 0, "rdx": 1, "rcx": 2, "rbx": 3, "rsi": 4, "rdi": 5, "rbp": 6, "rsp": 7}
+DWARF_REGISTERS.update({"r%d" % i: i for i in range(8, 16)})
+RBP, RSP, RETURN_ADDRESS = 6, 7, 16
+CALLEE_SAVED = ["rbx", "r12", "r13", "r14", "r15"]
+
+#instructions that use the stack or jump can't be in the body, the model only knows the ones it writes itself
+STACK_USE = re.compile(r"\b([re]?[sb]p|[sb]pl|push\w*|pop\w*|call|ret\w*|leave|enter|j\w+|loop\w*|int\w*|sys\w+|iret\w*)\b", re.I)
+
+#call frame instructions
+DW_CFA_ADVANCE_LOC1, DW_CFA_ADVANCE_LOC2, DW_CFA_ADVANCE_LOC4 = 0x02, 0x03, 0x04
+DW_CFA_REMEMBER_STATE, DW_CFA_RESTORE_STATE = 0x0a, 0x0b
+DW_CFA_DEF_CFA, DW_CFA_DEF_CFA_REGISTER, DW_CFA_DEF_CFA_OFFSET = 0x0c, 0x0d, 0x0e
+DW_CFA_OFFSET_EXTENDED_SF = 0x11
+DW_CFA_ADVANCE_LOC, DW_CFA_OFFSET, DW_CFA_RESTORE = 0x40, 0x80, 0xc0
+
+
+#cfa register and offset, cfa - rsp, and where the prologue saved registers relative to the cfa
+class State:
+    def __init__(self):
+        self.reg, self.offset, self.rsp, self.saved = RSP, 8, 8, {}
+
+    def copy(self):
+        state = State()
+        state.reg, state.offset, state.rsp, state.saved = self.reg, self.offset, self.rsp, dict(self.saved)
+        return state
+
+    def key(self):
+        return self.reg, self.offset, tuple(sorted(self.saved.items()))
+
+
+#the source of one of the variants and the state every instruction line starts in
+class Writer:
+    def __init__(self, explicit):
+        self.explicit = explicit
+        self.lines = []
+        self.expected = {}
+        self.state = State()
+
+    def line(self, text):
+        self.lines.append(text)
+
+    def directive(self, text):
+        if self.explicit:
+            self.lines.append("    " + text)
+
+    def instruction(self, text):
+        self.lines.append("    " + text)
+        self.expected[len(self.lines)] = self.state.key()
+
+    def adjust(self, size):
+        self.state.rsp += size
+        if self.state.reg == RSP:
+            self.state.offset = self.state.rsp
+            self.directive(".cfi_adjust_cfa_offset %d" % size)
+
+    def push(self, reg, save):
+        self.instruction("push %s" % reg)
+        self.adjust(8)
+        if save:
+            self.state.saved[DWARF_REGISTERS[reg]] = -self.state.rsp
+            self.directive(".cfi_offset %s, %d" % (reg, -self.state.rsp))
+
+    def leave_frame(self, instruction):
+        self.instruction(instruction)
+        self.state.reg, self.state.offset, self.state.rsp = RSP, 8, 8
+        self.directive(".cfi_def_cfa rsp, 8")
+
+
+def write_function(rng, w, index, body_lines):
+    name = "func_%d" % index
+    w.line("global %s" % name)
+    w.line("%s:" % name)
+    w.directive(".cfi_startproc")
+    w.state = State()
+
+    frame = rng.random() < 0.5
+    if frame:
+        w.push("rbp", True)
+        w.instruction("mov rbp, rsp")
+        w.state.reg = RBP
+        w.directive(".cfi_def_cfa_register rbp")
+    saves = rng.sample(CALLEE_SAVED, rng.randint(0, 3))
+    for reg in saves:
+        w.push(reg, True)
+    allocate = 8 * rng.randint(1, 8) if rng.random() < 0.5 else 0
+    if allocate:
+        w.instruction("sub rsp, %d" % allocate)
+        w.adjust(allocate)
+    body = w.state.copy()
+
+    def epilogue():
+        w.directive(".cfi_remember_state")
+        if allocate:
+            w.instruction("add rsp, %d" % allocate)
+            w.adjust(-allocate)
+        for reg in reversed(saves):
+            w.instruction("pop %s" % reg)
+            w.adjust(-8)
+        if frame:
+            w.leave_frame("leave" if rng.random() < 0.5 else "pop rbp")
+        w.instruction("ret")
+        #the code after it is reached from the body
+        w.state = body.copy()
+        w.directive(".cfi_restore_state")
+
+    blocks = rng.randint(1, 4)
+    for b in range(blocks):
+        w.line(".L%d_%d:" % (index, b))
+        for _ in range(rng.randint(2, 8)):
+            if rng.random() < 0.15:
+                w.push("rax", False)
+                w.instruction(rng.choice(body_lines))
+                w.instruction("add rsp, 8")
+                w.adjust(-8)
+            else:
+                w.instruction(rng.choice(body_lines))
+        if b + 1 < blocks:
+            #add rsp fuses with the jcc, --align-branches moves both along with the rule of the add
+            if rng.random() < 0.3:
+                w.push("rax", False)
+                w.instruction("add rsp, 8")
+                w.adjust(-8)
+            else:
+                w.instruction("test rdi, rdi")
+            w.instruction("jne .L%d_%d" % (index, b + 1))
+            epilogue()
+    epilogue()
+    w.directive(".cfi_endproc")
+
+
+#cie and fdes -> [(section, start, size, [(address, state key)])], the rows are in the order of the code
+def decode_eh_frame(data, relocations):
+    cies, fdes = {}, []
+    offset = 0
+    while offset < len(data):
+        reader = debug_line.Reader(data, offset)
+        length = reader.fixed("I")
+        end = reader.offset + length
+        cie_pointer = reader.fixed("I")
+        if cie_pointer == 0:
+            if reader.fixed("B") != 1:
+                sys.exit("cie at %d isn't version 1" % offset)
+            augmentation = reader.string()
+            code_alignment, data_alignment = reader.uleb(), reader.sleb()
+            return_address = reader.uleb()
+            if augmentation != "zR" or return_address != RETURN_ADDRESS:
+                sys.exit("cie at %d has augmentation %s and return address column %d" % (offset, augmentation, return_address))
+            augmentation_length = reader.uleb()
+            augmentation_data = data[reader.offset:reader.offset + augmentation_length]
+            if augmentation_data != b"\x1b":
+                sys.exit("fdes of the cie at %d aren't pcrel sdata4" % offset)
+            reader.offset += len(augmentation_data)
+            cies[offset] = (code_alignment, data_alignment, data[reader.offset:end])
+        else:
+            cie = cies[reader.offset - 4 - cie_pointer]
+            if reader.offset not in relocations:
+                sys.exit("fde at %d has no relocation for its start" % offset)
+            section, start = relocations[reader.offset]
+            reader.offset += 4
+            size = reader.fixed("I")
+            reader.offset += reader.uleb()
+            rows = run_instructions(cie, data[reader.offset:end], start)
+            fdes.append((section, start, size, rows))
+        offset = end
+    return fdes
+
+
+def run_instructions(cie, instructions, start):
+    code_alignment, data_alignment, initial = cie
+    state, stack, rows = State(), [], []
+    address = start
+
+    def run(program):
+        nonlocal state, address
+        reader = debug_line.Reader(program)
+        while reader.offset < len(program):
+            opcode = reader.fixed("B")
+            high, low = opcode & 0xc0, opcode & 0x3f
+            if high == DW_CFA_ADVANCE_LOC or opcode in (DW_CFA_ADVANCE_LOC1, DW_CFA_ADVANCE_LOC2, DW_CFA_ADVANCE_LOC4):
+                delta = low if high else reader.fixed({DW_CFA_ADVANCE_LOC1: "B", DW_CFA_ADVANCE_LOC2: "H", DW_CFA_ADVANCE_LOC4: "I"}[opcode])
+                rows.append((address, state.key()))
+                address += delta * code_alignment
+            elif high == DW_CFA_OFFSET:
+                state.saved[low] = reader.uleb() * data_alignment
+            elif high == DW_CFA_RESTORE:
+                state.saved.pop(low, None)
+            elif opcode == DW_CFA_OFFSET_EXTENDED_SF:
+                reg = reader.uleb()
+                state.saved[reg] = reader.sleb() * data_alignment
+            elif opcode == DW_CFA_DEF_CFA:
+                state.reg, state.offset = reader.uleb(), reader.uleb()
+            elif opcode == DW_CFA_DEF_CFA_REGISTER:
+                state.reg = reader.uleb()
+            elif opcode == DW_CFA_DEF_CFA_OFFSET:
+                state.offset = reader.uleb()
+            elif opcode == DW_CFA_REMEMBER_STATE:
+                stack.append(state.copy())
+            elif opcode == DW_CFA_RESTORE_STATE:
+                state = stack.pop()
+            elif opcode != 0:
+                sys.exit("unexpected call frame instruction 0x%x" % opcode)
+
+    run(initial)
+    #the return address is always at cfa - 8, the model only has the registers the prologue saves
+    state.saved.pop(RETURN_ADDRESS)
+    run(instructions)
+    rows.append((address, state.key()))
+    return rows
+
+
+#line -> text offset of every instruction the model knows, label -> text offset
+#the lines with add/sub rsp, imm are kept too, they need REX.W or only esp moves
+def read_listing(listing, lines):
+    offsets, labels, stack_adjusts = {}, {}, set()
+    with open(listing) as f:
+        in_labels = False
+        for line in f:
+            fields = line.split()
+            if line.startswith("label "):
+                in_labels = True
+            elif line.startswith("section "):
+                in_labels = False
+            elif in_labels and len(fields) == 4 and fields[1] == ".text":
+                labels[fields[0]] = int(fields[2], 16)
+            elif not in_labels and len(fields) >= 3 and fields[0].isdigit() and int(fields[0]) in lines:
+                offsets.setdefault(int(fields[0]), int(fields[1], 16))
+                if len(fields) >= 5 and fields[3] in ("add", "sub") and fields[4] == "rsp,":
+                    stack_adjusts.add(int(fields[0]))
+    return offsets, labels, stack_adjusts
+
+
+#with incremental the .eh_frame is the one of the object it writes, the listing is still basm's
+def check(basm, incremental, tmp, source, expected, function_count, flags, variant):
+    obj, listing = os.path.join(tmp, "corpus.o"), os.path.join(tmp, "corpus.lst")
+    subprocess.run([basm, "-f", "elf"] + flags + [source, "-o", obj, "-l", listing], check=True)
+    if incremental is not None:
+        subprocess.run([incremental, "-f", "elf"] + flags + [source, "-o", obj], check=True)
+    sections = debug_line.elf_section_list(obj)
+    by_name = dict(sections)
+    data = by_name.get(".eh_frame", b"")
+    fdes = decode_eh_frame(data, debug_line.section_relocations(sections, ".eh_frame"))
+    offsets, labels, stack_adjusts = read_listing(listing, expected)
+
+    errors = []
+    text = b"".join(data for name, data in sections if name.startswith(".text"))
+    text_size = len(text)
+    starts = sorted(labels["func_%d" % i] for i in range(function_count))
+    frames = []
+    for section, start, size, rows in fdes:
+        #a .text.<label> section starts at the label
+        base = 0 if section == ".text" else labels[section[len(".text."):]]
+        frames.append((base + start, base + start + size, [(base + address, key) for address, key in rows]))
+    frames.sort()
+    if [(start, end) for start, end, _ in frames] != list(zip(starts, starts[1:] + [text_size])):
+        errors.append("the fdes don't cover exactly one function each")
+
+    #the state holds up to the last byte of the instruction, padding moved in front of it included
+    lines = sorted(expected)
+    ends = [offsets[line] for line in lines[1:]] + [text_size]
+    for line, end in zip(lines, ends):
+        key = expected[line]
+        #padding of --align-branches comes before the instruction
+        encoded = text[offsets[line]:end]
+        if line in stack_adjusts and encoded[-7:-5] != b"\x48\x81" and encoded[-4:-2] != b"\x48\x83":
+            errors.append("line %d moves rsp with %s, which has no REX.W" % (line, encoded.hex()))
+        for offset in (offsets[line], end - 1):
+            frame = next((rows for start, frame_end, rows in frames if start <= offset < frame_end), None)
+            found = None if frame is None else [row for address, row in frame if address <= offset][-1]
+            if found != key:
+                errors.append("line %d at 0x%x should have cfa %s, saves %s, .eh_frame has %s" % (line, offset, key[:2], key[2], found))
+
+    print("%-9s %-12s %-34s %4d fdes, %6d bytes of .eh_frame (%.1f per fde), %s" %
+          (variant, "full" if incremental is None else "incremental", " ".join(flags) or "default", len(fdes), len(data), len(data) / max(1, len(fdes)),
+           "%d errors" % len(errors) if errors else "matches the model"))
+    for error in errors[:20]:
+        print("    " + error)
+    return not errors
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--basm", default="bin/basm")
+    parser.add_argument("--incremental", default="bin/incremental")
+    parser.add_argument("--golden", default=encoding.DEFAULT_GOLDEN)
+    parser.add_argument("--functions", type=int, default=300)
+    args = parser.parse_args()
+    basm = os.path.abspath(args.basm.strip())
+    incremental = os.path.abspath(args.incremental.strip())
+
+    body_lines = [asm for _, asm, encoded in encoding.read_golden(args.golden)
+                  if encoded != encoding.ERROR and not STACK_USE.search(asm)]
+    results = []
+    with tempfile.TemporaryDirectory() as tmp:
+        for variant, explicit, flags in [("auto", False, ["--auto-cfi"]), ("explicit", True, [])]:
+            rng = random.Random(1)
+            w = Writer(explicit)
+            w.line("section .text")
+            for i in range(args.functions):
+                write_function(rng, w, i, body_lines)
+            source = os.path.join(tmp, "corpus.asm")
+            with open(source, "w") as out:
+                out.write("\n".join(w.lines) + "\n")
+            results += [check(basm, inc, tmp, source, w.expected, args.functions, flags + extra, variant)
+                        for extra in FLAG_SETS for inc in [None, incremental]]
+
+    if not all(results):
+        sys.exit("eh_frame check failed")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,455 @@
+"""
+Golden encodings for every instruction variant basm can render, and a per form encoding benchmark
+
+  cases   assembles the hand checked lines of bench/encoder_cases.txt and fails if one is encoded differently
+  record  assembles every variant in x86/instructions.dat with register, memory and immediate operands
+          plus every addressing mode, and writes the bytes to bench/golden_encodings.txt, only if cases passes
+  check   assembles the lines in the golden file again and fails if any byte changed
+  bench   times tokenize and parse (which does the encoding) for the lines of each form
+  gas     disassembles the bytes basm and the GNU assembler produce for every line and fails if a line differs
+          that isn't in bench/gas_known.txt, --save writes the lines that differ to it
+  roundtrip  disassembles the golden lines and a generated corpus with basm --disasm, assembles the listing
+          again and fails if the bytes differ or the decoder doesn't get through the corpus at DECODE_TARGET MB/s
+
+Every line is assembled as its own file in one batch run so an error only drops that line
+"""
+import argparse
+import collections
+import json
+import os
+import random
+import re
+import struct
+import subprocess
+import sys
+import tempfile
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import gen_corpus
+
+BENCH_DIR = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_GOLDEN = os.path.join(BENCH_DIR, "golden_encodings.txt")
+ENCODER_CASES = os.path.join(BENCH_DIR, "encoder_cases.txt")
+
+#unlike the corpus every register can be a base here
+ALL_BASES = ["rax", "rcx", "rdx", "rbx", "rsp", "rbp", "rsi", "rdi",
+             "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15"]
+
+#renderings of every variant, enough for each register operand to take a few registers and one memory form
+VARIANT_PROBES = 16
+
+ERROR = "error"
+
+
+
+def reg32(reg):
+    return reg + "d" if reg[1].isdigit() else "e" + reg[1:]
+
+
+#every base, base + index and index only form modrm_sib_fields can produce
+def addressing_lines():
+    lines = []
+    for base in ALL_BASES:
+        lines.append(("legacy mem[base]", "mov rax, [%s]" % base))
+        lines.append(("legacy mem[base+disp]", "mov rax, [%s + 64]" % base))
+        lines.append(("legacy mem[base32]", "mov eax, [%s]" % reg32(base)))
+        for index in ALL_BASES:
+            if index == "rsp":
+                continue
+            lines.append(("legacy mem[base+index]", "mov rax, [%s + %s * 4]" % (base, index)))
+        lines.append(("vex mem[base]", "vmovaps ymm1, yword [%s]" % base))
+        lines.append(("vex mem[base+disp]", "vaddps xmm2, xmm3, dqword [%s + 4096]" % base))
+    for index in ALL_BASES:
+        if index != "rsp":
+            lines.append(("legacy mem[index]", "mov rax, [%s * 8]" % index))
+    return lines
+
+
+def encoding_class(opcode):
+    if opcode.startswith("VEX"):
+        return "vex"
+    if "REX.W" in opcode:
+        return "rex.w"
+    return "legacy"
+
+
+def operand_kind(op):
+    op = op.strip()
+    if "[" in op:
+        addr = op[op.index("["):]
+        if "*" in addr:
+            return "mem[sib]"
+        return "mem[base+disp]" if "+" in addr else "mem[base]"
+    if re.fullmatch(r"-?\d+", op):
+        return "imm"
+    return re.sub(r"\d+$", "", op) if op.startswith(("xmm", "ymm", "mm")) else "reg"
+
+
+def variant_lines():
+    lines = []
+    for variant in gen_corpus.read_variants(ALL_BASES):
+        cls = encoding_class(variant[2])
+        for k in range(VARIANT_PROBES):
+            line = gen_corpus.render(variant, k)
+            ops = line.split(" ", 1)[1].split(",") if " " in line else []
+            form = cls + " " + (",".join(operand_kind(op) for op in ops) or "none")
+            lines.append((form, line))
+    return lines
+
+
+
+def elf_sections(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    shoff, = struct.unpack_from("<Q", data, 0x28)
+    shentsize, shnum, shstrndx = struct.unpack_from("<HHH", data, 0x3A)
+    headers = []
+    for i in range(shnum):
+        name, _, _, _, offset, size = struct.unpack_from("<IIQQQQ", data, shoff + i * shentsize)
+        headers.append((name, offset, size))
+    strtab_offset = headers[shstrndx][1]
+    sections = {}
+    for name, offset, size in headers:
+        end = data.index(b"\0", strtab_offset + name)
+        sections[data[strtab_offset + name:end].decode()] = data[offset:offset + size]
+    return sections
+
+
+#(offset, type, symbol name, addend) of every relocation of .text, symbol indexes depend on the order they were first seen
+def elf_relocations(path):
+    sections = elf_sections(path)
+    symtab, strtab, rela = sections.get(".symtab", b""), sections.get(".strtab", b""), sections.get(".rela.text", b"")
+    names = []
+    for i in range(0, len(symtab), 24):
+        name, = struct.unpack_from("<I", symtab, i)
+        names.append(strtab[name:strtab.index(b"\0", name)].decode())
+    relocations = []
+    for i in range(0, len(rela), 24):
+        offset, info, addend = struct.unpack_from("<QQq", rela, i)
+        relocations.append((offset, info & 0xFFFFFFFF, names[info >> 32], addend))
+    return sorted(relocations)
+
+
+#returns the .text bytes of every line as hex, or ERROR if basm couldn't assemble it
+def assemble_lines(basm, lines):
+    results = []
+    with tempfile.TemporaryDirectory() as tmp:
+        inputs = []
+        for i, line in enumerate(lines):
+            path = os.path.join(tmp, "l%d.asm" % i)
+            with open(path, "w") as f:
+                f.write("section .text\n%s\n" % line)
+            inputs.append(path)
+        out = os.path.join(tmp, "out")
+        subprocess.run([basm, "-f", "elf", "--outdir", out] + inputs, capture_output=True)
+        for i in range(len(lines)):
+            obj = os.path.join(out, "l%d.o" % i)
+            results.append(elf_sections(obj)[".text"].hex() if os.path.exists(obj) else ERROR)
+    return results
+
+
+def read_golden(path):
+    entries = []
+    with open(path) as f:
+        for line in f:
+            if line.startswith("#") or not line.strip():
+                continue
+            form, asm, encoding = line.rstrip("\n").split("\t")
+            entries.append((form, asm, encoding))
+    return entries
+
+
+
+#the (source line, expected encoding) of every case
+def read_cases(path):
+    with open(path) as f:
+        return [tuple(line.rstrip("\n").split("\t")) for line in f if line.strip() and not line.startswith("#")]
+
+
+#prints the cases basm gets wrong and returns how many there are
+def failed_cases(basm):
+    entries = read_cases(ENCODER_CASES)
+    encodings = assemble_lines(basm, [asm for asm, _ in entries])
+    failed = 0
+    for (asm, expected), encoding in zip(entries, encodings):
+        if encoding != expected:
+            failed += 1
+            print("%-40s expected %s got %s" % (asm, expected, encoding))
+    return failed, len(entries)
+
+
+def cases(args):
+    failed, count = failed_cases(args.basm)
+    if failed:
+        sys.exit("%d of %d encoder cases failed" % (failed, count))
+    print("all %d encoder cases match" % count)
+
+
+def record(args):
+    #the golden table records whatever the encoder does, so it's only written for one that gets the cases right
+    failed, count = failed_cases(args.basm)
+    if failed:
+        sys.exit("%d of %d encoder cases failed, fix the encoder before recording %s" % (failed, count, args.golden))
+    lines = list(dict.fromkeys(addressing_lines() + variant_lines()))
+    encodings = assemble_lines(args.basm, [asm for _, asm in lines])
+    with open(args.golden, "w") as f:
+        f.write("# form\tsource line\tencoding (or %s), written by bench/encoding.py record\n" % ERROR)
+        for (form, asm), encoding in zip(lines, encodings):
+            f.write("%s\t%s\t%s\n" % (form, asm, encoding))
+    errors = encodings.count(ERROR)
+    print("recorded %d lines (%d that basm can't assemble) to %s" % (len(lines), errors, args.golden))
+
+
+def check(args):
+    entries = read_golden(args.golden)
+    encodings = assemble_lines(args.basm, [asm for _, asm, _ in entries])
+    changed = 0
+    for (form, asm, expected), encoding in zip(entries, encodings):
+        if encoding != expected:
+            changed += 1
+            print("%-40s %-24s expected %s got %s" % (asm, form, expected, encoding))
+    if changed:
+        sys.exit("%d of %d encodings changed, run `make golden-record` if that was intended" % (changed, len(entries)))
+    print("all %d encodings match" % len(entries))
+
+
+
+#every form is repeated until it has this many instructions so the timers have something to measure
+BENCH_INSTRUCTIONS = 20000
+
+def bench(args):
+    forms = collections.defaultdict(list)
+    for form, asm, encoding in read_golden(args.golden):
+        if encoding != ERROR:
+            forms[form].append(asm)
+
+    results = []
+    with tempfile.TemporaryDirectory() as tmp:
+        path = os.path.join(tmp, "form.asm")
+        for form, lines in forms.items():
+            with open(path, "w") as f:
+                f.write("section .text\n")
+                for i in range(BENCH_INSTRUCTIONS):
+                    f.write(lines[i % len(lines)] + "\n")
+            best = None
+            for _ in range(args.repeat):
+                result = subprocess.run([args.basm, "-f", "elf", path, "-o", os.path.join(tmp, "form.o"), "--stats=json"],
+                                        capture_output=True, text=True, check=True)
+                stats = json.loads(result.stderr)
+                if best is None or stats["phases"]["parse"]["wall_ns"] < best["phases"]["parse"]["wall_ns"]:
+                    best = stats
+            count = best["instructions"]
+            results.append((best["phases"]["parse"]["wall_ns"] / count, best["phases"]["tokenize"]["wall_ns"] / count,
+                            best["instruction_probes"] / count, form, len(lines)))
+
+    results.sort(reverse=True)
+    print("%-40s %6s %12s %12s %8s" % ("form", "lines", "parse ns/op", "tokens ns/op", "probes"))
+    for parse_ns, tokenize_ns, probes, form, lines in results:
+        print("%-40s %6d %12.1f %12.1f %8.1f" % (form, lines, parse_ns, tokenize_ns, probes))
+
+
+
+#source line -> why it fails, of the lines known to fail a check
+def read_known(path):
+    known = {}
+    if os.path.exists(path):
+        with open(path) as f:
+            for line in f:
+                if not line.startswith("#"):
+                    asm, _, reason = line.rstrip("\n").partition("\t")
+                    known[asm] = reason
+    return known
+
+
+def save_known(path, failed, header):
+    with open(path, "w") as f:
+        f.write("# %s\n" % header)
+        f.write("".join("%s\t%s\n" % item for item in failed.items()))
+    print("saved %d lines to %s" % (len(failed), path))
+
+
+
+DEFAULT_GAS_KNOWN = os.path.join(BENCH_DIR, "gas_known.txt")
+
+#gas spells some size keywords differently
+def gas_syntax(asm):
+    asm = re.sub(r"\b(byte|word|dword|qword)\s+\[", r"\1 ptr [", asm)
+    asm = re.sub(r"\bdqword\s+\[", "xmmword ptr [", asm)
+    return re.sub(r"\byword\s+\[", "ymmword ptr [", asm)
+
+
+#assembles the source with gas and splits the disassembly at the line_<n> labels
+def gas_disassemble(tmp, lines):
+    src = os.path.join(tmp, "gas.s")
+    obj = os.path.join(tmp, "gas.o")
+    with open(src, "w") as f:
+        f.write(".intel_syntax noprefix\n")
+        for i, line in enumerate(lines):
+            f.write("line_%d:\n%s\n" % (i, line))
+    result = subprocess.run(["as", "-o", obj, src], capture_output=True, text=True)
+    if result.returncode != 0:
+        return None, result.stderr
+    text = subprocess.run(["objdump", "-d", "-M", "intel", obj], capture_output=True, text=True, check=True).stdout
+
+    disassembly = collections.defaultdict(list)
+    current = None
+    for line in text.splitlines():
+        m = re.match(r"[0-9a-f]+ <line_(\d+)>:", line)
+        if m:
+            current = int(m.group(1))
+        #long instructions continue on a line with only the rest of the bytes
+        elif current is not None and re.match(r"\s+[0-9a-f]+:\t[^\t]*\t", line):
+            disassembly[current].append(line.split("\t")[-1].strip())
+    return disassembly, result.stderr
+
+
+def gas(args):
+    #what basm writes now, not the golden bytes, so a fix shows up before the golden file is recorded again
+    golden = read_golden(args.golden)
+    entries = [(form, asm, encoding) for (form, asm, _), encoding in zip(golden, assemble_lines(args.basm, [asm for _, asm, _ in golden]))
+               if encoding != ERROR]
+    with tempfile.TemporaryDirectory() as tmp:
+        lines = [gas_syntax(asm) for _, asm, _ in entries]
+        gas_lines, errors = gas_disassemble(tmp, lines)
+        #line 1 is the syntax directive, then a label and an instruction for every entry
+        rejected = set((int(m.group(1)) - 3) // 2 for m in re.finditer(r":(\d+): Error", errors))
+        if gas_lines is None:
+            #gas doesn't write the object if any line has an error
+            gas_lines, _ = gas_disassemble(tmp, [line if i not in rejected else "nop" for i, line in enumerate(lines)])
+        #the bytes basm wrote go through the same disassembler so the text is comparable
+        basm_lines, _ = gas_disassemble(tmp, [".byte " + ",".join("0x" + e[i:i + 2] for i in range(0, len(e), 2))
+                                              for _, _, e in entries])
+
+    different = {}
+    for i, (form, asm, encoding) in enumerate(entries):
+        if i not in rejected and basm_lines[i] != gas_lines[i]:
+            different[asm] = "basm: %s | gas: %s" % ("; ".join(basm_lines[i]), "; ".join(gas_lines[i]))
+    if args.save:
+        save_known(args.known, different, "golden lines basm encodes differently from gas, written by bench/encoding.py gas --save")
+
+    #a known line that matches now is an encoder bug fixed, `gas --save` takes it out of the list
+    known = read_known(args.known)
+    new = [asm for asm in different if asm not in known]
+    for asm in new:
+        print("%-40s %s" % (asm, different[asm]))
+    fixed = len([asm for asm in known if asm not in different])
+    print("%d of %d lines decode differently from gas, %d known, %d new, %d fixed, %d lines gas rejected" %
+          (len(different), len(entries), len(different) - len(new), len(new), fixed, len(rejected)))
+    if new:
+        sys.exit("%d lines encode differently from gas" % len(new))
+
+
+
+#a listing line is the instruction then a comment with its address and bytes
+LISTING_LINE = re.compile(r"    (\S.*?)\s+; ([0-9a-f]+): ([0-9a-f ]+)$")
+DEFAULT_ROUNDTRIP_KNOWN = os.path.join(BENCH_DIR, "roundtrip_known.txt")
+#basm_decode alone on the corpus, the best of --repeat runs of --stats has to be faster than this
+#other load on the machine only ever slows it down, so it gets up to DECODE_RUNS runs before it counts as too slow
+DECODE_TARGET = 100
+DECODE_RUNS = 10
+
+def disassemble(basm, obj, listing):
+    result = subprocess.run([basm, "--disasm", obj, "-o", listing, "--stats"], capture_output=True, text=True)
+    if result.returncode != 0:
+        sys.exit("basm --disasm %s failed: %s" % (obj, result.stderr))
+    return float(re.search(r"\(([\d.]+) MB/s\)", result.stderr).group(1))
+
+
+#the golden lines as one file through the disassembler, then every line it writes assembled by itself
+#returns the lines that came back with other bytes and the ones that came back the same
+def roundtrip_golden(basm, tmp, entries):
+    src, obj, listing = (os.path.join(tmp, name) for name in ("golden.asm", "golden.o", "golden.lst"))
+    with open(src, "w") as f:
+        #the labels stop the decoder from carrying on in the middle of the next line after a wrong encoding
+        f.write("section .text\n" + "".join("line_%d:\n%s\n" % (i, asm) for i, (_, asm, _) in enumerate(entries)))
+    subprocess.run([basm, "-f", "elf", src, "-o", obj], check=True)
+    disassemble(basm, obj, listing)
+
+    decoded = {}
+    with open(listing) as f:
+        for line in f:
+            m = LISTING_LINE.match(line.rstrip("\n"))
+            if m:
+                decoded[int(m.group(2), 16)] = (m.group(1), m.group(3).replace(" ", ""))
+
+    #a line the decoder split differently (mostly bytes basm encodes wrong) can't be assembled again by itself
+    failed, checked, offset = {}, [], 0
+    for form, asm, expected in entries:
+        text, encoding = decoded.get(offset, (None, None))
+        if encoding != expected:
+            failed[asm] = "%s decoded as %s" % (expected, text)
+        else:
+            checked.append((asm, expected, text))
+        offset += len(expected) // 2
+
+    clean = []
+    for (asm, expected, text), encoding in zip(checked, assemble_lines(basm, [text for _, _, text in checked])):
+        if encoding != expected:
+            failed[asm] = "%s -> %s -> %s" % (expected, text, encoding)
+        else:
+            clean.append(asm)
+    return failed, clean
+
+
+def roundtrip(args):
+    entries = [e for e in read_golden(args.golden) if e[2] != ERROR]
+    with tempfile.TemporaryDirectory() as tmp:
+        failed, clean = roundtrip_golden(args.basm, tmp, entries)
+        #the lines basm encodes wrong are in gas_known.txt, the list of the round trip only has the decoder's failures
+        wrong = read_known(DEFAULT_GAS_KNOWN)
+        failed = {asm: why for asm, why in failed.items() if asm not in wrong}
+        if args.save:
+            save_known(args.known, failed, "golden lines basm encodes like gas that don't come back with the same bytes, written by bench/encoding.py roundtrip --save")
+
+        known = read_known(args.known)
+        new = [asm for asm in failed if asm not in known]
+        for asm in new:
+            print("%-40s %s" % (asm, failed[asm]))
+        fixed = len([asm for asm in known if asm not in failed])
+        print("%d of %d golden lines round trip, %d encoded wrong (gas_known.txt), %d known failures, %d new, %d fixed" %
+              (len(clean), len(entries), len(entries) - len(clean) - len(failed), len(failed) - len(new), len(new), fixed))
+
+        #a corpus of the lines that do, with labels, branches, calls, externs and data, has to come back byte for byte
+        variants = [(asm, [], "") for asm in clean]
+        corpus, obj, listing, again = (os.path.join(tmp, name) for name in ("corpus.asm", "corpus.o", "corpus.lst", "again.o"))
+        rng = random.Random(1)
+        with open(corpus, "w") as out:
+            gen_corpus.write_data(rng, out, 500)
+            gen_corpus.write_bss(rng, out, 50)
+            gen_corpus.write_text(rng, out, variants, 2000, 200, 500)
+        subprocess.run([args.basm, "-f", "elf", corpus, "-o", obj], check=True)
+        runs = [disassemble(args.basm, obj, listing) for _ in range(args.repeat)]
+        while max(runs) <= DECODE_TARGET and len(runs) < DECODE_RUNS:
+            runs.append(disassemble(args.basm, obj, listing))
+        best = max(runs)
+        subprocess.run([args.basm, "-f", "elf", listing, "-o", again], check=True)
+        before, after = elf_sections(obj), elf_sections(again)
+        different = [section for section in (".text", ".data") if before.get(section) != after.get(section)]
+        if elf_relocations(obj) != elf_relocations(again):
+            different.append(".rela.text")
+        print("corpus: %d bytes of code decoded at %.1f MB/s (best of %d runs), %s" %
+              (len(before[".text"]), best, len(runs), "differs in " + " ".join(different) if different else "same bytes after the round trip"))
+
+    if new or different:
+        sys.exit("round trip failed")
+    if best <= DECODE_TARGET:
+        sys.exit("decoder at %.1f MB/s, it has to be faster than %d MB/s" % (best, DECODE_TARGET))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("command", choices=["cases", "record", "check", "bench", "gas", "roundtrip"])
+    parser.add_argument("--basm", default="bin/basm")
+    parser.add_argument("--golden", default=DEFAULT_GOLDEN)
+    parser.add_argument("--repeat", type=int, default=3)
+    parser.add_argument("--known", help="the known failures of gas or roundtrip, bench/<command>_known.txt by default")
+    parser.add_argument("--save", action="store_true", help="gas, roundtrip: write the lines that fail as the known failures")
+    args = parser.parse_args()
+    args.basm = os.path.abspath(args.basm.strip())
+    if args.known is None:
+        args.known = DEFAULT_GAS_KNOWN if args.command == "gas" else DEFAULT_ROUNDTRIP_KNOWN
+    {"cases": cases, "record": record, "check": check, "bench": bench, "gas": gas, "roundtrip": roundtrip}[args.command](args)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,216 @@
+"""
+Writes a large synthetic .asm file for benchmarking basm
+
+The instruction mix is drawn from x86/instructions.dat, the same table INSTRUCTION_TABLE is generated from,
+so new instructions show up in the benchmark without touching this script
+Every variant is rendered with concrete operands and the ones basm can't assemble yet are dropped
+by assembling them once with the basm binary passed in --basm
+
+The same seed and size always produce the same file
+"""
+import argparse
+import os
+import random
+import re
+import subprocess
+import tempfile
+
+DAT_FILE = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "x86", "instructions.dat")
+
+R8 = ["al", "cl", "dl", "bl", "sil", "dil", "r8b", "r9b", "r10b", "r11b", "r14b", "r15b"]
+R16 = ["ax", "cx", "dx", "bx", "si", "di", "r8w", "r9w", "r10w", "r11w", "r14w", "r15w"]
+R32 = ["eax", "ecx", "edx", "ebx", "esi", "edi", "r8d", "r9d", "r10d", "r11d", "r14d", "r15d"]
+R64 = ["rax", "rcx", "rdx", "rbx", "rsi", "rdi", "r8", "r9", "r10", "r11", "r14", "r15"]
+XMM = ["xmm%d" % i for i in range(16)]
+YMM = ["ymm%d" % i for i in range(16)]
+MM = ["mm%d" % i for i in range(8)]
+
+#rsp, rbp, r12 and r13 need special modrm forms, they are covered by the encoding tests instead
+BASE = ["rbx", "rsi", "rdi", "r8", "r9", "r10", "r11", "r14", "r15"]
+INDEX = ["rcx", "rdx", "rsi", "rdi", "r8", "r9"]
+
+SIZES = {"8": "byte", "16": "word", "32": "dword", "64": "qword", "128": "dqword", "256": "yword"}
+
+FIXED = {"AL", "CL", "DX", "AX", "EAX", "RAX"}
+
+
+#every operand is rendered from a number k so the probe can walk through all the choices
+def memory(k, size, bases=BASE):
+    base = bases[k % len(bases)]
+    k //= len(bases)
+    form = k % 3
+    k //= 3
+    if form == 0:
+        addr = "[%s]" % base
+    elif form == 1:
+        addr = "[%s + %d]" % (base, [8, 16, 64, 256, 4096][k % 5])
+    else:
+        addr = "[%s + %s * %d]" % (base, INDEX[k % len(INDEX)], [1, 2, 4, 8][(k // len(INDEX)) % 4])
+    return (SIZES[size] + " " + addr) if size is not None else addr
+
+
+def reg_or_memory(reg_list, size, bases):
+    #one in four is a memory operand
+    return lambda k: memory(k // 4, size, bases) if k % 4 == 3 else reg_list[k % len(reg_list)]
+
+
+#returns a function that renders the operand or None if the operand type isn't generated
+def operand_renderer(op, bases=BASE):
+    op = op.strip().replace(" ", "")
+    if op in FIXED:
+        return lambda k: op.lower()
+
+    regs = {"r8": R8, "r16": R16, "r32": R32, "r64": R64, "xmm": XMM, "ymm": YMM, "mm": MM}
+    imms = {"imm8": (1, 100), "imm16": (256, 30000), "imm32": (70000, 2000000000)}
+
+    m = re.fullmatch(r"(r8|r16|r32|r64|xmm|ymm|mm)\d?(?:/m(8|16|32|64|128|256))?", op)
+    if m:
+        reg_list = regs[m.group(1)]
+        if m.group(2) is None:
+            return lambda k: reg_list[k % len(reg_list)]
+        return reg_or_memory(reg_list, m.group(2), bases)
+
+    m = re.fullmatch(r"r/m(8|16|32|64)", op)
+    if m:
+        return reg_or_memory(regs["r" + m.group(1)], m.group(1), bases)
+
+    m = re.fullmatch(r"m(8|16|32|64|128|256)", op)
+    if m:
+        size = m.group(1)
+        return lambda k: memory(k, size, bases)
+    if op == "m":
+        return lambda k: memory(k, None, bases)
+
+    if op in imms:
+        low, high = imms[op]
+        return lambda k: str(low + k * 7919 % (high - low))
+    return None
+
+
+#(mnemonic, operand renderers, opcode column) for every form in the table that can be rendered
+def read_variants(bases=BASE):
+    variants = []
+    seen = set()
+    with open(DAT_FILE) as f:
+        for line in f:
+            if "|" not in line:
+                continue
+            opcode, form = (part.strip() for part in line.split("|", 1))
+            parts = form.split(" ", 1)
+            mnemonic = parts[0].lower()
+            ops = [o for o in parts[1].split(",")] if len(parts) > 1 else []
+            renderers = [operand_renderer(o, bases) for o in ops]
+            if any(r is None for r in renderers):
+                continue
+            key = (mnemonic, tuple(o.strip().replace(" ", "") for o in ops))
+            if key in seen:
+                continue
+            seen.add(key)
+            variants.append((mnemonic, renderers, opcode))
+    return variants
+
+
+def render(variant, k):
+    mnemonic, renderers, _ = variant
+    if not renderers:
+        return mnemonic
+    #operands after the first get a different choice so "add rax, rax" isn't the only pairing
+    return mnemonic + " " + ", ".join(r(k // (5 ** i) + i) for i, r in enumerate(renderers))
+
+
+
+#any choice of operand for a variant can end up in the corpus so every k it can be rendered with is assembled
+PROBES = 256
+
+#drops the variants basm can't assemble, every variant goes in its own file and only the ones that fail have no object
+def supported_variants(basm, variants):
+    with tempfile.TemporaryDirectory() as tmp:
+        inputs = []
+        for i, v in enumerate(variants):
+            path = os.path.join(tmp, "v%d.asm" % i)
+            with open(path, "w") as f:
+                f.write("section .text\n")
+                f.write("\n".join(dict.fromkeys(render(v, k) for k in range(PROBES))))
+                f.write("\n")
+            inputs.append(path)
+        out = os.path.join(tmp, "out")
+        subprocess.run([basm, "-f", "elf", "--outdir", out] + inputs, capture_output=True)
+        return [v for i, v in enumerate(variants) if os.path.exists(os.path.join(out, "v%d.o" % i))]
+
+
+
+def write_data(rng, out, tables):
+    out.write("section .data\n")
+    for i in range(tables):
+        kind = rng.randrange(4)
+        if kind == 0:
+            values = ", ".join(str(rng.randint(-1000000, 1000000)) for _ in range(rng.randint(8, 32)))
+            out.write("    table_%d: dq %s\n" % (i, values))
+        elif kind == 1:
+            values = ", ".join(str(rng.randint(0, 65535)) for _ in range(rng.randint(16, 64)))
+            out.write("    table_%d: dd %s\n" % (i, values))
+        elif kind == 2:
+            values = ", ".join(str(rng.randint(0, 255)) for _ in range(rng.randint(32, 128)))
+            out.write("    table_%d: db %s\n" % (i, values))
+        else:
+            words = " ".join(rng.choice(["alpha", "beta", "gamma", "delta", "error", "value", "%d"]) for _ in range(rng.randint(2, 8)))
+            out.write("    table_%d: db \"%s\\n\"\n" % (i, words))
+
+
+def write_bss(rng, out, count):
+    out.write("section .bss\n")
+    for i in range(count):
+        out.write("    buffer_%d: resb %d\n" % (i, rng.choice([16, 64, 256, 4096])))
+
+
+#functions with a label every few instructions, local branches both ways and calls to other functions and externs
+def write_text(rng, out, variants, functions, externs, tables):
+    out.write("section .text\n")
+    out.write("global _start\n")
+    for i in range(externs):
+        out.write("extern ext_%d\n" % i)
+
+    branches = ["jmp", "je", "jne", "jl", "jg", "jle", "jge", "jb", "ja"]
+    for f in range(functions):
+        name = "_start" if f == 0 else "func_%d" % f
+        if f % 8 == 0 and f > 0:
+            out.write("global %s\n" % name)
+        out.write("%s:\n" % name)
+
+        blocks = rng.randint(4, 12)
+        for b in range(blocks):
+            out.write(".L%d_%d:\n" % (f, b))
+            for _ in range(rng.randint(3, 10)):
+                out.write("    %s\n" % render(rng.choice(variants), rng.randrange(PROBES)))
+            roll = rng.random()
+            if roll < 0.15 and tables > 0:
+                out.write("    lea rdi, [table_%d]\n" % rng.randrange(tables))
+            if roll < 0.3 and externs > 0:
+                out.write("    call ext_%d\n" % rng.randrange(externs))
+            elif roll < 0.45 and functions > 1:
+                out.write("    call func_%d\n" % rng.randint(1, functions - 1))
+            out.write("    %s .L%d_%d\n" % (rng.choice(branches), f, rng.randrange(blocks)))
+        out.write("    ret\n")
+
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--basm", required=True, help="basm binary used to filter the instruction mix")
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("--functions", type=int, default=1000)
+    parser.add_argument("--externs", type=int, default=200)
+    parser.add_argument("--tables", type=int, default=500)
+    parser.add_argument("-o", "--output", required=True)
+    args = parser.parse_args()
+
+    rng = random.Random(args.seed)
+    variants = supported_variants(args.basm, read_variants())
+    with open(args.output, "w") as out:
+        write_data(rng, out, args.tables)
+        write_bss(rng, out, max(1, args.tables // 10))
+        write_text(rng, out, variants, args.functions, args.externs, args.tables)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,77 @@
+/*
+ * Assembles a file through the incremental api and writes the object, for bench/incremental.py
+ * Takes the same command line as basm
+ *
+ * The source goes through a few edits first so the records the last update links are a mix of
+ * lines that were encoded somewhere else in the file and lines that were just encoded:
+ * the whole file, a line inserted at the top (every line moves), a block deleted from the middle, the whole file again
+ * The updates before the last one can fail, a deleted block can leave a .cfi_startproc open
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../entry.h"
+#include "../util.h"
+
+
+//the source with lines [skip_start, skip_end) left out and insert in front
+static char* edit_source(const char* source, size_t size, int skip_start, int skip_end, const char* insert, size_t* out_size){
+    char* result = malloc(size + strlen(insert) + 1);
+    if(result == NULL) return NULL;
+    size_t length = strlen(insert);
+    memcpy(result, insert, length);
+
+    int line = 0;
+    for(size_t start = 0; start < size; line++){
+        const char* end = memchr(source + start, '\n', size - start);
+        size_t line_size = (end != NULL) ? (size_t)(end - source) - start + 1 : size - start;
+        if(line < skip_start || line >= skip_end){
+            memcpy(result + length, source + start, line_size);
+            length += line_size;
+        }
+        start += line_size;
+    }
+    *out_size = length;
+    return result;
+}
+
+
+int main(int argc, char** argv){
+    AssemblerFlags flags = {0};
+    if(!basm_parse_flags(&flags, argc, argv) || flags.input_count != 1) return 1;
+
+    size_t size;
+    char* source = read_file(flags.input_files[0], &size);
+    if(source == NULL) return 1;
+    int lines = 0;
+    for(size_t i = 0; i < size; i++) lines += source[i] == '\n';
+
+    BasmIncremental* inc = basm_incremental_create(flags.input_files[0]);
+    if(inc == NULL) return 1;
+    BasmContext* ctx = basm_incremental_context(inc);
+    basm_context_set_options(ctx, flags.options);
+
+    struct {
+        int skip_start;
+        int skip_end;
+        const char* insert;
+    } edits[] = {
+        {0, 0, ""},
+        {0, 0, "\n"},
+        {lines / 3, lines / 2, ""},
+    };
+    for(size_t i = 0; i < sizeof(edits) / sizeof(edits[0]); i++){
+        size_t edited_size;
+        char* edited = edit_source(source, size, edits[i].skip_start, edits[i].skip_end, edits[i].insert, &edited_size);
+        if(edited == NULL) return 1;
+        basm_incremental_update(inc, edited, edited_size);
+        free(edited);
+    }
+
+    bool result = basm_incremental_update(inc, source, size) && basm_write_object(ctx, flags.ftype, flags.output_file);
+    if(!result) fprintf(stderr, "%s", basm_context_error(ctx));
+    basm_incremental_delete(inc);
+    free(source);
+    free(flags.input_files);
+    return result ? 0 : 1;
+}
@@ -0,0 +1,124 @@
+"""
+Assembles a generated corpus with basm and through the incremental api and checks that the objects are the same
+
+The corpus has every kind of section (data, bss, .rodata with constants to merge, a user section, .tdata/.tbss,
+.text.<name> and functions with .cfi_* directives) around the golden lines. bin/incremental (bench/incremental.c)
+edits the source a few times before the last update, so the object it writes is linked from lines that were encoded
+at other line numbers. Every option set has to give the same bytes, the sections that differ are printed
+"""
+import argparse
+import os
+import random
+import subprocess
+import sys
+import tempfile
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import debug_line
+import eh_frame
+import encoding
+import gen_corpus
+
+FLAG_SETS = [[], ["--function-sections"], ["--merge-constants"], ["--align-branches"], ["-g"], ["--auto-cfi"],
+             ["-g", "--auto-cfi", "--align-branches", "--function-sections"]]
+
+
+def write_sections(rng, out, constants):
+    out.write("section .rodata\n")
+    for i in range(constants):
+        #a few values come up again so --merge-constants has copies to remove
+        value = rng.randrange(8)
+        kind = rng.randrange(3)
+        if kind == 0:
+            out.write("    const_%d: dq %d\n" % (i, value))
+        elif kind == 1:
+            out.write("    const_%d: dd %d\n" % (i, value))
+        else:
+            out.write("    const_%d: db \"name %d\", 0\n" % (i, value))
+    out.write("section .counters nobits write align=64\n")
+    out.write("    counters: resq 16\n")
+    out.write("section .tdata\n")
+    out.write("    thread_id: dq 7\n")
+    out.write("section .tbss\n")
+    out.write("    thread_counter: resq 1\n")
+
+
+def write_hot(rng, out, constants):
+    out.write("section .text.hot align=64\n")
+    for i in range(8):
+        out.write("global hot_%d\n" % i)
+        out.write("hot_%d:\n" % i)
+        out.write("    mov rax, [fs:thread_counter@tpoff]\n")
+        out.write("    add rax, [const_%d]\n" % rng.randrange(constants))
+        out.write("    mov [fs:thread_counter@tpoff], rax\n")
+        out.write("    lea rdi, [counters]\n")
+        out.write("    ret\n")
+
+
+def check(basm, incremental, tmp, source, flags):
+    full, inc = os.path.join(tmp, "full.o"), os.path.join(tmp, "incremental.o")
+    subprocess.run([basm, "-f", "elf"] + flags + [source, "-o", full], check=True)
+    result = subprocess.run([incremental, "-f", "elf"] + flags + [source, "-o", inc], stderr=subprocess.PIPE, text=True)
+    if result.returncode != 0:
+        print("%-22s incremental update failed: %s" % (" ".join(flags) or "default", result.stderr.strip()))
+        return False
+
+    full_sections, inc_sections = debug_line.elf_section_list(full), debug_line.elf_section_list(inc)
+    errors = []
+    if [name for name, _ in full_sections] != [name for name, _ in inc_sections]:
+        errors.append("sections %s, incremental %s" % ([name for name, _ in full_sections], [name for name, _ in inc_sections]))
+    else:
+        for (name, data), (_, inc_data) in zip(full_sections, inc_sections):
+            if data != inc_data:
+                at = next((i for i, (a, b) in enumerate(zip(data, inc_data)) if a != b), min(len(data), len(inc_data)))
+                errors.append("%s differs at 0x%x (%d bytes, incremental %d)" % (name, at, len(data), len(inc_data)))
+    with open(full, "rb") as a, open(inc, "rb") as b:
+        size, same = os.path.getsize(full), a.read() == b.read()
+    if same and errors:
+        errors = []
+    elif not same and not errors:
+        errors.append("the headers differ")
+
+    print("%-22s %8d bytes, %s" % (" ".join(flags) or "default", size,
+                                   "%d sections differ" % len(errors) if errors else "same object"))
+    for error in errors[:20]:
+        print("    " + error)
+    return not errors
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--basm", default="bin/basm")
+    parser.add_argument("--incremental", default="bin/incremental")
+    parser.add_argument("--golden", default=encoding.DEFAULT_GOLDEN)
+    parser.add_argument("--functions", type=int, default=200)
+    args = parser.parse_args()
+    basm = os.path.abspath(args.basm.strip())
+    incremental = os.path.abspath(args.incremental.strip())
+
+    golden = [(asm, encoded) for _, asm, encoded in encoding.read_golden(args.golden) if encoded != encoding.ERROR]
+    variants = [(asm, [], "") for asm, _ in golden]
+    body_lines = [asm for asm, _ in golden if not eh_frame.STACK_USE.search(asm)]
+    with tempfile.TemporaryDirectory() as tmp:
+        source = os.path.join(tmp, "corpus.asm")
+        rng = random.Random(1)
+        with open(source, "w") as out:
+            gen_corpus.write_data(rng, out, 50)
+            gen_corpus.write_bss(rng, out, 10)
+            write_sections(rng, out, 100)
+            gen_corpus.write_text(rng, out, variants, args.functions, 20, 50)
+            write_hot(rng, out, 100)
+            #numbered after the functions of write_text so the labels don't clash
+            w = eh_frame.Writer(True)
+            w.line("section .text")
+            for i in range(20):
+                eh_frame.write_function(rng, w, args.functions + i, body_lines)
+            out.write("\n".join(w.lines) + "\n")
+        results = [check(basm, incremental, tmp, source, flags) for flags in FLAG_SETS]
+
+    if not all(results):
+        sys.exit("incremental check failed")
+
+
+if __name__ == "__main__":
+    main()
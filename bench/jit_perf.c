@@ -0,0 +1,81 @@
+/*
+ * JITs a file with the perf map and the jitdump turned on, for bench/jit_perf.py
+ * ./jit_perf source.asm dump_dir label...
+ * ./jit_perf --write-first source.asm label...
+ * Calls every label as a long(long) with 5 and prints the pid, then the address and result of every label
+ * --write-first writes the object to memory and then loads the same context, without the perf map and jitdump
+ * The extern plus2 resolves to a C function that adds 2
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "../entry.h"
+#include "../util.h"
+
+
+static long plus2(long x){
+    return x + 2;
+}
+
+
+static void* resolve(const char* name, void* user_data){
+    (void)user_data;
+    return (strcmp(name, "plus2") == 0) ? (void*)plus2 : NULL;
+}
+
+
+//assembles into a context, writes the object and loads the context after that
+static BasmJit* jit_write_first(const char* path, const char* source, size_t size, BasmJitOptions* options){
+    BasmContext* ctx = basm_context_create();
+    uint8_t* object = NULL;
+    size_t object_size = 0;
+    BasmJit* jit = NULL;
+    if(basm_assemble_source(ctx, path, source, size) && basm_write_object_memory(ctx, BASM_FILE_ELF, &object, &object_size)){
+        jit = basm_jit_load(ctx, options);
+    }
+    if(jit == NULL) fprintf(stderr, "%s", basm_context_error(ctx));
+    free(object);
+    basm_context_delete(ctx);
+    return jit;
+}
+
+
+int main(int argc, char** argv){
+    bool write_first = argc > 1 && strcmp(argv[1], "--write-first") == 0;
+    if(argc < 3){
+        fprintf(stderr, "./jit_perf source.asm dump_dir label...\n./jit_perf --write-first source.asm label...\n");
+        return 1;
+    }
+    size_t size;
+    char* source = read_file(argv[write_first ? 2 : 1], &size);
+    if(source == NULL) return 1;
+
+    BasmJitOptions options = {0};
+    options.resolver = resolve;
+    BasmJit* jit;
+    if(write_first){
+        jit = jit_write_first(argv[2], source, size, &options);
+    } else{
+        options.perf_map = true;
+        options.jitdump = true;
+        options.jitdump_dir = argv[2];
+        jit = basm_jit_assemble(source, size, &options);
+        if(jit == NULL) fprintf(stderr, "%s", options.error);
+    }
+    free(source);
+    if(jit == NULL) return 1;
+
+    printf("pid %d\n", (int)getpid());
+    for(int i = 3; i < argc; i++){
+        long (*function)(long) = (long (*)(long))basm_jit_lookup(jit, argv[i]);
+        if(function == NULL){
+            fprintf(stderr, "%s isn't in the jit\n", argv[i]);
+            basm_jit_free(jit);
+            return 1;
+        }
+        printf("%s %lx %ld\n", argv[i], (unsigned long)function, function(5));
+    }
+    basm_jit_free(jit);
+    return 0;
+}
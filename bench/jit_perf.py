@@ -0,0 +1,203 @@
+"""
+JITs a small program with the perf map and the jitdump turned on and checks what perf would read
+
+bin/jit_perf (bench/jit_perf.c) loads the program with basm_jit_assemble and calls its functions.
+/tmp/perf-<pid>.map has to have a line with the address, size and name of every label, and jit-<pid>.dump
+a header perf accepts (magic, version, size, machine, pid) and a JIT_CODE_LOAD record per label with
+the right size, pid, addresses, a code index that counts up, the name and the code. The code has to be
+the bytes basm writes to .text for the same source, the label sizes come from its listing.
+bin/jit_perf --write-first then writes an object of a program that calls an extern and loads the same context
+after that, the calls have to give the same results as a context that was never written
+"""
+import argparse
+import os
+import struct
+import subprocess
+import sys
+import tempfile
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import encoding
+
+#functions are called with 5
+SOURCE = """section .text
+global add1
+add1:
+    lea rax, [rdi+1]
+    ret
+global sum
+sum:
+    xor eax, eax
+.loop:
+    add rax, rdi
+    dec rdi
+    jne .loop
+    ret
+global twice
+twice:
+    call add1
+    lea rax, [rax+rax]
+    ret
+"""
+RESULTS = {"add1": 6, "sum": 15, "twice": 12}
+
+#plus2 is a C function of bin/jit_perf, writing the object must leave its relative call and its address in .data as they were
+WRITE_FIRST_SOURCE = SOURCE + """extern plus2
+global call_c
+call_c:
+    call plus2
+    ret
+global call_pointer
+call_pointer:
+    mov rax, [c_pointer]
+    call rax
+    ret
+section .data
+c_pointer: dq plus2
+"""
+WRITE_FIRST_RESULTS = dict(RESULTS, call_c=7, call_pointer=7)
+
+JITDUMP_MAGIC = 0x4A695444
+JITDUMP_VERSION = 1
+JITDUMP_CODE_LOAD = 0
+EM_X86_64 = 62
+HEADER = "<IIIIIIQQ"
+CODE_LOAD = "<IIQIIQQQQ"
+
+
+#name -> (offset, size) of the labels in .text
+def read_labels(listing):
+    labels = {}
+    with open(listing) as f:
+        in_labels = False
+        for line in f:
+            fields = line.split()
+            if line.startswith("label "):
+                in_labels = True
+            elif line.startswith("section "):
+                in_labels = False
+            elif in_labels and len(fields) == 4 and fields[1] == ".text":
+                labels[fields[0]] = (int(fields[2], 16), int(fields[3]))
+    return labels
+
+
+def check_perf_map(path, labels, base):
+    errors = []
+    with open(path) as f:
+        entries = [line.split() for line in f]
+    found = {name: (int(address, 16), int(size, 16)) for address, size, name in entries}
+    if len(found) != len(entries):
+        errors.append("a label is in %s more than once" % path)
+    for name, (offset, size) in sorted(labels.items()):
+        if found.get(name) != (base + offset, size):
+            errors.append("perf map has %s at %s, it's at 0x%x with %d bytes" %
+                          (name, "nothing" if name not in found else "0x%x with %d bytes" % found[name], base + offset, size))
+    errors += ["perf map has %s, which isn't a label" % name for name in sorted(set(found) - set(labels))]
+    return errors
+
+
+def check_jitdump(path, labels, base, pid, text):
+    with open(path, "rb") as f:
+        data = f.read()
+    errors = []
+    magic, version, size, machine, _, dump_pid, _, flags = struct.unpack_from(HEADER, data, 0)
+    expected = (JITDUMP_MAGIC, JITDUMP_VERSION, struct.calcsize(HEADER), EM_X86_64, pid, 0)
+    if (magic, version, size, machine, dump_pid, flags) != expected:
+        header = "magic 0x%x, version %d, size %d, machine %d, pid %d, flags %d"
+        errors.append("header is %s, not %s" % (header % (magic, version, size, machine, dump_pid, flags), header % expected))
+        return errors
+
+    records = {}
+    offset = size
+    while offset < len(data):
+        kind, record_size, _, record_pid, _, vma, code_addr, code_size, code_index = struct.unpack_from(CODE_LOAD, data, offset)
+        name_start = offset + struct.calcsize(CODE_LOAD)
+        name_end = data.index(b"\0", name_start)
+        name = data[name_start:name_end].decode()
+        code = data[name_end + 1:name_end + 1 + code_size]
+        if kind != JITDUMP_CODE_LOAD:
+            errors.append("record at 0x%x has id %d" % (offset, kind))
+        if record_size != name_end + 1 - offset + code_size:
+            errors.append("record of %s is %d bytes, it has %d" % (name, record_size, name_end + 1 - offset + code_size))
+        if record_pid != pid or vma != code_addr or code_index != len(records):
+            errors.append("record of %s has pid %d, vma 0x%x, code_addr 0x%x, code_index %d" % (name, record_pid, vma, code_addr, code_index))
+        records[name] = (code_addr, code)
+        offset += max(record_size, 1)
+
+    for name, (label_offset, label_size) in sorted(labels.items()):
+        expected = (base + label_offset, text[label_offset:label_offset + label_size])
+        if records.get(name) != expected:
+            found = "no record" if name not in records else "0x%x %s" % (records[name][0], records[name][1].hex())
+            errors.append("jitdump has %s for %s, not 0x%x %s" % (found, name, expected[0], expected[1].hex()))
+    errors += ["jitdump has %s, which isn't a label" % name for name in sorted(set(records) - set(labels))]
+    return errors
+
+
+#the extern program jitted straight away and after writing its object from the same context
+def check_write_first(jit_perf, tmp):
+    source = os.path.join(tmp, "write_first.asm")
+    with open(source, "w") as out:
+        out.write(WRITE_FIRST_SOURCE)
+    errors = []
+    for write_first in (False, True):
+        arguments = ["--write-first", source] if write_first else [source, tmp]
+        run = subprocess.run([jit_perf] + arguments + sorted(WRITE_FIRST_RESULTS), stdout=subprocess.PIPE, stderr=subprocess.PIPE, text=True)
+        how = "after writing the object" if write_first else "without writing the object"
+        if run.returncode != 0:
+            errors.append("jit_perf failed %s: %s" % (how, run.stderr.strip()))
+            continue
+        #the plain run writes a perf map like the one of main
+        if not write_first:
+            os.remove("/tmp/perf-%d.map" % int(run.stdout.split()[1]))
+        for name, _, result in (line.split() for line in run.stdout.splitlines()[1:]):
+            if int(result) != WRITE_FIRST_RESULTS[name]:
+                errors.append("%s(5) returned %s %s, not %d" % (name, result, how, WRITE_FIRST_RESULTS[name]))
+    return errors
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--basm", default="bin/basm")
+    parser.add_argument("--jit-perf", default="bin/jit_perf")
+    args = parser.parse_args()
+    basm = os.path.abspath(args.basm.strip())
+    jit_perf = os.path.abspath(args.jit_perf.strip())
+
+    with tempfile.TemporaryDirectory() as tmp:
+        source, obj, listing = (os.path.join(tmp, name) for name in ("jit.asm", "jit.o", "jit.lst"))
+        with open(source, "w") as out:
+            out.write(SOURCE)
+        subprocess.run([basm, "-f", "elf", source, "-o", obj, "-l", listing], check=True)
+        text = encoding.elf_sections(obj)[".text"]
+        labels = read_labels(listing)
+
+        output = subprocess.run([jit_perf, source, tmp] + sorted(RESULTS), check=True, stdout=subprocess.PIPE, text=True).stdout
+        lines = [line.split() for line in output.splitlines()]
+        pid = int(lines[0][1])
+        perf_map = "/tmp/perf-%d.map" % pid
+        try:
+            errors = []
+            addresses = {}
+            for name, address, result in lines[1:]:
+                addresses[name] = int(address, 16)
+                if int(result) != RESULTS[name]:
+                    errors.append("%s(5) returned %s, not %d" % (name, result, RESULTS[name]))
+            base = addresses["add1"] - labels["add1"][0]
+            errors += ["%s is at 0x%x in the jit, not 0x%x" % (name, address, base + labels[name][0])
+                       for name, address in sorted(addresses.items()) if address != base + labels[name][0]]
+            errors += check_perf_map(perf_map, labels, base)
+            errors += check_jitdump(os.path.join(tmp, "jit-%d.dump" % pid), labels, base, pid, text)
+        finally:
+            if os.path.exists(perf_map):
+                os.remove(perf_map)
+        errors += check_write_first(jit_perf, tmp)
+
+    print("%d labels, %d bytes of code, %s" % (len(labels), len(text), "%d errors" % len(errors) if errors else "perf map and jitdump match, same results after writing the object"))
+    for error in errors[:20]:
+        print("    " + error)
+    if errors:
+        sys.exit("jit perf check failed")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,94 @@
+"""
+Starts basm --serve on a socket in a temporary directory and checks that --client gets the objects basm writes itself
+
+The server runs in another working directory than the client, which sends a generated corpus by its relative name.
+Every option set has to give the same bytes as a local assemble (the file symbol and the -g line table name
+the file as it was typed and the directory of the client), an error has to come back with the same message,
+and the socket has to be mode 0600
+"""
+import argparse
+import os
+import random
+import stat
+import subprocess
+import sys
+import tempfile
+import time
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import encoding
+import gen_corpus
+
+FLAG_SETS = [[], ["-g"], ["--function-sections", "--auto-cfi"]]
+
+
+def run(basm, cwd, args):
+    return subprocess.run([basm] + args, cwd=cwd, stdout=subprocess.PIPE, stderr=subprocess.PIPE, text=True)
+
+
+def check(basm, work, socket, flags, name):
+    local = run(basm, work, ["-f", "elf"] + flags + [name, "-o", "local.o"])
+    client = run(basm, work, ["--client", socket, "-f", "elf"] + flags + [name, "-o", "client.o"])
+    errors = []
+    if local.returncode != 0 or client.returncode != 0:
+        if (local.returncode, local.stderr) != (client.returncode, client.stderr):
+            errors.append("basm exited with %d: %s, the client with %d: %s" %
+                          (local.returncode, local.stderr.strip(), client.returncode, client.stderr.strip()))
+        result = "same error" if not errors else "different errors"
+    else:
+        with open(os.path.join(work, "local.o"), "rb") as a, open(os.path.join(work, "client.o"), "rb") as b:
+            local_object, client_object = a.read(), b.read()
+        if local_object != client_object:
+            at = next((i for i, (x, y) in enumerate(zip(local_object, client_object)) if x != y), min(len(local_object), len(client_object)))
+            errors.append("the objects differ at 0x%x (%d bytes, client %d)" % (at, len(local_object), len(client_object)))
+        result = "%d bytes, %s" % (len(local_object), "different objects" if errors else "same object")
+
+    print("%-12s %-34s %s" % (name, " ".join(flags) or "default", result))
+    for error in errors:
+        print("    " + error)
+    return not errors
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--basm", default="bin/basm")
+    parser.add_argument("--golden", default=encoding.DEFAULT_GOLDEN)
+    parser.add_argument("--functions", type=int, default=100)
+    args = parser.parse_args()
+    basm = os.path.abspath(args.basm.strip())
+
+    variants = [(asm, [], "") for _, asm, encoded in encoding.read_golden(args.golden) if encoded != encoding.ERROR]
+    with tempfile.TemporaryDirectory() as tmp:
+        work, server_dir = os.path.join(tmp, "work"), os.path.join(tmp, "server")
+        os.mkdir(work)
+        os.mkdir(server_dir)
+        rng = random.Random(1)
+        with open(os.path.join(work, "corpus.asm"), "w") as out:
+            gen_corpus.write_data(rng, out, 50)
+            gen_corpus.write_bss(rng, out, 10)
+            gen_corpus.write_text(rng, out, variants, args.functions, 20, 50)
+        with open(os.path.join(work, "broken.asm"), "w") as out:
+            out.write("section .text\nf:\n    mov rax, rbx, rcx\n")
+
+        socket = os.path.join(tmp, "basm.sock")
+        server = subprocess.Popen([basm, "--serve", socket], cwd=server_dir)
+        try:
+            for _ in range(100):
+                if os.path.exists(socket):
+                    break
+                time.sleep(0.05)
+            mode = stat.S_IMODE(os.stat(socket).st_mode)
+            results = [mode == 0o600]
+            print("socket mode %o, %s" % (mode, "only the user can connect" if results[0] else "should be 600"))
+            results += [check(basm, work, socket, flags, "corpus.asm") for flags in FLAG_SETS]
+            results.append(check(basm, work, socket, [], "broken.asm"))
+        finally:
+            server.kill()
+            server.wait()
+
+    if not all(results):
+        sys.exit("server check failed")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,235 @@
+#include "util.h"
+#include "entry.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/file.h>
+#include <time.h>
+
+
+/*
+ * Objects are stored as <cache dir>/<hash> where the hash covers everything
+ * that ends up in the object: the source, the input name, the flags and the version
+ * Entries are written to a temp file and renamed into place so concurrent builds
+ * never see a partial object, and a hit updates the mtime so eviction is LRU
+ * <cache dir>/.size has a running total of the entries so a store only scans the directory
+ * once the total passes the limit
+ */
+#define CACHE_TEMP_PREFIX "tmp."
+#define CACHE_TEMP_MAX_AGE (60 * 60)
+#define CACHE_SIZE_FILE ".size"
+
+//eviction deletes entries until the cache is this far under the limit, so the total takes a while to pass it again
+#define CACHE_EVICT_PERCENT 90
+
+//the total drifts when entries are overwritten or deleted by something else, a scan every so many stores sets it right
+#define CACHE_RESCAN_STORES 1000
+
+
+//128 bit FNV-1a
+#define FNV_PRIME ((((__uint128_t)0x0000000001000000ULL) << 64) | 0x000000000000013BULL)
+#define FNV_OFFSET ((((__uint128_t)0x6C62272E07BB0142ULL) << 64) | 0x62B821756295C58DULL)
+
+static __uint128_t hash_bytes(__uint128_t hash, const void* data, size_t size){
+    const uint8_t* bytes = data;
+    for(size_t i = 0; i < size; i++){
+        hash ^= bytes[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+
+//the length goes first so "ab" + "c" and "a" + "bc" don't hash the same
+static __uint128_t hash_field(__uint128_t hash, const void* data, size_t size){
+    uint64_t length = size;
+    hash = hash_bytes(hash, &length, sizeof(length));
+    return hash_bytes(hash, data, size);
+}
+
+
+
+//every flag that changes the object has to be part of the key
+CacheKey cache_key(AssemblerFlags* flags, const char* input_file, const char* source, size_t size){
+    uint32_t ftype = flags->ftype;
+
+    __uint128_t hash = FNV_OFFSET;
+    hash = hash_field(hash, BASM_VERSION, strlen(BASM_VERSION));
+    hash = hash_field(hash, &ftype, sizeof(ftype));
+    hash = hash_field(hash, &flags->options, sizeof(flags->options));
+    hash = hash_field(hash, input_file, strlen(input_file));
+    hash = hash_field(hash, source, size);
+    //-g objects hold the directory they were assembled in
+    char directory[4096];
+    if((flags->options & BASM_OPTION_DEBUG_LINES) && getcwd(directory, sizeof(directory)) != NULL){
+        hash = hash_field(hash, directory, strlen(directory));
+    }
+
+    CacheKey key = {(uint64_t)(hash >> 64), (uint64_t)hash};
+    return key;
+}
+
+
+static void cache_path(char* path, size_t size, const char* cache_dir, CacheKey key){
+    snprintf(path, size, "%s/%016lx%016lx", cache_dir, key.high, key.low);
+}
+
+
+
+bool cache_fetch(const char* cache_dir, CacheKey key, const char* output_file, bool executable){
+    char path[4096];
+    cache_path(path, sizeof(path), cache_dir, key);
+
+    size_t size;
+    char* data = read_file(path, &size);
+    if(data == NULL) return false;
+
+    bool result = write_file(output_file, data, size, executable);
+    free(data);
+
+    //mark the entry as recently used
+    if(result) utimensat(AT_FDCWD, path, NULL, 0);
+    return result;
+}
+
+
+
+typedef struct {
+    char* name;
+    uint64_t size;
+    struct timespec mtime;
+} CacheEntry;
+
+
+static int compare_cache_entry(const void* p1, const void* p2){
+    const CacheEntry* e1 = p1;
+    const CacheEntry* e2 = p2;
+    if(e1->mtime.tv_sec != e2->mtime.tv_sec) return (e1->mtime.tv_sec < e2->mtime.tv_sec) ? -1 : 1;
+    if(e1->mtime.tv_nsec != e2->mtime.tv_nsec) return (e1->mtime.tv_nsec < e2->mtime.tv_nsec) ? -1 : 1;
+    return 0;
+}
+
+
+//deletes the least recently used entries if the cache is over the limit, returns the size of the entries left
+static uint64_t cache_evict(const char* cache_dir, uint64_t max_size){
+    DIR* dir = opendir(cache_dir);
+    if(dir == NULL) return 0;
+
+    ArrayList entries;
+    array_list_create_cap(entries, CacheEntry, 64);
+    uint64_t total = 0;
+    char path[4096];
+
+    struct dirent* ent;
+    while((ent = readdir(dir)) != NULL){
+        if(ent->d_name[0] == '.') continue;
+
+        struct stat st;
+        snprintf(path, sizeof(path), "%s/%s", cache_dir, ent->d_name);
+        if(stat(path, &st) != 0 || !S_ISREG(st.st_mode)) continue;
+
+        //temp files from a build that died before renaming them
+        if(strncmp(ent->d_name, CACHE_TEMP_PREFIX, strlen(CACHE_TEMP_PREFIX)) == 0){
+            if(st.st_mtime + CACHE_TEMP_MAX_AGE < time(NULL)) unlink(path);
+            continue;
+        }
+
+        CacheEntry entry = {strdup(ent->d_name), st.st_size, st.st_mtim};
+        if(entry.name == NULL) continue;
+        array_list_append(entries, CacheEntry, entry);
+        total += st.st_size;
+    }
+    closedir(dir);
+
+    if(total > max_size){
+        qsort(entries.data, entries.size, sizeof(CacheEntry), compare_cache_entry);
+        uint64_t target = max_size / 100 * CACHE_EVICT_PERCENT;
+
+        //another build might be evicting the same entries, that's fine
+        for(int i = 0; i < entries.size && total > target; i++){
+            CacheEntry entry = array_list_get(entries, CacheEntry, i);
+            snprintf(path, sizeof(path), "%s/%s", cache_dir, entry.name);
+            unlink(path);
+            total -= entry.size;
+        }
+    }
+
+    for(int i = 0; i < entries.size; i++){
+        free(array_list_get(entries, CacheEntry, i).name);
+    }
+    free(entries.data);
+    return total;
+}
+
+
+typedef struct {
+    uint64_t size; //of the entries
+    uint64_t stores; //since the last scan
+} CacheSize;
+
+
+//adds a new entry to the running total, the directory is only scanned when it passes the limit
+//the lock keeps the total of concurrent builds and makes them wait for the one that evicts
+static void cache_add_size(const char* cache_dir, uint64_t size, uint64_t max_size){
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/" CACHE_SIZE_FILE, cache_dir);
+    int fd = open(path, O_RDWR | O_CREAT, 0644);
+    if(fd < 0) return;
+    if(flock(fd, LOCK_EX) != 0){
+        close(fd);
+        return;
+    }
+
+    CacheSize total = {0};
+    //a new cache or one written by an older basm
+    bool scan = pread(fd, &total, sizeof(total), 0) != sizeof(total);
+    total.size += size;
+    total.stores++;
+    if(scan || total.size > max_size || total.stores >= CACHE_RESCAN_STORES){
+        total.size = cache_evict(cache_dir, max_size);
+        total.stores = 0;
+    }
+    pwrite(fd, &total, sizeof(total), 0);
+    close(fd);
+}
+
+
+
+void cache_store(const char* cache_dir, CacheKey key, const void* data, size_t size, uint64_t max_size){
+    if(mkdir(cache_dir, 0755) != 0 && errno != EEXIST) return;
+    uint64_t entry_size = size;
+
+    char temp_path[4096];
+    snprintf(temp_path, sizeof(temp_path), "%s/" CACHE_TEMP_PREFIX "XXXXXX", cache_dir);
+    int fd = mkstemp(temp_path);
+    if(fd < 0) return;
+    fchmod(fd, 0644);
+
+    bool result = true;
+    const uint8_t* bytes = data;
+    while(result && size > 0){
+        ssize_t count = write(fd, bytes, size);
+        result = count > 0;
+        if(result){
+            bytes += count;
+            size -= count;
+        }
+    }
+    result = (close(fd) == 0) && result;
+
+    char path[4096];
+    cache_path(path, sizeof(path), cache_dir, key);
+    if(!result || rename(temp_path, path) != 0){
+        unlink(temp_path);
+        return;
+    }
+
+    cache_add_size(cache_dir, entry_size, max_size);
+}
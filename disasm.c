@@ -0,0 +1,887 @@
+#include "x86/decode_table.h"
+#include "util.h"
+#include "entry.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/*
+ * The decoder reads the prefixes and the opcode byte, then checks the variants in the bucket of that
+ * byte's DECODE_KEYS for the prefix class, modrm.reg and the DECODE_MATCH_ bits (66, rex.w, vex.l, mod 3),
+ * which generate_table.py builds from the same instructions.dat as the assembler's table. Most buckets
+ * have a single variant, the first one whose remaining opcode bytes fit is used, the generator puts the most specific ones first
+ * The text it writes is basm source, so assembling it again gives back the same bytes
+ */
+#define DECODE_MAX_LENGTH 15
+
+#define REX_W 8
+#define REX_R 4
+#define REX_X 2
+#define REX_B 1
+
+
+//indexed with the DECODE_REGS_ classes of the table
+static const char* REGISTER_NAMES[][16] = {
+    [DECODE_REGS_NONE] = {"?", "?", "?", "?", "?", "?", "?", "?", "?", "?", "?", "?", "?", "?", "?", "?"},
+    [DECODE_REGS_8] = {"al", "cl", "dl", "bl", "ah", "ch", "dh", "bh", "r8b", "r9b", "r10b", "r11b", "r12b", "r13b", "r14b", "r15b"},
+    [DECODE_REGS_16] = {"ax", "cx", "dx", "bx", "sp", "bp", "si", "di", "r8w", "r9w", "r10w", "r11w", "r12w", "r13w", "r14w", "r15w"},
+    [DECODE_REGS_32] = {"eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi", "r8d", "r9d", "r10d", "r11d", "r12d", "r13d", "r14d", "r15d"},
+    [DECODE_REGS_64] = {"rax", "rcx", "rdx", "rbx", "rsp", "rbp", "rsi", "rdi", "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15"},
+    [DECODE_REGS_MM] = {"mm0", "mm1", "mm2", "mm3", "mm4", "mm5", "mm6", "mm7", "mm0", "mm1", "mm2", "mm3", "mm4", "mm5", "mm6", "mm7"},
+    [DECODE_REGS_XMM] = {"xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6", "xmm7",
+                         "xmm8", "xmm9", "xmm10", "xmm11", "xmm12", "xmm13", "xmm14", "xmm15"},
+    [DECODE_REGS_YMM] = {"ymm0", "ymm1", "ymm2", "ymm3", "ymm4", "ymm5", "ymm6", "ymm7",
+                         "ymm8", "ymm9", "ymm10", "ymm11", "ymm12", "ymm13", "ymm14", "ymm15"},
+    [DECODE_REGS_ST] = {"st0", "st1", "st2", "st3", "st4", "st5", "st6", "st7", "st0", "st1", "st2", "st3", "st4", "st5", "st6", "st7"},
+    [DECODE_REGS_SEGMENT] = {"es", "cs", "ss", "ds", "fs", "gs", "?", "?", "?", "?", "?", "?", "?", "?", "?", "?"},
+};
+
+//any rex prefix turns ah, ch, dh and bh into these
+static const char* REGISTER_NAMES_8_REX[16] = {
+    "al", "cl", "dl", "bl", "spl", "bpl", "sil", "dil", "r8b", "r9b", "r10b", "r11b", "r12b", "r13b", "r14b", "r15b"
+};
+
+
+
+typedef struct {
+    const uint8_t* code;
+    size_t size;
+    size_t pos; //first byte after the opcode byte the variants are indexed with
+
+    bool operand_size_prefix;
+    bool address_size_prefix;
+    uint8_t rep;
+    const char* segment; //fs or gs override of the memory operand
+    bool has_rex;
+    uint8_t rex; //vex R, X, B and W are stored here too
+
+    bool vex;
+    uint8_t vex_l;
+    uint8_t vex_pp;
+    uint8_t vvvv;
+} Decoder;
+
+
+//the bucket already matched the prefix class, modrm.reg and the DECODE_MATCH_ state, what's left are the opcode bytes after the first
+static bool variant_matches(Decoder* d, const DecodeVariant* v){
+    if(v->extra_count == 0) return !(v->modrm & DECODE_MODRM) || d->pos < d->size;
+
+    size_t pos = d->pos;
+    for(int i = 0; i < v->extra_count; i++, pos++){
+        if(pos >= d->size) return false;
+        uint8_t byte = d->code[pos];
+        if(i + 1 == v->extra_count && (v->flags & DECODE_REG_IN_OPCODE)){
+            if(byte < v->extra[i] || byte > v->extra[i] + 7) return false;
+        } else if(byte != v->extra[i]){
+            return false;
+        }
+    }
+
+    if(!(v->modrm & DECODE_MODRM)) return true;
+    if(pos >= d->size) return false;
+
+    uint8_t modrm = d->code[pos];
+    if(v->digit != -1 && ((modrm >> 3) & 7) != v->digit) return false;
+    if((modrm >> 6) == 3) return !(v->modrm & DECODE_MODRM_MEMORY);
+    return !(v->modrm & DECODE_MODRM_REGISTER);
+}
+
+
+
+static inline const char* register_name(Decoder* d, uint8_t class, uint8_t index){
+    if(class == DECODE_REGS_8 && d->has_rex) return REGISTER_NAMES_8_REX[index & 15];
+    return REGISTER_NAMES[class][index & 15];
+}
+
+
+static int64_t read_value(const uint8_t* code, uint8_t size, bool sign_extend){
+    switch(size){
+        case 1: return sign_extend ? (int64_t)(int8_t)code[0] : (int64_t)code[0];
+        case 2: {
+            uint16_t value;
+            memcpy(&value, code, 2);
+            return sign_extend ? (int64_t)(int16_t)value : (int64_t)value;
+        }
+        case 4: {
+            uint32_t value;
+            memcpy(&value, code, 4);
+            return sign_extend ? (int64_t)(int32_t)value : (int64_t)value;
+        }
+        default: {
+            int64_t value;
+            memcpy(&value, code, 8);
+            return value;
+        }
+    }
+}
+
+
+//fills in a memory operand from the bytes after the modrm byte, returns the position after the displacement or 0
+static size_t decode_memory(Decoder* d, uint8_t modrm, size_t pos, BasmDecodedOperand* op){
+    uint8_t mod = modrm >> 6;
+    uint8_t rm = modrm & 7;
+    uint8_t address = d->address_size_prefix ? DECODE_REGS_32 : DECODE_REGS_64;
+
+    *op = (BasmDecodedOperand){.kind = BASM_DECODED_MEM, .segment = d->segment};
+    uint8_t disp_size = (mod == 1) ? 1 : (mod == 2) ? 4 : 0;
+
+    if(rm == 4){
+        if(pos >= d->size) return 0;
+        uint8_t sib = d->code[pos++];
+        uint8_t base = (sib & 7) | ((d->rex & REX_B) ? 8 : 0);
+        uint8_t index = ((sib >> 3) & 7) | ((d->rex & REX_X) ? 8 : 0);
+
+        //an index of 100 means there is no index and a base of 101 without a displacement means there is no base
+        if(index != 4){
+            op->index = REGISTER_NAMES[address][index];
+            op->scale = 1 << (sib >> 6);
+        }
+        if((sib & 7) == 5 && mod == 0){
+            disp_size = 4;
+        } else {
+            op->reg = REGISTER_NAMES[address][base];
+        }
+    } else if(rm == 5 && mod == 0){
+        op->rip = true;
+        disp_size = 4;
+    } else {
+        op->reg = REGISTER_NAMES[address][rm | ((d->rex & REX_B) ? 8 : 0)];
+    }
+
+    if(pos + disp_size > d->size) return 0;
+    if(disp_size != 0){
+        op->value = read_value(d->code + pos, disp_size, true);
+        op->field_offset = pos;
+    }
+    return pos + disp_size;
+}
+
+
+static inline void set_register(BasmDecodedOperand* op, const char* name){
+    *op = (BasmDecodedOperand){.kind = BASM_DECODED_REG, .reg = name};
+}
+
+
+//the operands are in the order of their bytes, the memory operand always comes before the immediates
+static int decode_operands(Decoder* d, const DecodeVariant* v, BasmDecoded* instr){
+    instr->mnemonic = v->mnemonic;
+
+    size_t pos = d->pos + v->extra_count;
+    uint8_t opcode_reg = d->code[pos - 1] & 7;
+    uint8_t modrm = 0;
+    if(v->modrm & DECODE_MODRM) modrm = d->code[pos++];
+    bool memory = (modrm >> 6) != 3;
+    //the register of every role that names one, fixed registers have theirs in the size and the rm is one only with a mod of 3
+    //the fpu stack registers repeat after st7, so rex.b doesn't change them
+    uint8_t index[DECODE_ROLE_VVVV + 1] = {
+        [DECODE_ROLE_REG] = ((modrm >> 3) & 7) | ((d->rex & REX_R) ? 8 : 0),
+        [DECODE_ROLE_RM] = (modrm & 7) | ((d->rex & REX_B) ? 8 : 0),
+        [DECODE_ROLE_OPCODE] = opcode_reg | ((d->rex & REX_B) ? 8 : 0),
+        [DECODE_ROLE_VVVV] = d->vvvv,
+    };
+    unsigned registers = (1 << DECODE_ROLE_FIXED) | (1 << DECODE_ROLE_REG) | (1 << DECODE_ROLE_OPCODE) | (1 << DECODE_ROLE_VVVV) | (memory ? 0 : 1 << DECODE_ROLE_RM);
+
+    //the operands without a role are all at the end
+    int i = 0;
+    for(; i < 4 && v->role[i] != DECODE_ROLE_NONE; i++){
+        BasmDecodedOperand* op = &instr->operands[i];
+        uint8_t role = v->role[i];
+        uint8_t bytes = v->size[i];
+
+        if(registers & (1 << role)){
+            set_register(op, register_name(d, v->regs[i], (role == DECODE_ROLE_FIXED) ? bytes : index[role]));
+        } else if(role == DECODE_ROLE_RM){
+            pos = decode_memory(d, modrm, pos, op);
+            if(pos == 0) return 0;
+            op->size = bytes;
+        } else if(role == DECODE_ROLE_IS4){
+            if(pos >= d->size) return 0;
+            set_register(op, register_name(d, v->regs[i], d->code[pos++] >> 4));
+        } else {
+            if(pos + bytes > d->size) return 0;
+            bool relative = role == DECODE_ROLE_REL;
+            *op = (BasmDecodedOperand){.kind = relative ? BASM_DECODED_REL : BASM_DECODED_IMM, .size = bytes};
+            op->field_offset = pos;
+            op->value = read_value(d->code + pos, bytes, relative || (v->flags & DECODE_SIGN_EXTEND));
+            pos += bytes;
+        }
+    }
+
+    instr->operand_count = i;
+    instr->length = pos;
+    return pos;
+}
+
+
+
+//the prefix class the variants are keyed by: the vex pp, or 66, f2 or f3 with a rep prefix before 66
+static inline int decode_class(const Decoder* d){
+    if(d->vex) return d->vex_pp;
+    if(d->rep != 0) return (d->rep == 0xF2) ? DECODE_CLASS_F2 : DECODE_CLASS_F3;
+    return d->operand_size_prefix ? DECODE_CLASS_66 : DECODE_CLASS_NONE;
+}
+
+
+int basm_decode(const uint8_t* code, size_t size, BasmDecoded* instr){
+    Decoder d = {0};
+    d.code = code;
+    d.size = (size < DECODE_MAX_LENGTH) ? size : DECODE_MAX_LENGTH;
+
+    size_t pos = 0;
+    for(; pos < d.size; pos++){
+        uint8_t byte = code[pos];
+        if(byte == 0x66) d.operand_size_prefix = true;
+        else if(byte == 0x67) d.address_size_prefix = true;
+        else if(byte == 0x64) d.segment = "fs";
+        else if(byte == 0x65) d.segment = "gs";
+        else if(byte == 0xF2 || byte == 0xF3) d.rep = byte;
+        else break;
+    }
+    if(pos < d.size && (code[pos] & 0xF0) == 0x40){
+        d.has_rex = true;
+        d.rex = code[pos++];
+    }
+    if(pos >= d.size) return 0;
+
+    int map = DECODE_MAP_LEGACY;
+    uint8_t byte = code[pos];
+    if((byte == 0xC4 || byte == 0xC5) && !d.has_rex && !d.operand_size_prefix && d.rep == 0){
+        //the R, X, B and vvvv bits are stored inverted
+        int vex_map = 1;
+        uint8_t last;
+        if(byte == 0xC5){
+            if(pos + 2 >= d.size) return 0;
+            last = code[pos + 1];
+            d.rex = (last & 0x80) ? 0 : REX_R;
+            pos += 2;
+        } else {
+            if(pos + 3 >= d.size) return 0;
+            uint8_t first = code[pos + 1];
+            last = code[pos + 2];
+            d.rex = ((first & 0x80) ? 0 : REX_R) | ((first & 0x40) ? 0 : REX_X) | ((first & 0x20) ? 0 : REX_B) | ((last & 0x80) ? REX_W : 0);
+            vex_map = first & 0x1F;
+            pos += 3;
+        }
+        if(vex_map < 1 || vex_map > 3) return 0;
+        map = DECODE_MAP_VEX + vex_map;
+        d.vex = true;
+        d.vvvv = (~last >> 3) & 0xF;
+        d.vex_l = (last >> 2) & 1;
+        d.vex_pp = last & 3;
+    } else if(byte == 0x0F){
+        map++;
+        pos++;
+        if(pos < d.size && (code[pos] == 0x38 || code[pos] == 0x3A)){
+            map += (code[pos] == 0x3A) ? 2 : 1;
+            pos++;
+        }
+    }
+    if(pos >= d.size) return 0;
+
+    uint8_t opcode = code[pos];
+    d.pos = pos + 1;
+    //the byte after the opcode is read as the modrm even if there is none
+    uint8_t next = (d.pos < d.size) ? code[d.pos] : 0;
+    uint8_t state = (d.operand_size_prefix ? DECODE_MATCH_SIZE_16 : 0) | ((d.rex & REX_W) ? DECODE_MATCH_REX_W : 0) | (d.vex_l ? DECODE_MATCH_VEX_L : 0)
+                  | (((next >> 6) == 3) ? DECODE_MATCH_MOD_3 : 0)
+                  | ((!d.vex && opcode == 0x90 && ((d.rex & REX_B) || d.operand_size_prefix)) ? DECODE_MATCH_XCHG : 0);
+    const DecodeKey* key = &DECODE_KEYS[map * 256 + opcode];
+    int class_slot = (key->classes >> (decode_class(&d) * 2)) & 3;
+    int bucket = key->first + class_slot * key->class_step + ((next >> 3) & 7) * key->reg_step + DECODE_STATE_INDEX[key->state_mask][state];
+    for(const DecodeVariant* v = &DECODE_VARIANTS[bucket]; v->mnemonic != NULL; v = &DECODE_VARIANTS[v->next]){
+        if(variant_matches(&d, v)) return decode_operands(&d, v, instr);
+    }
+    return 0;
+}
+
+
+
+typedef struct {
+    char* p;
+    char* end;
+} Writer;
+
+
+static void write_str(Writer* w, const char* str){
+    while(*str != '\0' && w->p < w->end) *w->p++ = *str++;
+}
+
+
+static const char HEX_DIGITS[] = "0123456789abcdef";
+
+static void write_hex(Writer* w, uint64_t value){
+    char temp[16];
+    int count = 0;
+    do {
+        temp[count++] = HEX_DIGITS[value & 0xF];
+        value >>= 4;
+    } while(value != 0);
+
+    write_str(w, "0x");
+    while(count > 0 && w->p < w->end) *w->p++ = temp[--count];
+}
+
+
+//always two digits and no 0x, for the bytes of the listing
+static void write_byte(Writer* w, uint8_t byte){
+    if(w->end - w->p < 2) return;
+    *w->p++ = HEX_DIGITS[byte >> 4];
+    *w->p++ = HEX_DIGITS[byte & 0xF];
+}
+
+
+static void write_signed(Writer* w, int64_t value){
+    if(value < 0){
+        write_str(w, "-");
+        write_hex(w, -(uint64_t)value);
+    } else {
+        write_hex(w, value);
+    }
+}
+
+
+static void write_memory_size(Writer* w, uint8_t size){
+    switch(size){
+        case 1: write_str(w, "byte "); break;
+        case 2: write_str(w, "word "); break;
+        case 4: write_str(w, "dword "); break;
+        case 8: write_str(w, "qword "); break;
+        case 10: write_str(w, "tword "); break;
+        case 16: write_str(w, "dqword "); break;
+        case 32: write_str(w, "yword "); break;
+        default: break;
+    }
+}
+
+
+
+//the names of the relocations and labels of a file, NULL when formatting a single instruction
+typedef struct Listing Listing;
+
+static bool listing_write_field(Listing* listing, Writer* w, const BasmDecoded* instr, uint64_t address, const BasmDecodedOperand* op);
+
+static bool listing_write_target(Listing* listing, Writer* w, uint64_t target);
+
+
+static void write_instruction(Writer* w, const BasmDecoded* instr, uint64_t address, Listing* listing){
+    write_str(w, instr->mnemonic);
+
+    for(int i = 0; i < instr->operand_count; i++){
+        const BasmDecodedOperand* op = &instr->operands[i];
+        write_str(w, (i == 0) ? " " : ", ");
+
+        switch(op->kind){
+            case BASM_DECODED_REG:
+                write_str(w, op->reg);
+                break;
+
+            case BASM_DECODED_IMM:
+                if(listing != NULL && listing_write_field(listing, w, instr, address, op)) break;
+                write_signed(w, op->value);
+                break;
+
+            case BASM_DECODED_REL: {
+                uint64_t target = address + instr->length + op->value;
+                if(listing != NULL && (listing_write_field(listing, w, instr, address, op) || listing_write_target(listing, w, target))) break;
+                write_hex(w, target);
+                break;
+            }
+
+            case BASM_DECODED_MEM: {
+                write_memory_size(w, op->size);
+                write_str(w, "[");
+                if(op->segment != NULL){
+                    write_str(w, op->segment);
+                    write_str(w, ":");
+                }
+                if(listing != NULL && listing_write_field(listing, w, instr, address, op)){
+                    write_str(w, "]");
+                    break;
+                }
+                if(op->rip){
+                    uint64_t target = address + instr->length + op->value;
+                    if(listing == NULL || !listing_write_target(listing, w, target)){
+                        write_str(w, "rip + ");
+                        write_hex(w, target);
+                    }
+                    write_str(w, "]");
+                    break;
+                }
+
+                //the displacement goes before the index since basm can't parse it after a scale
+                bool first = true;
+                if(op->reg != NULL){
+                    write_str(w, op->reg);
+                    first = false;
+                }
+                if(op->value != 0 || (op->reg == NULL && op->index == NULL)){
+                    if(!first) write_str(w, (op->value < 0) ? " - " : " + ");
+                    if(first) write_signed(w, op->value);
+                    else write_hex(w, (op->value < 0) ? -(uint64_t)op->value : (uint64_t)op->value);
+                    first = false;
+                }
+                if(op->index != NULL){
+                    if(!first) write_str(w, " + ");
+                    write_str(w, op->index);
+                    if(op->scale != 1 || op->reg == NULL){
+                        write_str(w, " * ");
+                        *w->p = '0' + op->scale;
+                        if(w->p < w->end) w->p++;
+                    }
+                }
+                write_str(w, "]");
+                break;
+            }
+        }
+    }
+}
+
+
+int basm_format_decoded(const BasmDecoded* instr, uint64_t address, char* buffer, size_t size){
+    if(size == 0) return 0;
+    Writer w = {buffer, buffer + size - 1};
+    write_instruction(&w, instr, address, NULL);
+    *w.p = '\0';
+    return w.p - buffer;
+}
+
+
+
+/*
+ * Files are written as source that basm can assemble again: externs and globals,
+ * the data and bss sections split at every symbol, then the code with a label at every
+ * symbol and branch target. Relocated fields are written as the symbol they refer to
+ * Labels that aren't symbols are named after their section and offset (L_1f, D_8, B_0)
+ */
+
+
+struct Listing {
+    ObjectFile* obj;
+    uint64_t sizes[SECTION_BSS + 1];
+    uint8_t* labels[SECTION_BSS + 1]; //a bit for every byte of the text, data and bss that has a label
+    uint8_t* starts; //a bit for every byte of the text an instruction starts at, branches into an instruction get no label
+    int next_relocation; //relocations are checked in order as the code is written
+};
+
+
+//relocations against sections other than the text, data and bss (.rodata of gcc output) never get a label
+static bool listing_has_label(Listing* listing, uint8_t section, uint64_t offset){
+    if(section > SECTION_BSS || offset >= listing->sizes[section] || !(listing->labels[section][offset / 8] & (1 << (offset % 8)))) return false;
+    return section != SECTION_TEXT || (listing->starts[offset / 8] & (1 << (offset % 8)));
+}
+
+
+static void listing_add_label(Listing* listing, uint8_t section, uint64_t offset){
+    if(section <= SECTION_BSS && offset < listing->sizes[section]) listing->labels[section][offset / 8] |= 1 << (offset % 8);
+}
+
+
+//first symbol at the offset, or NULL if the label there is a generated one
+static ObjectSymbol* listing_find_symbol(Listing* listing, uint8_t section, uint64_t offset){
+    ArrayList symbols = listing->obj->symbols;
+    int low = 0;
+    int high = symbols.size;
+    while(low < high){
+        int mid = (low + high) / 2;
+        ObjectSymbol* sym = &array_list_get(symbols, ObjectSymbol, mid);
+        if(sym->section < section || (sym->section == section && sym->offset < offset)) low = mid + 1;
+        else high = mid;
+    }
+    if(low == symbols.size) return NULL;
+    ObjectSymbol* sym = &array_list_get(symbols, ObjectSymbol, low);
+    return (sym->section == section && sym->offset == offset) ? sym : NULL;
+}
+
+
+static void write_generated_label(Writer* w, uint8_t section, uint64_t offset){
+    write_str(w, (section == SECTION_TEXT) ? "L_" : (section == SECTION_DATA) ? "D_" : "B_");
+    Writer digits = *w;
+    write_hex(w, offset);
+    //drop the 0x
+    memmove(digits.p, digits.p + 2, w->p - digits.p - 2);
+    w->p -= 2;
+}
+
+
+static bool listing_write_label(Listing* listing, Writer* w, uint8_t section, uint64_t offset){
+    if(!listing_has_label(listing, section, offset)) return false;
+    ObjectSymbol* sym = listing_find_symbol(listing, section, offset);
+    if(sym != NULL) write_str(w, sym->name);
+    else write_generated_label(w, section, offset);
+    return true;
+}
+
+
+static bool listing_write_target(Listing* listing, Writer* w, uint64_t target){
+    ObjectFile* obj = listing->obj;
+    if(target < obj->text_address) return false;
+    return listing_write_label(listing, w, SECTION_TEXT, target - obj->text_address);
+}
+
+
+//where a relocated field points, the addend of a relative one is from the end of the field
+static bool relocation_target(ObjectRelocation* reloc, const BasmDecoded* instr, const BasmDecodedOperand* op, uint64_t* offset){
+    *offset = reloc->addend;
+    if(reloc->is_relative) *offset += instr->length - op->field_offset;
+    return reloc->name == NULL;
+}
+
+
+static ObjectRelocation* listing_find_relocation(Listing* listing, uint64_t offset){
+    ArrayList relocs = listing->obj->relocations;
+    while(listing->next_relocation < relocs.size && array_list_get(relocs, ObjectRelocation, listing->next_relocation).offset < offset){
+        listing->next_relocation++;
+    }
+    if(listing->next_relocation == relocs.size) return NULL;
+    ObjectRelocation* reloc = &array_list_get(relocs, ObjectRelocation, listing->next_relocation);
+    return (reloc->offset == offset) ? reloc : NULL;
+}
+
+
+//executables have no relocations, [address] operands that point into the data or bss are written as a label there
+static bool absolute_target(ObjectFile* obj, const BasmDecodedOperand* op, uint8_t* section, uint64_t* offset){
+    if(obj->data_address == 0 || op->kind != BASM_DECODED_MEM || op->rip || op->reg != NULL || op->index != NULL) return false;
+    uint64_t address = (uint64_t)op->value;
+    if(address < obj->data_address || address - obj->data_address >= obj->data_size + obj->bss_size) return false;
+
+    *offset = address - obj->data_address;
+    *section = SECTION_DATA;
+    if(*offset >= obj->data_size){
+        *offset -= obj->data_size;
+        *section = SECTION_BSS;
+    }
+    return true;
+}
+
+
+static bool listing_write_field(Listing* listing, Writer* w, const BasmDecoded* instr, uint64_t address, const BasmDecodedOperand* op){
+    if(op->field_offset == 0) return false;
+    ObjectRelocation* reloc = listing_find_relocation(listing, address - listing->obj->text_address + op->field_offset);
+    uint8_t section;
+    uint64_t offset;
+    if(reloc == NULL){
+        return absolute_target(listing->obj, op, &section, &offset) && listing_write_label(listing, w, section, offset);
+    }
+    if(relocation_target(reloc, instr, op, &offset)) return listing_write_label(listing, w, reloc->section, offset);
+
+    write_str(w, reloc->name);
+    if(offset != 0){
+        write_str(w, " + ");
+        write_signed(w, offset);
+    }
+    if(reloc->reloc == SYMBOL_RELOC_TPOFF) write_str(w, "@tpoff");
+    if(reloc->reloc == SYMBOL_RELOC_GOTTPOFF) write_str(w, "@gottpoff");
+    return true;
+}
+
+
+//instructions never run over a symbol so the code after one is decoded from the right byte even if the bytes before it aren't code
+//or over the start of a text section, it only changes once the offset gets to it
+static uint64_t listing_decode_limit(Listing* listing, uint64_t offset, int* sym_index){
+    ArrayList* sections = &listing->obj->text_sections;
+    uint64_t limit = listing->sizes[SECTION_TEXT];
+    TextSubsection* section = text_subsection(sections, offset);
+    int next = (section == NULL) ? 0 : section - (TextSubsection*)sections->data + 1;
+    if(next < sections->size) limit = array_list_get((*sections), TextSubsection, next).start;
+
+    ArrayList symbols = listing->obj->symbols;
+    while(*sym_index < symbols.size){
+        ObjectSymbol* sym = &array_list_get(symbols, ObjectSymbol, *sym_index);
+        if(sym->section > SECTION_TEXT) break;
+        if(sym->section == SECTION_TEXT && sym->offset > offset) return (sym->offset < limit) ? sym->offset : limit;
+        (*sym_index)++;
+    }
+    return limit;
+}
+
+
+//nops that are the padding of an align directive, returns their length or 0 and sets the alignment that gives the same padding
+//align N pads less than N bytes so the smallest power of 2 above the length works, a lone nop stays an instruction
+static uint64_t padding_length(const uint8_t* code, uint64_t offset, uint64_t limit, uint64_t* alignment){
+    //every nop of NOP_PADDING starts with 90, 66 or 0f
+    *alignment = 0;
+    if(code[offset] != 0x90 && code[offset] != 0x66 && code[offset] != 0x0F) return 0;
+
+    uint64_t end = offset;
+    while(end + MAX_NOP_SIZE <= limit && memcmp(code + end, NOP_PADDING[MAX_NOP_SIZE - 1], MAX_NOP_SIZE) == 0) end += MAX_NOP_SIZE;
+    for(int size = MAX_NOP_SIZE - 1; size > 0; size--){
+        if(end + size <= limit && memcmp(code + end, NOP_PADDING[size - 1], size) == 0){
+            end += size;
+            break;
+        }
+    }
+
+    uint64_t length = end - offset;
+    uint64_t size = 2;
+    while(size <= length) size *= 2;
+    if(length < 2 || end % size != 0){
+        *alignment = 0;
+        return 0;
+    }
+    *alignment = size;
+    return length;
+}
+
+
+//decodes everything once for the branch targets and the targets of relocations against a section
+static void listing_collect_labels(Listing* listing, uint64_t* instructions){
+    ObjectFile* obj = listing->obj;
+    for(int i = 0; i < obj->symbols.size; i++){
+        ObjectSymbol sym = array_list_get(obj->symbols, ObjectSymbol, i);
+        if(sym.section <= SECTION_BSS) listing_add_label(listing, sym.section, sym.offset);
+    }
+    //data before the first symbol still needs a label
+    listing_add_label(listing, SECTION_DATA, 0);
+    listing_add_label(listing, SECTION_BSS, 0);
+
+    BasmDecoded instr;
+    uint64_t offset = 0;
+    uint64_t limit = 0;
+    int sym_index = 0;
+    while(offset < obj->text_size){
+        if(offset >= limit) limit = listing_decode_limit(listing, offset, &sym_index);
+        uint64_t alignment;
+        uint64_t padding = padding_length(obj->text, offset, limit, &alignment);
+        if(padding != 0){
+            listing->starts[offset / 8] |= 1 << (offset % 8);
+            offset += padding;
+            continue;
+        }
+
+        int length = basm_decode(obj->text + offset, limit - offset, &instr);
+        if(length == 0){
+            offset++;
+            continue;
+        }
+        (*instructions)++;
+        listing->starts[offset / 8] |= 1 << (offset % 8);
+
+        for(int i = 0; i < instr.operand_count; i++){
+            BasmDecodedOperand* op = &instr.operands[i];
+            if(op->field_offset == 0) continue;
+            ObjectRelocation* reloc = listing_find_relocation(listing, offset + op->field_offset);
+            uint64_t target;
+            uint8_t section;
+            if(reloc != NULL){
+                if(relocation_target(reloc, &instr, op, &target)) listing_add_label(listing, reloc->section, target);
+            } else if(op->kind == BASM_DECODED_REL || (op->kind == BASM_DECODED_MEM && op->rip)){
+                listing_add_label(listing, SECTION_TEXT, offset + length + op->value);
+            } else if(absolute_target(obj, op, &section, &target)){
+                listing_add_label(listing, section, target);
+            }
+        }
+        offset += length;
+    }
+    listing->next_relocation = 0;
+}
+
+
+
+//decodes every instruction start the first pass found again with nothing but basm_decode in the loop, for --stats
+//the fastest pass is kept, returns its time in ns
+#define DECODE_TIMING_PASSES 10
+
+static uint64_t listing_time_decode(Listing* listing){
+    ObjectFile* obj = listing->obj;
+    uint64_t* offsets = malloc((obj->text_size + 1) * sizeof(uint64_t));
+    uint64_t count = 0;
+    for(uint64_t offset = 0; offset < obj->text_size; offset++){
+        if(listing->starts[offset / 8] & (1 << (offset % 8))) offsets[count++] = offset;
+    }
+
+    BasmDecoded instr;
+    uint64_t best = UINT64_MAX;
+    for(int pass = 0; pass < DECODE_TIMING_PASSES; pass++){
+        StatsTimer timer = stats_timer_start();
+        for(uint64_t i = 0; i < count; i++) basm_decode(obj->text + offsets[i], obj->text_size - offsets[i], &instr);
+        uint64_t ns = stats_timer_start().wall_ns - timer.wall_ns;
+        if(ns < best) best = ns;
+    }
+    free(offsets);
+    return best;
+}
+
+
+
+static void write_line(FILE* output, Writer* w, char* line){
+    *w->p++ = '\n';
+    fwrite(line, 1, w->p - line, output);
+    w->p = line;
+}
+
+
+//labels of the data and bss sections split them into chunks
+static void listing_write_data(Listing* listing, FILE* output, uint8_t section){
+    char line[256];
+    Writer w = {line, line + sizeof(line) - 1};
+    ObjectFile* obj = listing->obj;
+    uint64_t size = listing->sizes[section];
+
+    uint64_t start = 0;
+    for(uint64_t end = 1; end <= size; end++){
+        if(end < size && !listing_has_label(listing, section, end)) continue;
+
+        listing_write_label(listing, &w, section, start);
+        if(section == SECTION_BSS){
+            write_str(&w, ": resb ");
+            write_signed(&w, end - start);
+            write_line(output, &w, line);
+            start = end;
+            continue;
+        }
+
+        write_str(&w, ": db ");
+        for(uint64_t offset = start; offset < end; offset++){
+            write_hex(&w, obj->data[offset]);
+            if(offset + 1 < end) write_str(&w, ", ");
+            //long chunks are written a piece at a time, they are still one line
+            if(w.end - w.p < 16){
+                fwrite(line, 1, w.p - line, output);
+                w.p = line;
+            }
+        }
+        write_line(output, &w, line);
+        start = end;
+    }
+}
+
+
+static void listing_write_text(Listing* listing, FILE* output){
+    char line[512];
+    Writer w = {line, line + sizeof(line) - 1};
+    ObjectFile* obj = listing->obj;
+
+    //every symbol gets its own line, a generated label only goes where there isn't one
+    int sym_index = 0;
+    while(sym_index < obj->symbols.size && array_list_get(obj->symbols, ObjectSymbol, sym_index).section < SECTION_TEXT) sym_index++;
+
+    BasmDecoded instr;
+    uint64_t offset = 0;
+    uint64_t limit = 0;
+    int limit_index = 0;
+    int section_index = 1; //the line of the first one is written before the globals
+    while(offset < obj->text_size){
+        for(; section_index < obj->text_sections.size; section_index++){
+            TextSubsection* section = &array_list_get(obj->text_sections, TextSubsection, section_index);
+            if(section->start > offset) break;
+            write_str(&w, "section ");
+            write_str(&w, section->name);
+            write_line(output, &w, line);
+        }
+
+        bool labeled = false;
+        for(; sym_index < obj->symbols.size; sym_index++){
+            ObjectSymbol* sym = &array_list_get(obj->symbols, ObjectSymbol, sym_index);
+            if(sym->section != SECTION_TEXT || sym->offset > offset) break;
+            write_str(&w, sym->name);
+            write_str(&w, ":");
+            write_line(output, &w, line);
+            labeled = true;
+        }
+        if(!labeled && listing_has_label(listing, SECTION_TEXT, offset)){
+            write_generated_label(&w, SECTION_TEXT, offset);
+            write_str(&w, ":");
+            write_line(output, &w, line);
+        }
+
+        uint64_t address = obj->text_address + offset;
+        if(offset >= limit) limit = listing_decode_limit(listing, offset, &limit_index);
+        uint64_t alignment;
+        int length = padding_length(obj->text, offset, limit, &alignment);
+        if(length == 0) length = basm_decode(obj->text + offset, limit - offset, &instr);
+        write_str(&w, "    ");
+        if(length != 0 && alignment != 0){
+            write_str(&w, "align ");
+            write_hex(&w, alignment);
+        } else if(length != 0){
+            write_instruction(&w, &instr, address, listing);
+        } else {
+            //basm has no way to write raw bytes in the text section
+            write_str(&w, "; unknown instruction");
+            length = 1;
+        }
+
+        while(w.p - line < 48) *w.p++ = ' ';
+        write_str(&w, " ; ");
+        //at least 4 digits of the address
+        for(int shift = 56; shift >= 0; shift -= 8){
+            if(shift < 16 || (address >> shift) != 0) write_byte(&w, address >> shift);
+        }
+        write_str(&w, ":");
+        for(int i = 0; i < length; i++){
+            write_str(&w, " ");
+            write_byte(&w, obj->text[offset + i]);
+        }
+        write_line(output, &w, line);
+        offset += length;
+    }
+}
+
+
+bool basm_disassemble_file(const char* input_file, const char* output_file, bool stats){
+    StatsTimer start = stats_timer_start();
+    ObjectFile obj;
+    if(!read_object(input_file, &obj)) return false;
+
+    FILE* output = stdout;
+    if(output_file != NULL){
+        output = fopen(output_file, "w");
+        if(output == NULL){
+            fprintf(stderr, "Error: couldn't open %s\n", output_file);
+            object_delete(&obj);
+            return false;
+        }
+    }
+
+    Listing listing = {0};
+    listing.obj = &obj;
+    listing.sizes[SECTION_TEXT] = obj.text_size;
+    listing.sizes[SECTION_DATA] = obj.data_size;
+    listing.sizes[SECTION_BSS] = obj.bss_size;
+    for(int i = 0; i <= SECTION_BSS; i++) listing.labels[i] = calloc(listing.sizes[i] / 8 + 1, 1);
+    listing.starts = calloc(obj.text_size / 8 + 1, 1);
+
+    uint64_t instructions = 0;
+    listing_collect_labels(&listing, &instructions);
+    uint64_t decode_ns = stats ? listing_time_decode(&listing) : 0;
+
+    fprintf(output, "; %s disassembled by basm\n", input_file);
+    if(obj.data_size > 0){
+        fprintf(output, "section .data\n");
+        listing_write_data(&listing, output, SECTION_DATA);
+    }
+    if(obj.bss_size > 0){
+        fprintf(output, "section .bss\n");
+        listing_write_data(&listing, output, SECTION_BSS);
+    }
+
+    //with more than one text section the first section line comes with the code
+    if(obj.text_sections.size == 0) fprintf(output, "section .text\n");
+    else fprintf(output, "section %s\n", array_list_get(obj.text_sections, TextSubsection, 0).name);
+    for(int i = 0; i < obj.symbols.size; i++){
+        ObjectSymbol sym = array_list_get(obj.symbols, ObjectSymbol, i);
+        if(sym.section == SECTION_EXTERN) fprintf(output, "extern %s\n", sym.name);
+        else if(sym.section == SECTION_TEXT && sym.visibility == VISIBILITY_GLOBAL) fprintf(output, "global %s\n", sym.name);
+    }
+    listing_write_text(&listing, output);
+
+    bool result = !ferror(output);
+    if(output != stdout) result = (fclose(output) == 0) && result;
+    else fflush(output);
+
+    if(stats){
+        uint64_t total_ns = stats_timer_start().wall_ns - start.wall_ns;
+        fprintf(stderr, "text bytes:         %lu\n", obj.text_size);
+        fprintf(stderr, "instructions:       %lu\n", instructions);
+        fprintf(stderr, "decode (ms):        %.3f (%.1f MB/s)\n", decode_ns / 1000000.0, obj.text_size / (decode_ns / 1000.0));
+        fprintf(stderr, "total (ms):         %.3f\n", total_ns / 1000000.0);
+    }
+
+    for(int i = 0; i <= SECTION_BSS; i++) free(listing.labels[i]);
+    free(listing.starts);
+    object_delete(&obj);
+    return result;
+}
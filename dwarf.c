@@ -0,0 +1,576 @@
+#include "util.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+
+/*
+ * -g maps every instruction back to its source line with a DWARF 5 .debug_line, so addr2line, gdb and perf annotate show the .asm
+ * The parser encodes a row for every instruction into Program.line_program as it goes through the text section, most of them
+ * take a single special opcode. The stream starts at .text + 0, an object with one text section gets it as it is
+ * while one with subsections gets a sequence per section since the linker can put them anywhere
+ * .debug_info only holds the compile unit with the ranges of the code, which is how consumers find the line program
+ */
+#define LINE_BASE -5
+#define LINE_RANGE 14
+#define OPCODE_BASE 13
+
+//operands of the standard opcodes 1 to OPCODE_BASE - 1
+static const uint8_t STANDARD_OPCODE_LENGTHS[OPCODE_BASE - 1] = {0, 1, 1, 1, 1, 0, 0, 0, 1, 0, 0, 1};
+
+
+typedef enum {
+    DW_LNS_ADVANCE_PC = 2,
+    DW_LNS_ADVANCE_LINE = 3,
+} DwarfStandardOpcode;
+
+
+typedef enum {
+    DW_LNE_END_SEQUENCE = 1,
+    DW_LNE_SET_ADDRESS = 2,
+} DwarfExtendedOpcode;
+
+
+typedef enum {
+    DW_TAG_COMPILE_UNIT = 0x11,
+    DW_AT_NAME = 0x03,
+    DW_AT_STMT_LIST = 0x10,
+    DW_AT_LOW_PC = 0x11,
+    DW_AT_LANGUAGE = 0x13,
+    DW_AT_COMP_DIR = 0x1b,
+    DW_AT_PRODUCER = 0x25,
+    DW_AT_RANGES = 0x55,
+    DW_FORM_ADDR = 0x01,
+    DW_FORM_DATA2 = 0x05,
+    DW_FORM_STRING = 0x08,
+    DW_FORM_UDATA = 0x0f,
+    DW_FORM_SEC_OFFSET = 0x17,
+    DW_LNCT_PATH = 1,
+    DW_LNCT_DIRECTORY_INDEX = 2,
+    DW_UT_COMPILE = 1,
+    DW_RLE_END_OF_LIST = 0,
+    DW_RLE_START_LENGTH = 7,
+    DW_LANG_MIPS_ASSEMBLER = 0x8001,
+} DwarfConstant;
+
+
+#define DWARF_VERSION 5
+
+
+static int uleb128(uint8_t* out, uint64_t value){
+    int size = 0;
+    do {
+        uint8_t byte = value & 0x7f;
+        value >>= 7;
+        out[size++] = byte | ((value != 0) ? 0x80 : 0);
+    } while(value != 0);
+    return size;
+}
+
+
+static int sleb128(uint8_t* out, int64_t value){
+    int size = 0;
+    bool more = true;
+    while(more){
+        uint8_t byte = value & 0x7f;
+        value >>= 7;
+        more = !((value == 0 && !(byte & 0x40)) || (value == -1 && (byte & 0x40)));
+        out[size++] = byte | (more ? 0x80 : 0);
+    }
+    return size;
+}
+
+
+int line_program_row(uint8_t* out, LineProgramState* state, uint64_t address, uint32_t line){
+    int size = 0;
+    int64_t line_delta = (int64_t)line - state->line;
+    uint64_t address_delta = address - state->address;
+    if(line_delta < LINE_BASE || line_delta >= LINE_BASE + LINE_RANGE){
+        out[size++] = DW_LNS_ADVANCE_LINE;
+        size += sleb128(out + size, line_delta);
+        line_delta = 0;
+    }
+    //a special opcode moves both registers and adds the row in one byte
+    uint64_t opcode = (line_delta - LINE_BASE) + OPCODE_BASE;
+    if(address_delta > (255 - opcode) / LINE_RANGE){
+        out[size++] = DW_LNS_ADVANCE_PC;
+        size += uleb128(out + size, address_delta);
+        address_delta = 0;
+    }
+    out[size++] = opcode + address_delta * LINE_RANGE;
+    state->address = address;
+    state->line = line;
+    return size;
+}
+
+
+static uint64_t read_uleb128(Section* stream, uint64_t* index){
+    uint64_t value = 0;
+    for(int shift = 0; *index < stream->size; shift += 7){
+        uint8_t byte = stream->data[(*index)++];
+        value |= (uint64_t)(byte & 0x7f) << shift;
+        if(!(byte & 0x80)) break;
+    }
+    return value;
+}
+
+
+static int64_t read_sleb128(Section* stream, uint64_t* index){
+    int64_t value = 0;
+    int shift = 0;
+    uint8_t byte = 0;
+    while(*index < stream->size){
+        byte = stream->data[(*index)++];
+        value |= (int64_t)(byte & 0x7f) << shift;
+        shift += 7;
+        if(!(byte & 0x80)) break;
+    }
+    if(shift < 64 && (byte & 0x40)) value |= -((int64_t)1 << shift);
+    return value;
+}
+
+
+//the next row of a stream written by line_program_row, false once it runs out
+static bool line_program_next_row(Section* stream, uint64_t* index, LineProgramState* state){
+    while(*index < stream->size){
+        uint8_t opcode = stream->data[(*index)++];
+        if(opcode == DW_LNS_ADVANCE_LINE){
+            state->line += read_sleb128(stream, index);
+        } else if(opcode == DW_LNS_ADVANCE_PC){
+            state->address += read_uleb128(stream, index);
+        } else {
+            opcode -= OPCODE_BASE;
+            state->address += opcode / LINE_RANGE;
+            state->line += LINE_BASE + opcode % LINE_RANGE;
+            return true;
+        }
+    }
+    return false;
+}
+
+
+
+typedef struct {
+    Program* p;
+    uint8_t section; //the bytes are written to
+    Section* bytes;
+    bool failed; //ran out of memory
+} DebugWriter;
+
+
+static void put_bytes(DebugWriter* w, const void* data, uint64_t size){
+    Section* s = w->bytes;
+    if(s->size + size > s->capacity){
+        uint64_t capacity = (s->capacity == 0) ? 64 : s->capacity;
+        while(s->size + size > capacity) capacity *= 2;
+        uint8_t* grown = realloc(s->data, capacity);
+        if(grown == NULL){
+            w->failed = true;
+            return;
+        }
+        s->data = grown;
+        s->capacity = capacity;
+    }
+    memcpy(s->data + s->size, data, size);
+    s->size += size;
+}
+
+
+#define put_value(w, type, value) do { type v = (value); put_bytes(w, &v, sizeof(v)); } while(0)
+
+
+static void put_uleb128(DebugWriter* w, uint64_t value){
+    uint8_t buffer[10];
+    put_bytes(w, buffer, uleb128(buffer, value));
+}
+
+
+static void put_string(DebugWriter* w, const char* str){
+    put_bytes(w, str, strlen(str) + 1);
+}
+
+
+static void put_sleb128(DebugWriter* w, int64_t value){
+    uint8_t buffer[10];
+    put_bytes(w, buffer, sleb128(buffer, value));
+}
+
+
+static void put_section_address(DebugWriter* w, uint8_t size, uint8_t target, uint64_t target_offset, bool is_relative){
+    static const uint8_t zeros[8] = {0};
+    SectionAddress address = {w->section, size, target, w->bytes->size, target_offset, is_relative};
+    array_list_append(w->p->section_addresses, SectionAddress, address);
+    put_bytes(w, zeros, size);
+}
+
+
+//the linker fills the field in with the address of target_offset in target
+#define put_address(w, size, target, target_offset) put_section_address(w, size, target, target_offset, false)
+
+//or with the distance from the field to it, always 4 bytes
+#define put_relative_address(w, target, target_offset) put_section_address(w, 4, target, target_offset, true)
+
+
+//unit lengths and header lengths are only known once the rest is written
+static void patch_length(DebugWriter* w, uint64_t field){
+    uint32_t length = w->bytes->size - field - 4;
+    if(!w->failed) memcpy(w->bytes->data + field, &length, 4);
+}
+
+
+//the code of text section i of the object, the subsections or all of .text
+static void text_section_range(Program* p, int i, uint64_t* start, uint64_t* end){
+    *start = 0;
+    *end = p->text.size;
+    if(p->subsections.size == 0) return;
+    *start = array_list_get(p->subsections, TextSubsection, i).start;
+    if(i + 1 < p->subsections.size) *end = array_list_get(p->subsections, TextSubsection, i + 1).start;
+}
+
+
+#define text_section_count(p) (((p)->subsections.size > 0) ? (p)->subsections.size : 1)
+
+
+static void write_abbrev(DebugWriter* w){
+    static const uint8_t ABBREV[] = {
+        1, DW_TAG_COMPILE_UNIT, 0, //no children
+        DW_AT_PRODUCER, DW_FORM_STRING,
+        DW_AT_LANGUAGE, DW_FORM_DATA2,
+        DW_AT_NAME, DW_FORM_STRING,
+        DW_AT_COMP_DIR, DW_FORM_STRING,
+        DW_AT_STMT_LIST, DW_FORM_SEC_OFFSET,
+        DW_AT_LOW_PC, DW_FORM_ADDR,
+        DW_AT_RANGES, DW_FORM_SEC_OFFSET,
+        0, 0,
+        0,
+    };
+    put_bytes(w, ABBREV, sizeof(ABBREV));
+}
+
+
+static void write_info(DebugWriter* w, const char* input_file, const char* directory, uint8_t abbrev, uint8_t ranges, uint8_t line){
+    uint64_t unit = w->bytes->size;
+    put_value(w, uint32_t, 0);
+    put_value(w, uint16_t, DWARF_VERSION);
+    put_value(w, uint8_t, DW_UT_COMPILE);
+    put_value(w, uint8_t, 8);
+    put_address(w, 4, abbrev, 0);
+
+    put_uleb128(w, 1);
+    put_string(w, "basm " BASM_VERSION);
+    put_value(w, uint16_t, DW_LANG_MIPS_ASSEMBLER);
+    put_string(w, input_file);
+    put_string(w, directory);
+    put_address(w, 4, line, 0);
+    //the ranges hold the addresses, they are relative to a base of 0
+    put_value(w, uint64_t, 0);
+    //the list starts after the 12 byte header
+    put_address(w, 4, ranges, 12);
+    patch_length(w, unit);
+}
+
+
+static void write_ranges(DebugWriter* w){
+    Program* p = w->p;
+    uint64_t unit = w->bytes->size;
+    put_value(w, uint32_t, 0);
+    put_value(w, uint16_t, DWARF_VERSION);
+    put_value(w, uint8_t, 8);
+    put_value(w, uint8_t, 0); //segment selector size
+    put_value(w, uint32_t, 0); //offset entry count
+
+    for(int i = 0; i < text_section_count(p); i++){
+        uint64_t start, end;
+        text_section_range(p, i, &start, &end);
+        if(end == start) continue;
+        put_value(w, uint8_t, DW_RLE_START_LENGTH);
+        put_address(w, 8, SECTION_TEXT, start);
+        put_uleb128(w, end - start);
+    }
+    put_value(w, uint8_t, DW_RLE_END_OF_LIST);
+    patch_length(w, unit);
+}
+
+
+static void write_line_header(DebugWriter* w, const char* input_file, const char* directory){
+    put_value(w, uint16_t, DWARF_VERSION);
+    put_value(w, uint8_t, 8);
+    put_value(w, uint8_t, 0); //segment selector size
+
+    uint64_t header = w->bytes->size;
+    put_value(w, uint32_t, 0);
+    put_value(w, uint8_t, 1); //minimum instruction length
+    put_value(w, uint8_t, 1); //operations per instruction
+    put_value(w, uint8_t, 1); //default is_stmt
+    put_value(w, int8_t, LINE_BASE);
+    put_value(w, uint8_t, LINE_RANGE);
+    put_value(w, uint8_t, OPCODE_BASE);
+    put_bytes(w, STANDARD_OPCODE_LENGTHS, sizeof(STANDARD_OPCODE_LENGTHS));
+
+    static const uint8_t DIRECTORY_FORMAT[] = {1, DW_LNCT_PATH, DW_FORM_STRING};
+    put_bytes(w, DIRECTORY_FORMAT, sizeof(DIRECTORY_FORMAT));
+    put_uleb128(w, 1);
+    put_string(w, directory);
+
+    //file 0 is the primary source file in dwarf 5 and rows default to file 1, both are the input
+    static const uint8_t FILE_FORMAT[] = {2, DW_LNCT_PATH, DW_FORM_STRING, DW_LNCT_DIRECTORY_INDEX, DW_FORM_UDATA};
+    put_bytes(w, FILE_FORMAT, sizeof(FILE_FORMAT));
+    put_uleb128(w, 2);
+    for(int i = 0; i < 2; i++){
+        put_string(w, input_file);
+        put_uleb128(w, 0);
+    }
+    patch_length(w, header);
+}
+
+
+static void write_line_program(DebugWriter* w, const char* input_file, const char* directory){
+    Program* p = w->p;
+    uint64_t unit = w->bytes->size;
+    put_value(w, uint32_t, 0);
+    write_line_header(w, input_file, directory);
+
+    uint64_t index = 0;
+    LineProgramState row = {0, 1};
+    bool has_row = line_program_next_row(&p->line_program, &index, &row);
+    for(int i = 0; i < text_section_count(p); i++){
+        uint64_t start, end;
+        text_section_range(p, i, &start, &end);
+        if(end == start) continue;
+
+        put_value(w, uint8_t, 0);
+        put_uleb128(w, 9);
+        put_value(w, uint8_t, DW_LNE_SET_ADDRESS);
+        put_address(w, 8, SECTION_TEXT, start);
+
+        LineProgramState state = {start, 1};
+        if(start == 0 && end == p->text.size){
+            //the rows were encoded from the same state while parsing
+            put_bytes(w, p->line_program.data, p->line_program.size);
+            if(p->line_program.size > 0) state = p->line_state;
+        } else {
+            uint8_t buffer[LINE_PROGRAM_MAX_ROW];
+            for(; has_row && row.address < end; has_row = line_program_next_row(&p->line_program, &index, &row)){
+                put_bytes(w, buffer, line_program_row(buffer, &state, row.address, row.line));
+            }
+        }
+
+        put_value(w, uint8_t, DW_LNS_ADVANCE_PC);
+        put_uleb128(w, end - state.address);
+        put_value(w, uint8_t, 0);
+        put_uleb128(w, 1);
+        put_value(w, uint8_t, DW_LNE_END_SEQUENCE);
+    }
+    patch_length(w, unit);
+}
+
+
+typedef enum {
+    DEBUG_ABBREV,
+    DEBUG_INFO,
+    DEBUG_RANGES,
+    DEBUG_LINE,
+    DEBUG_SECTION_COUNT,
+} DebugSection;
+
+
+static const char* DEBUG_SECTION_NAMES[DEBUG_SECTION_COUNT] = {".debug_abbrev", ".debug_info", ".debug_rnglists", ".debug_line"};
+
+
+bool program_add_debug_sections(Program* p, const char* input_file, const char* directory){
+    //nothing to map without code
+    if(p->text.size == 0) return true;
+    if(program_section_count(p) + DEBUG_SECTION_COUNT >= SECTION_UNDEFINED){
+        fprintf(stderr, "Error: too many sections for the debug sections of -g\n");
+        return false;
+    }
+
+    char cwd[4096];
+    if(directory == NULL) directory = (getcwd(cwd, sizeof(cwd)) != NULL) ? cwd : "";
+
+    uint8_t first = program_section_count(p);
+    if(p->sections.data == NULL) array_list_create_cap(p->sections, ProgramSection, 4);
+    for(int i = 0; i < DEBUG_SECTION_COUNT; i++){
+        ProgramSection section = {DEBUG_SECTION_NAMES[i], SECTION_FLAG_NOALLOC, 0, {0}};
+        array_list_append(p->sections, ProgramSection, section);
+    }
+    if(p->section_addresses.data == NULL) array_list_create_cap(p->section_addresses, SectionAddress, 16);
+
+    bool failed = false;
+    for(int i = 0; i < DEBUG_SECTION_COUNT; i++){
+        DebugWriter w = {p, first + i, program_section(p, first + i), false};
+        if(i == DEBUG_ABBREV) write_abbrev(&w);
+        if(i == DEBUG_INFO) write_info(&w, input_file, directory, first + DEBUG_ABBREV, first + DEBUG_RANGES, first + DEBUG_LINE);
+        if(i == DEBUG_RANGES) write_ranges(&w);
+        if(i == DEBUG_LINE) write_line_program(&w, input_file, directory);
+        failed |= w.failed;
+    }
+    if(failed) fprintf(stderr, "Error: Out of memory\n");
+    return !failed;
+}
+
+
+void program_remove_debug_sections(Program* p, int section_count){
+    for(int i = section_count; i < p->sections.size; i++){
+        free(array_list_get(p->sections, ProgramSection, i).bytes.data);
+    }
+    if(p->sections.size > section_count) p->sections.size = section_count;
+    p->section_addresses.size = 0;
+}
+
+
+
+/*
+ * .eh_frame tells unwinders (perf --call-graph dwarf, gdb, c++ exceptions) where the caller's frame is at every instruction
+ * It has a single cie with the state right after a call and an fde per CfiFrame with the rules that change it as its code goes on
+ * The start of an fde is pc relative so the linker only needs an R_X86_64_PC32 for it, and builds .eh_frame_hdr out of them
+ */
+#define CFI_CODE_ALIGNMENT 1
+#define CFI_DATA_ALIGNMENT -8
+
+typedef enum {
+    DW_CFA_NOP = 0,
+    DW_CFA_ADVANCE_LOC1 = 0x02,
+    DW_CFA_ADVANCE_LOC2 = 0x03,
+    DW_CFA_ADVANCE_LOC4 = 0x04,
+    DW_CFA_OFFSET_EXTENDED_SF = 0x11,
+    DW_CFA_ADVANCE_LOC = 0x40,
+    DW_EH_PE_PCREL_SDATA4 = 0x1b,
+} DwarfFrameConstant;
+
+
+const uint8_t DWARF_REGISTERS[16] = {0, 2, 1, 3, DWARF_REG_RSP, DWARF_REG_RBP, 4, 5, 8, 9, 10, 11, 12, 13, 14, 15};
+
+
+static void write_cfa_advance(DebugWriter* w, uint64_t delta){
+    if(delta == 0) return;
+    if(delta < 64){
+        put_value(w, uint8_t, DW_CFA_ADVANCE_LOC | delta);
+    } else if(delta <= UINT8_MAX){
+        put_value(w, uint8_t, DW_CFA_ADVANCE_LOC1);
+        put_value(w, uint8_t, delta);
+    } else if(delta <= UINT16_MAX){
+        put_value(w, uint8_t, DW_CFA_ADVANCE_LOC2);
+        put_value(w, uint16_t, delta);
+    } else {
+        put_value(w, uint8_t, DW_CFA_ADVANCE_LOC4);
+        put_value(w, uint32_t, delta);
+    }
+}
+
+
+static void write_cfa_rule(DebugWriter* w, CfiRule rule){
+    switch(rule.op){
+        case CFI_DEF_CFA:
+            put_value(w, uint8_t, rule.op);
+            put_uleb128(w, rule.reg);
+            put_uleb128(w, rule.value);
+            break;
+        case CFI_DEF_CFA_REGISTER:
+            put_value(w, uint8_t, rule.op);
+            put_uleb128(w, rule.reg);
+            break;
+        case CFI_DEF_CFA_OFFSET:
+            put_value(w, uint8_t, rule.op);
+            put_uleb128(w, rule.value);
+            break;
+        case CFI_OFFSET:
+            //the short form only takes saves below the cfa, the factored offset is unsigned
+            if(rule.value <= 0){
+                put_value(w, uint8_t, CFI_OFFSET | rule.reg);
+                put_uleb128(w, rule.value / CFI_DATA_ALIGNMENT);
+            } else {
+                put_value(w, uint8_t, DW_CFA_OFFSET_EXTENDED_SF);
+                put_uleb128(w, rule.reg);
+                put_sleb128(w, rule.value / CFI_DATA_ALIGNMENT);
+            }
+            break;
+        case CFI_RESTORE:
+            put_value(w, uint8_t, CFI_RESTORE | rule.reg);
+            break;
+        default:
+            put_value(w, uint8_t, rule.op);
+    }
+}
+
+
+//entries are padded with nops to the size of an address, the section starts aligned to one
+static void end_frame_entry(DebugWriter* w, uint64_t entry){
+    while(w->bytes->size % 8 != 0) put_value(w, uint8_t, DW_CFA_NOP);
+    patch_length(w, entry);
+}
+
+
+static void write_cie(DebugWriter* w){
+    uint64_t entry = w->bytes->size;
+    put_value(w, uint32_t, 0);
+    put_value(w, uint32_t, 0); //cie id
+    put_value(w, uint8_t, 1); //version
+    //z says there is augmentation data, R that it holds the encoding of the fde addresses
+    put_string(w, "zR");
+    put_uleb128(w, CFI_CODE_ALIGNMENT);
+    put_sleb128(w, CFI_DATA_ALIGNMENT);
+    put_uleb128(w, DWARF_REG_RETURN_ADDRESS);
+    put_uleb128(w, 1);
+    put_value(w, uint8_t, DW_EH_PE_PCREL_SDATA4);
+
+    //right after the call the cfa is rsp + 8 and the return address is just below it
+    write_cfa_rule(w, (CfiRule){0, CFI_DEF_CFA, DWARF_REG_RSP, 8});
+    write_cfa_rule(w, (CfiRule){0, CFI_OFFSET, DWARF_REG_RETURN_ADDRESS, -8});
+    end_frame_entry(w, entry);
+}
+
+
+static void write_fde(DebugWriter* w, CfiFrame* frame){
+    Program* p = w->p;
+    uint64_t entry = w->bytes->size;
+    put_value(w, uint32_t, 0);
+    //distance back to the cie at the start of the section
+    put_value(w, uint32_t, w->bytes->size);
+    put_relative_address(w, SECTION_TEXT, frame->start);
+    put_value(w, uint32_t, frame->end - frame->start);
+    put_uleb128(w, 0); //no augmentation data
+
+    uint64_t location = frame->start;
+    for(uint32_t i = frame->first_rule; i < frame->first_rule + frame->rule_count; i++){
+        CfiRule rule = array_list_get(p->cfi_rules, CfiRule, i);
+        //the state after the last instruction doesn't matter
+        if(rule.offset >= frame->end) break;
+        write_cfa_advance(w, rule.offset - location);
+        write_cfa_rule(w, rule);
+        location = rule.offset;
+    }
+    end_frame_entry(w, entry);
+}
+
+
+bool program_add_unwind_section(Program* p){
+    if(p->cfi_frames.size == 0) return true;
+    if(program_section_count(p) + 1 >= SECTION_UNDEFINED){
+        fprintf(stderr, "Error: too many sections for .eh_frame\n");
+        return false;
+    }
+    //the fde of a frame can only cover one object section
+    for(int i = 0; i < p->cfi_frames.size; i++){
+        CfiFrame* frame = &array_list_get(p->cfi_frames, CfiFrame, i);
+        if(text_subsection(&p->subsections, frame->start) != text_subsection(&p->subsections, frame->end - 1)){
+            fprintf(stderr, "Error: the cfi frame at .text+0x%lx goes on into the next text section\n", frame->start);
+            return false;
+        }
+    }
+
+    uint8_t section = program_section_count(p);
+    if(p->sections.data == NULL) array_list_create_cap(p->sections, ProgramSection, 4);
+    ProgramSection eh_frame = {".eh_frame", 0, 0, {.alignment = 8}};
+    array_list_append(p->sections, ProgramSection, eh_frame);
+    if(p->section_addresses.data == NULL) array_list_create_cap(p->section_addresses, SectionAddress, 16);
+
+    DebugWriter w = {p, section, program_section(p, section), false};
+    write_cie(&w);
+    for(int i = 0; i < p->cfi_frames.size; i++) write_fde(&w, &array_list_get(p->cfi_frames, CfiFrame, i));
+    if(w.failed) fprintf(stderr, "Error: Out of memory\n");
+    return !w.failed;
+}
@@ -1,10 +1,15 @@
 #pragma once
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 
+#define BASM_VERSION "0.1.0"
+
 typedef enum {
     BASM_FILE_ELF = 0,
     BASM_FILE_PE = 1,
+    BASM_FILE_ELF_EXEC = 2,
 } BasmFileType;
 
 
@@ -12,12 +17,284 @@ typedef struct {
     const char* input_file;    
     const char* output_file;
     BasmFileType ftype; 
+
+    //with more than one input every file is assembled into its own object in output_dir
+    const char** input_files;
+    int input_count;
+    const char* output_dir;
+    int jobs; //worker threads, 0 uses one per core
+
+    //sends the files to a basm server instead of assembling them in this process
+    const char* client_socket;
+    const char* serve_socket;
+
+    //reuses objects of files that were already assembled with the same flags
+    const char* cache_dir;
+    uint64_t cache_size; //bytes, 0 uses the default
+
+    //prints phase times and counters once every file is done
+    bool stats;
+    bool stats_json;
+
+    //chrome trace event json with a track per thread
+    const char* trace_file;
+
+    //source lines with their offsets and bytes, only works with a single input file
+    const char* listing_file;
+
+    //BasmOption bits every file is assembled with
+    uint32_t options;
+
+    //disassembles input_file into output_file (stdout if NULL) instead of assembling
+    bool disasm;
 } AssemblerFlags;
 
 
 
 bool basm_assemble_program(AssemblerFlags* flags);
 
+/*
+ * Listens on a unix socket and assembles the requests of basm --client
+ * Every connection gets its own thread, only returns if the socket can't be set up
+ */
+bool basm_serve(const char* socket_path);
+
+
+// returns the address of an extern symbol or NULL if it can't be found
+typedef void* (*BasmSymbolResolver)(const char* name, void* user_data);
+
+typedef struct BasmJitOptions {
+    BasmSymbolResolver resolver;
+    void* user_data;
+
+    //append an entry for every label to /tmp/perf-<pid>.map
+    bool perf_map;
+
+    //write code load records to jit-<pid>.dump for perf inject --jit
+    bool jitdump;
+    //directory of the jitdump file, uses the current directory if NULL
+    const char* jitdump_dir;
+
+    //basm_jit_assemble writes its error here when it returns NULL, nothing is printed
+    char error[512];
+} BasmJitOptions;
+
+typedef struct BasmJit BasmJit;
+
+
+/*
+ * Assembles source text straight into executable memory
+ * Externs are looked up with the resolver in the options 
+ * Returns NULL if the code can't be loaded, options->error says why
+ */
+BasmJit* basm_jit_assemble(const char* source, size_t size, BasmJitOptions* options);
+
+// returns the address of a label inside the jitted code or NULL
+void* basm_jit_lookup(BasmJit* jit, const char* label);
+
+void basm_jit_free(BasmJit* jit);
+
 bool basm_parse_flags(AssemblerFlags* flags, int argc, char** argv);
 
 void basm_help();
+
+
+/*
+ * Builder api for code generators that want to skip the text parser 
+ * Instructions are appended to the text section in the order they are emitted 
+ */
+
+//same order as the registers in x86/nmemonics.h
+typedef enum {
+    BASM_REG_YMM0, BASM_REG_YMM1, BASM_REG_YMM2, BASM_REG_YMM3, BASM_REG_YMM4, BASM_REG_YMM5, BASM_REG_YMM6, BASM_REG_YMM7,
+    BASM_REG_YMM8, BASM_REG_YMM9, BASM_REG_YMM10, BASM_REG_YMM11, BASM_REG_YMM12, BASM_REG_YMM13, BASM_REG_YMM14, BASM_REG_YMM15,
+    BASM_REG_XMM0, BASM_REG_XMM1, BASM_REG_XMM2, BASM_REG_XMM3, BASM_REG_XMM4, BASM_REG_XMM5, BASM_REG_XMM6, BASM_REG_XMM7,
+    BASM_REG_XMM8, BASM_REG_XMM9, BASM_REG_XMM10, BASM_REG_XMM11, BASM_REG_XMM12, BASM_REG_XMM13, BASM_REG_XMM14, BASM_REG_XMM15,
+    BASM_REG_MM0, BASM_REG_MM1, BASM_REG_MM2, BASM_REG_MM3, BASM_REG_MM4, BASM_REG_MM5, BASM_REG_MM6, BASM_REG_MM7,
+    BASM_REG_RAX, BASM_REG_RCX, BASM_REG_RDX, BASM_REG_RBX, BASM_REG_RSP, BASM_REG_RBP, BASM_REG_RSI, BASM_REG_RDI,
+    BASM_REG_R8, BASM_REG_R9, BASM_REG_R10, BASM_REG_R11, BASM_REG_R12, BASM_REG_R13, BASM_REG_R14, BASM_REG_R15,
+    BASM_REG_EAX, BASM_REG_ECX, BASM_REG_EDX, BASM_REG_EBX, BASM_REG_ESP, BASM_REG_EBP, BASM_REG_ESI, BASM_REG_EDI,
+    BASM_REG_R8D, BASM_REG_R9D, BASM_REG_R10D, BASM_REG_R11D, BASM_REG_R12D, BASM_REG_R13D, BASM_REG_R14D, BASM_REG_R15D,
+    BASM_REG_AX, BASM_REG_CX, BASM_REG_DX, BASM_REG_BX, BASM_REG_SP, BASM_REG_BP, BASM_REG_SI, BASM_REG_DI,
+    BASM_REG_R8W, BASM_REG_R9W, BASM_REG_R10W, BASM_REG_R11W, BASM_REG_R12W, BASM_REG_R13W, BASM_REG_R14W, BASM_REG_R15W,
+    BASM_REG_AL, BASM_REG_CL, BASM_REG_DL, BASM_REG_BL, BASM_REG_AH, BASM_REG_CH, BASM_REG_DH, BASM_REG_BH,
+    BASM_REG_R8B, BASM_REG_R9B, BASM_REG_R10B, BASM_REG_R11B, BASM_REG_R12B, BASM_REG_R13B, BASM_REG_R14B, BASM_REG_R15B,
+    BASM_REG_MAX,
+} BasmRegister;
+
+
+typedef enum {
+    BASM_OPERAND_NONE = 0,
+    BASM_OPERAND_REG,
+    BASM_OPERAND_IMM,
+    BASM_OPERAND_MEM,
+    BASM_OPERAND_LABEL,
+} BasmOperandKind;
+
+
+typedef struct {
+    BasmOperandKind kind;
+    BasmRegister reg;    //register or base register of a memory operand
+    BasmRegister index;
+    uint8_t scale;
+    uint8_t size;        //memory size in bytes, 0 if it should be inferred
+    int32_t offset;
+    int64_t imm;
+    const char* label;   //jump target or memory label
+} BasmOperand;
+
+
+static inline BasmOperand basm_op_reg(BasmRegister reg){
+    return (BasmOperand){.kind = BASM_OPERAND_REG, .reg = reg, .index = BASM_REG_MAX};
+}
+
+static inline BasmOperand basm_op_imm(int64_t imm){
+    return (BasmOperand){.kind = BASM_OPERAND_IMM, .reg = BASM_REG_MAX, .index = BASM_REG_MAX, .imm = imm};
+}
+
+static inline BasmOperand basm_op_label(const char* label){
+    return (BasmOperand){.kind = BASM_OPERAND_LABEL, .reg = BASM_REG_MAX, .index = BASM_REG_MAX, .label = label};
+}
+
+// size [base + index * scale + offset], use BASM_REG_MAX for an unused register
+static inline BasmOperand basm_op_mem(uint8_t size, BasmRegister base, BasmRegister index, uint8_t scale, int32_t offset){
+    return (BasmOperand){.kind = BASM_OPERAND_MEM, .reg = base, .index = index, .scale = scale, .size = size, .offset = offset};
+}
+
+// size [label]
+static inline BasmOperand basm_op_mem_label(uint8_t size, const char* label){
+    return (BasmOperand){.kind = BASM_OPERAND_MEM, .reg = BASM_REG_MAX, .index = BASM_REG_MAX, .size = size, .label = label};
+}
+
+
+typedef int BasmMnemonic;
+
+typedef struct BasmContext BasmContext;
+
+
+//returns -1 if the name isn't an instruction
+BasmMnemonic basm_mnemonic(const char* name);
+
+/*
+ * A context owns everything needed to assemble one program so 
+ * separate contexts can be used from different threads at the same time
+ * Functions that fail return false/NULL and set the context error
+ */
+BasmContext* basm_context_create();
+
+void basm_context_delete(BasmContext* ctx);
+
+//returns the message of the last error or NULL if there wasn't one
+const char* basm_context_error(BasmContext* ctx);
+
+typedef enum {
+    //pads with nops so no jcc, jmp, call or ret and no fused cmp/test + jcc crosses or ends on a 32 byte boundary
+    BASM_OPTION_ALIGN_BRANCHES = 1,
+    //every global label in .text starts its own .text.<label> section in objects
+    BASM_OPTION_FUNCTION_SECTIONS = 2,
+    //moves strings and 4/8/16 byte constants out of read only sections into .rodata.str1.1 and .rodata.cst<N>
+    BASM_OPTION_MERGE_CONSTANTS = 4,
+    //-g, elf objects get a dwarf .debug_line that maps every instruction back to its line in the source
+    BASM_OPTION_DEBUG_LINES = 8,
+    //--auto-cfi, every global label in .text starts a cfi frame whose rules are worked out from its push/sub rsp prologue
+    BASM_OPTION_AUTO_CFI = 16,
+} BasmOption;
+
+//options change how the source is encoded so they have to be set before anything is assembled
+void basm_context_set_options(BasmContext* ctx, uint32_t options);
+
+//assembles source text into the context, can be mixed with the builder functions
+bool basm_assemble_source(BasmContext* ctx, const char* name, const char* source, size_t size);
+
+bool basm_assemble_file(BasmContext* ctx, const char* input_file);
+
+bool basm_emit(BasmContext* ctx, BasmMnemonic mnemonic, int operand_count, const BasmOperand* operands);
+
+#define basm_emit0(ctx, m) basm_emit(ctx, m, 0, NULL)
+#define basm_emit1(ctx, m, a) basm_emit(ctx, m, 1, (BasmOperand[]){a})
+#define basm_emit2(ctx, m, a, b) basm_emit(ctx, m, 2, (BasmOperand[]){a, b})
+#define basm_emit3(ctx, m, a, b, c) basm_emit(ctx, m, 3, (BasmOperand[]){a, b, c})
+
+//defines a label at the current end of the text section
+bool basm_label(BasmContext* ctx, const char* name);
+
+bool basm_global(BasmContext* ctx, const char* name);
+
+bool basm_extern(BasmContext* ctx, const char* name);
+
+//defines a label in the data section holding a copy of the bytes
+bool basm_data(BasmContext* ctx, const char* name, const void* data, size_t size);
+
+//reserves size bytes in the bss section
+bool basm_bss(BasmContext* ctx, const char* name, size_t size);
+
+//resolves the labels and writes an object file
+bool basm_write_object(BasmContext* ctx, BasmFileType ftype, const char* output_file);
+
+//same as basm_write_object but the object is returned in a malloced buffer
+bool basm_write_object_memory(BasmContext* ctx, BasmFileType ftype, uint8_t** data, size_t* size);
+
+//loads the program into executable memory, returns NULL with the reason in basm_context_error if it can't
+BasmJit* basm_jit_load(BasmContext* ctx, BasmJitOptions* options);
+
+
+typedef struct BasmIncremental BasmIncremental;
+
+/*
+ * Keeps the tokens, encoded bytes and symbols of every line between updates
+ * so after an edit only the lines that changed are lexed and encoded again
+ * The result is the same as assembling the whole source
+ */
+BasmIncremental* basm_incremental_create(const char* name);
+
+void basm_incremental_delete(BasmIncremental* inc);
+
+//replaces the source, the error is in the context if it returns false
+bool basm_incremental_update(BasmIncremental* inc, const char* source, size_t size);
+
+//holds the assembled program for basm_write_object or basm_jit_load
+BasmContext* basm_incremental_context(BasmIncremental* inc);
+
+
+/*
+ * Disassembler that decodes with the same instruction table the assembler encodes with
+ * Operands are decoded into the form basm would parse them in
+ */
+typedef enum {
+    BASM_DECODED_REG = 1,
+    BASM_DECODED_MEM,
+    BASM_DECODED_IMM,
+    BASM_DECODED_REL,
+} BasmDecodedKind;
+
+
+typedef struct {
+    BasmDecodedKind kind;
+    uint8_t size;         //bytes of the memory operand (0 if the instruction doesn't say) or the immediate
+    const char* reg;      //register, or base of a memory operand (NULL if there isn't one)
+    const char* index;
+    uint8_t scale;
+    bool rip;             //memory operand relative to the end of the instruction
+    int64_t value;        //immediate, displacement, or branch offset from the end of the instruction
+    uint8_t field_offset; //where the displacement or immediate starts in the instruction, 0 if it has none
+    const char* segment;  //"fs" or "gs" if a memory operand has a segment override, NULL otherwise
+} BasmDecodedOperand;
+
+
+typedef struct {
+    const char* mnemonic;
+    uint8_t length;
+    uint8_t operand_count;
+    BasmDecodedOperand operands[4];
+} BasmDecoded;
+
+
+//decodes the instruction at the start of code, returns its length or 0 if it isn't one basm knows
+int basm_decode(const uint8_t* code, size_t size, BasmDecoded* instr);
+
+//writes the instruction as basm source, address is where it is for the target of relative operands
+//returns the length of the text, which is cut off if it doesn't fit
+int basm_format_decoded(const BasmDecoded* instr, uint64_t address, char* buffer, size_t size);
+
+//writes the code (plus data, bss and symbols) of an elf object or executable as basm source
+bool basm_disassemble_file(const char* input_file, const char* output_file, bool stats);
@@ -0,0 +1,22 @@
+; static executable that doesn't need libc
+; assemble and run with: bin/basm -f elfexe exit.asm -o exit && ./exit
+section .data
+    msg: db "Hello from a static executable\n"
+
+section .bss
+    counter: resq 1
+
+section .text
+global _start
+
+_start:
+    mov rax, 1
+    mov rdi, 1
+    lea rsi, [msg]
+    mov rdx, 31
+    syscall
+
+    mov qword [counter], 42
+    mov rdi, qword [counter]
+    mov rax, 60
+    syscall
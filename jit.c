@@ -0,0 +1,394 @@
+#include "util.h"
+#include "entry.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/syscall.h>
+
+
+typedef struct {
+    char* name;
+    void* addr;
+} JitSymbol;
+
+
+struct BasmJit {
+    uint8_t* memory;
+    uint64_t size;
+    ArrayList symbols;
+};
+
+
+/*
+ * Calls to externs go through a stub placed after the text section
+ * since the extern can be further away than a rel32 can reach
+ * jmp [rip + 0] followed by the 8 byte address of the extern
+ */
+#define JIT_STUB_SIZE 16
+
+static const uint8_t JIT_STUB[6] = {0xFF, 0x25, 0x00, 0x00, 0x00, 0x00};
+
+#define align_up(n, alignment) (((n) + (alignment) - 1) & ~((uint64_t)(alignment) - 1))
+
+
+
+typedef struct {
+    const char* name;
+    uint64_t offset;
+    uint64_t size;
+} JitCodeRange;
+
+
+static int compare_code_range(const void* p1, const void* p2){
+    const JitCodeRange* r1 = p1;
+    const JitCodeRange* r2 = p2;
+    if(r1->offset < r2->offset) return -1;
+    return r1->offset > r2->offset;
+}
+
+
+/*
+ * Every text label is the start of a range that goes until the next label 
+ * or the end of the text section
+ */
+static ArrayList jit_code_ranges(Program* p){
+    ArrayList ranges;
+    array_list_create_cap(ranges, JitCodeRange, 16);
+
+    for(int i = 0; i < p->symTable.symbols.size; i++){
+        SymbolTableEntry e = array_list_get(p->symTable.symbols, SymbolTableEntry, i);
+        if(e.section != SECTION_TEXT) continue;
+        JitCodeRange range = {e.name, e.section_offset, 0};
+        array_list_append(ranges, JitCodeRange, range);
+    }
+
+    qsort(ranges.data, ranges.size, sizeof(JitCodeRange), compare_code_range);
+
+    for(int i = 0; i < ranges.size; i++){
+        JitCodeRange* range = &array_list_get(ranges, JitCodeRange, i);
+        uint64_t end = (i + 1 < ranges.size) ? array_list_get(ranges, JitCodeRange, i + 1).offset : p->text.size;
+        range->size = end - range->offset;
+    }
+    return ranges;
+}
+
+
+
+static void jit_write_perf_map(uint8_t* memory, ArrayList* ranges){
+    char path[64];
+    snprintf(path, sizeof(path), "/tmp/perf-%d.map", (int)getpid());
+
+    FILE* map = fopen(path, "a");
+    if(map == NULL){
+        fprintf(stderr, "Warning: Failed to open %s\n", path);
+        return;
+    }
+
+    for(int i = 0; i < ranges->size; i++){
+        JitCodeRange range = array_list_get((*ranges), JitCodeRange, i);
+        if(range.size == 0) continue;
+        fprintf(map, "%lx %lx %s\n", (uint64_t)(memory + range.offset), range.size, range.name);
+    }
+    fclose(map);
+}
+
+
+
+/*
+ * Jitdump format used by perf inject --jit 
+ * tools/perf/Documentation/jitdump-specification.txt in the linux source
+ */
+#define JITDUMP_MAGIC 0x4A695444
+#define JITDUMP_VERSION 1
+#define JITDUMP_CODE_LOAD 0
+#define JITDUMP_MACHINE_X86_64 62
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t size;
+    uint32_t machine;
+    uint32_t pad;
+    uint32_t pid;
+    uint64_t timestamp;
+    uint64_t flags;
+} JitdumpHeader;
+
+
+typedef struct {
+    uint32_t id;
+    uint32_t size;
+    uint64_t timestamp;
+    uint32_t pid;
+    uint32_t tid;
+    uint64_t vma;
+    uint64_t code_addr;
+    uint64_t code_size;
+    uint64_t code_index;
+} JitdumpCodeLoad;
+
+
+//one dump file is shared by every jit in the process
+static struct {
+    pthread_mutex_t lock;
+    FILE* file;
+    void* marker;
+    uint64_t code_index;
+} jitdump = {PTHREAD_MUTEX_INITIALIZER, NULL, NULL, 0};
+
+
+//perf expects the same clock that it uses for its samples
+static uint64_t jitdump_timestamp(){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+
+static bool jitdump_open(const char* dir){
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/jit-%d.dump", (dir != NULL) ? dir : ".", (int)getpid());
+
+    jitdump.file = fopen(path, "w+");
+    if(jitdump.file == NULL){
+        fprintf(stderr, "Warning: Failed to open %s\n", path);
+        return false;
+    }
+
+    JitdumpHeader head = {0};
+    head.magic = JITDUMP_MAGIC;
+    head.version = JITDUMP_VERSION;
+    head.size = sizeof(JitdumpHeader);
+    head.machine = JITDUMP_MACHINE_X86_64;
+    head.pid = getpid();
+    head.timestamp = jitdump_timestamp();
+    fwrite(&head, sizeof(head), 1, jitdump.file);
+    fflush(jitdump.file);
+
+    //perf finds the dump through this executable mapping of the file
+    long page_size = sysconf(_SC_PAGESIZE);
+    jitdump.marker = mmap(NULL, page_size, PROT_READ | PROT_EXEC, MAP_PRIVATE, fileno(jitdump.file), 0);
+    if(jitdump.marker == MAP_FAILED){
+        fprintf(stderr, "Warning: Failed to map %s\n", path);
+        fclose(jitdump.file);
+        jitdump.file = NULL;
+        return false;
+    }
+    return true;
+}
+
+
+static void jit_write_jitdump(uint8_t* memory, ArrayList* ranges, const char* dir){
+    pthread_mutex_lock(&jitdump.lock);
+
+    if(jitdump.file == NULL && !jitdump_open(dir)){
+        pthread_mutex_unlock(&jitdump.lock);
+        return;
+    }
+
+    for(int i = 0; i < ranges->size; i++){
+        JitCodeRange range = array_list_get((*ranges), JitCodeRange, i);
+        if(range.size == 0) continue;
+
+        uint64_t name_size = strlen(range.name) + 1;
+
+        JitdumpCodeLoad record = {0};
+        record.id = JITDUMP_CODE_LOAD;
+        record.size = sizeof(record) + name_size + range.size;
+        record.timestamp = jitdump_timestamp();
+        record.pid = getpid();
+        record.tid = syscall(SYS_gettid);
+        record.vma = (uint64_t)(memory + range.offset);
+        record.code_addr = record.vma;
+        record.code_size = range.size;
+        record.code_index = jitdump.code_index++;
+
+        fwrite(&record, sizeof(record), 1, jitdump.file);
+        fwrite(range.name, 1, name_size, jitdump.file);
+        fwrite(memory + range.offset, 1, range.size, jitdump.file);
+    }
+    fflush(jitdump.file);
+
+    pthread_mutex_unlock(&jitdump.lock);
+}
+
+
+
+//the caller gets the message in its context instead of stderr
+static void jit_error(char* error, size_t error_size, const char* fmt, ...){
+    int size = snprintf(error, error_size, "Error: ");
+    va_list list;
+    va_start(list, fmt);
+    vsnprintf(error + size, error_size - size, fmt, list);
+    va_end(list);
+}
+
+
+/*
+ * Layout of the jit memory
+ * | text | extern stubs | (page aligned) data | bss | user sections |
+ * The text and the stubs get flipped to RX once everything is resolved
+ * The memory is mapped in the low 2GB since absolute addresses
+ * are encoded as 32 bit displacements
+ */
+BasmJit* jit_load_program(Program* p, BasmJitOptions* options, char* error, size_t error_size){
+    if(program_uses_tls(p)){
+        jit_error(error, error_size, "thread local storage can't be used in jitted code\n");
+        return NULL;
+    }
+    uint32_t extern_count = 0;
+    for(int i = 0; i < p->symTable.symbols.size; i++){
+        SymbolTableEntry e = array_list_get(p->symTable.symbols, SymbolTableEntry, i);
+        if(e.section == SECTION_EXTERN) extern_count++;
+    }
+
+    //offset of every section in the memory
+    uint64_t* offsets = calloc(program_section_count(p), sizeof(uint64_t));
+    if(offsets == NULL){
+        jit_error(error, error_size, "Out of memory\n");
+        return NULL;
+    }
+
+    uint64_t page_size = sysconf(_SC_PAGESIZE);
+    uint64_t stub_offset = align_up(p->text.size, 16);
+    uint64_t data_offset = align_up(stub_offset + extern_count * JIT_STUB_SIZE, page_size);
+    offsets[SECTION_DATA] = data_offset;
+    offsets[SECTION_BSS] = align_up(data_offset + p->data.size, section_alignment(p->bss, 16));
+    uint64_t end = offsets[SECTION_BSS] + p->bss.size;
+    for(int i = 0; i < p->sections.size; i++){
+        Section* bytes = &array_list_get(p->sections, ProgramSection, i).bytes;
+        offsets[SECTION_USER + i] = align_up(end, section_alignment(*bytes, 1));
+        end = offsets[SECTION_USER + i] + bytes->size;
+    }
+    uint64_t size = align_up(end, page_size);
+    if(size == data_offset) size += page_size;
+
+    int map_flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_32BIT
+    map_flags |= MAP_32BIT;
+#endif
+
+    uint8_t* memory = mmap(NULL, size, PROT_READ | PROT_WRITE, map_flags, -1, 0);
+    if(memory == MAP_FAILED){
+        free(offsets);
+        jit_error(error, error_size, "Failed to map jit memory\n");
+        return NULL;
+    }
+
+    BasmJit* jit = malloc(sizeof(BasmJit));
+    if(jit == NULL){
+        free(offsets);
+        munmap(memory, size);
+        jit_error(error, error_size, "Out of memory\n");
+        return NULL;
+    }
+    jit->memory = memory;
+    jit->size = size;
+    array_list_create_cap(jit->symbols, JitSymbol, 16);
+
+    if(p->text.size > 0) memcpy(memory, p->text.data, p->text.size);
+    if(p->data.size > 0) memcpy(memory + data_offset, p->data.data, p->data.size);
+    for(int i = 0; i < p->sections.size; i++){
+        ProgramSection* section = &array_list_get(p->sections, ProgramSection, i);
+        if(section->flags & SECTION_FLAG_NOBITS || section->bytes.size == 0) continue;
+        memcpy(memory + offsets[SECTION_USER + i], section->bytes.data, section->bytes.size);
+    }
+
+    uint8_t* stub = memory + stub_offset;
+
+    for(int i = 0; i < p->symTable.symbols.size; i++){
+        SymbolTableEntry e = array_list_get(p->symTable.symbols, SymbolTableEntry, i);
+        uint8_t* addr = NULL;
+
+        if(e.section == SECTION_EXTERN){
+            if(options != NULL && options->resolver != NULL){
+                addr = options->resolver(e.name, options->user_data);
+            }
+            if(addr == NULL){
+                jit_error(error, error_size, "Failed to resolve extern symbol %s\n", e.name);
+                goto error;
+            }
+        } else{
+            addr = memory + offsets[e.section] + e.section_offset;
+            JitSymbol sym = {strdup(e.name), addr};
+            array_list_append(jit->symbols, JitSymbol, sym);
+        }
+
+        uint8_t* call_target = addr;
+        if(e.section == SECTION_EXTERN){
+            memcpy(stub, JIT_STUB, sizeof(JIT_STUB));
+            memcpy(stub + sizeof(JIT_STUB), &addr, 8);
+            call_target = stub;
+            stub += JIT_STUB_SIZE;
+        }
+
+        for(int j = 0; j < e.instances.size; j++){
+            SymbolInstance instance = array_list_get(e.instances, SymbolInstance, j);
+            if(instance.is_relative){
+                //internal jumps were already resolved by the assembler
+                if(e.section != SECTION_EXTERN) continue;
+                int32_t rel_addr = (int32_t)(call_target - (memory + instance.offset));
+                memcpy(memory + instance.offset - 4, &rel_addr, 4);
+            } else if(instance.size == 8){
+                memcpy(memory + offsets[instance.section] + instance.offset, &addr, 8);
+            } else{
+                if((uint64_t)addr > INT32_MAX){
+                    jit_error(error, error_size, "address of %s doesn't fit in 32 bits\n", e.name);
+                    goto error;
+                }
+                uint32_t addr32 = (uint32_t)(uint64_t)addr;
+                memcpy(memory + offsets[instance.section] + instance.offset, &addr32, 4);
+            }
+        }
+    }
+
+    if(mprotect(memory, data_offset, PROT_READ | PROT_EXEC) != 0){
+        jit_error(error, error_size, "Failed to make jit memory executable\n");
+        goto error;
+    }
+
+    if(options != NULL && (options->perf_map || options->jitdump)){
+        ArrayList ranges = jit_code_ranges(p);
+        if(options->perf_map) jit_write_perf_map(memory, &ranges);
+        if(options->jitdump) jit_write_jitdump(memory, &ranges, options->jitdump_dir);
+        free(ranges.data);
+    }
+
+    free(offsets);
+    return jit;
+
+error:
+    free(offsets);
+    basm_jit_free(jit);
+    return NULL;
+}
+
+
+
+void* basm_jit_lookup(BasmJit* jit, const char* label){
+    for(int i = 0; i < jit->symbols.size; i++){
+        JitSymbol sym = array_list_get(jit->symbols, JitSymbol, i);
+        if(strcmp(sym.name, label) == 0) return sym.addr;
+    }
+    return NULL;
+}
+
+
+
+void basm_jit_free(BasmJit* jit){
+    if(jit == NULL) return;
+
+    for(int i = 0; i < jit->symbols.size; i++){
+        free(array_list_get(jit->symbols, JitSymbol, i).name);
+    }
+    free(jit->symbols.data);
+    munmap(jit->memory, jit->size);
+    free(jit);
+}
@@ -0,0 +1,160 @@
+#include "util.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/*
+ * Writes the source next to the offset and bytes every line ended up with, like nasm -l
+ * The parser records the byte range of each line while it encodes, the bytes are read
+ * out of the sections once the symbols are resolved so jumps show their final offsets
+ * After the source come the labels with the bytes up to the next label and the size of every section
+ */
+#define LISTING_BYTES_PER_ROW 10
+
+
+#define section_is_nobits(p, section) (program_section_flags(p, section) & SECTION_FLAG_NOBITS)
+
+
+//bss lines have no bytes, only their offset and size
+static void write_row(FILE* output, Program* p, ListingLine* line, uint64_t start, const char* source, int source_length){
+    fprintf(output, "%6u  %08lx  ", line->line, start);
+
+    int written = 0;
+    uint64_t end = line->end;
+    if(end - start > LISTING_BYTES_PER_ROW) end = start + LISTING_BYTES_PER_ROW;
+    if(section_is_nobits(p, line->section)){
+        written = fprintf(output, "<res %lx>", line->end - line->start);
+    } else {
+        const uint8_t* data = program_section(p, line->section)->data;
+        for(uint64_t i = start; i < end; i++) written += fprintf(output, "%02X", data[i]);
+        //the rest of the bytes continue on the next rows
+        if(end < line->end) written += fprintf(output, "-");
+    }
+    fprintf(output, "%*s  %.*s\n", LISTING_BYTES_PER_ROW * 2 + 1 - written, "", source_length, source);
+}
+
+
+typedef struct {
+    const char* name;
+    uint8_t section;
+    uint64_t offset;
+} ListingLabel;
+
+
+static int compare_labels(const void* p1, const void* p2){
+    const ListingLabel* a = p1;
+    const ListingLabel* b = p2;
+    if(a->section != b->section) return a->section - b->section;
+    if(a->offset != b->offset) return (a->offset < b->offset) ? -1 : 1;
+    return strcmp(a->name, b->name);
+}
+
+
+//every label owns the bytes up to the next label of its section, so a function's size is the size of its label
+static void write_labels(FILE* output, Program* p, uint64_t* sizes){
+    SymbolTable* table = &p->symTable;
+    ListingLabel* labels = malloc(sizeof(ListingLabel) * (table->symbols.size + 1));
+    if(labels == NULL) return;
+
+    int count = 0;
+    for(int i = 0; i < table->symbols.size; i++){
+        SymbolTableEntry* e = &array_list_get(table->symbols, SymbolTableEntry, i);
+        if(e->section < SECTION_TEXT || e->section >= program_section_count(p)) continue;
+        labels[count++] = (ListingLabel){e->name, e->section, e->section_offset};
+    }
+    qsort(labels, count, sizeof(ListingLabel), compare_labels);
+
+    fprintf(output, "\nlabel                             section   offset    size\n");
+    for(int i = 0; i < count; i++){
+        uint64_t end = sizes[labels[i].section];
+        if(i + 1 < count && labels[i + 1].section == labels[i].section) end = labels[i + 1].offset;
+        fprintf(output, "%-32s  %-8s  %08lx  %lu\n", labels[i].name, program_section_name(p, labels[i].section), labels[i].offset, end - labels[i].offset);
+    }
+    free(labels);
+}
+
+
+static void write_sections(FILE* output, Program* p, ArrayList* lines, uint64_t* sizes){
+    uint64_t* line_counts = calloc(program_section_count(p), sizeof(uint64_t));
+    if(line_counts == NULL) return;
+    for(int i = 0; i < lines->size; i++){
+        ListingLine* line = &array_list_get((*lines), ListingLine, i);
+        if(line->end > line->start) line_counts[line->section]++;
+    }
+
+    fprintf(output, "\nsection   size      lines\n");
+    for(int section = SECTION_TEXT; section < program_section_count(p); section++){
+        fprintf(output, "%-8s  %-8lu  %lu\n", program_section_name(p, section), sizes[section], line_counts[section]);
+    }
+    free(line_counts);
+}
+
+
+bool write_listing(const char* listing_file, const char* input_file, Program* p, ArrayList* lines){
+    size_t size;
+    char* source = read_file(input_file, &size);
+    if(source == NULL){
+        fprintf(stderr, "Failed to open file: %s\n", input_file);
+        return false;
+    }
+
+    FILE* output = fopen(listing_file, "w");
+    if(output == NULL){
+        fprintf(stderr, "Failed to create file %s\n", listing_file);
+        free(source);
+        return false;
+    }
+
+    fprintf(output, "  line  offset    bytes%*s  source\n", LISTING_BYTES_PER_ROW * 2 - 4, "");
+
+    //the lines were recorded in source order
+    int next = 0;
+    uint32_t line_number = 1;
+    size_t start = 0;
+    while(start < size){
+        size_t end = start;
+        while(end < size && source[end] != '\n') end++;
+        int length = end - start;
+        if(length > 0 && source[end - 1] == '\r') length--;
+
+        bool written = false;
+        for(; next < lines->size && array_list_get((*lines), ListingLine, next).line <= line_number; next++){
+            ListingLine* line = &array_list_get((*lines), ListingLine, next);
+            if(line->line != line_number) continue;
+
+            uint64_t offset = line->start;
+            do {
+                write_row(output, p, line, offset, written ? "" : source + start, written ? 0 : length);
+                written = true;
+                offset += LISTING_BYTES_PER_ROW;
+            } while(!section_is_nobits(p, line->section) && offset < line->end);
+        }
+        if(!written) fprintf(output, "%6u  %*s  %.*s\n", line_number, LISTING_BYTES_PER_ROW * 2 + 11, "", length, source + start);
+
+        line_number++;
+        start = end + 1;
+    }
+
+    //the sections were padded for the object file, the sizes are where the last line ends
+    uint64_t* sizes = calloc(program_section_count(p), sizeof(uint64_t));
+    if(sizes == NULL){
+        fclose(output);
+        free(source);
+        return false;
+    }
+    for(int i = 0; i < lines->size; i++){
+        ListingLine* line = &array_list_get((*lines), ListingLine, i);
+        if(line->end > sizes[line->section]) sizes[line->section] = line->end;
+    }
+    write_labels(output, p, sizes);
+    write_sections(output, p, lines, sizes);
+    free(sizes);
+
+    bool result = !ferror(output);
+    if(fclose(output) != 0) result = false;
+    free(source);
+    return result;
+}
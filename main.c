@@ -1,4 +1,31 @@
 #include "entry.h"
+#include "util.h"
+#include <stdlib.h>
+
+
+/*
+ * The binary is linked with --wrap so every allocation made by basm 
+ * goes through these and --stats can report the number of calls
+ */
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+
+void* __wrap_malloc(size_t size){
+    __atomic_fetch_add(&stats_malloc_calls, 1, __ATOMIC_RELAXED);
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size){
+    __atomic_fetch_add(&stats_malloc_calls, 1, __ATOMIC_RELAXED);
+    return __real_calloc(count, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size){
+    __atomic_fetch_add(&stats_malloc_calls, 1, __ATOMIC_RELAXED);
+    return __real_realloc(ptr, size);
+}
+
 
 
 int main(int argc, char** argv){
@@ -6,5 +33,8 @@ int main(int argc, char** argv){
     if(!basm_parse_flags(&flags, argc, argv)){
         return 1;
     } 
-    basm_assemble_program(&flags);
+    if(flags.serve_socket != NULL){
+        return basm_serve(flags.serve_socket) ? 0 : 1;
+    }
+    return basm_assemble_program(&flags) ? 0 : 1;
 }
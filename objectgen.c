@@ -60,6 +60,7 @@ typedef enum {
     ELF_SF_STRINGS = 0x20,
     ELF_SF_INFO_LINK = 0x40,
     ELF_SF_LINK_ORDER = 0x80,
+    ELF_SF_TLS = 0x400,
 } ElfSectionFlag;
 
 
@@ -84,6 +85,7 @@ typedef enum {
     SB_SECTION = 3,
     SB_FILE = 4,
     SB_COMMON = 5,
+    SB_TLS = 6,
 } ElfSymbolBind;
 
 
@@ -101,6 +103,8 @@ typedef enum{
     RELOC_PC32 = 2,
     RELOC_32 = 10, 
     RELOC_32S = 11, 
+    RELOC_GOTTPOFF = 22,
+    RELOC_TPOFF32 = 23,
 } ElfRelocationTypes;
 
 
@@ -119,58 +123,245 @@ static int compare_visibility(const void *p1, const void *p2){
 #define MACHINE_X86_64 62
 
  
-static uint64_t section_pad(Section* section, uint64_t offset, uint64_t alignment){
-    int padding = 0;
-    while(offset % alignment != 0){
-        offset++;
-        padding++;
-    }
-
-    if(section->size + padding >= section->capacity){
-        uint64_t new_capacity = section->capacity * 2;
-        section->data = realloc(section->data, new_capacity);
-        if(section->data == NULL){
-            printf("Out of memory\n");
-            return 0;
-        }
-        section->capacity = new_capacity;
-    }
+#define align_up(n, alignment) (((n) + (alignment) - 1) & ~((uint64_t)(alignment) - 1))
+#define ELF_PAGE_SIZE 0x1000
+
+
+//huge page alignments only matter once the sections are loaded, padding the object that much would just waste space
+#define elf_file_alignment(alignment) (((alignment) < ELF_PAGE_SIZE) ? (alignment) : ELF_PAGE_SIZE)
+
 
-    for(int i = 0; i < padding; i++){
-        section->data[section->size++] = 0;
+//a relocation in the format independent form both object writers start from
+typedef struct {
+    uint64_t offset;  //of the field in its object section
+    uint32_t target;  //index of the symbol, or of the object section if is_section
+    bool is_section;
+    bool is_relative;
+    uint8_t size;     //of the field, 4 or 8 bytes
+    uint8_t reloc;    //SymbolReloc of the instance
+    int64_t addend;   //offset of the target in its object section
+} SectionRelocation;
+
+
+//a section of an object with bytes of the program: a text subsection, data, bss or a user section
+typedef struct {
+    const char* name;
+    uint8_t section; //SECTION_TEXT/DATA/BSS or the user section the bytes are from
+    uint64_t start;  //of the bytes in that section
+    uint64_t size;
+    ArrayList relocations; //SectionRelocation of the fields in the section
+} ObjectSection;
 
+
+//the text subsections come first, in the same order as in the program, then data, bss and the user sections
+static int object_section_index(Program* p, uint8_t section, uint64_t offset){
+    int text_count = (p->subsections.size > 0) ? p->subsections.size : 1;
+    if(section == SECTION_TEXT){
+        TextSubsection* subsection = text_subsection(&p->subsections, offset);
+        return (subsection == NULL) ? 0 : subsection - (TextSubsection*)p->subsections.data;
     }
-    return offset;
+    if(section == SECTION_DATA) return text_count;
+    if(section == SECTION_BSS) return text_count + (p->data.size > 0);
+    //user sections are kept even if they are empty
+    return text_count + (p->data.size > 0) + (p->bss.size > 0) + (section - SECTION_USER);
+}
+
+
+//the alignment the object gives the section, data and bss never get less than 4 and code not less than 16
+static uint64_t object_section_alignment(Program* p, uint8_t section){
+    if(section == SECTION_TEXT) return section_alignment(p->text, 16);
+    if(section == SECTION_DATA) return section_alignment(p->data, 4);
+    if(section == SECTION_BSS) return section_alignment(p->bss, 4);
+    return section_alignment(*program_section(p, section), 1);
 }
 
 
-static uint32_t get_reloc_count(Program* p){
-    uint32_t count = 0;
-    //only allow text section relocations for now
+/*
+ * Splits the program into the sections of the object and sorts the symbol instances into relocations
+ * A relative instance only needs one if its jump goes to a different text subsection, the linker might move them apart
+ * Returns NULL if it runs out of memory
+ */
+static ObjectSection* object_sections(Program* p, int* count){
+    int text_count = (p->subsections.size > 0) ? p->subsections.size : 1;
+    ObjectSection* sections = calloc(text_count + 2 + p->sections.size, sizeof(ObjectSection));
+    if(sections == NULL) return NULL;
+
+    if(p->subsections.size == 0){
+        sections[0] = (ObjectSection){".text", SECTION_TEXT, 0, p->text.size, {0}};
+    }
+    for(int i = 0; i < p->subsections.size; i++){
+        TextSubsection* subsection = &array_list_get(p->subsections, TextSubsection, i);
+        uint64_t end = (i + 1 < p->subsections.size) ? array_list_get(p->subsections, TextSubsection, i + 1).start : p->text.size;
+        sections[i] = (ObjectSection){subsection->name, SECTION_TEXT, subsection->start, end - subsection->start, {0}};
+    }
+    *count = text_count;
+    if(p->data.size > 0) sections[(*count)++] = (ObjectSection){".data", SECTION_DATA, 0, p->data.size, {0}};
+    if(p->bss.size > 0) sections[(*count)++] = (ObjectSection){".bss", SECTION_BSS, 0, p->bss.size, {0}};
+    for(int i = 0; i < p->sections.size; i++){
+        ProgramSection* section = &array_list_get(p->sections, ProgramSection, i);
+        sections[(*count)++] = (ObjectSection){section->name, SECTION_USER + i, 0, section->bytes.size, {0}};
+    }
+
+    for(int i = 0; i < *count; i++) array_list_create_cap(sections[i].relocations, SectionRelocation, 4);
+
     for(int i = 0; i < p->symTable.symbols.size; i++){
         SymbolTableEntry e = array_list_get(p->symTable.symbols, SymbolTableEntry, i);
         for(int j = 0; j < e.instances.size; j++){
             SymbolInstance instance = array_list_get(e.instances, SymbolInstance, j);
-            //skip over the relative instances
-            if(!instance.is_relative){
-                count++;
+            SectionRelocation reloc = {0};
+            reloc.size = instance.size;
+            reloc.reloc = instance.reloc;
+
+            if(instance.reloc != SYMBOL_RELOC_DEFAULT){
+                //always against the symbol, the linker works out its offset from the thread pointer even if it's in this file
+                reloc.offset = (instance.reloc == SYMBOL_RELOC_GOTTPOFF) ? instance.offset - 4 : instance.offset;
+                reloc.target = i;
+                reloc.is_relative = instance.reloc == SYMBOL_RELOC_GOTTPOFF;
+            } else if(e.section == SECTION_EXTERN){
+                //calls and jumps to an extern end at the offset, its address in data or in a memory operand starts there
+                reloc.offset = instance.is_relative ? instance.offset - 4 : instance.offset;
+                reloc.target = i;
+                reloc.is_relative = instance.is_relative;
+            } else {
+                int target = object_section_index(p, e.section, e.section_offset);
+                //relative instances point at the end of the field
+                reloc.offset = instance.is_relative ? instance.offset - 4 : instance.offset;
+                if(instance.is_relative && object_section_index(p, SECTION_TEXT, reloc.offset) == target) continue;
+
+                reloc.target = target;
+                reloc.is_section = true;
+                reloc.is_relative = instance.is_relative;
+                reloc.addend = e.section_offset - sections[target].start;
             }
+
+            ObjectSection* section = &sections[object_section_index(p, instance.section, reloc.offset)];
+            reloc.offset -= section->start;
+            array_list_append(section->relocations, SectionRelocation, reloc);
         }
     }
-    return count;
+
+    //the fields of the dwarf sections and .eh_frame point at the object section the offset ended up in
+    for(int i = 0; i < p->section_addresses.size; i++){
+        SectionAddress address = array_list_get(p->section_addresses, SectionAddress, i);
+        int target = object_section_index(p, address.target, address.target_offset);
+        SectionRelocation reloc = {address.offset, target, true, address.is_relative, address.size, SYMBOL_RELOC_DEFAULT, address.target_offset - sections[target].start};
+        //write_elf takes 4 off relative addends for fields at the end of an instruction, the start of an fde is relative to the field itself
+        if(address.is_relative) reloc.addend += 4;
+        ObjectSection* section = &sections[object_section_index(p, address.section, address.offset)];
+        array_list_append(section->relocations, SectionRelocation, reloc);
+    }
+    return sections;
 }
 
 
+static void object_sections_delete(ObjectSection* sections, int count){
+    for(int i = 0; i < count; i++) free(sections[i].relocations.data);
+    free(sections);
+}
 
 
-bool write_elf(const char* input_file, const char* output_file, Program* p){
-    FILE* output_stream = fopen(output_file, "wb");
 
-    if(output_stream == NULL){
-        printf("Failed to create file %s\n", input_file);
-        return false;
+
+//symbols of tls sections, and externs used through a tls relocation, have to be STT_TLS or the linker refuses them
+static bool elf_symbol_is_tls(Program* p, SymbolTableEntry* e){
+    if(e->section != SECTION_EXTERN) return e->section < program_section_count(p) && (program_section_flags(p, e->section) & SECTION_FLAG_TLS);
+    for(int i = 0; i < e->instances.size; i++){
+        if(array_list_get(e->instances, SymbolInstance, i).reloc != SYMBOL_RELOC_DEFAULT) return true;
+    }
+    return false;
+}
+
+
+typedef struct {
+    int symbol;
+    int section; //index of the object section
+    uint64_t offset;
+} SizedSymbol;
+
+
+static int compare_sized_symbols(const void* p1, const void* p2){
+    const SizedSymbol* a = p1;
+    const SizedSymbol* b = p2;
+    if(a->section != b->section) return a->section - b->section;
+    if(a->offset != b->offset) return (a->offset < b->offset) ? -1 : 1;
+    return a->symbol - b->symbol;
+}
+
+
+//functions and objects without a size go up to the next one in their object section, or to the end of it
+//local labels in code have no type so the jump targets in a function don't cut it short
+static uint64_t* symbol_sizes(Program* p, ObjectSection* sections){
+    uint64_t* sizes = calloc(p->symTable.symbols.size + 1, sizeof(uint64_t));
+    SizedSymbol* sized = malloc(sizeof(SizedSymbol) * (p->symTable.symbols.size + 1));
+    if(sizes == NULL || sized == NULL){
+        free(sizes);
+        free(sized);
+        return NULL;
     }
 
+    int count = 0;
+    for(int i = 0; i < p->symTable.symbols.size; i++){
+        SymbolTableEntry* e = &array_list_get(p->symTable.symbols, SymbolTableEntry, i);
+        if(e->section == SECTION_EXTERN || e->section >= program_section_count(p)) continue;
+        if(program_symbol_type(p, e) == SYMBOL_TYPE_NONE) continue;
+        sized[count++] = (SizedSymbol){i, object_section_index(p, e->section, e->section_offset), e->section_offset};
+    }
+    qsort(sized, count, sizeof(SizedSymbol), compare_sized_symbols);
+
+    for(int i = 0; i < count; i++){
+        SymbolTableEntry* e = &array_list_get(p->symTable.symbols, SymbolTableEntry, sized[i].symbol);
+        if(e->size != 0){
+            sizes[sized[i].symbol] = e->size;
+            continue;
+        }
+        ObjectSection* section = &sections[sized[i].section];
+        uint64_t end = section->start + section->size;
+        //labels at the same offset are aliases of the same function
+        for(int j = i + 1; j < count && sized[j].section == sized[i].section; j++){
+            if(sized[j].offset > sized[i].offset){
+                end = sized[j].offset;
+                break;
+            }
+        }
+        sizes[sized[i].symbol] = end - sized[i].offset;
+    }
+    free(sized);
+    return sizes;
+}
+
+
+static const uint8_t ELF_SYMBOL_TYPES[] = {
+    [SYMBOL_TYPE_NONE] = 0,
+    [SYMBOL_TYPE_FUNCTION] = SB_FUNCTION,
+    [SYMBOL_TYPE_OBJECT] = SB_OBJECT,
+};
+
+
+bool write_elf(ScratchBuffer* sb, const char* input_file, FILE* output_stream, Program* p){
+    //THE GLOBAL SYMBOLS MUST COME AFTER THE LOCAL ONES 
+    //sorted before the relocations are made since they hold the symbol indices
+    int local_count = 0;
+    if(p->symTable.symbols.data != NULL){
+        qsort(p->symTable.symbols.data, p->symTable.symbols.size, sizeof(SymbolTableEntry),compare_visibility);
+
+        //get the index of the last local var
+        for(int i = p->symTable.symbols.size - 1; i >= 0; i--){
+            SymbolTableEntry e = array_list_get(p->symTable.symbols, SymbolTableEntry, i);
+            if(e.visibility == VISIBILITY_LOCAL){
+                local_count = i + 1;
+                break;
+            }
+        }
+    }
+
+    int section_count;
+    ObjectSection* sections = object_sections(p, &section_count);
+    if(sections == NULL) return false;
+
+    int reloc_section_count = 0;
+    for(int i = 0; i < section_count; i++) reloc_section_count += (sections[i].relocations.size > 0);
+
+
     ElfHeader head = {0};
     head.ident[0] = 0x7f;
     head.ident[1] = 'E';
@@ -191,348 +382,470 @@ bool write_elf(const char* input_file, const char* output_file, Program* p){
     head.section_header_offset = head.header_size;
     head.section_header_size = sizeof(ElfSectionHeader);
 
-
-    int string_table_index = 2;
-
-
-    //section names table, linker symbol table, string table, .text section, plus null header
-    head.section_header_entries = 5;
-    if(p->bss.size > 0) {
-        head.section_header_entries += 1;
-        string_table_index += 1;
-    }
-    if(p->data.size > 0){
-        head.section_header_entries += 1;
-        string_table_index += 1;
-    } 
+    //null header, the program sections, section names table, linker symbol table, string table 
+    //and a relocation section for every program section that needs one
+    int string_table_index = section_count + 1;
+    head.section_header_entries = string_table_index + 3 + reloc_section_count;
     head.string_table_index = string_table_index;
 
-    bool has_text_reloca = false;
-    uint32_t num_text_reloca_entries = get_reloc_count(p);
-    if(num_text_reloca_entries > 0) has_text_reloca = true;
-
- 
-    head.section_header_entries += (int)has_text_reloca;
-
-    fwrite(&head, sizeof(ElfHeader),1, output_stream);
+    ElfSectionHeader* headers = calloc(head.section_header_entries, sizeof(ElfSectionHeader));
+    uint64_t* sizes = symbol_sizes(p, sections);
+    if(headers == NULL || sizes == NULL){
+        free(headers);
+        free(sizes);
+        object_sections_delete(sections, section_count);
+        return false;
+    }
 
     uint64_t offset = head.section_header_size * head.section_header_entries + head.header_size;
 
-    int section_index = 0;
-    int section_count = 0;
-
-    uint64_t data_offset = 0;
-
-    //first section is always null
-    ElfSectionHeader null_header = {0};
-    fwrite(&null_header, sizeof(null_header),1, output_stream);
-    section_index++;
-    
-    //TODO MAKE SURE THAT IT HAS A TEXT SECTION
-    scratch_buffer_clear();
-
     //hold the section string table
-    scratch_buffer_append_char(0);
-    scratch_buffer_append_str(".text");
-
-    ElfSectionHeader text = {0};
-    text.name = 1;
-    text.type = ELF_SECTION_PINFO;
-    text.flags = ELF_SF_ALLOC | ELF_SF_EXECINSTR;
-    text.addr = 0;
-    text.offset = offset;
-    text.size = p->text.size;
-    text.addralign = 16; //CHECK THIS
-    fwrite(&text, sizeof(text), 1, output_stream);
-    section_index++;
-    section_count++;
-
-
-    offset += text.size;
-    offset = section_pad(&p->text, offset, text.addralign);
-
-    
-    if(p->data.size > 0){
-        ElfSectionHeader data = {0};
-        data.type = ELF_SECTION_PINFO;
-        data.flags = ELF_SF_ALLOC | ELF_SF_WRITE;
-        data.name = scratch_buffer_offset();
-        data.size = p->data.size;
-        data.offset = offset;
-        data.addralign = 4;
-
-        data_offset = data.offset;
-        offset += data.size;
-        offset = section_pad(&p->data, offset, data.addralign);
+    scratch_buffer_clear(sb);
+    scratch_buffer_append_char(sb, 0);
 
-
-        scratch_buffer_append_str(".data");
-        fwrite(&data, sizeof(data), 1, output_stream);
-
-        section_index++;
-        section_count++;
-    }
-
-    if(p->bss.size > 0){
-        ElfSectionHeader bss = {0};
-        bss.type = ELF_SECTION_NOBITS;
-        bss.flags = ELF_SF_ALLOC | ELF_SF_WRITE;
-        bss.name = scratch_buffer_offset();
-        bss.size = p->bss.size;
-        bss.offset = offset;
-        bss.addralign = 4; //seems to be the default but idk
-        
-        scratch_buffer_append_str(".bss");
-        fwrite(&bss, sizeof(bss), 1, output_stream);
-
-        section_index++;
-        section_count++;
+    //first section is always null
+    for(int i = 0; i < section_count; i++){
+        ElfSectionHeader* header = &headers[i + 1];
+        header->name = scratch_buffer_offset(sb);
+        scratch_buffer_append_str(sb, (char*)sections[i].name);
+        header->type = ELF_SECTION_PINFO;
+        header->offset = offset;
+        header->size = sections[i].size;
+        header->addralign = object_section_alignment(p, sections[i].section);
+
+        uint32_t flags = program_section_flags(p, sections[i].section);
+        if(!(flags & SECTION_FLAG_NOALLOC)) header->flags |= ELF_SF_ALLOC;
+        if(flags & SECTION_FLAG_EXEC) header->flags |= ELF_SF_EXECINSTR;
+        if(flags & SECTION_FLAG_WRITE) header->flags |= ELF_SF_WRITE;
+        if(flags & SECTION_FLAG_NOBITS) header->type = ELF_SECTION_NOBITS;
+        if(flags & SECTION_FLAG_TLS) header->flags |= ELF_SF_TLS;
+        if(flags & SECTION_FLAG_MERGE){
+            header->flags |= ELF_SF_MERGE;
+            if(flags & SECTION_FLAG_STRINGS) header->flags |= ELF_SF_STRINGS;
+            header->entsize = array_list_get(p->sections, ProgramSection, sections[i].section - SECTION_USER).entry_size;
+        }
+        if(header->type != ELF_SECTION_NOBITS) offset = align_up(offset + header->size, elf_file_alignment(header->addralign));
     }
 
 
-    ElfSectionHeader section_st = {0};
-    section_st.type = ELF_SECTION_STRING_TABLE; 
-    section_st.name = scratch_buffer_offset();
-    section_st.offset = offset;
-    section_st.addralign = 1;
-
-    section_index++;
+    ElfSectionHeader* section_st = &headers[string_table_index];
+    section_st->type = ELF_SECTION_STRING_TABLE; 
+    section_st->name = scratch_buffer_offset(sb);
+    section_st->offset = offset;
+    section_st->addralign = 1;
 
     //write the remaing
-    scratch_buffer_append_str(".shrstrtab");
-    uint64_t symbol_table_st_index = scratch_buffer_offset();
-    scratch_buffer_append_str(".symtab");
-    uint64_t symbol_string_table_st_index = scratch_buffer_offset();
-    scratch_buffer_append_str(".strtab");
-    uint64_t text_reloca_st_index = 0;
-
-    if(has_text_reloca){
-        text_reloca_st_index = scratch_buffer_offset();
-        scratch_buffer_append_str(".rela.text");
+    scratch_buffer_append_str(sb, ".shrstrtab");
+    ElfSectionHeader* symbol_table = &headers[string_table_index + 1];
+    symbol_table->name = scratch_buffer_offset(sb);
+    scratch_buffer_append_str(sb, ".symtab");
+    ElfSectionHeader* symbol_str_table = &headers[string_table_index + 2];
+    symbol_str_table->name = scratch_buffer_offset(sb);
+    scratch_buffer_append_str(sb, ".strtab");
+
+    ElfSectionHeader* reloc_headers = &headers[string_table_index + 3];
+    for(int i = 0, j = 0; i < section_count; i++){
+        if(sections[i].relocations.size == 0) continue;
+        reloc_headers[j].name = scratch_buffer_offset(sb);
+        reloc_headers[j].info = i + 1; //the section the relocations are for
+        scratch_buffer_fmt(sb, ".rela%s", sections[i].name);
+        scratch_buffer_append_char(sb, 0);
+        j++;
     }
 
-    char* section_string_table = scratch_buffer_get_data(0);
-    section_st.size = scratch_buffer_offset();
-
-    fwrite(&section_st, sizeof(section_st), 1, output_stream);
-
+    section_st->size = scratch_buffer_offset(sb);
 
     //pad the section string table with zeros to align with the symbol table
-    while((section_st.offset + section_st.size) % 8 != 0){
-        section_st.size++;
-        scratch_buffer_append_char(0);
+    uint64_t section_st_size = section_st->size;
+    while((section_st->offset + section_st_size) % 8 != 0){
+        section_st_size++;
+        scratch_buffer_append_char(sb, 0);
     }
 
 
-    //THE GLOBAL SYMBOLS MUST COME AFTER THE LOCAL ONES 
-    // account for null symbol, text section, and file name
-    int sym_table_info = 3;
-    if(data_offset != 0) sym_table_info++;
-    if(p->bss.size > 0) sym_table_info++;
+    symbol_table->type = ELF_SECTION_LSYMTABLE;
+    symbol_table->link = string_table_index + 2; //symbol string table will follow 
+    //one plus index of last local symbol, the null, file and section symbols are local too
+    symbol_table->info = section_count + 2 + local_count;
+    symbol_table->entsize = sizeof(ElfSymbolEntry);
+    symbol_table->addralign = 8;
+    //sections plus all symbols plus the file and null header
+    symbol_table->size = ((section_count + p->symTable.symbols.size) + 2) * symbol_table->entsize; 
+    symbol_table->offset = section_st->offset + section_st_size; 
 
-    if(p->symTable.symbols.data != NULL){
-        qsort(p->symTable.symbols.data, p->symTable.symbols.size, sizeof(SymbolTableEntry),compare_visibility);
+    symbol_str_table->type = ELF_SECTION_STRING_TABLE;
+    symbol_str_table->addralign = 1; 
+    symbol_str_table->offset = symbol_table->offset + symbol_table->size;
+    symbol_str_table->size = strlen(input_file) + 1 + 1;
+    for(int i = 0; i < p->symTable.symbols.size; i++){
+        SymbolTableEntry e = array_list_get(p->symTable.symbols, SymbolTableEntry, i);
+        symbol_str_table->size += strlen(e.name) + 1;
+    }
 
-        //get the index of the last local var
-        for(int i = p->symTable.symbols.size - 1; i >= 0; i--){
-            SymbolTableEntry e = array_list_get(p->symTable.symbols, SymbolTableEntry, i);
-            if(e.visibility == VISIBILITY_LOCAL){
-                sym_table_info += i + 1;
-                break;
-            }
+    uint64_t reloc_offset = align_up(symbol_str_table->offset + symbol_str_table->size, 8);
+    int reloc_padding = reloc_offset - (symbol_str_table->offset + symbol_str_table->size);
+    for(int i = 0, j = 0; i < section_count; i++){
+        if(sections[i].relocations.size == 0) continue;
+        ElfSectionHeader* text_reloc = &reloc_headers[j++];
+        text_reloc->type = ELF_SECTION_RELAENTRY; 
+        text_reloc->offset = reloc_offset;
+        text_reloc->link = string_table_index + 1; //points to the symbol table
+        text_reloc->addralign = 8;
+        text_reloc->entsize = sizeof(ElfRelocatableEntry); 
+        text_reloc->size = text_reloc->entsize * sections[i].relocations.size;
+        reloc_offset += text_reloc->size;
+    }
+
+    fwrite(&head, sizeof(ElfHeader),1, output_stream);
+    fwrite(headers, sizeof(ElfSectionHeader), head.section_header_entries, output_stream);
+
+
+    uint8_t padding[16] = {0};
+    for(int i = 0; i < section_count; i++){
+        ElfSectionHeader* header = &headers[i + 1];
+        if(header->type == ELF_SECTION_NOBITS) continue;
+        Section* section = program_section(p, sections[i].section);
+        fwrite(section->data + sections[i].start, 1, header->size, output_stream);
+        //the next section starts at the alignment of this one
+        uint64_t end = header->offset + header->size;
+        for(uint64_t pad = align_up(end, elf_file_alignment(header->addralign)) - end; pad > 0;){
+            uint64_t size = (pad > sizeof(padding)) ? sizeof(padding) : pad;
+            fwrite(padding, 1, size, output_stream);
+            pad -= size;
         }
     }
 
+    fwrite(scratch_buffer_get_data(sb, 0),1, section_st_size, output_stream);
 
-    ElfSectionHeader symbol_table= {0};
-    symbol_table.type = ELF_SECTION_LSYMTABLE;
-    symbol_table.name = symbol_table_st_index;
-    symbol_table.addralign = 8;
-    symbol_table.link = section_index + 1; //symbol string table will follow 
-    symbol_table.info = sym_table_info; // one plus index of last local symbol 
-    symbol_table.entsize = sizeof(ElfSymbolEntry);
-    symbol_table.addralign = 8;
-    //sections plus all symbols plus the file and null header
-    symbol_table.size = ((section_count + p->symTable.symbols.size) + 2) * symbol_table.entsize; 
-    symbol_table.offset = section_st.offset + section_st.size; 
 
-    fwrite(&symbol_table, sizeof(symbol_table), 1, output_stream);
+    //setup the symbol string table
+    scratch_buffer_clear(sb);
 
-    
+    //first symbol is always null
+    scratch_buffer_append_char(sb, 0);
+    ElfSymbolEntry file_sym = {0};
+    fwrite(&file_sym, sizeof(file_sym), 1, output_stream);
 
+    //add the file name
+    scratch_buffer_append_str(sb, (char*)input_file);
 
-    ElfSectionHeader symbol_str_table = {0};
-    symbol_str_table.type = ELF_SECTION_STRING_TABLE;
-    symbol_str_table.name = symbol_string_table_st_index;
-    symbol_str_table.addralign = 1; 
-    symbol_str_table.offset = symbol_table.offset + symbol_table.size;
 
+    file_sym.name = 1;
+    file_sym.section_index = 0xfff1;
+    file_sym.info = SB_LOCAL + SB_FILE;
 
-    uint8_t padding[8] = {0};
-    int symbol_table_padding = 0;
-    int text_reloca_padding = 0;
 
+    //write the file 
+    fwrite(&file_sym, sizeof(file_sym), 1, output_stream);
 
-    while(symbol_table.offset % symbol_table.addralign != 0){
-        symbol_table.offset++;
-        symbol_str_table.offset++;
-        symbol_table_padding++;
-    }
 
+    //a section symbol for every program section, the relocations against a section go through them
+    for(int i = 0; i < section_count; i++){
+        ElfSymbolEntry temp  = {0};
+        temp.section_index = i + 1;
+        temp.info = SB_SECTION + SB_LOCAL;
+        fwrite(&temp, sizeof(temp), 1, output_stream);
+    }
 
-    symbol_str_table.size = strlen(input_file) + 1 + 1;
     for(int i = 0; i < p->symTable.symbols.size; i++){
+        ElfSymbolEntry temp = {0};
         SymbolTableEntry e = array_list_get(p->symTable.symbols, SymbolTableEntry, i);
-        symbol_str_table.size += strlen(e.name) + 1;
-    }
-
-
-    fwrite(&symbol_str_table, sizeof(symbol_str_table), 1, output_stream);
+        temp.name = scratch_buffer_offset(sb);
+        temp.value = e.section_offset;
 
+        if(e.section != SECTION_EXTERN){
+            int index = object_section_index(p, e.section, e.section_offset);
+            temp.section_index = index + 1;
+            temp.value -= sections[index].start;
+        }
 
-    if(has_text_reloca){
-        uint64_t text_reloc_offset = symbol_str_table.offset + symbol_str_table.size;
+        temp.info =  (e.visibility == VISIBILITY_GLOBAL) ? SB_GLOBAL : SB_LOCAL; 
+        temp.info |= elf_symbol_is_tls(p, &e) ? SB_TLS : ELF_SYMBOL_TYPES[program_symbol_type(p, &e)];
+        temp.size = sizes[i];
+        fwrite(&temp, sizeof(temp), 1,output_stream);
+        scratch_buffer_append_str(sb, e.name);
+    }
 
-        while(text_reloc_offset % 8 != 0){
-            text_reloc_offset++;
-            text_reloca_padding++;
+    char* sym_strt_str = scratch_buffer_get_data(sb, 0);
+    fwrite(sym_strt_str,1, scratch_buffer_offset(sb), output_stream);
+
+    if(reloc_section_count > 0) fwrite(padding, 1, reloc_padding, output_stream);
+    for(int i = 0; i < section_count; i++){
+        for(int j = 0; j < sections[i].relocations.size; j++){
+            SectionRelocation reloc = array_list_get(sections[i].relocations, SectionRelocation, j);
+            ElfRelocatableEntry reloc_e = {0};
+            reloc_e.offset = reloc.offset;
+            reloc_e.addend = reloc.addend;
+
+            //the program symbols come after the null, file and section symbols
+            uint64_t symbol = reloc.is_section ? reloc.target + 2 : reloc.target + 2 + section_count;
+            if(reloc.reloc == SYMBOL_RELOC_TPOFF){
+                reloc_e.info = (symbol << 32) | RELOC_TPOFF32;
+            } else if(reloc.reloc == SYMBOL_RELOC_GOTTPOFF){
+                reloc_e.addend -= 4;
+                reloc_e.info = (symbol << 32) | RELOC_GOTTPOFF;
+            } else if(reloc.is_relative){
+                //addend of 0 doesn't work since the cpu adds the target to the end of the field 
+                reloc_e.addend -= 4;
+                reloc_e.info = (symbol << 32) | RELOC_PC32;
+            } else {
+                reloc_e.info = (symbol << 32) | ((reloc.size == 8) ? RELOC_64 : RELOC_32);
+            }
+            fwrite(&reloc_e, sizeof(reloc_e), 1, output_stream);
         }
-
-        ElfSectionHeader text_reloc = {0};
-        text_reloc.name = text_reloca_st_index;
-        text_reloc.type = ELF_SECTION_RELAENTRY; 
-        text_reloc.offset = text_reloc_offset;
-        text_reloc.link = symbol_table.link - 1; //points to the symbol table
-        text_reloc.info = 1; // points to the text section?
-        text_reloc.addralign = 8;
-        text_reloc.entsize = sizeof(ElfRelocatableEntry); 
-        text_reloc.size = text_reloc.entsize * num_text_reloca_entries;
-        fwrite(&text_reloc, sizeof(text_reloc), 1, output_stream);
     }
 
+    free(headers);
+    free(sizes);
+    object_sections_delete(sections, section_count);
+    return true;
 
+}
 
-    fwrite(p->text.data, 1, p->text.size, output_stream);
-    if(data_offset != 0) fwrite(p->data.data,1,p->data.size, output_stream);
 
-    fwrite(section_string_table,1, section_st.size, output_stream);
-    fwrite(padding, 1, symbol_table_padding, output_stream);
+typedef struct {
+    uint32_t type;
+    uint32_t flags;
+    uint64_t offset;
+    uint64_t vaddr;
+    uint64_t paddr;
+    uint64_t file_size;
+    uint64_t mem_size;
+    uint64_t align;
+} ElfProgramHeader;
 
 
-    //setup the symbol string table
-    scratch_buffer_clear();
+typedef enum {
+    ELF_PT_LOAD = 1,
+} ElfSegmentType;
 
-    //first symbol is always null
-    scratch_buffer_append_char(0);
-    ElfSymbolEntry file_sym = {0};
-    fwrite(&file_sym, sizeof(file_sym), 1, output_stream);
 
-    //add the file name
-    scratch_buffer_append_str((char*)input_file);
+typedef enum {
+    ELF_PF_X = 0x1,
+    ELF_PF_W = 0x2,
+    ELF_PF_R = 0x4,
+} ElfSegmentFlag;
 
 
-    file_sym.name = 1;
-    file_sym.section_index = 0xfff1;
-    file_sym.info = SB_LOCAL + SB_FILE;
+#define ELF_EXEC_BASE_ADDR 0x400000
 
 
-    //write the file 
-    fwrite(&file_sym, sizeof(file_sym), 1, output_stream);
+//writes size zero bytes of padding
+static void write_zeros(FILE* output_stream, uint64_t size){
+    uint8_t padding[16] = {0};
+    while(size > 0){
+        uint64_t chunk = (size > sizeof(padding)) ? sizeof(padding) : size;
+        fwrite(padding, 1, chunk, output_stream);
+        size -= chunk;
+    }
+}
 
 
-    
-    ElfSymbolEntry temp  = {0};
-    temp.name = 0;
-    temp.section_index = 1;
-    temp.info = SB_SECTION + SB_LOCAL;
+//the user sections go after the sections of their segment, returns where the last one ends
+static uint64_t exec_place_sections(Program* p, uint64_t* addrs, uint64_t offset, uint32_t flags){
+    for(int i = 0; i < p->sections.size; i++){
+        ProgramSection* section = &array_list_get(p->sections, ProgramSection, i);
+        if((section->flags & (SECTION_FLAG_WRITE | SECTION_FLAG_NOBITS | SECTION_FLAG_NOALLOC)) != flags) continue;
+        offset = align_up(offset, section_alignment(section->bytes, 1));
+        addrs[SECTION_USER + i] = ELF_EXEC_BASE_ADDR + offset;
+        offset += section->bytes.size;
+    }
+    return offset;
+}
 
-    //write text entry 
-    fwrite(&temp, sizeof(temp), 1, output_stream);
+
+//the largest alignment of the read only or writable user sections, at least minimum
+static uint64_t exec_segment_alignment(Program* p, uint64_t minimum, bool writable){
+    for(int i = 0; i < p->sections.size; i++){
+        ProgramSection* section = &array_list_get(p->sections, ProgramSection, i);
+        if((section->flags & SECTION_FLAG_NOALLOC) || ((section->flags & (SECTION_FLAG_WRITE | SECTION_FLAG_NOBITS)) != 0) != writable) continue;
+        minimum = section_alignment(section->bytes, minimum);
+    }
+    return minimum;
+}
 
 
-    //write data entry
-    if(data_offset != 0){
-        ElfSymbolEntry d = {0};
-        d.section_index = 2;
-        d.info = SB_SECTION + SB_LOCAL;
-        fwrite(&d, sizeof(d), 1, output_stream);
+static void exec_write_sections(FILE* output_stream, Program* p, uint64_t* addrs, uint64_t offset, uint32_t flags){
+    for(int i = 0; i < p->sections.size; i++){
+        ProgramSection* section = &array_list_get(p->sections, ProgramSection, i);
+        if((section->flags & (SECTION_FLAG_WRITE | SECTION_FLAG_NOBITS | SECTION_FLAG_NOALLOC)) != flags) continue;
+        uint64_t start = addrs[SECTION_USER + i] - ELF_EXEC_BASE_ADDR;
+        write_zeros(output_stream, start - offset);
+        fwrite(section->bytes.data, 1, section->bytes.size, output_stream);
+        offset = start + section->bytes.size;
     }
+}
+
+
+/*
+ * Writes a static executable that can be run without going through a linker
+ * The text section gets mapped along with the headers in the first R+X segment 
+ * read only sections get a R segment and data and bss share a RW segment, each starts on its own page
+ * Since we don't have a linker, every symbol must be defined in this file 
+ */
+bool write_elf_exec(FILE* output_stream, Program* p){
+    uint64_t entry = MAX_OFFSET;
 
-    //write data entry 
-    if(p->bss.size > 0){
-        ElfSymbolEntry b = {0};
-        //if there is a data section it goes right after it 
-        b.section_index = (data_offset != 0) ? 3 : 2;
-        b.info = SB_SECTION + SB_LOCAL;
-        fwrite(&b, sizeof(b), 1, output_stream);
+    //the tls segment and the thread pointer are set up by the linker and libc
+    if(program_uses_tls(p)){
+        fprintf(stderr, "Error: thread local storage can't be used in an executable without a linker\n");
+        return false;
     }
 
     for(int i = 0; i < p->symTable.symbols.size; i++){
-        memset(&temp, 0, sizeof(ElfSymbolEntry));
         SymbolTableEntry e = array_list_get(p->symTable.symbols, SymbolTableEntry, i);
-        temp.name = scratch_buffer_offset();
-        
-        temp.section_index = e.section;
-        //if there is no data section bss section will be at SECTION_BSS - 1
-        if(e.section == SECTION_BSS && data_offset == 0){
-            temp.section_index = 2;    
-        } 
-
-        temp.value = e.section_offset;
-        temp.info =  (e.visibility == VISIBILITY_GLOBAL) ? SB_GLOBAL : SB_LOCAL; 
-        fwrite(&temp, sizeof(temp), 1,output_stream);
-        scratch_buffer_append_str(e.name);
+        if(e.section == SECTION_EXTERN){
+            fprintf(stderr, "Error: extern symbol %s can't be used in an executable\n", e.name);
+            return false;
+        }
+        if(e.section == SECTION_TEXT && strcmp(e.name, "_start") == 0){
+            entry = e.section_offset;
+        }
     }
 
-    char* sym_strt_str = scratch_buffer_get_data(0);
-    fwrite(sym_strt_str,1, scratch_buffer_offset(), output_stream);
+    if(entry == MAX_OFFSET){
+        fprintf(stderr, "Error: executable has no _start symbol\n");
+        return false;
+    }
 
-    if(has_text_reloca){
-        fwrite(padding,1, text_reloca_padding, output_stream);
+    //the address every section is loaded at, noalloc sections are left out
+    uint64_t* addrs = calloc(program_section_count(p), sizeof(uint64_t));
+    if(addrs == NULL) return false;
+
+    bool has_rodata = false;
+    bool has_data = p->data.size > 0 || p->bss.size > 0;
+    for(int i = 0; i < p->sections.size; i++){
+        uint32_t flags = array_list_get(p->sections, ProgramSection, i).flags;
+        if(flags & SECTION_FLAG_NOALLOC) continue;
+        if(flags & (SECTION_FLAG_WRITE | SECTION_FLAG_NOBITS)) has_data = true;
+        else has_rodata = true;
+    }
+    int segment_count = 1 + has_rodata + has_data;
+
+    uint64_t text_offset = align_up(sizeof(ElfHeader) + segment_count * sizeof(ElfProgramHeader), section_alignment(p->text, 16));
+    uint64_t text_addr = ELF_EXEC_BASE_ADDR + text_offset;
+    addrs[SECTION_TEXT] = text_addr;
+
+    //the other segments have to start on a new page so the text can stay read only
+    uint64_t rodata_offset = align_up(text_offset + p->text.size, ELF_PAGE_SIZE);
+    uint64_t rodata_end = exec_place_sections(p, addrs, rodata_offset, 0);
+    uint64_t data_offset = align_up(has_rodata ? rodata_end : text_offset + p->text.size, section_alignment(p->data, ELF_PAGE_SIZE));
+    uint64_t data_addr = ELF_EXEC_BASE_ADDR + data_offset;
+    addrs[SECTION_DATA] = data_addr;
+    uint64_t data_end = exec_place_sections(p, addrs, data_offset + p->data.size, SECTION_FLAG_WRITE);
+    uint64_t bss_addr = align_up(ELF_EXEC_BASE_ADDR + data_end, section_alignment(p->bss, 16));
+    addrs[SECTION_BSS] = bss_addr;
+    uint64_t bss_end = bss_addr + p->bss.size - ELF_EXEC_BASE_ADDR;
+    bss_end = exec_place_sections(p, addrs, bss_end, SECTION_FLAG_WRITE | SECTION_FLAG_NOBITS);
+    bss_end = exec_place_sections(p, addrs, bss_end, SECTION_FLAG_NOBITS);
+
+    //the linker isn't going to do the relocations for us
+    for(int i = 0; i < p->symTable.symbols.size; i++){
+        SymbolTableEntry e = array_list_get(p->symTable.symbols, SymbolTableEntry, i);
+        for(int j = 0; j < e.instances.size; j++){
+            SymbolInstance instance = array_list_get(e.instances, SymbolInstance, j);
+            if(instance.is_relative) continue;
 
-        //for pc relative symbols 
-        //there index into the elf symbol table 
-        //will be calculated using our symbol table index 
-        //plus all the entries that come before our symbols (null, text, file, bss, etc)
-        int pc_sym_index = 3;
-        if(data_offset != 0) pc_sym_index++;
-        if(p->bss.size > 0) pc_sym_index++;
+            uint64_t addr = addrs[e.section] + e.section_offset;
+            uint8_t* field = program_section(p, instance.section)->data + instance.offset;
+            if(instance.size == 8){
+                memcpy(field, &addr, 8);
+                continue;
+            }
 
-        for(int i = 0; i < p->symTable.symbols.size; i++){
-            SymbolTableEntry e = array_list_get(p->symTable.symbols, SymbolTableEntry, i);
-            for(int j = 0; j < e.instances.size; j++){
-                SymbolInstance instance = array_list_get(e.instances, SymbolInstance, j);
-
-                if(instance.is_relative) continue;
-
-                ElfRelocatableEntry reloc_e = {0};
-
-                if(e.section == SECTION_EXTERN){
-                    //still not sure exactly why i need to do -4
-                    //but addend of 0 doesn't work
-                    reloc_e.offset = instance.offset - 4;
-                    reloc_e.addend = -4;
-                    reloc_e.info = ((uint64_t)(pc_sym_index + i) << 32)| RELOC_PC32;
-                } else{
-                    //assume 32 for now 
-                    reloc_e.offset = instance.offset;
-                    reloc_e.addend = e.section_offset;
-                    reloc_e.info = ((uint64_t)(e.section + 1) << 32)| RELOC_32;
-                }
-                fwrite(&reloc_e, sizeof(reloc_e), 1, output_stream);
+            //all other absolute addresses are encoded as sign extended 32 bit displacements
+            if(addr > INT32_MAX){
+                fprintf(stderr, "Error: address of %s doesn't fit in 32 bits\n", e.name);
+                free(addrs);
+                return false;
             }
+            uint32_t addr32 = (uint32_t)addr;
+            memcpy(field, &addr32, 4);
         }
+    }
+
+    ElfHeader head = {0};
+    head.ident[0] = 0x7f;
+    head.ident[1] = 'E';
+    head.ident[2] = 'L';
+    head.ident[3] = 'F';
+    head.ident[4] = 2;//64 bit objects
+    head.ident[5] = 1; //endianness
+    head.ident[6] = 1;  // File Version
+    head.ident[7] = 0; //System V OS ABI
+    head.ident[8] = 0; //ABI Version
 
+    head.file_type = 2; //EXECUTABLE FILE
+    head.machine_type = MACHINE_X86_64;
+    head.version = 1;
+    head.entry = text_addr + entry;
+    head.header_size = sizeof(ElfHeader);
+    head.program_header_offset = sizeof(ElfHeader);
+    head.program_header_size = sizeof(ElfProgramHeader);
+    head.program_header_entries = segment_count;
+    head.section_header_size = sizeof(ElfSectionHeader);
 
+    fwrite(&head, sizeof(head), 1, output_stream);
+
+    //headers are mapped with the code so the offsets line up with the addresses
+    ElfProgramHeader text = {0};
+    text.type = ELF_PT_LOAD;
+    text.flags = ELF_PF_R | ELF_PF_X;
+    text.offset = 0;
+    text.vaddr = ELF_EXEC_BASE_ADDR;
+    text.paddr = ELF_EXEC_BASE_ADDR;
+    text.file_size = text_offset + p->text.size;
+    text.mem_size = text.file_size;
+    text.align = section_alignment(p->text, ELF_PAGE_SIZE);
+    fwrite(&text, sizeof(text), 1, output_stream);
 
+    if(has_rodata){
+        ElfProgramHeader rodata = {0};
+        rodata.type = ELF_PT_LOAD;
+        rodata.flags = ELF_PF_R;
+        rodata.offset = rodata_offset;
+        rodata.vaddr = ELF_EXEC_BASE_ADDR + rodata_offset;
+        rodata.paddr = rodata.vaddr;
+        rodata.file_size = rodata_end - rodata_offset;
+        rodata.mem_size = rodata.file_size;
+        rodata.align = exec_segment_alignment(p, ELF_PAGE_SIZE, false);
+        fwrite(&rodata, sizeof(rodata), 1, output_stream);
+    }
 
+    if(has_data){
+        ElfProgramHeader data = {0};
+        data.type = ELF_PT_LOAD;
+        data.flags = ELF_PF_R | ELF_PF_W;
+        data.offset = data_offset;
+        data.vaddr = data_addr;
+        data.paddr = data_addr;
+        data.file_size = data_end - data_offset;
+        data.mem_size = bss_end - data_offset;
+        data.align = exec_segment_alignment(p, section_alignment(p->bss, section_alignment(p->data, ELF_PAGE_SIZE)), true);
+        fwrite(&data, sizeof(data), 1, output_stream);
+    }
+
+    write_zeros(output_stream, text_offset - (sizeof(ElfHeader) + segment_count * sizeof(ElfProgramHeader)));
+    fwrite(p->text.data, 1, p->text.size, output_stream);
+    uint64_t offset = text_offset + p->text.size;
+
+    if(has_rodata){
+        exec_write_sections(output_stream, p, addrs, offset, 0);
+        offset = rodata_end;
+    }
+    if(data_end > data_offset){
+        write_zeros(output_stream, data_offset - offset);
+        fwrite(p->data.data, 1, p->data.size, output_stream);
+        exec_write_sections(output_stream, p, addrs, data_offset + p->data.size, SECTION_FLAG_WRITE);
     }
-    fclose(output_stream);
-    return true;
 
+    free(addrs);
+    return true;
 }
 
 
+
+
 #define PE_X86_64 0x8664
 
 typedef struct {
@@ -565,12 +878,21 @@ typedef enum {
     PE_SF_UNINITIALIZED = 0x00000080,
     PE_SF_EXEC= 0x00000020,
     PE_SF_ALIGN_1 = 0x00100000,
+    PE_SF_DISCARDABLE = 0x02000000,
     PE_SF_EXEC_CODE = 0x20000000,
     PE_SF_READ = 0x40000000,
     PE_SF_WRITE = 0x80000000,
 } PESectionFlags;
 
 
+//the align flags go from 1 (0x00100000) to 8192 bytes (0x00E00000)
+static uint32_t pe_align_flag(uint64_t alignment){
+    uint32_t flag = PE_SF_ALIGN_1;
+    for(uint64_t size = 2; size <= alignment && size <= 8192; size *= 2) flag += PE_SF_ALIGN_1;
+    return flag;
+}
+
+
 typedef struct {
     uint32_t virtual_addr; //section offset
     uint32_t symbol_table_index;
@@ -613,6 +935,10 @@ typedef struct{
 
 
 
+//complex type in the high byte, the base type in the low one is left as null
+#define PE_TYPE_FUNCTION 0x20
+
+
 typedef enum {
     PE_SC_EXTERNAL = 2,
     PE_SC_STATIC = 3,
@@ -622,9 +948,11 @@ typedef enum {
 
 
 
-static void write_pe_symbol_section(FILE* output_stream, const char* name, int index, uint64_t size, uint32_t reloc_count){
+//long names are in the string table, string_offset is 0 if the name fits in the symbol
+static void write_pe_symbol_section(FILE* output_stream, const char name[8], uint32_t string_offset, int index, uint64_t size, uint32_t reloc_count){
     PESymbolTableEntry temp_entry = {0};
-    strcpy(temp_entry.name, name);
+    if(string_offset != 0) temp_entry.offset[1] = string_offset;
+    else memcpy(temp_entry.name, name, 8);
     temp_entry.section = index;
     temp_entry.aux_symbol_count = 1;
     temp_entry.storage_class = PE_SC_STATIC;
@@ -637,108 +965,128 @@ static void write_pe_symbol_section(FILE* output_stream, const char* name, int i
 }
 
 
+//coff linkers merge .text$name into .text sorted by the name, the same as .text.name in elf
+//read only data is .rdata in coff, names that don't fit in the header are in the string table and the header holds /offset
+static void pe_section_name(ScratchBuffer* sb, const char* name, char header_name[8], uint32_t* string_offset){
+    char rdata_name[256];
+    if(strncmp(name, ".rodata", 7) == 0 && (name[7] == '\0' || name[7] == '.')){
+        snprintf(rdata_name, sizeof(rdata_name), ".rdata%s", name + 7);
+        name = rdata_name;
+    }
+    size_t length = strlen(name);
+    char* pe_name;
+    *string_offset = 0;
+    if(length <= 8){
+        memset(header_name, 0, 8);
+        memcpy(header_name, name, length);
+        pe_name = header_name;
+    } else {
+        *string_offset = scratch_buffer_offset(sb) + 4;
+        scratch_buffer_append_str(sb, (char*)name);
+        pe_name = (char*)scratch_buffer_get_data(sb, *string_offset - 4);
+
+        char offset_name[16];
+        snprintf(offset_name, sizeof(offset_name), "/%u", *string_offset);
+        memcpy(header_name, offset_name, 8);
+    }
+    const char* group = strchr(name + 1, '.');
+    if(group != NULL && (strncmp(name, ".text.", 6) == 0 || strncmp(name, ".rdata.", 7) == 0)) pe_name[group - name] = '$';
+}
+
 
-bool write_pe(const char* input_file, const char* output_file, Program* p){
-    FILE* output_stream = fopen(output_file, "wb");
 
-    if(output_stream == NULL){
-        printf("Failed to create file %s\n", input_file);
+bool write_pe(ScratchBuffer* sb, const char* input_file, FILE* output_stream, Program* p){
+    if(program_uses_tls(p)){
+        fprintf(stderr, "Error: thread local storage is only supported in elf objects\n");
+        return false;
+    }
+    int section_count;
+    ObjectSection* sections = object_sections(p, &section_count);
+    if(sections == NULL) return false;
+
+    PESectionHeader* headers = calloc(section_count, sizeof(PESectionHeader));
+    uint32_t* string_offsets = calloc(section_count, sizeof(uint32_t));
+    if(headers == NULL || string_offsets == NULL){
+        free(headers);
+        free(string_offsets);
+        object_sections_delete(sections, section_count);
         return false;
     }
-
-
-    uint32_t sym_offset = 0;
 
     PEHeader head = {0};
     head.machine_type = PE_X86_64;
     head.date = (uint32_t)time(NULL);
-    head.section_count = 1;
-
-    if(p->bss.size != 0) head.section_count++;
-    if(p->data.size != 0){
-        sym_offset += p->data.size;
-        head.section_count++;
-    } 
+    head.section_count = section_count;
 
     //TODO: CHECK FOR FILE NAMES GREATER THAN 18 BYTES
     //At least 2 for the file name + One for .Absolut? 
     //Each section has 2
     head.symbol_count = 3 + head.section_count * 2 + p->symTable.symbols.size;
 
-
     uint32_t sym_table_text_offset = 2;
 
-    PESectionHeader text_section = {0};
-
-    strcpy(text_section.name, ".text");
-    text_section.size = p->text.size; 
-    text_section.offset = head.section_count * sizeof(PESectionHeader) + sizeof(PEHeader);
-    text_section.reloc_offset = text_section.offset + p->text.size;
-    text_section.reloc_count = get_reloc_count(p);
-    text_section.flags = PE_SF_ALIGN_1 | PE_SF_READ | PE_SF_EXEC | PE_SF_EXEC_CODE;
-
-    sym_offset += text_section.reloc_offset + text_section.reloc_count * sizeof(PERelocatableEntry);
-    head.symbol_table_offset = sym_offset;
-
-    fwrite(&head, sizeof(PEHeader),1, output_stream);
-    fwrite(&text_section, sizeof(PESectionHeader), 1, output_stream);
-
-
-    if(p->data.size != 0){
-        PESectionHeader data_section = {0};
-        strcpy(data_section.name, ".data");
-        data_section.size = p->data.size; 
-        data_section.offset = text_section.reloc_offset + text_section.reloc_count * sizeof(PERelocatableEntry);
-        data_section.reloc_offset = data_section.offset + p->data.size;
-        data_section.reloc_count = 0; //going to be zero for now
-        data_section.flags = PE_SF_ALIGN_1 | PE_SF_READ | PE_SF_INITIALIZED | PE_SF_WRITE;
-        fwrite(&data_section, sizeof(data_section), 1, output_stream);
+    //the string table holds the long section names and then the long symbol names
+    scratch_buffer_clear(sb);
+
+    //every section is followed by its relocations
+    uint32_t offset = head.section_count * sizeof(PESectionHeader) + sizeof(PEHeader);
+    for(int i = 0; i < section_count; i++){
+        PESectionHeader* header = &headers[i];
+        pe_section_name(sb, sections[i].name, header->name, &string_offsets[i]);
+        header->size = sections[i].size;
+        header->reloc_count = sections[i].relocations.size;
+
+        uint32_t flags = program_section_flags(p, sections[i].section);
+        header->flags = pe_align_flag(program_section(p, sections[i].section)->alignment) | PE_SF_READ;
+        if(flags & SECTION_FLAG_EXEC) header->flags |= PE_SF_EXEC | PE_SF_EXEC_CODE;
+        else if(flags & SECTION_FLAG_NOBITS) header->flags |= PE_SF_UNINITIALIZED;
+        else header->flags |= PE_SF_INITIALIZED;
+        if(flags & SECTION_FLAG_WRITE) header->flags |= PE_SF_WRITE;
+        if(flags & SECTION_FLAG_NOALLOC) header->flags |= PE_SF_DISCARDABLE;
+        if(flags & SECTION_FLAG_NOBITS) continue;
+        header->offset = offset;
+        header->reloc_offset = header->offset + header->size;
+        offset = header->reloc_offset + header->reloc_count * sizeof(PERelocatableEntry);
     }
+    head.symbol_table_offset = offset;
 
-    if(p->bss.size != 0){
-        PESectionHeader bss_section = {0};
-        strcpy(bss_section.name, ".bss");
-        bss_section.size = p->bss.size; 
-        bss_section.offset = 0;
-        bss_section.reloc_offset = 0;
-        bss_section.reloc_count = 0; //going to be zero for now
-        bss_section.flags = PE_SF_ALIGN_1 | PE_SF_READ | PE_SF_UNINITIALIZED| PE_SF_WRITE;
-        fwrite(&bss_section, sizeof(bss_section), 1, output_stream);
-
-    }
+    fwrite(&head, sizeof(PEHeader),1, output_stream);
+    fwrite(headers, sizeof(PESectionHeader), section_count, output_stream);
 
     //write the data
-    fwrite(p->text.data, 1, p->text.size, output_stream);
-    if(text_section.reloc_count != 0){
-        for(int i = 0; i < p->symTable.symbols.size; i++){
-            SymbolTableEntry e = array_list_get(p->symTable.symbols, SymbolTableEntry, i);
-            for(int j = 0; j < e.instances.size; j++){
-                SymbolInstance instance = array_list_get(e.instances, SymbolInstance, j);
-
-                if(instance.is_relative) continue;
-
-                PERelocatableEntry reloc_e = {0};
-                reloc_e.virtual_addr = instance.offset;
-
-                
-                if(e.section == SECTION_EXTERN){
-                    //get the index of this symbol in the symbol table
-                    reloc_e.symbol_table_index = sym_table_text_offset + head.section_count * 2 + 1 + i;
-                    reloc_e.type = PE_RELOC_AMD64_REL32; 
-                    reloc_e.virtual_addr -= 4;
-                } else{
-                    //each section in the symbol table has an auxiliary section 
-                    //thats why we multiply by 2
-                    reloc_e.symbol_table_index = sym_table_text_offset + (e.section - 1) * 2;
-                    reloc_e.type = PE_RELOC_AMD64_ADDR32;
-                }
-                fwrite(&reloc_e, sizeof(reloc_e), 1, output_stream);
+    for(int i = 0; i < section_count; i++){
+        if(program_section_flags(p, sections[i].section) & SECTION_FLAG_NOBITS) continue;
+        ArrayList relocations = sections[i].relocations;
+
+        //coff keeps the addend in the field, the fields hold the offset of the target in its section
+        Section* section = program_section(p, sections[i].section);
+        for(int j = 0; j < relocations.size; j++){
+            SectionRelocation reloc = array_list_get(relocations, SectionRelocation, j);
+            if(!reloc.is_section) continue;
+            int64_t addend = reloc.addend;
+            memcpy(section->data + sections[i].start + reloc.offset, &addend, reloc.size);
+        }
+        fwrite(section->data + sections[i].start, 1, sections[i].size, output_stream);
+
+        for(int j = 0; j < relocations.size; j++){
+            SectionRelocation reloc = array_list_get(relocations, SectionRelocation, j);
+            PERelocatableEntry reloc_e = {0};
+            reloc_e.virtual_addr = reloc.offset;
+
+            if(!reloc.is_section){
+                //get the index of this symbol in the symbol table
+                reloc_e.symbol_table_index = sym_table_text_offset + head.section_count * 2 + 1 + reloc.target;
+            } else {
+                //each section in the symbol table has an auxiliary section 
+                //thats why we multiply by 2
+                reloc_e.symbol_table_index = sym_table_text_offset + reloc.target * 2;
             }
+            if(reloc.is_relative) reloc_e.type = PE_RELOC_AMD64_REL32;
+            else reloc_e.type = (reloc.size == 8) ? PE_RELOC_AMD64_ADDR64 : PE_RELOC_AMD64_ADDR32;
+            fwrite(&reloc_e, sizeof(reloc_e), 1, output_stream);
         }
     }
 
-    if(p->data.size != 0) fwrite(p->data.data, 1, p->data.size, output_stream);
-
 
      //TODO: HANDLE FILE NAMES LARGER THAN 18 CHARS
     PESymbolTableEntry temp_entry = {0};
@@ -752,15 +1100,8 @@ bool write_pe(const char* input_file, const char* output_file, Program* p){
     strcpy(file_name,input_file);
     fwrite(file_name, 1, 18, output_stream);
 
-    write_pe_symbol_section(output_stream, ".text", 1, p->text.size, text_section.reloc_count);
-
-    int index = 2;
-    if(p->data.size != 0){
-        write_pe_symbol_section(output_stream, ".data", 2, p->data.size, 0);
-        index++;
-    }
-    if(p->bss.size != 0){
-        write_pe_symbol_section(output_stream, ".bss", index, p->bss.size, 0);
+    for(int i = 0; i < section_count; i++){
+        write_pe_symbol_section(output_stream, headers[i].name, string_offsets[i], i + 1, sections[i].size, sections[i].relocations.size);
     }
 
     memset(&temp_entry, 0,sizeof(temp_entry));
@@ -772,7 +1113,6 @@ bool write_pe(const char* input_file, const char* output_file, Program* p){
     fwrite(&temp_entry, sizeof(temp_entry), 1, output_stream);
 
 
-    scratch_buffer_clear();
     for(int i = 0; i < p->symTable.symbols.size; i++){
         PESymbolTableEntry pe_entry = {0};
         SymbolTableEntry e = array_list_get(p->symTable.symbols, SymbolTableEntry, i);
@@ -780,30 +1120,264 @@ bool write_pe(const char* input_file, const char* output_file, Program* p){
             strcpy(pe_entry.name, e.name);
         } else{
             pe_entry.offset[0] = 0;
-            pe_entry.offset[1] = scratch_buffer_offset() + 4;
-            scratch_buffer_append_str(e.name);
+            pe_entry.offset[1] = scratch_buffer_offset(sb) + 4;
+            scratch_buffer_append_str(sb, e.name);
         }
         pe_entry.value = e.section_offset; 
         pe_entry.section = e.section;
 
-        //if there is no data section bss section will be at SECTION_BSS - 1
-        if(e.section == SECTION_BSS && p->data.size == 0){
-            pe_entry.section = 2;    
-        } 
+        if(e.section != SECTION_EXTERN){
+            int index = object_section_index(p, e.section, e.section_offset);
+            pe_entry.section = index + 1;
+            pe_entry.value -= sections[index].start;
+        }
         pe_entry.storage_class = (e.visibility == VISIBILITY_GLOBAL) ? PE_SC_EXTERNAL : PE_SC_STATIC; 
+        if(program_symbol_type(p, &e) == SYMBOL_TYPE_FUNCTION) pe_entry.type = PE_TYPE_FUNCTION;
         fwrite(&pe_entry, sizeof(pe_entry), 1,output_stream);
     }
 
     //write the string table
-    uint32_t string_table_size = scratch_buffer_offset() + 4;
+    uint32_t string_table_size = scratch_buffer_offset(sb) + 4;
     fwrite(&string_table_size, 4, 1, output_stream);
 
     if(string_table_size != 4){
-        fwrite(scratch_buffer_get_data(0), 1,string_table_size - 4, output_stream);
+        fwrite(scratch_buffer_get_data(sb, 0), 1,string_table_size - 4, output_stream);
     }
 
+    free(headers);
+    free(string_offsets);
+    object_sections_delete(sections, section_count);
+    return true; 
+}
 
-    fclose(output_stream);
 
-    return true; 
+
+static int compare_object_symbol(const void* p1, const void* p2){
+    const ObjectSymbol* s1 = p1;
+    const ObjectSymbol* s2 = p2;
+    if(s1->section != s2->section) return s1->section - s2->section;
+    if(s1->offset != s2->offset) return (s1->offset < s2->offset) ? -1 : 1;
+    return 0;
+}
+
+
+static int compare_object_relocation(const void* p1, const void* p2){
+    const ObjectRelocation* r1 = p1;
+    const ObjectRelocation* r2 = p2;
+    if(r1->offset != r2->offset) return (r1->offset < r2->offset) ? -1 : 1;
+    return 0;
+}
+
+
+static bool elf_range_valid(size_t file_size, uint64_t offset, uint64_t size){
+    return offset <= file_size && size <= file_size - offset;
+}
+
+
+static uint8_t elf_section_id(const char* name){
+    if(strcmp(name, ".text") == 0 || strncmp(name, ".text.", 6) == 0) return SECTION_TEXT;
+    if(strcmp(name, ".data") == 0) return SECTION_DATA;
+    if(strcmp(name, ".bss") == 0) return SECTION_BSS;
+    return SECTION_UNDEFINED;
+}
+
+
+//executables don't have section headers, the code is the part of the R+X segment after the headers
+static bool read_elf_exec(ObjectFile* obj, size_t size){
+    ElfHeader* head = (ElfHeader*)obj->file;
+    uint64_t headers_size = head->program_header_entries * sizeof(ElfProgramHeader);
+    if(!elf_range_valid(size, head->program_header_offset, headers_size)) return false;
+
+    ElfProgramHeader* segments = (ElfProgramHeader*)(obj->file + head->program_header_offset);
+    for(int i = 0; i < head->program_header_entries; i++){
+        ElfProgramHeader* seg = &segments[i];
+        if(seg->type != ELF_PT_LOAD || !elf_range_valid(size, seg->offset, seg->file_size)) continue;
+
+        if(seg->flags & ELF_PF_X){
+            uint64_t start = align_up(head->program_header_offset + headers_size, 16);
+            if(start < seg->offset || start > seg->offset + seg->file_size) start = seg->offset;
+            obj->text = (uint8_t*)obj->file + start;
+            obj->text_size = seg->offset + seg->file_size - start;
+            obj->text_address = seg->vaddr + (start - seg->offset);
+        } else if(seg->flags & ELF_PF_W){
+            obj->data = (uint8_t*)obj->file + seg->offset;
+            obj->data_size = seg->file_size;
+            obj->data_address = seg->vaddr;
+            obj->bss_size = seg->mem_size - seg->file_size;
+        }
+    }
+    if(obj->text == NULL) return false;
+
+    //write_elf_exec doesn't keep a symbol table, the entry point is all that's left
+    if(head->entry >= obj->text_address && head->entry - obj->text_address < obj->text_size){
+        ObjectSymbol sym = {"_start", head->entry - obj->text_address, SECTION_TEXT, VISIBILITY_GLOBAL};
+        array_list_append(obj->symbols, ObjectSymbol, sym);
+    }
+    return true;
+}
+
+
+static bool read_elf_object(ObjectFile* obj, size_t size){
+    ElfHeader* head = (ElfHeader*)obj->file;
+    uint64_t headers_size = head->section_header_entries * sizeof(ElfSectionHeader);
+    if(!elf_range_valid(size, head->section_header_offset, headers_size)) return false;
+    if(head->string_table_index >= head->section_header_entries) return false;
+
+    ElfSectionHeader* sections = (ElfSectionHeader*)(obj->file + head->section_header_offset);
+    ElfSectionHeader* names = &sections[head->string_table_index];
+    if(!elf_range_valid(size, names->offset, names->size)) return false;
+
+    //section index in the file -> SECTION_TEXT/DATA/BSS and where the section starts in the text
+    uint8_t* ids = calloc(head->section_header_entries, 1);
+    uint64_t* text_starts = calloc(head->section_header_entries, sizeof(uint64_t));
+    if(ids == NULL || text_starts == NULL){
+        free(ids);
+        free(text_starts);
+        return false;
+    }
+    ElfSectionHeader* symtab = NULL;
+
+    for(int i = 0; i < head->section_header_entries; i++){
+        ElfSectionHeader* sec = &sections[i];
+        ids[i] = SECTION_UNDEFINED;
+        if(sec->name >= names->size) continue;
+        const char* name = obj->file + names->offset + sec->name;
+
+        if(sec->type == ELF_SECTION_LSYMTABLE){
+            symtab = sec;
+        } else if(sec->type != ELF_SECTION_RELAENTRY){
+            ids[i] = elf_section_id(name);
+            bool has_bytes = sec->type != ELF_SECTION_NOBITS && elf_range_valid(size, sec->offset, sec->size);
+            if(ids[i] == SECTION_TEXT && has_bytes){
+                TextSubsection text = {name, obj->text_size};
+                array_list_append(obj->text_sections, TextSubsection, text);
+                text_starts[i] = obj->text_size;
+                obj->text = (uint8_t*)obj->file + sec->offset;
+                obj->text_size += sec->size;
+            } else if(ids[i] == SECTION_DATA && has_bytes){
+                obj->data = (uint8_t*)obj->file + sec->offset;
+                obj->data_size = sec->size;
+            } else if(ids[i] == SECTION_BSS){
+                obj->bss_size = sec->size;
+            }
+        }
+    }
+
+    if(obj->text_sections.size > 1){
+        obj->text_copy = malloc(obj->text_size);
+        if(obj->text_copy == NULL){
+            free(ids);
+            free(text_starts);
+            return false;
+        }
+        for(int i = 0; i < head->section_header_entries; i++){
+            if(ids[i] != SECTION_TEXT || sections[i].type == ELF_SECTION_NOBITS) continue;
+            memcpy(obj->text_copy + text_starts[i], obj->file + sections[i].offset, sections[i].size);
+        }
+        obj->text = obj->text_copy;
+    } else {
+        obj->text_sections.size = 0;
+    }
+
+    bool result = obj->text != NULL;
+    uint64_t symbol_count = 0;
+    ElfSymbolEntry* symbols = NULL;
+    ElfSectionHeader* strtab = NULL;
+    if(result && symtab != NULL && symtab->link < head->section_header_entries){
+        strtab = &sections[symtab->link];
+        result = elf_range_valid(size, symtab->offset, symtab->size) && elf_range_valid(size, strtab->offset, strtab->size);
+        symbols = (ElfSymbolEntry*)(obj->file + symtab->offset);
+        symbol_count = symtab->size / sizeof(ElfSymbolEntry);
+    }
+
+    for(uint64_t i = 0; result && i < symbol_count; i++){
+        ElfSymbolEntry* sym = &symbols[i];
+        int type = sym->info & 0xf;
+        if(sym->name == 0 || sym->name >= strtab->size || type == SB_SECTION || type == SB_FILE) continue;
+
+        ObjectSymbol entry = {obj->file + strtab->offset + sym->name, sym->value, SECTION_EXTERN, VISIBILITY_LOCAL};
+        if(sym->section_index != 0){
+            if(sym->section_index >= head->section_header_entries) continue;
+            entry.section = ids[sym->section_index];
+            entry.offset += text_starts[sym->section_index];
+        }
+        if((sym->info & 0xf0) != SB_LOCAL) entry.visibility = VISIBILITY_GLOBAL;
+        array_list_append(obj->symbols, ObjectSymbol, entry);
+    }
+
+    //the relocations of every text section
+    for(int j = 0; result && j < head->section_header_entries; j++){
+        ElfSectionHeader* rela = &sections[j];
+        if(rela->type != ELF_SECTION_RELAENTRY || rela->info >= head->section_header_entries || ids[rela->info] != SECTION_TEXT) continue;
+        if(!elf_range_valid(size, rela->offset, rela->size)) continue;
+
+        ElfRelocatableEntry* entries = (ElfRelocatableEntry*)(obj->file + rela->offset);
+        for(uint64_t i = 0; i < rela->size / sizeof(ElfRelocatableEntry); i++){
+            uint32_t sym_index = entries[i].info >> 32;
+            uint32_t type = entries[i].info & 0xffffffff;
+            if(sym_index >= symbol_count) continue;
+
+            ElfSymbolEntry* sym = &symbols[sym_index];
+            ObjectRelocation reloc = {entries[i].offset + text_starts[rela->info], NULL, SECTION_EXTERN, entries[i].addend, type == RELOC_PC32 || type == RELOC_GOTTPOFF, SYMBOL_RELOC_DEFAULT};
+            if(type == RELOC_TPOFF32) reloc.reloc = SYMBOL_RELOC_TPOFF;
+            if(type == RELOC_GOTTPOFF) reloc.reloc = SYMBOL_RELOC_GOTTPOFF;
+            if((sym->info & 0xf) == SB_SECTION){
+                if(sym->section_index < head->section_header_entries){
+                    reloc.section = ids[sym->section_index];
+                    reloc.addend += text_starts[sym->section_index];
+                }
+            } else if(sym->name < strtab->size){
+                reloc.name = obj->file + strtab->offset + sym->name;
+            }
+            array_list_append(obj->relocations, ObjectRelocation, reloc);
+        }
+    }
+
+    free(ids);
+    free(text_starts);
+    return result;
+}
+
+
+bool read_object(const char* input_file, ObjectFile* obj){
+    memset(obj, 0, sizeof(ObjectFile));
+    size_t size;
+    obj->file = read_file(input_file, &size);
+    if(obj->file == NULL){
+        fprintf(stderr, "Error: couldn't read %s\n", input_file);
+        return false;
+    }
+    array_list_create_cap(obj->symbols, ObjectSymbol, 16);
+    array_list_create_cap(obj->relocations, ObjectRelocation, 16);
+    array_list_create_cap(obj->text_sections, TextSubsection, 4);
+
+    ElfHeader* head = (ElfHeader*)obj->file;
+    bool result = size >= sizeof(ElfHeader) && memcmp(head->ident, "\x7f" "ELF", 4) == 0 && head->ident[4] == 2 &&
+                  head->machine_type == MACHINE_X86_64;
+    if(result){
+        result = (head->file_type == 2) ? read_elf_exec(obj, size) : read_elf_object(obj, size);
+    }
+    if(!result){
+        fprintf(stderr, "Error: %s isn't an x86-64 elf file with a text section\n", input_file);
+        object_delete(obj);
+        return false;
+    }
+
+    qsort(obj->symbols.data, obj->symbols.size, sizeof(ObjectSymbol), compare_object_symbol);
+    qsort(obj->relocations.data, obj->relocations.size, sizeof(ObjectRelocation), compare_object_relocation);
+    return true;
+}
+
+
+void object_delete(ObjectFile* obj){
+    free(obj->file);
+    free(obj->symbols.data);
+    free(obj->relocations.data);
+    free(obj->text_sections.data);
+    free(obj->text_copy);
+    obj->file = NULL;
+    obj->symbols.data = NULL;
+    obj->relocations.data = NULL;
+    obj->text_sections.data = NULL;
+    obj->text_copy = NULL;
 }
@@ -0,0 +1,272 @@
+#include "util.h"
+#include "entry.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/stat.h>
+
+
+/*
+ * Every request is a RequestHeader followed by
+ * | name (name_size) | directory (directory_size) | source (source_size) | output path (output_size) |
+ * The name is the path of the input as it was typed unless the source is sent inline,
+ * relative input and output paths are in the directory (the working directory of the client)
+ * and -g names it, so the object is the same as one assembled by the client itself
+ * The server writes the object to the output path if one is given,
+ * otherwise the object bytes follow the ResponseHeader
+ * A connection can send any number of requests
+ *
+ * The server reads and writes any path a request has with the rights of its user,
+ * so the socket is created with mode 0600 and only that user can connect
+ */
+#define SERVER_MAGIC 0x4D534142 //BASM
+
+#define REQUEST_INLINE_SOURCE 1
+
+#define REQUEST_MAX_PATH 4096
+#define REQUEST_MAX_SOURCE (1ULL << 30)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t ftype;
+    uint32_t flags;
+    uint32_t name_size;
+    uint32_t output_size;
+    uint32_t directory_size; //0 to use the working directory of the server
+    uint32_t options; //BasmOption bits
+    uint64_t source_size;
+} RequestHeader;
+
+
+#define RESPONSE_OK 0
+#define RESPONSE_ERROR 1
+
+typedef struct {
+    uint32_t status;
+    uint32_t error_size;
+    uint64_t object_size;
+} ResponseHeader;
+
+
+
+static bool read_all(int fd, void* data, size_t size){
+    uint8_t* bytes = data;
+    while(size > 0){
+        ssize_t count = read(fd, bytes, size);
+        if(count <= 0) return false;
+        bytes += count;
+        size -= count;
+    }
+    return true;
+}
+
+
+static bool write_all(int fd, const void* data, size_t size){
+    const uint8_t* bytes = data;
+    while(size > 0){
+        ssize_t count = send(fd, bytes, size, MSG_NOSIGNAL);
+        if(count <= 0) return false;
+        bytes += count;
+        size -= count;
+    }
+    return true;
+}
+
+
+//reads size bytes into a null terminated string
+static char* read_string(int fd, uint64_t size){
+    char* str = malloc(size + 1);
+    if(str == NULL) return NULL;
+    if(!read_all(fd, str, size)){
+        free(str);
+        return NULL;
+    }
+    str[size] = '\0';
+    return str;
+}
+
+
+
+static bool send_response(int fd, const char* error, const uint8_t* object, uint64_t object_size){
+    ResponseHeader head = {0};
+    head.status = (error != NULL) ? RESPONSE_ERROR : RESPONSE_OK;
+    head.error_size = (error != NULL) ? strlen(error) : 0;
+    head.object_size = object_size;
+
+    if(!write_all(fd, &head, sizeof(head))) return false;
+    if(!write_all(fd, error, head.error_size)) return false;
+    return write_all(fd, object, object_size);
+}
+
+
+
+static bool server_handle_request(int fd){
+    RequestHeader head;
+    if(!read_all(fd, &head, sizeof(head))) return false;
+
+    if(head.magic != SERVER_MAGIC || head.name_size > REQUEST_MAX_PATH || head.directory_size > REQUEST_MAX_PATH ||
+       head.output_size > REQUEST_MAX_PATH || head.source_size > REQUEST_MAX_SOURCE){
+        send_response(fd, "Error: Invalid request\n", NULL, 0);
+        return false;
+    }
+
+    char* name = read_string(fd, head.name_size);
+    char* directory = (head.directory_size > 0) ? read_string(fd, head.directory_size) : NULL;
+    char* source = (head.flags & REQUEST_INLINE_SOURCE) ? read_string(fd, head.source_size) : NULL;
+    char* output = (head.output_size > 0) ? read_string(fd, head.output_size) : NULL;
+
+    bool ok = name != NULL && (head.directory_size == 0 || directory != NULL) && ((head.flags & REQUEST_INLINE_SOURCE) == 0 || source != NULL) &&
+              (head.output_size == 0 || output != NULL);
+
+    BasmContext* ctx = ok ? basm_context_create() : NULL;
+    if(ctx != NULL){
+        basm_context_set_options(ctx, head.options);
+        bool result = directory == NULL || context_set_directory(ctx, directory);
+        if(result && source != NULL) result = basm_assemble_source(ctx, name, source, head.source_size);
+        else if(result) result = basm_assemble_file(ctx, name);
+
+        uint8_t* object = NULL;
+        size_t object_size = 0;
+        if(result && output != NULL){
+            result = basm_write_object(ctx, (BasmFileType)head.ftype, output);
+        } else if(result){
+            result = basm_write_object_memory(ctx, (BasmFileType)head.ftype, &object, &object_size);
+        }
+
+        const char* error = basm_context_error(ctx);
+        if(!result && error == NULL) error = "Error: Failed to write the object\n";
+        ok = send_response(fd, result ? NULL : error, object, object_size);
+
+        free(object);
+        basm_context_delete(ctx);
+    } else if(ok){
+        send_response(fd, "Error: Out of memory\n", NULL, 0);
+        ok = false;
+    }
+
+    free(name);
+    free(directory);
+    free(source);
+    free(output);
+    return ok;
+}
+
+
+static void* server_connection(void* arg){
+    int fd = (int)(intptr_t)arg;
+    while(server_handle_request(fd));
+    close(fd);
+    return NULL;
+}
+
+
+
+static bool socket_address(const char* socket_path, struct sockaddr_un* addr){
+    memset(addr, 0, sizeof(*addr));
+    addr->sun_family = AF_UNIX;
+    if(strlen(socket_path) >= sizeof(addr->sun_path)){
+        fprintf(stderr, "Error: Socket path is too long: %s\n", socket_path);
+        return false;
+    }
+    strcpy(addr->sun_path, socket_path);
+    return true;
+}
+
+
+
+bool basm_serve(const char* socket_path){
+    struct sockaddr_un addr;
+    if(!socket_address(socket_path, &addr)) return false;
+
+    int server = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(server < 0){
+        fprintf(stderr, "Error: Failed to create socket\n");
+        return false;
+    }
+
+    unlink(socket_path);
+    //the socket file gets mode 0600 when it's created, changing it after bind would leave a window to connect
+    mode_t mask = umask(0177);
+    int bound = bind(server, (struct sockaddr*)&addr, sizeof(addr));
+    umask(mask);
+    if(bound != 0 || listen(server, 64) != 0){
+        fprintf(stderr, "Error: Failed to listen on %s\n", socket_path);
+        close(server);
+        return false;
+    }
+
+    while(true){
+        int fd = accept(server, NULL, NULL);
+        if(fd < 0) continue;
+
+        pthread_t thread;
+        if(pthread_create(&thread, NULL, server_connection, (void*)(intptr_t)fd) != 0){
+            close(fd);
+            continue;
+        }
+        pthread_detach(thread);
+    }
+}
+
+
+
+bool client_assemble_file(const char* socket_path, const char* input_file, const char* output_file, BasmFileType ftype, uint32_t options){
+    struct sockaddr_un addr;
+    if(!socket_address(socket_path, &addr)) return false;
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(fd < 0 || connect(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0){
+        fprintf(stderr, "Error: Failed to connect to %s\n", socket_path);
+        if(fd >= 0) close(fd);
+        return false;
+    }
+
+    //the server doesn't share our working directory, the name is sent as it was typed so the object names the same file
+    char directory[PATH_MAX];
+    if(getcwd(directory, sizeof(directory)) == NULL){
+        fprintf(stderr, "Error: Failed to get the working directory\n");
+        close(fd);
+        return false;
+    }
+
+    RequestHeader request = {0};
+    request.magic = SERVER_MAGIC;
+    request.ftype = ftype;
+    request.options = options;
+    request.name_size = strlen(input_file);
+    request.directory_size = strlen(directory);
+
+    ResponseHeader response;
+    bool result = write_all(fd, &request, sizeof(request)) && write_all(fd, input_file, request.name_size) &&
+                  write_all(fd, directory, request.directory_size) && read_all(fd, &response, sizeof(response));
+    if(!result){
+        fprintf(stderr, "Error: Lost connection to %s\n", socket_path);
+        close(fd);
+        return false;
+    }
+
+    char* error = read_string(fd, response.error_size);
+    uint8_t* object = malloc(response.object_size + 1);
+    result = error != NULL && object != NULL && read_all(fd, object, response.object_size);
+
+    if(!result){
+        fprintf(stderr, "Error: Lost connection to %s\n", socket_path);
+    } else if(response.status != RESPONSE_OK){
+        fprintf(stderr, "%s", error);
+        result = false;
+    } else{
+        result = write_file(output_file, object, response.object_size, ftype == BASM_FILE_ELF_EXEC);
+    }
+
+    free(error);
+    free(object);
+    close(fd);
+    return result;
+}
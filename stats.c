@@ -0,0 +1,136 @@
+#include "util.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <sys/resource.h>
+
+
+uint64_t stats_malloc_calls = 0;
+
+
+//totals of every file assembled by this process
+static struct {
+    pthread_mutex_t lock;
+    Stats total;
+} stats = {PTHREAD_MUTEX_INITIALIZER, {0}};
+
+
+static const char* PHASE_NAMES[STATS_PHASE_COUNT] = {
+    "tokenize",
+    "parse",
+    "resolve",
+    "write",
+};
+
+
+
+static uint64_t clock_ns(clockid_t clock){
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+
+//the cpu time is per thread so the phases of files assembled at the same time don't mix
+StatsTimer stats_timer_start(){
+    StatsTimer timer = {clock_ns(CLOCK_MONOTONIC), clock_ns(CLOCK_THREAD_CPUTIME_ID)};
+    return timer;
+}
+
+
+void stats_timer_stop(Stats* stats, StatsPhase phase, StatsTimer timer){
+    stats->wall_ns[phase] += clock_ns(CLOCK_MONOTONIC) - timer.wall_ns;
+    stats->cpu_ns[phase] += clock_ns(CLOCK_THREAD_CPUTIME_ID) - timer.cpu_ns;
+}
+
+
+
+void stats_add(Stats* s){
+    pthread_mutex_lock(&stats.lock);
+    Stats* total = &stats.total;
+    for(int i = 0; i < STATS_PHASE_COUNT; i++){
+        total->wall_ns[i] += s->wall_ns[i];
+        total->cpu_ns[i] += s->cpu_ns[i];
+    }
+    total->files += s->files;
+    total->cache_hits += s->cache_hits;
+    total->tokens += s->tokens;
+    total->instructions += s->instructions;
+    total->instruction_probes += s->instruction_probes;
+    total->symbols += s->symbols;
+    total->relocations += s->relocations;
+    total->text_bytes += s->text_bytes;
+    total->data_bytes += s->data_bytes;
+    total->bss_bytes += s->bss_bytes;
+    pthread_mutex_unlock(&stats.lock);
+}
+
+
+
+static double ns_to_ms(uint64_t ns){
+    return ns / 1000000.0;
+}
+
+
+static void stats_report_text(FILE* output, Stats* s, uint64_t wall_ns, long peak_rss_kb, uint64_t malloc_calls){
+    fprintf(output, "%-10s %12s %12s\n", "phase", "wall (ms)", "cpu (ms)");
+    for(int i = 0; i < STATS_PHASE_COUNT; i++){
+        fprintf(output, "%-10s %12.3f %12.3f\n", PHASE_NAMES[i], ns_to_ms(s->wall_ns[i]), ns_to_ms(s->cpu_ns[i]));
+    }
+    fprintf(output, "%-10s %12.3f\n\n", "total", ns_to_ms(wall_ns));
+
+    double probes = (s->instructions > 0) ? (double)s->instruction_probes / s->instructions : 0;
+    fprintf(output, "files:              %lu (%lu cached)\n", s->files, s->cache_hits);
+    fprintf(output, "tokens:             %lu\n", s->tokens);
+    fprintf(output, "instructions:       %lu\n", s->instructions);
+    fprintf(output, "probes/instruction: %.2f\n", probes);
+    fprintf(output, "symbols:            %lu\n", s->symbols);
+    fprintf(output, "relocations:        %lu\n", s->relocations);
+    fprintf(output, "text bytes:         %lu\n", s->text_bytes);
+    fprintf(output, "data bytes:         %lu\n", s->data_bytes);
+    fprintf(output, "bss bytes:          %lu\n", s->bss_bytes);
+    fprintf(output, "peak rss:           %ld KB\n", peak_rss_kb);
+    fprintf(output, "malloc calls:       %lu\n", malloc_calls);
+}
+
+
+static void stats_report_json(FILE* output, Stats* s, uint64_t wall_ns, long peak_rss_kb, uint64_t malloc_calls){
+    fprintf(output, "{\n  \"phases\": {\n");
+    for(int i = 0; i < STATS_PHASE_COUNT; i++){
+        fprintf(output, "    \"%s\": {\"wall_ns\": %lu, \"cpu_ns\": %lu}%s\n", PHASE_NAMES[i],
+                s->wall_ns[i], s->cpu_ns[i], (i + 1 < STATS_PHASE_COUNT) ? "," : "");
+    }
+    fprintf(output, "  },\n");
+    fprintf(output, "  \"wall_ns\": %lu,\n", wall_ns);
+    fprintf(output, "  \"files\": %lu,\n", s->files);
+    fprintf(output, "  \"cache_hits\": %lu,\n", s->cache_hits);
+    fprintf(output, "  \"tokens\": %lu,\n", s->tokens);
+    fprintf(output, "  \"instructions\": %lu,\n", s->instructions);
+    fprintf(output, "  \"instruction_probes\": %lu,\n", s->instruction_probes);
+    fprintf(output, "  \"symbols\": %lu,\n", s->symbols);
+    fprintf(output, "  \"relocations\": %lu,\n", s->relocations);
+    fprintf(output, "  \"text_bytes\": %lu,\n", s->text_bytes);
+    fprintf(output, "  \"data_bytes\": %lu,\n", s->data_bytes);
+    fprintf(output, "  \"bss_bytes\": %lu,\n", s->bss_bytes);
+    fprintf(output, "  \"peak_rss_kb\": %ld,\n", peak_rss_kb);
+    fprintf(output, "  \"malloc_calls\": %lu\n", malloc_calls);
+    fprintf(output, "}\n");
+}
+
+
+//run is the timer started before the first file
+void stats_report(FILE* output, StatsTimer run, bool json){
+    uint64_t wall_ns = clock_ns(CLOCK_MONOTONIC) - run.wall_ns;
+    struct rusage usage;
+    long peak_rss_kb = (getrusage(RUSAGE_SELF, &usage) == 0) ? usage.ru_maxrss : 0;
+    uint64_t malloc_calls = __atomic_load_n(&stats_malloc_calls, __ATOMIC_RELAXED);
+
+    pthread_mutex_lock(&stats.lock);
+    if(json) stats_report_json(output, &stats.total, wall_ns, peak_rss_kb, malloc_calls);
+    else stats_report_text(output, &stats.total, wall_ns, peak_rss_kb, malloc_calls);
+    pthread_mutex_unlock(&stats.lock);
+}
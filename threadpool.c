@@ -0,0 +1,153 @@
+#include "util.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+
+/*
+ * Every worker owns a deque of task indices
+ * The owner takes tasks from the bottom and idle workers steal from the top
+ * so a worker stuck on a big file doesn't hold back the tasks queued behind it
+ */
+typedef struct {
+    pthread_mutex_t lock;
+    uint32_t* tasks;
+    uint32_t top;
+    uint32_t bottom;
+} WorkQueue;
+
+
+typedef struct ThreadPool ThreadPool;
+
+typedef struct {
+    ThreadPool* pool;
+    uint32_t id;
+} Worker;
+
+
+struct ThreadPool {
+    WorkQueue* queues;
+    Worker* workers;
+    uint32_t worker_count;
+    ThreadPoolFunc func;
+    void* arg;
+};
+
+
+
+static bool work_queue_pop(WorkQueue* q, uint32_t* task){
+    bool found = false;
+    pthread_mutex_lock(&q->lock);
+    if(q->top < q->bottom){
+        *task = q->tasks[--q->bottom];
+        found = true;
+    }
+    pthread_mutex_unlock(&q->lock);
+    return found;
+}
+
+
+static bool work_queue_steal(WorkQueue* q, uint32_t* task){
+    bool found = false;
+    pthread_mutex_lock(&q->lock);
+    if(q->top < q->bottom){
+        *task = q->tasks[q->top++];
+        found = true;
+    }
+    pthread_mutex_unlock(&q->lock);
+    return found;
+}
+
+
+
+//tasks never create other tasks so a worker is done once every queue is empty
+static bool worker_next_task(Worker* w, uint32_t* task){
+    ThreadPool* pool = w->pool;
+    if(work_queue_pop(&pool->queues[w->id], task)) return true;
+
+    for(uint32_t i = 1; i < pool->worker_count; i++){
+        uint32_t victim = (w->id + i) % pool->worker_count;
+        if(work_queue_steal(&pool->queues[victim], task)) return true;
+    }
+    return false;
+}
+
+
+static void* worker_run(void* arg){
+    Worker* w = arg;
+    uint32_t task;
+    while(worker_next_task(w, &task)){
+        w->pool->func(w->pool->arg, task);
+    }
+    return NULL;
+}
+
+
+
+bool thread_pool_run(uint32_t worker_count, uint32_t task_count, ThreadPoolFunc func, void* arg){
+    if(worker_count > task_count) worker_count = task_count;
+    if(worker_count == 0) worker_count = 1;
+
+    ThreadPool pool = {0};
+    pool.worker_count = worker_count;
+    pool.func = func;
+    pool.arg = arg;
+    pool.queues = calloc(worker_count, sizeof(WorkQueue));
+    pool.workers = calloc(worker_count, sizeof(Worker));
+    pthread_t* threads = calloc(worker_count, sizeof(pthread_t));
+    uint32_t* tasks = malloc(sizeof(uint32_t) * (task_count + 1));
+
+    if(pool.queues == NULL || pool.workers == NULL || threads == NULL || tasks == NULL){
+        fprintf(stderr, "Error: Out of memory\n");
+        free(pool.queues);
+        free(pool.workers);
+        free(threads);
+        free(tasks);
+        return false;
+    }
+
+    //deal the tasks out in order, each worker gets a contiguous slice of the array
+    uint32_t next = 0;
+    for(uint32_t i = 0; i < worker_count; i++){
+        WorkQueue* q = &pool.queues[i];
+        pthread_mutex_init(&q->lock, NULL);
+        q->tasks = tasks + next;
+        for(uint32_t task = i; task < task_count; task += worker_count){
+            tasks[next++] = task;
+        }
+        //the owner pops from the bottom so the first task goes last
+        uint32_t count = (uint32_t)(tasks + next - q->tasks);
+        for(uint32_t j = 0; j < count / 2; j++){
+            uint32_t temp = q->tasks[j];
+            q->tasks[j] = q->tasks[count - j - 1];
+            q->tasks[count - j - 1] = temp;
+        }
+        q->top = 0;
+        q->bottom = count;
+        pool.workers[i] = (Worker){&pool, i};
+    }
+
+    //the calling thread is worker 0
+    uint32_t started = 1;
+    for(uint32_t i = 1; i < worker_count; i++){
+        if(pthread_create(&threads[i], NULL, worker_run, &pool.workers[i]) != 0) break;
+        started++;
+    }
+    worker_run(&pool.workers[0]);
+
+    for(uint32_t i = 1; i < started; i++){
+        pthread_join(threads[i], NULL);
+    }
+
+    for(uint32_t i = 0; i < worker_count; i++){
+        pthread_mutex_destroy(&pool.queues[i].lock);
+    }
+    free(pool.queues);
+    free(pool.workers);
+    free(threads);
+    free(tasks);
+    return true;
+}
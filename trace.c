@@ -0,0 +1,182 @@
+#include "util.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+
+
+/*
+ * Every thread records its spans into its own buffer without taking a lock,
+ * the buffer is only registered in the global list the first time the thread records something
+ * The buffers are written out once at the end of the run as trace event json
+ * which chrome://tracing and ui.perfetto.dev can open, every thread gets its own track
+ */
+typedef struct {
+    const char* name;
+    char* detail;
+    uint64_t start_ns;
+    uint64_t duration_ns;
+} TraceEvent;
+
+
+typedef struct TraceBuffer TraceBuffer;
+
+struct TraceBuffer {
+    TraceBuffer* next;
+    int tid;
+    ArrayList events;
+    ArrayList details; //copies the events point into, the spans of a file share one
+};
+
+
+bool trace_enabled = false;
+
+static struct {
+    pthread_mutex_t lock;
+    TraceBuffer* buffers;
+    uint64_t start_ns;
+    int thread_count;
+} trace = {PTHREAD_MUTEX_INITIALIZER, NULL, 0, 0};
+
+static __thread TraceBuffer* thread_buffer = NULL;
+
+
+
+static uint64_t trace_timestamp(){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+
+void trace_start(){
+    trace.start_ns = trace_timestamp();
+    trace_enabled = true;
+}
+
+
+TraceSpan trace_begin(const char* name, const char* detail){
+    TraceSpan span = {0};
+    if(!trace_enabled) return span;
+    span.name = name;
+    span.detail = detail;
+    span.start_ns = trace_timestamp();
+    return span;
+}
+
+
+static TraceBuffer* trace_thread_buffer(){
+    if(thread_buffer != NULL) return thread_buffer;
+
+    TraceBuffer* buffer = calloc(1, sizeof(TraceBuffer));
+    if(buffer == NULL) return NULL;
+    buffer->tid = (int)syscall(SYS_gettid);
+    array_list_create_cap(buffer->events, TraceEvent, 64);
+    array_list_create_cap(buffer->details, char*, 8);
+
+    pthread_mutex_lock(&trace.lock);
+    buffer->next = trace.buffers;
+    trace.buffers = buffer;
+    pthread_mutex_unlock(&trace.lock);
+
+    thread_buffer = buffer;
+    return buffer;
+}
+
+
+void trace_end(TraceSpan span){
+    if(span.name == NULL) return;
+
+    TraceBuffer* buffer = trace_thread_buffer();
+    if(buffer == NULL) return;
+
+    //the name is a literal, the detail usually belongs to a context that's gone by the time the trace is written
+    //so it's copied once for the run of spans that have the same one
+    TraceEvent event = {span.name, NULL, span.start_ns, trace_timestamp() - span.start_ns};
+    if(span.detail != NULL){
+        char* last = (buffer->details.size > 0) ? array_list_get(buffer->details, char*, buffer->details.size - 1) : NULL;
+        if(last == NULL || strcmp(last, span.detail) != 0){
+            last = strdup(span.detail);
+            if(last != NULL) array_list_append(buffer->details, char*, last);
+        }
+        event.detail = last;
+    }
+    array_list_append(buffer->events, TraceEvent, event);
+}
+
+
+void trace_stop(){
+    trace_enabled = false;
+    pthread_mutex_lock(&trace.lock);
+    TraceBuffer* buffer = trace.buffers;
+    while(buffer != NULL){
+        TraceBuffer* next = buffer->next;
+        for(int i = 0; i < buffer->details.size; i++) free(array_list_get(buffer->details, char*, i));
+        free(buffer->details.data);
+        free(buffer->events.data);
+        free(buffer);
+        buffer = next;
+    }
+    trace.buffers = NULL;
+    pthread_mutex_unlock(&trace.lock);
+    thread_buffer = NULL;
+}
+
+
+
+static void write_json_string(FILE* output, const char* str){
+    fputc('"', output);
+    for(; *str != '\0'; str++){
+        unsigned char c = *str;
+        if(c == '"' || c == '\\') fprintf(output, "\\%c", c);
+        else if(c < 0x20) fprintf(output, "\\u%04x", c);
+        else fputc(c, output);
+    }
+    fputc('"', output);
+}
+
+
+bool trace_write(const char* path){
+    FILE* output = fopen(path, "w");
+    if(output == NULL){
+        fprintf(stderr, "Error: Failed to create trace %s\n", path);
+        return false;
+    }
+
+    int pid = (int)getpid();
+    bool first = true;
+    fprintf(output, "{\"traceEvents\": [\n");
+
+    pthread_mutex_lock(&trace.lock);
+    for(TraceBuffer* buffer = trace.buffers; buffer != NULL; buffer = buffer->next){
+        fprintf(output, "%s{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": %d, \"tid\": %d, \"args\": {\"name\": \"%s %d\"}}",
+                first ? "" : ",\n", pid, buffer->tid, (buffer->tid == pid) ? "main" : "worker", buffer->tid);
+        first = false;
+
+        for(int i = 0; i < buffer->events.size; i++){
+            TraceEvent event = array_list_get(buffer->events, TraceEvent, i);
+            //timestamps are in microseconds
+            fprintf(output, ",\n{\"name\": \"%s\", \"ph\": \"X\", \"pid\": %d, \"tid\": %d, \"ts\": %.3f, \"dur\": %.3f",
+                    event.name, pid, buffer->tid, (event.start_ns - trace.start_ns) / 1000.0, event.duration_ns / 1000.0);
+            if(event.detail != NULL){
+                fprintf(output, ", \"args\": {\"file\": ");
+                write_json_string(output, event.detail);
+                fprintf(output, "}");
+            }
+            fprintf(output, "}");
+        }
+    }
+    pthread_mutex_unlock(&trace.lock);
+
+    fprintf(output, "\n]}\n");
+    if(fclose(output) != 0){
+        fprintf(stderr, "Error: Failed to write trace %s\n", path);
+        return false;
+    }
+    return true;
+}
@@ -6,97 +6,112 @@
 #include <stdio.h>
 #include <stdarg.h>
 #include <string.h>
+#include <sys/stat.h>
 
 
-typedef struct {
-    char* data;
-    uint32_t offset;
-    uint32_t size;
-} ScratchBuffer;
-
-
-
-static ScratchBuffer scratch_buffer = {0};
-
 #define SCRATCH_BUFFER_SIZE 8092
 
-void init_scratch_buffer(){
-    scratch_buffer.data = malloc(SCRATCH_BUFFER_SIZE);
-    scratch_buffer.offset = 0;
+bool init_scratch_buffer(ScratchBuffer* sb){
+    if(sb->data != NULL){
+        sb->offset = 0;
+        return true;
+    }
+    sb->data = malloc(SCRATCH_BUFFER_SIZE);
+    sb->offset = 0;
+    sb->size = SCRATCH_BUFFER_SIZE;
 
-    if(scratch_buffer.data == NULL){
+    if(sb->data == NULL){
         fprintf(stderr, "Failed to allocate memory\n");
-        exit(EXIT_FAILURE);
+        return false;
     }
+    return true;
+}
+
+
+void scratch_buffer_delete(ScratchBuffer* sb){
+    free(sb->data);
+    sb->data = NULL;
+    sb->offset = 0;
+    sb->size = 0;
 }
 
-static inline void scratch_buffer_full(){
-    if(scratch_buffer.offset >= SCRATCH_BUFFER_SIZE){
+
+//makes sure there is room for the bytes plus a null terminator
+//pointers returned before this gets called can become invalid
+static inline void scratch_buffer_reserve(ScratchBuffer* sb, uint32_t bytes){
+    if(sb->offset + bytes + 1 <= sb->size) return;
+
+    uint32_t new_size = sb->size * 2;
+    while(sb->offset + bytes + 1 > new_size) new_size *= 2;
+
+    char* data = realloc(sb->data, new_size);
+    if(data == NULL){
        fprintf(stderr, "ScratchBuffer is full"); 
-       exit(EXIT_FAILURE);
+       abort();
     }
+    sb->data = data;
+    sb->size = new_size;
 }
 
-void scratch_buffer_append_char(char c){
-    scratch_buffer_full();
-    *((char*)scratch_buffer.data + scratch_buffer.offset) = c;
-    scratch_buffer.offset += sizeof(char);
+void scratch_buffer_append_char(ScratchBuffer* sb, char c){
+    scratch_buffer_reserve(sb, 1);
+    *((char*)sb->data + sb->offset) = c;
+    sb->offset += sizeof(char);
 }
 
 
-void scratch_buffer_clear(){
-    scratch_buffer.offset = 0;
+void scratch_buffer_clear(ScratchBuffer* sb){
+    sb->offset = 0;
 }
 
 
-uint32_t scratch_buffer_offset(){
-    return scratch_buffer.offset;
+uint32_t scratch_buffer_offset(ScratchBuffer* sb){
+    return sb->offset;
 }
 
 
-void* scratch_buffer_get_data(uint32_t offset){
-    if(offset >= SCRATCH_BUFFER_SIZE) return NULL;
-    return scratch_buffer.data + offset;
+void* scratch_buffer_get_data(ScratchBuffer* sb, uint32_t offset){
+    if(offset >= sb->size) return NULL;
+    return sb->data + offset;
 }
 
 
-char* scratch_buffer_fmt(const char* fmt, ...){
+char* scratch_buffer_fmt(ScratchBuffer* sb, const char* fmt, ...){
     va_list list;
     va_start(list, fmt);
-    uint32_t max_size = SCRATCH_BUFFER_SIZE - scratch_buffer.offset;
-    size_t size = vsnprintf(scratch_buffer.data + scratch_buffer.offset, max_size, fmt, list);
+    char* result = scratch_buffer_vfmt(sb, fmt, list);
     va_end(list);
-    scratch_buffer.offset += size;
-    return scratch_buffer.data;
+    return result;
 }
 
 
 
-void scratch_buffer_append_str(char* str){ 
+void scratch_buffer_append_str(ScratchBuffer* sb, char* str){ 
     int len = strlen(str) + 1;
-    if(len + scratch_buffer.offset > SCRATCH_BUFFER_SIZE){
-        printf("Failed to allocate to scratch buffer\n");
-        return;
-    }
-
-    memcpy(scratch_buffer.data + scratch_buffer.offset, str, len);
-    scratch_buffer.offset += len;
+    scratch_buffer_reserve(sb, len);
+    memcpy(sb->data + sb->offset, str, len);
+    sb->offset += len;
 }
 
 
-char* scratch_buffer_vfmt(const char* fmt, va_list list){
-    uint32_t max_size = SCRATCH_BUFFER_SIZE - scratch_buffer.offset;
-    size_t size = vsnprintf(scratch_buffer.data + scratch_buffer.offset, max_size, fmt, list);
-    scratch_buffer.offset += size;
-    return scratch_buffer.data;
+char* scratch_buffer_vfmt(ScratchBuffer* sb, const char* fmt, va_list list){
+    va_list copy;
+    va_copy(copy, list);
+    int size = vsnprintf(NULL, 0, fmt, copy);
+    va_end(copy);
+
+    scratch_buffer_reserve(sb, size);
+    vsnprintf(sb->data + sb->offset, size + 1, fmt, list);
+    sb->offset += size;
+    return sb->data;
 }
 
 
-char* scratch_buffer_as_str(){ 
-    if(scratch_buffer.offset == 0) return NULL;
+char* scratch_buffer_as_str(ScratchBuffer* sb){ 
+    if(sb->offset == 0) return NULL;
 
-    *((char*)scratch_buffer.data + scratch_buffer.offset) = '\0';
-    return scratch_buffer.data;
+    *((char*)sb->data + sb->offset) = '\0';
+    return sb->data;
 }
 
 
@@ -126,47 +141,112 @@ FileBuffer* file_buffer_create(const char* name){
 
 
 
+FileBuffer* file_buffer_create_from_memory(const char* name, const char* data, size_t size){
+    //fmemopen doesn't allow empty buffers 
+    FILE* file = (size == 0) ? fmemopen((void*)"\n", 1, "r") : fmemopen((void*)data, size, "r");
+    
+    if(file == NULL){
+        fprintf(stderr, "Failed to open memory buffer: %s\n", name);
+        return NULL;
+    }
+
+    FileBuffer* fb = malloc(sizeof(FileBuffer) + FILE_BUFFER_CAPACITY);
+
+    if(fb == NULL){
+        fprintf(stderr, "Failed to allocate memory for file: %s\n", name);
+        fclose(file);
+        return NULL;
+    }
+    fb->name = name;
+    fb->file = file;
+    fb->size = 0;
+    fb->index = 0;
+    fb->data = (char*)((uint8_t*)fb + sizeof(FileBuffer));
+
+    return fb;
+}
+
+
+
+//reads a whole file into a malloced buffer
+char* read_file(const char* name, size_t* size){
+    FILE* file = fopen(name, "rb");
+    if(file == NULL) return NULL;
+
+    size_t capacity = 4096;
+    size_t length = 0;
+    char* data = malloc(capacity);
+
+    while(data != NULL){
+        length += fread(data + length, 1, capacity - length, file);
+        if(length < capacity) break;
+        capacity *= 2;
+        char* temp = realloc(data, capacity);
+        if(temp == NULL) free(data);
+        data = temp;
+    }
+
+    if(data != NULL && ferror(file)){
+        free(data);
+        data = NULL;
+    }
+    fclose(file);
+    *size = length;
+    return data;
+}
+
+
+bool write_file(const char* name, const void* data, size_t size, bool executable){
+    FILE* file = fopen(name, "wb");
+    if(file == NULL){
+        fprintf(stderr, "Error: Failed to create file %s\n", name);
+        return false;
+    }
+
+    bool result = fwrite(data, 1, size, file) == size;
+    result = (fclose(file) == 0) && result;
+    if(result && executable) chmod(name, 0755);
+    return result;
+}
+
+
+
 void file_buffer_delete(FileBuffer* buff){
-    if(buff != NULL) free(buff);
+    if(buff != NULL){
+        fclose(buff->file);
+        free(buff);
+    } 
+}
+
+//loads the next block of the file once everything in the buffer was read
+static bool file_buffer_fill(FileBuffer* buff){
+    if(buff->index < buff->size) return true;
+    buff->size = fread(buff->data, 1, FILE_BUFFER_CAPACITY, buff->file);
+    buff->index = 0;
+    return buff->size > 0;
 }
 
+
+//true once every character was read
 bool file_buffer_eof(FileBuffer* buff){
-    return buff->size < FILE_BUFFER_CAPACITY && buff->index >= buff->size - 1;
+    return !file_buffer_fill(buff);
 }
 
 
 char file_buffer_get_char(FileBuffer* buff){
-    if(buff->size == 0 || buff->index >= buff->size){ 
-        size_t size = fread(buff->data, 1, FILE_BUFFER_CAPACITY, buff->file);
-        if(size == 0) return EOF; 
-        buff->size = size;
-        buff->index = 0;
-    } 
+    if(!file_buffer_fill(buff)) return EOF;
     return buff->data[buff->index++];
 }
 
 char file_buffer_peek_char(FileBuffer* buff){
-    if(buff->size == 0){ 
-        size_t size = fread(buff->data, 1, FILE_BUFFER_CAPACITY, buff->file);
-        if(size == 0) return EOF;
-        buff->size = size; 
-        buff->index = 0;
-    }
-
-    else if(buff->index >= buff->size - 1){
-        fpos_t pos;
-        fgetpos(buff->file, &pos);
-        char c = fgetc(buff->file);
-        fsetpos(buff->file, &pos);
-        return c;
-    }
+    if(!file_buffer_fill(buff)) return EOF;
     return buff->data[buff->index];
 }
 
 
 char* file_get_line(FileBuffer* buff, int line){
     long current_offset = ftell(buff->file);
-    long offset = current_offset - buff->index; 
+    long offset = current_offset - (long)(buff->size - buff->index); 
     
     rewind(buff->file);
 
@@ -178,9 +258,14 @@ char* file_get_line(FileBuffer* buff, int line){
     }
 
     char* line_data = fgets(buff->data, FILE_BUFFER_CAPACITY, buff->file);
+    if(line_data == NULL){
+        line_data = buff->data;
+        line_data[0] = 0;
+    }
 
+    //the last line might not end with a new line
     for(int i = 0;;i++){
-        if(line_data[i] == EOF || line_data[i] == '\n' || line_data[i] == ';'){
+        if(line_data[i] == 0 || line_data[i] == EOF || line_data[i] == '\n' || line_data[i] == ';'){
             line_data[i] = 0;
             break;
         }
@@ -191,3 +276,95 @@ char* file_get_line(FileBuffer* buff, int line){
     buff->index = 0;
     return buff->data;
 }
+
+
+
+const uint8_t NOP_PADDING[MAX_NOP_SIZE][MAX_NOP_SIZE] = {
+    {0x90},
+    {0x66, 0x90},
+    {0x0F, 0x1F, 0x00},
+    {0x0F, 0x1F, 0x40, 0x00},
+    {0x0F, 0x1F, 0x44, 0x00, 0x00},
+    {0x66, 0x0F, 0x1F, 0x44, 0x00, 0x00},
+    {0x0F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00},
+    {0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x66, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x66, 0x2E, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x66, 0x66, 0x2E, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},
+};
+
+
+
+TextSubsection* text_subsection(ArrayList* subsections, uint64_t offset){
+    //binary search for the last subsection that starts at or before offset
+    int low = 0;
+    int high = subsections->size;
+    while(low < high){
+        int mid = (low + high) / 2;
+        if(array_list_get((*subsections), TextSubsection, mid).start <= offset) low = mid + 1;
+        else high = mid;
+    }
+    return (low == 0) ? NULL : &array_list_get((*subsections), TextSubsection, low - 1);
+}
+
+
+Section* program_section(Program* p, uint8_t section){
+    if(section == SECTION_TEXT) return &p->text;
+    if(section == SECTION_DATA) return &p->data;
+    if(section == SECTION_BSS) return &p->bss;
+    if(section >= SECTION_USER && section < program_section_count(p)){
+        return &array_list_get(p->sections, ProgramSection, section - SECTION_USER).bytes;
+    }
+    return NULL;
+}
+
+
+const char* program_section_name(Program* p, uint8_t section){
+    if(section == SECTION_TEXT) return ".text";
+    if(section == SECTION_DATA) return ".data";
+    if(section == SECTION_BSS) return ".bss";
+    return array_list_get(p->sections, ProgramSection, section - SECTION_USER).name;
+}
+
+
+uint32_t program_section_flags(Program* p, uint8_t section){
+    if(section == SECTION_TEXT) return SECTION_FLAG_EXEC;
+    if(section == SECTION_DATA) return SECTION_FLAG_WRITE;
+    if(section == SECTION_BSS) return SECTION_FLAG_WRITE | SECTION_FLAG_NOBITS;
+    return array_list_get(p->sections, ProgramSection, section - SECTION_USER).flags;
+}
+
+
+bool program_uses_tls(Program* p){
+    for(int i = 0; i < p->sections.size; i++){
+        if(array_list_get(p->sections, ProgramSection, i).flags & SECTION_FLAG_TLS) return true;
+    }
+    for(int i = 0; i < p->symTable.symbols.size; i++){
+        SymbolTableEntry* e = &array_list_get(p->symTable.symbols, SymbolTableEntry, i);
+        for(int j = 0; j < e->instances.size; j++){
+            if(array_list_get(e->instances, SymbolInstance, j).reloc != SYMBOL_RELOC_DEFAULT) return true;
+        }
+    }
+    return false;
+}
+
+
+
+//a call rel32 (e8) to the label, its relative fields end at the instance offset
+static bool symbol_is_called(Program* p, SymbolTableEntry* e){
+    for(int i = 0; i < e->instances.size; i++){
+        SymbolInstance instance = array_list_get(e->instances, SymbolInstance, i);
+        if(instance.is_relative && instance.offset >= 5 && instance.offset <= p->text.size && p->text.data[instance.offset - 5] == 0xE8) return true;
+    }
+    return false;
+}
+
+
+uint8_t program_symbol_type(Program* p, SymbolTableEntry* e){
+    if(e->type != SYMBOL_TYPE_AUTO) return e->type;
+    if(e->section == SECTION_EXTERN || e->section >= program_section_count(p)) return SYMBOL_TYPE_NONE;
+    //local labels in code are mostly jump targets inside a function, they would split it in two
+    //unless something calls them, then they are a function of their own that ends the one before
+    if(e->section == SECTION_TEXT) return (e->visibility == VISIBILITY_GLOBAL || symbol_is_called(p, e)) ? SYMBOL_TYPE_FUNCTION : SYMBOL_TYPE_NONE;
+    return SYMBOL_TYPE_OBJECT;
+}
@@ -1,3 +1,4 @@
+#include "entry.h"
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdarg.h>
@@ -46,23 +47,32 @@ do { \
     } while(0)
 
 
-void init_scratch_buffer();
+typedef struct {
+    char* data;
+    uint32_t offset;
+    uint32_t size;
+} ScratchBuffer;
+
+
+bool init_scratch_buffer(ScratchBuffer* sb);
 
-void scratch_buffer_append_char(char c);
+void scratch_buffer_delete(ScratchBuffer* sb);
 
-void scratch_buffer_clear();
+void scratch_buffer_append_char(ScratchBuffer* sb, char c);
 
-uint32_t scratch_buffer_offset();
+void scratch_buffer_clear(ScratchBuffer* sb);
 
-char* scratch_buffer_fmt(const char* fmt, ...);
+uint32_t scratch_buffer_offset(ScratchBuffer* sb);
 
-char* scratch_buffer_vfmt(const char* fmt, va_list list);
+char* scratch_buffer_fmt(ScratchBuffer* sb, const char* fmt, ...);
 
-void scratch_buffer_append_str(char* str);
+char* scratch_buffer_vfmt(ScratchBuffer* sb, const char* fmt, va_list list);
 
-void* scratch_buffer_get_data(uint32_t offset);
+void scratch_buffer_append_str(ScratchBuffer* sb, char* str);
 
-char* scratch_buffer_as_str();
+void* scratch_buffer_get_data(ScratchBuffer* sb, uint32_t offset);
+
+char* scratch_buffer_as_str(ScratchBuffer* sb);
 
 #define FILE_BUFFER_CAPACITY 4096
 
@@ -77,6 +87,8 @@ typedef struct {
 
 FileBuffer* file_buffer_create(const char* name);
 
+FileBuffer* file_buffer_create_from_memory(const char* name, const char* data, size_t size);
+
 void file_buffer_delete(FileBuffer* buff);
 
 bool file_buffer_eof(FileBuffer* buff);
@@ -87,11 +99,17 @@ char file_buffer_peek_char(FileBuffer* buff);
 
 char* file_get_line(FileBuffer* buff, int line);
 
+char* read_file(const char* name, size_t* size);
+
+bool write_file(const char* name, const void* data, size_t size, bool executable);
+
 
 #define SECTION_EXTERN 0
 #define SECTION_TEXT 1 
 #define SECTION_DATA 2 
 #define SECTION_BSS 3 
+//sections declared with a section line, SECTION_USER + i is sections[i] of the program
+#define SECTION_USER 4
 
 #define SECTION_UNDEFINED 255
 
@@ -104,18 +122,39 @@ char* file_get_line(FileBuffer* buff, int line);
 
 
 
-//SYMBOLS ARE ONLY VALID IN THE TEXT SECTION FOR NOW 
+//what the linker puts in a field besides the plain address or offset of the symbol
+typedef enum {
+    SYMBOL_RELOC_DEFAULT = 0,
+    SYMBOL_RELOC_TPOFF, //offset of a thread local symbol from the thread pointer (fs), label@tpoff
+    SYMBOL_RELOC_GOTTPOFF, //rip relative address of the got entry holding that offset, label@gottpoff
+} SymbolReloc;
+
+
 typedef struct {
     uint64_t offset; 
-    bool is_relative;
+    bool is_relative; //relative fields are only in the text section
+    uint8_t section; //the field is in
+    uint8_t size; //of the field, 4 or 8 bytes
+    uint8_t reloc; //SymbolReloc, the tls ones always get a relocation
 }SymbolInstance;
 
 
+//what profilers and debuggers see a symbol as, global name:function|data [size] sets it
+typedef enum {
+    SYMBOL_TYPE_AUTO = 0, //global labels in code are functions, labels in the other sections are objects
+    SYMBOL_TYPE_NONE,
+    SYMBOL_TYPE_FUNCTION,
+    SYMBOL_TYPE_OBJECT,
+} SymbolType;
+
+
 typedef struct {
     char* name;
     uint8_t section;
     uint8_t visibility;
+    uint8_t type; //SymbolType
     uint64_t section_offset;
+    uint64_t size; //given after the type, 0 if it goes up to the next function or object of the section
     ArrayList instances; 
 } SymbolTableEntry;
 
@@ -130,20 +169,315 @@ typedef struct {
     uint8_t* data;
     uint64_t capacity;
     uint64_t size;
+    uint64_t alignment; //largest align directive in the section, 0 if there wasn't one
 } Section;
 
+//the recommended multi byte nops the text section is aligned with, NOP_PADDING[n - 1] is n bytes long
+//longer padding is made out of several of them, past 11 bytes they need more than 3 prefixes which some cores decode slowly
+#define MAX_NOP_SIZE 11
+
+extern const uint8_t NOP_PADDING[MAX_NOP_SIZE][MAX_NOP_SIZE];
+
+//the alignment a writer has to give the section, never less than what the format uses by default
+#define section_alignment(section, minimum) (((section).alignment > (minimum)) ? (section).alignment : (uint64_t)(minimum))
+
+
+//a part of the text section that objects get as its own section, so the linker can drop or move it on its own
+typedef struct {
+    const char* name;
+    uint64_t start; //offset in the text section, it ends where the next one starts
+} TextSubsection;
+
+
+typedef enum {
+    SECTION_FLAG_EXEC = 1,
+    SECTION_FLAG_WRITE = 2,
+    SECTION_FLAG_NOBITS = 4, //only has a size, like the bss
+    SECTION_FLAG_NOALLOC = 8, //isn't loaded when the program runs
+    SECTION_FLAG_MERGE = 16, //constants of entry_size bytes the linker keeps one copy of
+    SECTION_FLAG_STRINGS = 32, //the constants of a merge section are nul terminated strings instead
+    SECTION_FLAG_TLS = 64, //every thread gets its own copy, .tdata and .tbss
+} SectionFlags;
+
+
+//a data or bss like section declared with a section line, code goes to a text subsection instead
+typedef struct {
+    const char* name;
+    uint32_t flags;
+    uint64_t entry_size; //of the constants in a merge section, 0 otherwise
+    Section bytes; //only the size is used if the section is nobits
+} ProgramSection;
+
+
+//where the last row of a dwarf line program left the address and line registers
+typedef struct {
+    uint64_t address;
+    uint32_t line;
+} LineProgramState;
+
+
+//a field that holds the address of an offset in another section, the dwarf sections of -g point into the code and at each other
+typedef struct {
+    uint8_t section; //the field is in
+    uint8_t size; //of the field, 4 or 8 bytes
+    uint8_t target;
+    uint64_t offset;
+    uint64_t target_offset;
+    bool is_relative; //holds the distance from the field to the target instead, like the start of an fde in .eh_frame
+} SectionAddress;
+
+
+//the call frame instructions the .cfi_* directives and --auto-cfi record, the values are their dwarf opcodes
+typedef enum {
+    CFI_REMEMBER_STATE = 0x0a,
+    CFI_RESTORE_STATE = 0x0b,
+    CFI_DEF_CFA = 0x0c,
+    CFI_DEF_CFA_REGISTER = 0x0d,
+    CFI_DEF_CFA_OFFSET = 0x0e,
+    CFI_OFFSET = 0x80,
+    CFI_RESTORE = 0xc0,
+} CfiOp;
+
+
+//dwarf numbers of the registers the cfa is based on and of the return address
+#define DWARF_REG_RBP 6
+#define DWARF_REG_RSP 7
+#define DWARF_REG_RETURN_ADDRESS 16
+
+//the dwarf number of rax to r15, in the order of their encoding
+extern const uint8_t DWARF_REGISTERS[16];
+
+
+//a change to where the caller's frame is, it holds from offset in the text section on
+typedef struct {
+    uint64_t offset;
+    uint8_t op; //CfiOp
+    uint8_t reg; //dwarf number
+    int64_t value; //offset of the cfa from reg, or where reg is saved relative to the cfa
+} CfiRule;
+
+
+//the code from .cfi_startproc to .cfi_endproc, an fde of .eh_frame
+typedef struct {
+    uint64_t start;
+    uint64_t end;
+    uint32_t first_rule; //index in Program.cfi_rules
+    uint32_t rule_count;
+} CfiFrame;
+
 
 typedef struct {
     SymbolTable symTable; //holds all the locations of the symbols 
     Section data;
     Section text;
     Section bss;
+    ArrayList subsections; //TextSubsection sorted by start, empty if all the code is in .text
+    ArrayList sections; //ProgramSection in the order they were declared
+    Section line_program; //dwarf line number rows of the code from the start of .text, only with -g
+    LineProgramState line_state; //after the last row of line_program
+    ArrayList section_addresses; //SectionAddress of the sections added by program_add_debug_sections
+    ArrayList cfi_frames; //CfiFrame in the order of the code
+    ArrayList cfi_rules; //CfiRule of all the frames, each frame's in the order of the code
 } Program;
 
+//the TextSubsection of the list the byte at offset of the text section is in, NULL if there are none
+TextSubsection* text_subsection(ArrayList* subsections, uint64_t offset);
+
+//the bytes of SECTION_TEXT/DATA/BSS or a user section, NULL for externs
+Section* program_section(Program* p, uint8_t section);
+
+const char* program_section_name(Program* p, uint8_t section);
+
+uint32_t program_section_flags(Program* p, uint8_t section);
+
+//true if there are tls sections or label@tpoff/label@gottpoff fields, which only a linker can resolve
+bool program_uses_tls(Program* p);
+
+//the SymbolType of e with SYMBOL_TYPE_AUTO worked out, never SYMBOL_TYPE_AUTO
+uint8_t program_symbol_type(Program* p, SymbolTableEntry* e);
+
+//number of section ids in use, user sections included
+#define program_section_count(p) (SECTION_USER + (p)->sections.size)
+
+
+
+
+
+bool write_elf(ScratchBuffer* sb, const char* input_file, FILE* output_stream, Program *p);
+
+bool write_pe(ScratchBuffer* sb, const char* input_file, FILE* output_stream, Program* p);
+
+bool write_elf_exec(FILE* output_stream, Program* p);
+
+BasmJit* jit_load_program(Program* p, BasmJitOptions* options, char* error, size_t error_size);
+
+
+//the bytes a source line emitted, end == start for lines that only hold a label
+typedef struct {
+    uint32_t line;
+    uint8_t section;
+    uint64_t start;
+    uint64_t end;
+} ListingLine;
+
+//lines holds the ListingLine of the file in source order, the symbols have to be resolved already
+bool write_listing(const char* listing_file, const char* input_file, Program* p, ArrayList* lines);
+
+
+
+//the most bytes line_program_row writes
+#define LINE_PROGRAM_MAX_ROW 24
+
+//encodes a row for the instruction at address, returns the number of bytes written to out
+int line_program_row(uint8_t* out, LineProgramState* state, uint64_t address, uint32_t line);
+
+//adds the .debug_* sections of the line program to the user sections before an elf object is written
+//returns false if it runs out of memory, program_remove_debug_sections takes them out again either way
+//directory is the one the input file is in, NULL for the current directory
+bool program_add_debug_sections(Program* p, const char* input_file, const char* directory);
+
+//adds the .eh_frame of the cfi frames, one cie for all of them and an fde per frame, false if it fails
+bool program_add_unwind_section(Program* p);
+
+//takes out the sections added by program_add_debug_sections and program_add_unwind_section
+void program_remove_debug_sections(Program* p, int section_count);
+
+
+
+typedef void (*ThreadPoolFunc)(void* arg, uint32_t task);
+
+//runs func for every task index in [0, task_count) and returns once they are all done
+bool thread_pool_run(uint32_t worker_count, uint32_t task_count, ThreadPoolFunc func, void* arg);
+
+
+
+//an object or executable read back for the disassembler, the names point into the file data
+typedef struct {
+    const char* name;
+    uint64_t offset;
+    uint8_t section;
+    uint8_t visibility;
+} ObjectSymbol;
+
+
+typedef struct {
+    uint64_t offset; //of the field in the text section
+    const char* name; //symbol the field refers to, NULL if it's relative to the start of section
+    uint8_t section;
+    int64_t addend;
+    bool is_relative;
+    uint8_t reloc; //SymbolReloc, label@tpoff and label@gottpoff
+} ObjectRelocation;
+
+
+typedef struct {
+    char* file;
+    const uint8_t* text;
+    uint64_t text_size;
+    uint64_t text_address;
+    const uint8_t* data;
+    uint64_t data_size;
+    uint64_t data_address; //of executables, the bss follows the data
+    uint64_t bss_size;
+    ArrayList symbols; //ObjectSymbol sorted by section and offset
+    ArrayList relocations; //ObjectRelocation sorted by offset
+
+    //objects with more than one text section get them back to back in a copy, the same way basm lays out subsections
+    ArrayList text_sections; //TextSubsection, empty if there is only .text
+    uint8_t* text_copy;
+} ObjectFile;
+
+//reads elf objects and the executables written by write_elf_exec
+bool read_object(const char* input_file, ObjectFile* obj);
+
+void object_delete(ObjectFile* obj);
+
+
+//sends one file to a basm server and writes the object it returns
+bool client_assemble_file(const char* socket_path, const char* input_file, const char* output_file, BasmFileType ftype, uint32_t options);
+
+//relative input and output paths are opened in directory, which -g writes as the directory of the input
+//the server assembles in the working directory of the client with it
+bool context_set_directory(BasmContext* ctx, const char* directory);
+
+
+
+typedef struct {
+    uint64_t high;
+    uint64_t low;
+} CacheKey;
+
+CacheKey cache_key(AssemblerFlags* flags, const char* input_file, const char* source, size_t size);
+
+//copies the cached object to the output, returns false on a miss
+bool cache_fetch(const char* cache_dir, CacheKey key, const char* output_file, bool executable);
+
+void cache_store(const char* cache_dir, CacheKey key, const void* data, size_t size, uint64_t max_size);
+
+
+
+typedef enum {
+    STATS_TOKENIZE,
+    STATS_PARSE,
+    STATS_RESOLVE,
+    STATS_WRITE,
+    STATS_PHASE_COUNT,
+} StatsPhase;
+
+
+typedef struct {
+    uint64_t wall_ns[STATS_PHASE_COUNT];
+    uint64_t cpu_ns[STATS_PHASE_COUNT];
+
+    uint64_t files;
+    uint64_t cache_hits;
+    uint64_t tokens;
+    uint64_t instructions;
+    uint64_t instruction_probes; //variants find_instruction checked
+    uint64_t symbols;
+    uint64_t relocations;
+    uint64_t text_bytes;
+    uint64_t data_bytes;
+    uint64_t bss_bytes;
+} Stats;
+
+
+typedef struct {
+    uint64_t wall_ns;
+    uint64_t cpu_ns;
+} StatsTimer;
+
+//counted by the malloc wrappers in main.c, stays 0 when basm is used as a library
+extern uint64_t stats_malloc_calls;
+
+StatsTimer stats_timer_start();
+
+void stats_timer_stop(Stats* stats, StatsPhase phase, StatsTimer timer);
+
+//adds the stats of one file to the totals of the run, safe to call from any thread
+void stats_add(Stats* stats);
+
+void stats_report(FILE* output, StatsTimer run, bool json);
+
+
+
+//spans only get recorded after trace_start, otherwise trace_begin returns an empty span
+typedef struct {
+    const char* name;
+    const char* detail;
+    uint64_t start_ns;
+} TraceSpan;
+
+extern bool trace_enabled;
 
+void trace_start();
 
+TraceSpan trace_begin(const char* name, const char* detail);
 
+void trace_end(TraceSpan span);
 
-bool write_elf(const char* input_file, const char* output_file, Program *p);
+//writes the spans of every thread as chrome trace event json, the threads have to be done
+bool trace_write(const char* path);
 
-bool write_pe(const char* input_file, const char* output_file, Program* p);
+//frees the spans of every thread, the threads have to be done
+void trace_stop();
@@ -0,0 +1,8452 @@
+/* Generated by generate_table.py from instructions.dat, don't include it with nmemonics.h */
+#pragma once
+#include <stdint.h>
+
+typedef enum {
+OPERAND_NOP = 0,
+OPERAND_REL8 = 1,
+OPERAND_REL16 = 2,
+OPERAND_REL32 = 3,
+OPERAND_ES = 4,
+OPERAND_CS = 5,
+OPERAND_SS = 6,
+OPERAND_DS = 7,
+OPERAND_FS = 8,
+OPERAND_GS = 9,
+OPERAND_REG = 10,
+OPERAND_R8 = 11,
+OPERAND_R16 = 12,
+OPERAND_R32 = 13,
+OPERAND_R64 = 14,
+OPERAND_MEM_ANY = 15,
+OPERAND_M8 = 16,
+OPERAND_M16 = 17,
+OPERAND_M32 = 18,
+OPERAND_M64 = 19,
+OPERAND_M128 = 20,
+OPERAND_M256 = 21,
+OPERAND_M80 = 22,
+OPERAND_RM8 = 23,
+OPERAND_RM16 = 24,
+OPERAND_RM32 = 25,
+OPERAND_RM64 = 26,
+OPERAND_IMM8 = 27,
+OPERAND_IMM16 = 28,
+OPERAND_IMM32 = 29,
+OPERAND_IMM64 = 30,
+OPERAND_SIGNED = 31,
+OPERAND_L8 = 32,
+OPERAND_L16 = 33,
+OPERAND_L32 = 34,
+OPERAND_L64 = 35,
+OPERAND_M = 36,
+OPERAND_STI = 37,
+OPERAND_DR0DR7 = 38,
+OPERAND_MMM32 = 39,
+OPERAND_MMM64 = 40,
+OPERAND_MM = 41,
+OPERAND_XMM = 42,
+OPERAND_YMM = 43,
+OPERAND_XMMM8 = 44,
+OPERAND_XMMM16 = 45,
+OPERAND_XMMM32 = 46,
+OPERAND_XMMM64 = 47,
+OPERAND_XMMM128 = 48,
+OPERAND_YMMM256 = 49,
+OPERAND_BND = 50,
+OPERAND_AL = 248,
+OPERAND_CL = 249,
+OPERAND_AX = 250,
+OPERAND_DX = 251,
+OPERAND_EAX = 252,
+OPERAND_RAX = 253,
+OPERAND_UNSUPPORTED = 255,
+}OperandType;
+
+#define MODRM_CONTAINS_REG_AND_MEM 0x1 
+#define ADD_REG_TO_OPCODE 0x2
+#define INSTR_USES_REX 0x4
+#define INSTR_USES_2VEX 0x8
+#define INSTR_USES_3VEX 0x10
+#define INSTR_OP4_IS_REG 0x2
+
+#define DECODE_MAP_LEGACY 0
+#define DECODE_MAP_VEX 4
+#define DECODE_MAP_COUNT 8
+#define DECODE_OPERAND_SIZE_16 0x1
+#define DECODE_OPERAND_SIZE_32 0x2
+#define DECODE_REG_IN_OPCODE 0x4
+#define DECODE_SIGN_EXTEND 0x8
+#define DECODE_MODRM 0x1
+#define DECODE_MODRM_MEMORY 0x2
+#define DECODE_MODRM_REGISTER 0x4
+#define DECODE_CLASS_NONE 0
+#define DECODE_CLASS_66 1
+#define DECODE_CLASS_F2 2
+#define DECODE_CLASS_F3 3
+#define DECODE_MATCH_SIZE_16 0x1
+#define DECODE_MATCH_REX_W 0x2
+#define DECODE_MATCH_VEX_L 0x4
+#define DECODE_MATCH_MOD_3 0x8
+#define DECODE_MATCH_XCHG 0x10
+#define DECODE_REGS_NONE 0
+#define DECODE_REGS_8 1
+#define DECODE_REGS_16 2
+#define DECODE_REGS_32 3
+#define DECODE_REGS_64 4
+#define DECODE_REGS_MM 5
+#define DECODE_REGS_XMM 6
+#define DECODE_REGS_YMM 7
+#define DECODE_REGS_ST 8
+#define DECODE_REGS_SEGMENT 9
+#define DECODE_ROLE_NONE 0
+#define DECODE_ROLE_FIXED 1
+#define DECODE_ROLE_REG 2
+#define DECODE_ROLE_RM 3
+#define DECODE_ROLE_OPCODE 4
+#define DECODE_ROLE_VVVV 5
+#define DECODE_ROLE_IMM 6
+#define DECODE_ROLE_IS4 7
+#define DECODE_ROLE_REL 8
+
+//the prefixes, rex.w and vex bits of a variant are in its DECODE_KEYS bucket, not here
+typedef struct {
+    const char* mnemonic;
+    uint8_t role[4];
+    uint8_t regs[4];         //DECODE_REGS_ class of the register operands
+    uint8_t size[4];         //bytes of the memory operands and immediates, index of the fixed registers
+    uint8_t extra[2];        //opcode bytes that follow the byte the table is indexed with
+    uint8_t extra_count;
+    int8_t digit;
+    uint8_t modrm;
+    uint8_t flags;
+    uint16_t next;           //the next variant of the same bucket, 0 after the last
+} DecodeVariant;
+
+//where the buckets of an opcode are, see DECODE_VARIANTS
+typedef struct {
+    uint16_t first;
+    uint16_t class_step;     //buckets between two class slots
+    uint8_t classes;         //class slot of each prefix class, 2 bits each from DECODE_CLASS_NONE up
+    uint8_t reg_step;        //buckets between two modrm.reg values, 0 if the opcode isn't split by it
+    uint8_t state_mask;      //DECODE_MATCH_ bits the opcode is split by
+} DecodeKey;
+// the first variant of a bucket is DECODE_VARIANTS[bucket], the bucket of an opcode is
+// first + class slot * class_step + modrm.reg * reg_step + DECODE_STATE_INDEX[state_mask][state] of its DECODE_KEYS
+static const DecodeVariant DECODE_VARIANTS[] = {
+{0},
+{"add", {3, 2, 0, 0}, {1, 1, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"add", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"add", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"add", {3, 2, 0, 0}, {4, 4, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7144},
+{"add", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"add", {2, 3, 0, 0}, {1, 1, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"add", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"add", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"add", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7145},
+{"add", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"add", {1, 6, 0, 0}, {1, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"add", {1, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"add", {1, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"add", {1, 6, 0, 0}, {4, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 8, 7146},
+{"add", {1, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"or", {3, 2, 0, 0}, {1, 1, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"or", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"or", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"or", {3, 2, 0, 0}, {4, 4, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7147},
+{"or", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"or", {2, 3, 0, 0}, {1, 1, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"or", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"or", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"or", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7148},
+{"or", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"or", {1, 6, 0, 0}, {1, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"or", {1, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"or", {1, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"or", {1, 6, 0, 0}, {4, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 8, 7149},
+{"or", {1, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"adc", {3, 2, 0, 0}, {1, 1, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"adc", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"adc", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"adc", {3, 2, 0, 0}, {4, 4, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7150},
+{"adc", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"adc", {2, 3, 0, 0}, {1, 1, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"adc", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"adc", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"adc", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7151},
+{"adc", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"adc", {1, 6, 0, 0}, {1, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"adc", {1, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"adc", {1, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"adc", {1, 6, 0, 0}, {4, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 8, 7152},
+{"adc", {1, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"sbb", {3, 2, 0, 0}, {1, 1, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"sbb", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"sbb", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"sbb", {3, 2, 0, 0}, {4, 4, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7153},
+{"sbb", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"sbb", {2, 3, 0, 0}, {1, 1, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"sbb", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"sbb", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"sbb", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7154},
+{"sbb", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"sbb", {1, 6, 0, 0}, {1, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"sbb", {1, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"sbb", {1, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"sbb", {1, 6, 0, 0}, {4, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 8, 7155},
+{"sbb", {1, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"and", {3, 2, 0, 0}, {1, 1, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"and", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"and", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"and", {3, 2, 0, 0}, {4, 4, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7156},
+{"and", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"and", {2, 3, 0, 0}, {1, 1, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"and", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"and", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"and", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7157},
+{"and", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"and", {1, 6, 0, 0}, {1, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"and", {1, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"and", {1, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"and", {1, 6, 0, 0}, {4, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 8, 7158},
+{"and", {1, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"sub", {3, 2, 0, 0}, {1, 1, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"sub", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"sub", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"sub", {3, 2, 0, 0}, {4, 4, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7159},
+{"sub", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"sub", {2, 3, 0, 0}, {1, 1, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"sub", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"sub", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"sub", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7160},
+{"sub", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"sub", {1, 6, 0, 0}, {1, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"sub", {1, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"sub", {1, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"sub", {1, 6, 0, 0}, {4, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 8, 7161},
+{"sub", {1, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"xor", {3, 2, 0, 0}, {1, 1, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"xor", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"xor", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"xor", {3, 2, 0, 0}, {4, 4, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7162},
+{"xor", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"xor", {2, 3, 0, 0}, {1, 1, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"xor", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"xor", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"xor", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7163},
+{"xor", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"xor", {1, 6, 0, 0}, {1, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"xor", {1, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"xor", {1, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"xor", {1, 6, 0, 0}, {4, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 8, 7164},
+{"xor", {1, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"cmp", {3, 2, 0, 0}, {1, 1, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"cmp", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmp", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmp", {3, 2, 0, 0}, {4, 4, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7165},
+{"cmp", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"cmp", {2, 3, 0, 0}, {1, 1, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"cmp", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmp", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmp", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7166},
+{"cmp", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"cmp", {1, 6, 0, 0}, {1, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"cmp", {1, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"cmp", {1, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"cmp", {1, 6, 0, 0}, {4, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 8, 7167},
+{"cmp", {1, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"push", {4, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"push", {4, 0, 0, 0}, {2, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{0},
+{"push", {4, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"push", {4, 0, 0, 0}, {2, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{0},
+{"push", {4, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"push", {4, 0, 0, 0}, {2, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{0},
+{"push", {4, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"push", {4, 0, 0, 0}, {2, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{0},
+{"push", {4, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"push", {4, 0, 0, 0}, {2, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{0},
+{"push", {4, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"push", {4, 0, 0, 0}, {2, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{0},
+{"push", {4, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"push", {4, 0, 0, 0}, {2, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{0},
+{"push", {4, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"push", {4, 0, 0, 0}, {2, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{0},
+{"pop", {4, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"pop", {4, 0, 0, 0}, {2, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{0},
+{"pop", {4, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"pop", {4, 0, 0, 0}, {2, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{0},
+{"pop", {4, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"pop", {4, 0, 0, 0}, {2, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{0},
+{"pop", {4, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"pop", {4, 0, 0, 0}, {2, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{0},
+{"pop", {4, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"pop", {4, 0, 0, 0}, {2, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{0},
+{"pop", {4, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"pop", {4, 0, 0, 0}, {2, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{0},
+{"pop", {4, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"pop", {4, 0, 0, 0}, {2, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{0},
+{"pop", {4, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"pop", {4, 0, 0, 0}, {2, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{0},
+{"movsxd", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movsxd", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movsxd", {2, 3, 0, 0}, {4, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7168},
+{"movsxd", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"push", {6, 0, 0, 0}, {0, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7169},
+{0},
+{"imul", {2, 3, 6, 0}, {3, 3, 0, 0}, {0, 4, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"imul", {2, 3, 6, 0}, {2, 2, 0, 0}, {0, 2, 2, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"imul", {2, 3, 6, 0}, {4, 4, 0, 0}, {0, 8, 4, 0}, {0x0, 0x0}, 0, -1, 1, 8, 7170},
+{"imul", {2, 3, 6, 0}, {2, 2, 0, 0}, {0, 2, 2, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"push", {6, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"imul", {2, 3, 6, 0}, {3, 3, 0, 0}, {0, 4, 1, 0}, {0x0, 0x0}, 0, -1, 1, 8, 0},
+{"imul", {2, 3, 6, 0}, {2, 2, 0, 0}, {0, 2, 1, 0}, {0x0, 0x0}, 0, -1, 1, 8, 0},
+{"imul", {2, 3, 6, 0}, {4, 4, 0, 0}, {0, 8, 1, 0}, {0x0, 0x0}, 0, -1, 1, 8, 7171},
+{"imul", {2, 3, 6, 0}, {2, 2, 0, 0}, {0, 2, 1, 0}, {0x0, 0x0}, 0, -1, 1, 8, 0},
+{0},
+{0},
+{0},
+{0},
+{"insb", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"insd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"insd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"insw", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7172},
+{"insw", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7173},
+{0},
+{0},
+{"rep", {3, 1, 0, 0}, {3, 2, 0, 0}, {4, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"outsb", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"outsb", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{0},
+{"rep", {1, 3, 0, 0}, {2, 1, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"rep", {1, 3, 0, 0}, {2, 1, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"outsd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"outsd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"outsd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"outsd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"outsw", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7174},
+{"outsw", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7175},
+{"outsw", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7176},
+{"outsw", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7177},
+{0},
+{0},
+{0},
+{0},
+{"rep", {1, 3, 0, 0}, {2, 3, 0, 0}, {2, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"rep", {1, 3, 0, 0}, {2, 2, 0, 0}, {2, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"rep", {1, 3, 0, 0}, {2, 3, 0, 0}, {2, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"rep", {1, 3, 0, 0}, {2, 2, 0, 0}, {2, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"jo", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"jno", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"jb", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7178},
+{0},
+{"jae", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7180},
+{0},
+{"je", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7182},
+{0},
+{"jne", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7183},
+{0},
+{"jbe", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7184},
+{0},
+{"ja", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7185},
+{0},
+{"js", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"jns", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"jp", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7186},
+{0},
+{"jnp", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7187},
+{0},
+{"jl", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7188},
+{0},
+{"jge", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7189},
+{0},
+{"jle", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7190},
+{0},
+{"jg", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7191},
+{0},
+{"add", {3, 6, 0, 0}, {1, 0, 0, 0}, {1, 1, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"or", {3, 6, 0, 0}, {1, 0, 0, 0}, {1, 1, 0, 0}, {0x0, 0x0}, 0, 1, 1, 0, 0},
+{"adc", {3, 6, 0, 0}, {1, 0, 0, 0}, {1, 1, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 0},
+{"sbb", {3, 6, 0, 0}, {1, 0, 0, 0}, {1, 1, 0, 0}, {0x0, 0x0}, 0, 3, 1, 0, 0},
+{"and", {3, 6, 0, 0}, {1, 0, 0, 0}, {1, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{"sub", {3, 6, 0, 0}, {1, 0, 0, 0}, {1, 1, 0, 0}, {0x0, 0x0}, 0, 5, 1, 0, 0},
+{"xor", {3, 6, 0, 0}, {1, 0, 0, 0}, {1, 1, 0, 0}, {0x0, 0x0}, 0, 6, 1, 0, 0},
+{"cmp", {3, 6, 0, 0}, {1, 0, 0, 0}, {1, 1, 0, 0}, {0x0, 0x0}, 0, 7, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"add", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 4, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"add", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 2, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"add", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 4, 0, 0}, {0x0, 0x0}, 0, 0, 1, 8, 7192},
+{"add", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 2, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"or", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 4, 0, 0}, {0x0, 0x0}, 0, 1, 1, 0, 0},
+{"or", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 2, 0, 0}, {0x0, 0x0}, 0, 1, 1, 0, 0},
+{"or", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 4, 0, 0}, {0x0, 0x0}, 0, 1, 1, 8, 7193},
+{"or", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 2, 0, 0}, {0x0, 0x0}, 0, 1, 1, 0, 0},
+{"adc", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 4, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 0},
+{"adc", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 2, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 0},
+{"adc", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 4, 0, 0}, {0x0, 0x0}, 0, 2, 1, 8, 7194},
+{"adc", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 2, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 0},
+{"sbb", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 4, 0, 0}, {0x0, 0x0}, 0, 3, 1, 0, 0},
+{"sbb", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 2, 0, 0}, {0x0, 0x0}, 0, 3, 1, 0, 0},
+{"sbb", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 4, 0, 0}, {0x0, 0x0}, 0, 3, 1, 8, 7195},
+{"sbb", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 2, 0, 0}, {0x0, 0x0}, 0, 3, 1, 0, 0},
+{"and", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 4, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{"and", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 2, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{"and", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 4, 0, 0}, {0x0, 0x0}, 0, 4, 1, 8, 7196},
+{"and", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 2, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{"sub", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 4, 0, 0}, {0x0, 0x0}, 0, 5, 1, 0, 0},
+{"sub", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 2, 0, 0}, {0x0, 0x0}, 0, 5, 1, 0, 0},
+{"sub", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 4, 0, 0}, {0x0, 0x0}, 0, 5, 1, 8, 7197},
+{"sub", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 2, 0, 0}, {0x0, 0x0}, 0, 5, 1, 0, 0},
+{"xor", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 4, 0, 0}, {0x0, 0x0}, 0, 6, 1, 0, 0},
+{"xor", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 2, 0, 0}, {0x0, 0x0}, 0, 6, 1, 0, 0},
+{"xor", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 4, 0, 0}, {0x0, 0x0}, 0, 6, 1, 8, 7198},
+{"xor", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 2, 0, 0}, {0x0, 0x0}, 0, 6, 1, 0, 0},
+{"cmp", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 4, 0, 0}, {0x0, 0x0}, 0, 7, 1, 0, 0},
+{"cmp", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 2, 0, 0}, {0x0, 0x0}, 0, 7, 1, 0, 0},
+{"cmp", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 4, 0, 0}, {0x0, 0x0}, 0, 7, 1, 8, 7199},
+{"cmp", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 2, 0, 0}, {0x0, 0x0}, 0, 7, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"add", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 0, 1, 8, 0},
+{"add", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 0, 1, 8, 0},
+{"add", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 1, 0, 0}, {0x0, 0x0}, 0, 0, 1, 8, 7200},
+{"add", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 0, 1, 8, 0},
+{"or", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 1, 1, 8, 0},
+{"or", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 1, 1, 8, 0},
+{"or", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 1, 0, 0}, {0x0, 0x0}, 0, 1, 1, 8, 7201},
+{"or", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 1, 1, 8, 0},
+{"adc", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 2, 1, 8, 0},
+{"adc", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 2, 1, 8, 0},
+{"adc", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 1, 0, 0}, {0x0, 0x0}, 0, 2, 1, 8, 7202},
+{"adc", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 2, 1, 8, 0},
+{"sbb", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 3, 1, 8, 0},
+{"sbb", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 3, 1, 8, 0},
+{"sbb", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 1, 0, 0}, {0x0, 0x0}, 0, 3, 1, 8, 7203},
+{"sbb", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 3, 1, 8, 0},
+{"and", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 8, 0},
+{"and", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 8, 0},
+{"and", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 8, 7204},
+{"and", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 8, 0},
+{"sub", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 5, 1, 8, 0},
+{"sub", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 5, 1, 8, 0},
+{"sub", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 1, 0, 0}, {0x0, 0x0}, 0, 5, 1, 8, 7205},
+{"sub", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 5, 1, 8, 0},
+{"xor", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 6, 1, 8, 0},
+{"xor", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 6, 1, 8, 0},
+{"xor", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 1, 0, 0}, {0x0, 0x0}, 0, 6, 1, 8, 7206},
+{"xor", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 6, 1, 8, 0},
+{"cmp", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 7, 1, 8, 0},
+{"cmp", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 7, 1, 8, 0},
+{"cmp", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 1, 0, 0}, {0x0, 0x0}, 0, 7, 1, 8, 7207},
+{"cmp", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 7, 1, 8, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"test", {3, 2, 0, 0}, {1, 1, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"test", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"test", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"test", {3, 2, 0, 0}, {4, 4, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7208},
+{"test", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"xchg", {3, 2, 0, 0}, {1, 1, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7209},
+{0},
+{"xchg", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7210},
+{"xchg", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7211},
+{"xchg", {3, 2, 0, 0}, {4, 4, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7212},
+{"xchg", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7215},
+{0},
+{0},
+{0},
+{0},
+{"mov", {3, 2, 0, 0}, {1, 1, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"mov", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"mov", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"mov", {3, 2, 0, 0}, {4, 4, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7216},
+{"mov", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"mov", {2, 3, 0, 0}, {1, 1, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"mov", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"mov", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"mov", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7217},
+{"mov", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"lea", {2, 3, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{"lea", {2, 3, 0, 0}, {2, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{"lea", {2, 3, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 7218},
+{"lea", {2, 3, 0, 0}, {2, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"pop", {3, 0, 0, 0}, {4, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"pop", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"nop", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7219},
+{"nop", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7221},
+{"xchg", {1, 4, 0, 0}, {4, 4, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7223},
+{"nop", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7227},
+{"xchg", {1, 4, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7229},
+{"xchg", {1, 4, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7230},
+{"xchg", {1, 4, 0, 0}, {4, 4, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7231},
+{"xchg", {1, 4, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7234},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"pause", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"pause", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"pause", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"pause", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"xchg", {1, 4, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7235},
+{"xchg", {1, 4, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7236},
+{"xchg", {1, 4, 0, 0}, {4, 4, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7237},
+{"xchg", {1, 4, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7240},
+{0},
+{0},
+{0},
+{0},
+{"xchg", {1, 4, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7241},
+{"xchg", {1, 4, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7242},
+{"xchg", {1, 4, 0, 0}, {4, 4, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7243},
+{"xchg", {1, 4, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7246},
+{0},
+{0},
+{0},
+{0},
+{"xchg", {1, 4, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7247},
+{"xchg", {1, 4, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7248},
+{"xchg", {1, 4, 0, 0}, {4, 4, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7249},
+{"xchg", {1, 4, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7252},
+{0},
+{0},
+{0},
+{0},
+{"xchg", {1, 4, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7253},
+{"xchg", {1, 4, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7254},
+{"xchg", {1, 4, 0, 0}, {4, 4, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7255},
+{"xchg", {1, 4, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7258},
+{0},
+{0},
+{0},
+{0},
+{"xchg", {1, 4, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7259},
+{"xchg", {1, 4, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7260},
+{"xchg", {1, 4, 0, 0}, {4, 4, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7261},
+{"xchg", {1, 4, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7264},
+{0},
+{0},
+{0},
+{0},
+{"xchg", {1, 4, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7265},
+{"xchg", {1, 4, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7266},
+{"xchg", {1, 4, 0, 0}, {4, 4, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7267},
+{"xchg", {1, 4, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7270},
+{0},
+{0},
+{0},
+{0},
+{"xchg", {1, 4, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7271},
+{"xchg", {1, 4, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7272},
+{"xchg", {1, 4, 0, 0}, {4, 4, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7273},
+{"xchg", {1, 4, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7276},
+{0},
+{0},
+{0},
+{0},
+{"cwde", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"cdqe", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7277},
+{"cbw", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7278},
+{"cbw", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7279},
+{0},
+{0},
+{"cdq", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"cqo", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7281},
+{"cwd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7282},
+{"cwd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7283},
+{0},
+{0},
+{"fwait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7285},
+{"fwait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7286},
+{"fwait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7287},
+{"fwait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7288},
+{"fwait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7289},
+{"fwait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7290},
+{"fwait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7291},
+{"fclex", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xdb, 0xe2}, 2, -1, 0, 0, 7292},
+{"fwait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7296},
+{"fwait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7297},
+{"fwait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7298},
+{"fwait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7299},
+{"fwait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7300},
+{"fwait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7301},
+{"fwait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7302},
+{"fwait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7303},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"pushf", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7304},
+{0},
+{"popf", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7305},
+{0},
+{"movsb", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"movsd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"movsq", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7306},
+{"movsw", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7307},
+{"movsw", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7308},
+{0},
+{0},
+{"cmpsb", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"cmpsd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"cmpsq", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7310},
+{"cmpsw", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7311},
+{"cmpsw", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7312},
+{0},
+{0},
+{"test", {1, 6, 0, 0}, {1, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"test", {1, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"test", {1, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"test", {1, 6, 0, 0}, {4, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 8, 7314},
+{"test", {1, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"stosb", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"stosd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"stosq", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7315},
+{"stosw", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7316},
+{"stosw", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7317},
+{0},
+{0},
+{"lodsb", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"lodsb", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{0},
+{"rep", {1, 0, 0, 0}, {1, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"rep", {1, 0, 0, 0}, {1, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"lodsd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"lodsd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"lodsq", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7319},
+{"lodsq", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7320},
+{"lodsw", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7321},
+{"lodsw", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7322},
+{"lodsw", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7323},
+{"lodsw", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7325},
+{0},
+{0},
+{0},
+{0},
+{"rep", {1, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"rep", {1, 0, 0, 0}, {2, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"rep", {1, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7327},
+{"rep", {1, 0, 0, 0}, {2, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"scasb", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"scasd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"scasq", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7328},
+{"scasw", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7329},
+{"scasw", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7330},
+{0},
+{0},
+{"mov", {4, 6, 0, 0}, {1, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{"mov", {4, 6, 0, 0}, {1, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{"mov", {4, 6, 0, 0}, {1, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{"mov", {4, 6, 0, 0}, {1, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{"mov", {4, 6, 0, 0}, {1, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{"mov", {4, 6, 0, 0}, {1, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{"mov", {4, 6, 0, 0}, {1, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{"mov", {4, 6, 0, 0}, {1, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{"mov", {4, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"mov", {4, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"mov", {4, 6, 0, 0}, {4, 0, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7332},
+{"mov", {4, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{0},
+{0},
+{0},
+{"mov", {4, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"mov", {4, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"mov", {4, 6, 0, 0}, {4, 0, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7333},
+{"mov", {4, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{0},
+{0},
+{0},
+{"mov", {4, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"mov", {4, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"mov", {4, 6, 0, 0}, {4, 0, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7334},
+{"mov", {4, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{0},
+{0},
+{0},
+{"mov", {4, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"mov", {4, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"mov", {4, 6, 0, 0}, {4, 0, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7335},
+{"mov", {4, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{0},
+{0},
+{0},
+{"mov", {4, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"mov", {4, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"mov", {4, 6, 0, 0}, {4, 0, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7336},
+{"mov", {4, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{0},
+{0},
+{0},
+{"mov", {4, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"mov", {4, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"mov", {4, 6, 0, 0}, {4, 0, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7337},
+{"mov", {4, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{0},
+{0},
+{0},
+{"mov", {4, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"mov", {4, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"mov", {4, 6, 0, 0}, {4, 0, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7338},
+{"mov", {4, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{0},
+{0},
+{0},
+{"mov", {4, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"mov", {4, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"mov", {4, 6, 0, 0}, {4, 0, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7339},
+{"mov", {4, 6, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{0},
+{0},
+{0},
+{"rol", {3, 6, 0, 0}, {1, 0, 0, 0}, {1, 1, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"ror", {3, 6, 0, 0}, {1, 0, 0, 0}, {1, 1, 0, 0}, {0x0, 0x0}, 0, 1, 1, 0, 0},
+{"rcl", {3, 6, 0, 0}, {1, 0, 0, 0}, {1, 1, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 0},
+{"rcr", {3, 6, 0, 0}, {1, 0, 0, 0}, {1, 1, 0, 0}, {0x0, 0x0}, 0, 3, 1, 0, 0},
+{"sal", {3, 6, 0, 0}, {1, 0, 0, 0}, {1, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 7340},
+{"shr", {3, 6, 0, 0}, {1, 0, 0, 0}, {1, 1, 0, 0}, {0x0, 0x0}, 0, 5, 1, 0, 0},
+{0},
+{"sar", {3, 6, 0, 0}, {1, 0, 0, 0}, {1, 1, 0, 0}, {0x0, 0x0}, 0, 7, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"rol", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 0, 1, 8, 0},
+{"rol", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 0, 1, 8, 0},
+{"rol", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 1, 0, 0}, {0x0, 0x0}, 0, 0, 1, 8, 7341},
+{"rol", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 0, 1, 8, 0},
+{"ror", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 1, 1, 8, 0},
+{"ror", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 1, 1, 8, 0},
+{"ror", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 1, 0, 0}, {0x0, 0x0}, 0, 1, 1, 8, 7342},
+{"ror", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 1, 1, 8, 0},
+{"rcl", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 2, 1, 8, 0},
+{"rcl", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 2, 1, 8, 0},
+{"rcl", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 1, 0, 0}, {0x0, 0x0}, 0, 2, 1, 8, 7343},
+{"rcl", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 2, 1, 8, 0},
+{"rcr", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 3, 1, 8, 0},
+{"rcr", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 3, 1, 8, 0},
+{"rcr", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 1, 0, 0}, {0x0, 0x0}, 0, 3, 1, 8, 7344},
+{"rcr", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 3, 1, 8, 0},
+{"sal", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 8, 7345},
+{"sal", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 8, 7346},
+{"sal", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 8, 7347},
+{"sal", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 8, 7350},
+{"shr", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 5, 1, 8, 0},
+{"shr", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 5, 1, 8, 0},
+{"shr", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 1, 0, 0}, {0x0, 0x0}, 0, 5, 1, 8, 7351},
+{"shr", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 5, 1, 8, 0},
+{0},
+{0},
+{0},
+{0},
+{"sar", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 7, 1, 8, 0},
+{"sar", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 7, 1, 8, 0},
+{"sar", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 1, 0, 0}, {0x0, 0x0}, 0, 7, 1, 8, 7352},
+{"sar", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 7, 1, 8, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"ret", {6, 0, 0, 0}, {0, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"ret", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"mov", {3, 6, 0, 0}, {1, 0, 0, 0}, {1, 1, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"mov", {3, 6, 0, 0}, {1, 0, 0, 0}, {1, 1, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"xabort", {6, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0xf8, 0x0}, 1, -1, 0, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"mov", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 4, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"mov", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 2, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"mov", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 4, 0, 0}, {0x0, 0x0}, 0, 0, 1, 8, 7353},
+{"mov", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 2, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"mov", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 4, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"mov", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 2, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"mov", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 4, 0, 0}, {0x0, 0x0}, 0, 0, 1, 8, 7354},
+{"mov", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 2, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"xbegin", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0xf8, 0x0}, 1, -1, 0, 0, 0},
+{"xbegin", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0xf8, 0x0}, 1, -1, 0, 0, 0},
+{"xbegin", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0xf8, 0x0}, 1, -1, 0, 0, 0},
+{"xbegin", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0xf8, 0x0}, 1, -1, 0, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"enter", {6, 0, 0, 0}, {0, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 1, -1, 0, 0, 7355},
+{"enter", {6, 6, 0, 0}, {0, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"enter", {6, 6, 0, 0}, {0, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"enter", {6, 6, 0, 0}, {0, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"enter", {6, 6, 0, 0}, {0, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"enter", {6, 6, 0, 0}, {0, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"enter", {6, 6, 0, 0}, {0, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"enter", {6, 6, 0, 0}, {0, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"enter", {6, 6, 0, 0}, {0, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"enter", {6, 6, 0, 0}, {0, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"enter", {6, 6, 0, 0}, {0, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"enter", {6, 6, 0, 0}, {0, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"enter", {6, 6, 0, 0}, {0, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"enter", {6, 6, 0, 0}, {0, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"enter", {6, 6, 0, 0}, {0, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"enter", {6, 6, 0, 0}, {0, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"leave", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"ret", {6, 0, 0, 0}, {0, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"ret", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"iret", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7357},
+{"iretq", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7358},
+{0},
+{0},
+{"rol", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"ror", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 1, 1, 0, 0},
+{"rcl", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 0},
+{"rcr", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 3, 1, 0, 0},
+{"sal", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 7360},
+{"shr", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 5, 1, 0, 0},
+{0},
+{"sar", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 7, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"rol", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"rol", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"rol", {3, 0, 0, 0}, {4, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 7361},
+{"rol", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"ror", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 1, 1, 0, 0},
+{"ror", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 1, 1, 0, 0},
+{"ror", {3, 0, 0, 0}, {4, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 1, 1, 0, 7362},
+{"ror", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 1, 1, 0, 0},
+{"rcl", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 0},
+{"rcl", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 0},
+{"rcl", {3, 0, 0, 0}, {4, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 7363},
+{"rcl", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 0},
+{"rcr", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 3, 1, 0, 0},
+{"rcr", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 3, 1, 0, 0},
+{"rcr", {3, 0, 0, 0}, {4, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 3, 1, 0, 7364},
+{"rcr", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 3, 1, 0, 0},
+{"sal", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 7365},
+{"sal", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 7366},
+{"sal", {3, 0, 0, 0}, {4, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 7367},
+{"sal", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 7370},
+{"shr", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 5, 1, 0, 0},
+{"shr", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 5, 1, 0, 0},
+{"shr", {3, 0, 0, 0}, {4, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 5, 1, 0, 7371},
+{"shr", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 5, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"sar", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 7, 1, 0, 0},
+{"sar", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 7, 1, 0, 0},
+{"sar", {3, 0, 0, 0}, {4, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 7, 1, 0, 7372},
+{"sar", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 7, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"rol", {3, 1, 0, 0}, {1, 1, 0, 0}, {1, 1, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"ror", {3, 1, 0, 0}, {1, 1, 0, 0}, {1, 1, 0, 0}, {0x0, 0x0}, 0, 1, 1, 0, 0},
+{"rcl", {3, 1, 0, 0}, {1, 1, 0, 0}, {1, 1, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 0},
+{"rcr", {3, 1, 0, 0}, {1, 1, 0, 0}, {1, 1, 0, 0}, {0x0, 0x0}, 0, 3, 1, 0, 0},
+{"sal", {3, 1, 0, 0}, {1, 1, 0, 0}, {1, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 7373},
+{"shr", {3, 1, 0, 0}, {1, 1, 0, 0}, {1, 1, 0, 0}, {0x0, 0x0}, 0, 5, 1, 0, 0},
+{0},
+{"sar", {3, 1, 0, 0}, {1, 1, 0, 0}, {1, 1, 0, 0}, {0x0, 0x0}, 0, 7, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"rol", {3, 1, 0, 0}, {3, 1, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"rol", {3, 1, 0, 0}, {2, 1, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"rol", {3, 1, 0, 0}, {4, 1, 0, 0}, {8, 1, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 7374},
+{"rol", {3, 1, 0, 0}, {2, 1, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"ror", {3, 1, 0, 0}, {3, 1, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 1, 1, 0, 0},
+{"ror", {3, 1, 0, 0}, {2, 1, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 1, 1, 0, 0},
+{"ror", {3, 1, 0, 0}, {4, 1, 0, 0}, {8, 1, 0, 0}, {0x0, 0x0}, 0, 1, 1, 0, 7375},
+{"ror", {3, 1, 0, 0}, {2, 1, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 1, 1, 0, 0},
+{"rcl", {3, 1, 0, 0}, {3, 1, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 0},
+{"rcl", {3, 1, 0, 0}, {2, 1, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 0},
+{"rcl", {3, 1, 0, 0}, {4, 1, 0, 0}, {8, 1, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 7376},
+{"rcl", {3, 1, 0, 0}, {2, 1, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 0},
+{"rcr", {3, 1, 0, 0}, {3, 1, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 3, 1, 0, 0},
+{"rcr", {3, 1, 0, 0}, {2, 1, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 3, 1, 0, 0},
+{"rcr", {3, 1, 0, 0}, {4, 1, 0, 0}, {8, 1, 0, 0}, {0x0, 0x0}, 0, 3, 1, 0, 7377},
+{"rcr", {3, 1, 0, 0}, {2, 1, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 3, 1, 0, 0},
+{"sal", {3, 1, 0, 0}, {3, 1, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 7378},
+{"sal", {3, 1, 0, 0}, {2, 1, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 7379},
+{"sal", {3, 1, 0, 0}, {4, 1, 0, 0}, {8, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 7380},
+{"sal", {3, 1, 0, 0}, {2, 1, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 7383},
+{"shr", {3, 1, 0, 0}, {3, 1, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 5, 1, 0, 0},
+{"shr", {3, 1, 0, 0}, {2, 1, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 5, 1, 0, 0},
+{"shr", {3, 1, 0, 0}, {4, 1, 0, 0}, {8, 1, 0, 0}, {0x0, 0x0}, 0, 5, 1, 0, 7384},
+{"shr", {3, 1, 0, 0}, {2, 1, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 5, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"sar", {3, 1, 0, 0}, {3, 1, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 7, 1, 0, 0},
+{"sar", {3, 1, 0, 0}, {2, 1, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 7, 1, 0, 0},
+{"sar", {3, 1, 0, 0}, {4, 1, 0, 0}, {8, 1, 0, 0}, {0x0, 0x0}, 0, 7, 1, 0, 7385},
+{"sar", {3, 1, 0, 0}, {2, 1, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 7, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"xlatb", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"xlatb", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{0},
+{"fadd", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 0, 3, 0, 0},
+{"fadd", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xc0, 0x0}, 1, -1, 0, 4, 0},
+{"fmul", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 1, 3, 0, 0},
+{"fmul", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xc8, 0x0}, 1, -1, 0, 4, 0},
+{"fcom", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 2, 3, 0, 0},
+{"fcom", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xd0, 0x0}, 1, -1, 0, 4, 7386},
+{"fcomp", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 3, 3, 0, 0},
+{"fcomp", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xd8, 0x0}, 1, -1, 0, 4, 7387},
+{"fsub", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 4, 3, 0, 0},
+{"fsub", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xe0, 0x0}, 1, -1, 0, 4, 0},
+{"fsubr", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 5, 3, 0, 0},
+{"fsubr", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xe8, 0x0}, 1, -1, 0, 4, 0},
+{"fdiv", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 6, 3, 0, 0},
+{"fdiv", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xf0, 0x0}, 1, -1, 0, 4, 0},
+{"fdivr", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 7, 3, 0, 0},
+{"fdivr", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xf8, 0x0}, 1, -1, 0, 4, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"fld", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 0, 3, 0, 0},
+{"fld", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xc0, 0x0}, 1, -1, 0, 4, 0},
+{0},
+{"fxch", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xc8, 0x0}, 1, -1, 0, 4, 7388},
+{"fst", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 2, 3, 0, 0},
+{"fnop", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xd0, 0x0}, 1, -1, 0, 0, 0},
+{"fstp", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 3, 3, 0, 0},
+{0},
+{0},
+{"fabs", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xe1, 0x0}, 1, -1, 0, 0, 7389},
+{0},
+{"fld1", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xe8, 0x0}, 1, -1, 0, 0, 7392},
+{0},
+{"f2xm1", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf0, 0x0}, 1, -1, 0, 0, 7398},
+{0},
+{"fcos", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xff, 0x0}, 1, -1, 0, 0, 7405},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"fiadd", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 0, 3, 0, 0},
+{"fcmovb", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xc0, 0x0}, 1, -1, 0, 4, 0},
+{"fimul", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 1, 3, 0, 0},
+{"fcmove", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xc8, 0x0}, 1, -1, 0, 4, 0},
+{"ficom", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 2, 3, 0, 0},
+{"fcmovbe", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xd0, 0x0}, 1, -1, 0, 4, 0},
+{"ficomp", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 3, 3, 0, 0},
+{"fcmovu", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xd8, 0x0}, 1, -1, 0, 4, 0},
+{"fisub", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 4, 3, 0, 0},
+{0},
+{"fisubr", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 5, 3, 0, 0},
+{"fucompp", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xe9, 0x0}, 1, -1, 0, 0, 0},
+{"fidiv", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 6, 3, 0, 0},
+{0},
+{"fidivr", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 7, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"fild", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 0, 3, 0, 0},
+{"fcmovnb", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xc0, 0x0}, 1, -1, 0, 4, 0},
+{"fisttp", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 1, 3, 0, 0},
+{"fcmovne", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xc8, 0x0}, 1, -1, 0, 4, 0},
+{"fist", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 2, 3, 0, 0},
+{"fcmovnbe", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xd0, 0x0}, 1, -1, 0, 4, 0},
+{"fistp", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 3, 3, 0, 0},
+{"fcmovnu", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xd8, 0x0}, 1, -1, 0, 4, 0},
+{0},
+{"fnclex1", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xe2, 0x0}, 1, -1, 0, 0, 7412},
+{"fld", {3, 0, 0, 0}, {0, 0, 0, 0}, {10, 0, 0, 0}, {0x0, 0x0}, 0, 5, 3, 0, 0},
+{0},
+{0},
+{0},
+{"fstp", {3, 0, 0, 0}, {0, 0, 0, 0}, {10, 0, 0, 0}, {0x0, 0x0}, 0, 7, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"fadd", {3, 0, 0, 0}, {0, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 0, 3, 0, 0},
+{"fadd", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xc0, 0x0}, 1, -1, 0, 4, 0},
+{"fmul", {3, 0, 0, 0}, {0, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 1, 3, 0, 0},
+{"fmul", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xc8, 0x0}, 1, -1, 0, 4, 0},
+{"fcom", {3, 0, 0, 0}, {0, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 2, 3, 0, 0},
+{0},
+{"fcomp", {3, 0, 0, 0}, {0, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 3, 3, 0, 0},
+{0},
+{"fsub", {3, 0, 0, 0}, {0, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 4, 3, 0, 0},
+{"fsubr", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xe0, 0x0}, 1, -1, 0, 4, 0},
+{"fsubr", {3, 0, 0, 0}, {0, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 5, 3, 0, 0},
+{"fsub", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xe8, 0x0}, 1, -1, 0, 4, 0},
+{"fdiv", {3, 0, 0, 0}, {0, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 6, 3, 0, 0},
+{"fdivr", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xf0, 0x0}, 1, -1, 0, 4, 0},
+{"fdivr", {3, 0, 0, 0}, {0, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 7, 3, 0, 0},
+{"fdiv", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xf8, 0x0}, 1, -1, 0, 4, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"fld", {3, 0, 0, 0}, {0, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 0, 3, 0, 0},
+{"ffree", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xc0, 0x0}, 1, -1, 0, 4, 0},
+{"fisttp", {3, 0, 0, 0}, {0, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 1, 3, 0, 0},
+{0},
+{"fst", {3, 0, 0, 0}, {0, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 2, 3, 0, 0},
+{"fst", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xd0, 0x0}, 1, -1, 0, 4, 0},
+{"fstp", {3, 0, 0, 0}, {0, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 3, 3, 0, 0},
+{"fstp", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xd8, 0x0}, 1, -1, 0, 4, 0},
+{0},
+{"fucom", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xe0, 0x0}, 1, -1, 0, 4, 7413},
+{0},
+{"fucomp", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xe8, 0x0}, 1, -1, 0, 4, 7414},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"fiadd", {3, 0, 0, 0}, {0, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 0, 3, 0, 0},
+{"faddp", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xc0, 0x0}, 1, -1, 0, 4, 7415},
+{"fimul", {3, 0, 0, 0}, {0, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 1, 3, 0, 0},
+{"fmulp", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xc8, 0x0}, 1, -1, 0, 4, 7416},
+{"ficom", {3, 0, 0, 0}, {0, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 2, 3, 0, 0},
+{0},
+{"ficomp", {3, 0, 0, 0}, {0, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 3, 3, 0, 0},
+{"fcompp", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xd9, 0x0}, 1, -1, 0, 0, 0},
+{"fisub", {3, 0, 0, 0}, {0, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 4, 3, 0, 0},
+{"fsubrp", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xe0, 0x0}, 1, -1, 0, 4, 7417},
+{"fisubr", {3, 0, 0, 0}, {0, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 5, 3, 0, 0},
+{"fsubp", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xe8, 0x0}, 1, -1, 0, 4, 7418},
+{"fidiv", {3, 0, 0, 0}, {0, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 6, 3, 0, 0},
+{"fdivrp", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xf0, 0x0}, 1, -1, 0, 4, 7419},
+{"fidivr", {3, 0, 0, 0}, {0, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 7, 3, 0, 0},
+{"fdivp", {4, 0, 0, 0}, {8, 0, 0, 0}, {0, 0, 0, 0}, {0xf8, 0x0}, 1, -1, 0, 4, 7420},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"fild", {3, 0, 0, 0}, {0, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 0, 3, 0, 0},
+{0},
+{"fisttp", {3, 0, 0, 0}, {0, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 1, 3, 0, 0},
+{0},
+{"fist", {3, 0, 0, 0}, {0, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 2, 3, 0, 0},
+{0},
+{"fistp", {3, 0, 0, 0}, {0, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 3, 3, 0, 0},
+{0},
+{"fbld", {3, 0, 0, 0}, {0, 0, 0, 0}, {10, 0, 0, 0}, {0x0, 0x0}, 0, 4, 3, 0, 0},
+{"fnstsw1", {1, 0, 0, 0}, {2, 0, 0, 0}, {0, 0, 0, 0}, {0xe0, 0x0}, 1, -1, 0, 0, 0},
+{"fild", {3, 0, 0, 0}, {0, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 5, 3, 0, 0},
+{0},
+{"fbstp", {3, 0, 0, 0}, {0, 0, 0, 0}, {10, 0, 0, 0}, {0x0, 0x0}, 0, 6, 3, 0, 0},
+{0},
+{"fistp", {3, 0, 0, 0}, {0, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 7, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"loopne", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"loope", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"loop", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"jecxz", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7421},
+{0},
+{"in", {1, 6, 0, 0}, {1, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"in", {1, 6, 0, 0}, {3, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 8, 0},
+{"in", {1, 6, 0, 0}, {2, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 8, 0},
+{0},
+{0},
+{"out", {6, 1, 0, 0}, {0, 1, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"out", {6, 1, 0, 0}, {0, 3, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"out", {6, 1, 0, 0}, {0, 2, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{0},
+{"call", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"jmp", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"jmp", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"in", {1, 1, 0, 0}, {1, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"in", {1, 1, 0, 0}, {3, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"in", {1, 1, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{0},
+{"out", {1, 1, 0, 0}, {2, 1, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"out", {1, 1, 0, 0}, {2, 3, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"out", {1, 1, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{0},
+{"lock", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"hlt", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"cmc", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"test", {3, 6, 0, 0}, {1, 0, 0, 0}, {1, 1, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{0},
+{"not", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 0},
+{"neg", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 3, 1, 0, 0},
+{"mul", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{"imul", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 5, 1, 0, 0},
+{"div", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 6, 1, 0, 0},
+{"idiv", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 7, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"test", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 4, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"test", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 2, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"test", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 4, 0, 0}, {0x0, 0x0}, 0, 0, 1, 8, 7422},
+{"test", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 2, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"not", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 0},
+{"not", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 0},
+{"not", {3, 0, 0, 0}, {4, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 7423},
+{"not", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 0},
+{"neg", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 3, 1, 0, 0},
+{"neg", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 3, 1, 0, 0},
+{"neg", {3, 0, 0, 0}, {4, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 3, 1, 0, 7424},
+{"neg", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 3, 1, 0, 0},
+{"mul", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{"mul", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{"mul", {3, 0, 0, 0}, {4, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 7425},
+{"mul", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{"imul", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 5, 1, 0, 0},
+{"imul", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 5, 1, 0, 0},
+{"imul", {3, 0, 0, 0}, {4, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 5, 1, 0, 7426},
+{"imul", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 5, 1, 0, 0},
+{"div", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 6, 1, 0, 0},
+{"div", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 6, 1, 0, 0},
+{"div", {3, 0, 0, 0}, {4, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 6, 1, 0, 7427},
+{"div", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 6, 1, 0, 0},
+{"idiv", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 7, 1, 0, 0},
+{"idiv", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 7, 1, 0, 0},
+{"idiv", {3, 0, 0, 0}, {4, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 7, 1, 0, 7428},
+{"idiv", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 7, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"clc", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"stc", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"cli", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"sti", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"cld", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"std", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"inc", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"dec", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"inc", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"inc", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"inc", {3, 0, 0, 0}, {4, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 7429},
+{"inc", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"dec", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 1, 1, 0, 0},
+{"dec", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 1, 1, 0, 0},
+{"dec", {3, 0, 0, 0}, {4, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 1, 1, 0, 7430},
+{"dec", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 1, 1, 0, 0},
+{"call", {3, 0, 0, 0}, {4, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 0},
+{0},
+{"call", {3, 0, 0, 0}, {4, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"jmp", {3, 0, 0, 0}, {4, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{0},
+{"jmp", {3, 0, 0, 0}, {4, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"push", {3, 0, 0, 0}, {4, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 6, 1, 0, 0},
+{"push", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 6, 1, 0, 0},
+{"push", {3, 0, 0, 0}, {4, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 6, 1, 0, 0},
+{"push", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 6, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"sldt", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"str", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 1, 1, 0, 0},
+{"lldt", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 0},
+{"ltr", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 3, 1, 0, 0},
+{"verr", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{"verw", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 5, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"sgdt", {3, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 0, 3, 0, 0},
+{"pconfig", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xc5, 0x0}, 1, -1, 0, 0, 0},
+{"sidt", {3, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 1, 3, 0, 0},
+{"clac", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xca, 0x0}, 1, -1, 0, 0, 7431},
+{0},
+{"xend", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xd5, 0x0}, 1, -1, 0, 0, 7434},
+{0},
+{0},
+{"smsw", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{"smsw", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{0},
+{"rdpkru", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xee, 0x0}, 1, -1, 0, 0, 7437},
+{"lmsw", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 6, 1, 0, 0},
+{"lmsw", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 6, 1, 0, 0},
+{"invlpg", {3, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 7, 3, 0, 0},
+{"rdtscp", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf9, 0x0}, 1, -1, 0, 0, 7439},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"xresldtrk", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xe9, 0x0}, 1, -1, 0, 0, 7440},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"clui", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xee, 0x0}, 1, -1, 0, 0, 7441},
+{0},
+{0},
+{0},
+{0},
+{"syscall", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"clts", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"sysret", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"sysret", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{0},
+{"invd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"wbinvd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"wbnoinvd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"ud2", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{0},
+{0},
+{"prefetchw", {3, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 1, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"movups", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movups", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movupd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7445},
+{"movupd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7446},
+{"movsd", {2, 3, 0, 0}, {6, 0, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{"movsd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{"movss", {2, 3, 0, 0}, {6, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{"movss", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{"movups", {3, 2, 0, 0}, {6, 6, 0, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movupd", {3, 2, 0, 0}, {6, 6, 0, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7447},
+{"movsd", {3, 2, 0, 0}, {6, 6, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movss", {3, 2, 0, 0}, {6, 6, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movlps", {2, 3, 0, 0}, {6, 0, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{"movhlps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{"movlpd", {2, 3, 0, 0}, {6, 0, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 7448},
+{"movhlps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{"movddup", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movddup", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movsldup", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movsldup", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movlps", {3, 2, 0, 0}, {0, 6, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{"movlpd", {3, 2, 0, 0}, {0, 6, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 7449},
+{0},
+{0},
+{0},
+{"unpcklps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"unpcklpd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7450},
+{0},
+{"unpckhps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"unpckhpd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7451},
+{0},
+{"movhps", {2, 3, 0, 0}, {6, 0, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{"movlhps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{"movhpd", {2, 3, 0, 0}, {6, 0, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 7452},
+{"movlhps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{0},
+{0},
+{"movshdup", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movshdup", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movhps", {3, 2, 0, 0}, {0, 6, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{"movhpd", {3, 2, 0, 0}, {0, 6, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 7453},
+{0},
+{0},
+{0},
+{"prefetchnta", {3, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 0, 3, 0, 0},
+{0},
+{"prefetcht0", {3, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 1, 3, 0, 0},
+{0},
+{"prefetcht1", {3, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 2, 3, 0, 0},
+{0},
+{"prefetcht2", {3, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 3, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"bndcu", {2, 3, 0, 0}, {0, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"bndcl", {2, 3, 0, 0}, {0, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"bndcn", {2, 3, 0, 0}, {0, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"bndcn", {2, 3, 0, 0}, {0, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"bndmk", {2, 3, 0, 0}, {0, 0, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{"bndmk", {2, 3, 0, 0}, {0, 0, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{"cldemote", {3, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 0, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"endbr32", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xfb, 0x0}, 1, -1, 0, 0, 7454},
+{"nop", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"nop", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"mov", {2, 3, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"mov", {2, 3, 0, 0}, {0, 4, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"movaps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movapd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7455},
+{0},
+{"movaps", {3, 2, 0, 0}, {6, 6, 0, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movapd", {3, 2, 0, 0}, {6, 6, 0, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7456},
+{0},
+{"cvtpi2ps", {2, 3, 0, 0}, {6, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvtpi2ps", {2, 3, 0, 0}, {6, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvtpi2ps", {2, 3, 0, 0}, {6, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvtpi2ps", {2, 3, 0, 0}, {6, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvtpi2pd", {2, 3, 0, 0}, {6, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7457},
+{"cvtpi2pd", {2, 3, 0, 0}, {6, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7458},
+{"cvtpi2pd", {2, 3, 0, 0}, {6, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7459},
+{"cvtpi2pd", {2, 3, 0, 0}, {6, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7460},
+{"cvtsi2sd", {2, 3, 0, 0}, {6, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"cvtsi2sd", {2, 3, 0, 0}, {6, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7461},
+{0},
+{"cvtsi2ss", {2, 3, 0, 0}, {6, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"cvtsi2ss", {2, 3, 0, 0}, {6, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7462},
+{0},
+{"movntps", {3, 2, 0, 0}, {0, 6, 0, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{"movntpd", {3, 2, 0, 0}, {0, 6, 0, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 7463},
+{0},
+{0},
+{0},
+{"cvttps2pi", {2, 3, 0, 0}, {5, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvttps2pi", {2, 3, 0, 0}, {5, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvttps2pi", {2, 3, 0, 0}, {5, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvttps2pi", {2, 3, 0, 0}, {5, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvttpd2pi", {2, 3, 0, 0}, {5, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7464},
+{"cvttpd2pi", {2, 3, 0, 0}, {5, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7465},
+{"cvttpd2pi", {2, 3, 0, 0}, {5, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7466},
+{"cvttpd2pi", {2, 3, 0, 0}, {5, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7467},
+{"cvttsd2si", {2, 3, 0, 0}, {3, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"cvttsd2si", {2, 3, 0, 0}, {4, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7468},
+{0},
+{"cvttss2si", {2, 3, 0, 0}, {3, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"cvttss2si", {2, 3, 0, 0}, {4, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7469},
+{0},
+{"cvtps2pi", {2, 3, 0, 0}, {5, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvtps2pi", {2, 3, 0, 0}, {5, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvtps2pi", {2, 3, 0, 0}, {5, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvtps2pi", {2, 3, 0, 0}, {5, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvtpd2pi", {2, 3, 0, 0}, {5, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7470},
+{"cvtpd2pi", {2, 3, 0, 0}, {5, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7471},
+{"cvtpd2pi", {2, 3, 0, 0}, {5, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7472},
+{"cvtpd2pi", {2, 3, 0, 0}, {5, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7473},
+{"cvtsd2si", {2, 3, 0, 0}, {3, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"cvtsd2si", {2, 3, 0, 0}, {4, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7474},
+{0},
+{"cvtss2si", {2, 3, 0, 0}, {3, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"cvtss2si", {2, 3, 0, 0}, {4, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7475},
+{0},
+{"ucomiss", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"ucomisd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7476},
+{0},
+{"comiss", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"comisd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7477},
+{0},
+{"wrmsr", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"rdtsc", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"rdmsr", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"rdpmc", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"sysenter", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"sysexit", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"sysexit", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{0},
+{"cmovo", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovo", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovo", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7478},
+{"cmovo", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"cmovno", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovno", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovno", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7479},
+{"cmovno", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"cmovb", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7480},
+{"cmovb", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7482},
+{"cmovb", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7484},
+{"cmovb", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7489},
+{0},
+{0},
+{0},
+{0},
+{"cmovae", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7491},
+{"cmovae", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7493},
+{"cmovae", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7495},
+{"cmovae", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7500},
+{0},
+{0},
+{0},
+{0},
+{"cmove", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7502},
+{"cmove", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7503},
+{"cmove", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7504},
+{"cmove", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7507},
+{0},
+{0},
+{0},
+{0},
+{"cmovne", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7508},
+{"cmovne", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7509},
+{"cmovne", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7510},
+{"cmovne", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7513},
+{0},
+{0},
+{0},
+{0},
+{"cmovbe", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7514},
+{"cmovbe", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7515},
+{"cmovbe", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7516},
+{"cmovbe", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7519},
+{0},
+{0},
+{0},
+{0},
+{"cmova", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7520},
+{"cmova", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7521},
+{"cmova", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7522},
+{"cmova", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7525},
+{0},
+{0},
+{0},
+{0},
+{"cmovs", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovs", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovs", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7526},
+{"cmovs", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"cmovns", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovns", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovns", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7527},
+{"cmovns", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"cmovp", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7528},
+{"cmovp", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7529},
+{"cmovp", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7530},
+{"cmovp", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7533},
+{0},
+{0},
+{0},
+{0},
+{"cmovnp", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7534},
+{"cmovnp", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7535},
+{"cmovnp", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7536},
+{"cmovnp", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7539},
+{0},
+{0},
+{0},
+{0},
+{"cmovl", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7540},
+{"cmovl", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7541},
+{"cmovl", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7542},
+{"cmovl", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7545},
+{0},
+{0},
+{0},
+{0},
+{"cmovge", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7546},
+{"cmovge", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7547},
+{"cmovge", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7548},
+{"cmovge", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7551},
+{0},
+{0},
+{0},
+{0},
+{"cmovle", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7552},
+{"cmovle", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7553},
+{"cmovle", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7554},
+{"cmovle", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7557},
+{0},
+{0},
+{0},
+{0},
+{"cmovg", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7558},
+{"cmovg", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7559},
+{"cmovg", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7560},
+{"cmovg", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7563},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"movmskps", {2, 3, 0, 0}, {3, 6, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{0},
+{"movmskpd", {2, 3, 0, 0}, {3, 6, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 7564},
+{0},
+{0},
+{"sqrtps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"sqrtpd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7565},
+{"sqrtsd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"sqrtss", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"rsqrtps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"rsqrtss", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"rcpps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"rcpss", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"andps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"andpd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7566},
+{0},
+{"andnps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"andnpd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7567},
+{0},
+{"orps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"orpd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7568},
+{0},
+{"xorps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"xorpd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7569},
+{0},
+{"addps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"addpd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7570},
+{"addsd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"addss", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"mulps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"mulpd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7571},
+{"mulsd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"mulss", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvtps2pd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvtpd2ps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7572},
+{"cvtsd2ss", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvtss2sd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"cvtps2dq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvttps2dq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"subps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"subpd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7573},
+{"subsd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"subss", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"minps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"minpd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7574},
+{"minsd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"minss", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"divps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"divpd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7575},
+{"divsd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"divss", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"maxps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"maxpd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7576},
+{"maxsd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"maxss", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"punpcklbw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"punpcklbw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7577},
+{0},
+{"punpcklwd", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"punpcklwd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7578},
+{0},
+{"punpckldq", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"punpckldq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7579},
+{0},
+{"packsswb", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"packsswb", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7580},
+{0},
+{"pcmpgtb", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pcmpgtb", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7581},
+{0},
+{"pcmpgtw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pcmpgtw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7582},
+{0},
+{"pcmpgtd", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pcmpgtd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7583},
+{0},
+{"packuswb", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"packuswb", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7584},
+{0},
+{"punpckhbw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"punpckhbw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7585},
+{0},
+{"punpckhwd", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"punpckhwd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7586},
+{0},
+{"punpckhdq", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"punpckhdq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7587},
+{0},
+{"packssdw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"packssdw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7588},
+{0},
+{0},
+{"punpcklqdq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"punpckhqdq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movd", {2, 3, 0, 0}, {5, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"movq", {2, 3, 0, 0}, {5, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7589},
+{0},
+{"movd", {2, 3, 0, 0}, {6, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7590},
+{"movd", {2, 3, 0, 0}, {6, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movq", {2, 3, 0, 0}, {6, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7591},
+{"movq", {2, 3, 0, 0}, {6, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7594},
+{0},
+{0},
+{0},
+{0},
+{"movq", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movdqa", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7595},
+{0},
+{"movdqu", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pshufw", {2, 3, 6, 0}, {5, 5, 0, 0}, {0, 8, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pshufd", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7596},
+{"pshuflw", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pshufhw", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"psrlw", {3, 6, 0, 0}, {5, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, 2, 5, 0, 0},
+{0},
+{0},
+{0},
+{"psraw", {3, 6, 0, 0}, {5, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, 4, 5, 0, 0},
+{0},
+{0},
+{0},
+{"psllw", {3, 6, 0, 0}, {5, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, 6, 5, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"psrlw", {3, 6, 0, 0}, {6, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, 2, 5, 0, 7597},
+{0},
+{0},
+{0},
+{"psraw", {3, 6, 0, 0}, {6, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, 4, 5, 0, 7598},
+{0},
+{0},
+{0},
+{"psllw", {3, 6, 0, 0}, {6, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, 6, 5, 0, 7599},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"psrld", {3, 6, 0, 0}, {5, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, 2, 5, 0, 0},
+{0},
+{0},
+{0},
+{"psrad", {3, 6, 0, 0}, {5, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, 4, 5, 0, 0},
+{0},
+{0},
+{0},
+{"pslld", {3, 6, 0, 0}, {5, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, 6, 5, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"psrld", {3, 6, 0, 0}, {6, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, 2, 5, 0, 7600},
+{0},
+{0},
+{0},
+{"psrad", {3, 6, 0, 0}, {6, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, 4, 5, 0, 7601},
+{0},
+{0},
+{0},
+{"pslld", {3, 6, 0, 0}, {6, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, 6, 5, 0, 7602},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"psrlq", {3, 6, 0, 0}, {5, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, 2, 5, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"psllq", {3, 6, 0, 0}, {5, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, 6, 5, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"psrlq", {3, 6, 0, 0}, {6, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, 2, 5, 0, 7603},
+{0},
+{"psrldq", {3, 6, 0, 0}, {6, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, 3, 5, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"psllq", {3, 6, 0, 0}, {6, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, 6, 5, 0, 7604},
+{0},
+{"pslldq", {3, 6, 0, 0}, {6, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, 7, 5, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"pcmpeqb", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pcmpeqb", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7605},
+{0},
+{"pcmpeqw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pcmpeqw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7606},
+{0},
+{"pcmpeqd", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pcmpeqd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7607},
+{0},
+{"emms", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{0},
+{"haddpd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"haddps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"hsubpd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"hsubps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movd", {3, 2, 0, 0}, {3, 5, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"movq", {3, 2, 0, 0}, {4, 5, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7608},
+{0},
+{"movd", {3, 2, 0, 0}, {3, 6, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7609},
+{"movd", {3, 2, 0, 0}, {3, 6, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movq", {3, 2, 0, 0}, {4, 6, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7610},
+{"movq", {3, 2, 0, 0}, {4, 6, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7613},
+{0},
+{0},
+{0},
+{0},
+{"movq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movq", {3, 2, 0, 0}, {5, 5, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movdqa", {3, 2, 0, 0}, {6, 6, 0, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7614},
+{0},
+{"movdqu", {3, 2, 0, 0}, {6, 6, 0, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"jo", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"jno", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"jb", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7615},
+{0},
+{"jae", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7617},
+{0},
+{"je", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7619},
+{0},
+{"jne", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7620},
+{0},
+{"jbe", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7621},
+{0},
+{"ja", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7622},
+{0},
+{"js", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"jns", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"jp", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7623},
+{0},
+{"jnp", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7624},
+{0},
+{"jl", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7625},
+{0},
+{"jge", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7626},
+{0},
+{"jle", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7627},
+{0},
+{"jg", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7628},
+{0},
+{"seto", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"setno", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"setb", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7629},
+{0},
+{"setae", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7631},
+{0},
+{"sete", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7633},
+{0},
+{"setne", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7634},
+{0},
+{"setbe", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7635},
+{0},
+{"seta", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7636},
+{0},
+{"sets", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"setns", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"setp", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7637},
+{0},
+{"setnp", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7638},
+{0},
+{"setl", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7639},
+{0},
+{"setge", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7640},
+{0},
+{"setle", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7641},
+{0},
+{"setg", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7642},
+{0},
+{"push", {1, 0, 0, 0}, {9, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"pop", {1, 0, 0, 0}, {9, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"cpuid", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"bt", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"bt", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"bt", {3, 2, 0, 0}, {4, 4, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7643},
+{"bt", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"shld", {3, 2, 6, 0}, {3, 3, 0, 0}, {4, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 8, 0},
+{"shld", {3, 2, 6, 0}, {2, 2, 0, 0}, {2, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 8, 0},
+{"shld", {3, 2, 6, 0}, {4, 4, 0, 0}, {8, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 8, 7644},
+{"shld", {3, 2, 6, 0}, {2, 2, 0, 0}, {2, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 8, 0},
+{0},
+{0},
+{0},
+{0},
+{"shld", {3, 2, 1, 0}, {3, 3, 1, 0}, {4, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"shld", {3, 2, 1, 0}, {2, 2, 1, 0}, {2, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"shld", {3, 2, 1, 0}, {4, 4, 1, 0}, {8, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7645},
+{"shld", {3, 2, 1, 0}, {2, 2, 1, 0}, {2, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"push", {1, 0, 0, 0}, {9, 0, 0, 0}, {5, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"pop", {1, 0, 0, 0}, {9, 0, 0, 0}, {5, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"rsm", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"bts", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"bts", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"bts", {3, 2, 0, 0}, {4, 4, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7646},
+{"bts", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"shrd", {3, 2, 6, 0}, {3, 3, 0, 0}, {4, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 8, 0},
+{"shrd", {3, 2, 6, 0}, {2, 2, 0, 0}, {2, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 8, 0},
+{"shrd", {3, 2, 6, 0}, {4, 4, 0, 0}, {8, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 8, 7647},
+{"shrd", {3, 2, 6, 0}, {2, 2, 0, 0}, {2, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 8, 0},
+{0},
+{0},
+{0},
+{0},
+{"shrd", {3, 2, 1, 0}, {3, 3, 1, 0}, {4, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"shrd", {3, 2, 1, 0}, {2, 2, 1, 0}, {2, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"shrd", {3, 2, 1, 0}, {4, 4, 1, 0}, {8, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7648},
+{"shrd", {3, 2, 1, 0}, {2, 2, 1, 0}, {2, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"ldmxcsr", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 2, 3, 0, 0},
+{"ldmxcsr", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 2, 3, 0, 0},
+{"ldmxcsr", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 2, 3, 0, 0},
+{"ldmxcsr", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 2, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"stmxcsr", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 3, 3, 0, 0},
+{"stmxcsr", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 3, 3, 0, 0},
+{"stmxcsr", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 3, 3, 0, 0},
+{"stmxcsr", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 3, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"lfence", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xe8, 0x0}, 1, -1, 0, 0, 0},
+{"lfence", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xe8, 0x0}, 1, -1, 0, 0, 0},
+{"lfence", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xe8, 0x0}, 1, -1, 0, 0, 0},
+{"lfence", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xe8, 0x0}, 1, -1, 0, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"mfence", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf0, 0x0}, 1, -1, 0, 0, 0},
+{"mfence", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf0, 0x0}, 1, -1, 0, 0, 0},
+{"mfence", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf0, 0x0}, 1, -1, 0, 0, 0},
+{"mfence", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf0, 0x0}, 1, -1, 0, 0, 0},
+{"clflush", {3, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 7, 3, 0, 0},
+{"clflush", {3, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 7, 3, 0, 0},
+{"clflush", {3, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 7, 3, 0, 0},
+{"clflush", {3, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 7, 3, 0, 0},
+{"sfence", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf8, 0x0}, 1, -1, 0, 0, 0},
+{"sfence", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf8, 0x0}, 1, -1, 0, 0, 0},
+{"sfence", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf8, 0x0}, 1, -1, 0, 0, 0},
+{"sfence", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf8, 0x0}, 1, -1, 0, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"ldmxcsr", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 2, 3, 0, 0},
+{"ldmxcsr", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 2, 3, 0, 0},
+{"ldmxcsr", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 2, 3, 0, 0},
+{"ldmxcsr", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 2, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"stmxcsr", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 3, 3, 0, 0},
+{"stmxcsr", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 3, 3, 0, 0},
+{"stmxcsr", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 3, 3, 0, 0},
+{"stmxcsr", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 3, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"lfence", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xe8, 0x0}, 1, -1, 0, 0, 0},
+{"lfence", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xe8, 0x0}, 1, -1, 0, 0, 0},
+{"lfence", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xe8, 0x0}, 1, -1, 0, 0, 0},
+{"lfence", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xe8, 0x0}, 1, -1, 0, 0, 0},
+{"clwb", {3, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 6, 3, 0, 0},
+{"clwb", {3, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 6, 3, 0, 0},
+{"clwb", {3, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 6, 3, 0, 0},
+{"clwb", {3, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 6, 3, 0, 0},
+{"tpause", {3, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 6, 5, 0, 7649},
+{"tpause", {3, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 6, 5, 0, 7650},
+{"tpause", {3, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 6, 5, 0, 7651},
+{"tpause", {3, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 6, 5, 0, 7652},
+{"clflushopt", {3, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 7, 3, 0, 7653},
+{"clflushopt", {3, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 7, 3, 0, 7654},
+{"clflushopt", {3, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 7, 3, 0, 7655},
+{"clflushopt", {3, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 7, 3, 0, 7656},
+{"sfence", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf8, 0x0}, 1, -1, 0, 0, 0},
+{"sfence", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf8, 0x0}, 1, -1, 0, 0, 0},
+{"sfence", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf8, 0x0}, 1, -1, 0, 0, 0},
+{"sfence", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf8, 0x0}, 1, -1, 0, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"umwait", {3, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 6, 5, 0, 0},
+{0},
+{"umwait", {3, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 6, 5, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"rdfsbase", {3, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 0, 5, 0, 0},
+{0},
+{"rdfsbase", {3, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 0, 5, 0, 7657},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"rdgsbase", {3, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 1, 5, 0, 0},
+{0},
+{"rdgsbase", {3, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 1, 5, 0, 7658},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"wrfsbase", {3, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 2, 5, 0, 0},
+{0},
+{"wrfsbase", {3, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 2, 5, 0, 7659},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"wrgsbase", {3, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 3, 5, 0, 0},
+{0},
+{"wrgsbase", {3, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 3, 5, 0, 7660},
+{0},
+{"ptwrite", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{0},
+{"ptwrite", {3, 0, 0, 0}, {4, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 7661},
+{0},
+{"ptwrite", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{0},
+{"ptwrite", {3, 0, 0, 0}, {4, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 7662},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"incsspd", {3, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 5, 5, 0, 0},
+{0},
+{"incsspq", {3, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 5, 5, 0, 7663},
+{0},
+{"clrssbsy", {3, 0, 0, 0}, {0, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 6, 3, 0, 0},
+{"clrssbsy", {3, 0, 0, 0}, {0, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 6, 3, 0, 0},
+{"clrssbsy", {3, 0, 0, 0}, {0, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 6, 3, 0, 0},
+{"clrssbsy", {3, 0, 0, 0}, {0, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 6, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"imul", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"imul", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"imul", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7664},
+{"imul", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"cmpxchg", {3, 2, 0, 0}, {1, 1, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"cmpxchg", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmpxchg", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmpxchg", {3, 2, 0, 0}, {4, 4, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7665},
+{"cmpxchg", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"btr", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"btr", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"btr", {3, 2, 0, 0}, {4, 4, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7666},
+{"btr", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"movzx", {2, 3, 0, 0}, {3, 1, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movzx", {2, 3, 0, 0}, {2, 1, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movzx", {2, 3, 0, 0}, {4, 1, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7667},
+{"movzx", {2, 3, 0, 0}, {2, 1, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"movzx", {2, 3, 0, 0}, {3, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movzx", {2, 3, 0, 0}, {4, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7668},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"popcnt", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"popcnt", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"popcnt", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7669},
+{"popcnt", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"ud1", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"bt", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 8, 0},
+{"bt", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 8, 0},
+{"bt", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 8, 7670},
+{"bt", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 8, 0},
+{"bts", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 5, 1, 8, 0},
+{"bts", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 5, 1, 8, 0},
+{"bts", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 1, 0, 0}, {0x0, 0x0}, 0, 5, 1, 8, 7671},
+{"bts", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 5, 1, 8, 0},
+{"btr", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 6, 1, 8, 0},
+{"btr", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 6, 1, 8, 0},
+{"btr", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 1, 0, 0}, {0x0, 0x0}, 0, 6, 1, 8, 7672},
+{"btr", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 6, 1, 8, 0},
+{"btc", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 7, 1, 8, 0},
+{"btc", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 7, 1, 8, 0},
+{"btc", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 1, 0, 0}, {0x0, 0x0}, 0, 7, 1, 8, 7673},
+{"btc", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 7, 1, 8, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"btc", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"btc", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"btc", {3, 2, 0, 0}, {4, 4, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7674},
+{"btc", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"bsf", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"bsf", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"bsf", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7675},
+{"bsf", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"tzcnt", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"tzcnt", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"tzcnt", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7676},
+{"tzcnt", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"bsr", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"bsr", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"bsr", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7677},
+{"bsr", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"lzcnt", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"lzcnt", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"lzcnt", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7678},
+{"lzcnt", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movsx", {2, 3, 0, 0}, {3, 1, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movsx", {2, 3, 0, 0}, {2, 1, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movsx", {2, 3, 0, 0}, {4, 1, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7679},
+{"movsx", {2, 3, 0, 0}, {2, 1, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"movsx", {2, 3, 0, 0}, {3, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movsx", {2, 3, 0, 0}, {4, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7680},
+{0},
+{0},
+{"xadd", {3, 2, 0, 0}, {1, 1, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"xadd", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"xadd", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"xadd", {3, 2, 0, 0}, {4, 4, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7681},
+{"xadd", {3, 2, 0, 0}, {2, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"cmpps", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmppd", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7682},
+{"cmpsd", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 8, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmpss", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 4, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movnti", {3, 2, 0, 0}, {0, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{"movnti", {3, 2, 0, 0}, {0, 4, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 7683},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"pextrw", {2, 3, 6, 0}, {3, 5, 0, 0}, {0, 0, 1, 0}, {0x0, 0x0}, 0, -1, 5, 8, 0},
+{0},
+{"pextrw", {2, 3, 6, 0}, {3, 6, 0, 0}, {0, 0, 1, 0}, {0x0, 0x0}, 0, -1, 5, 8, 7684},
+{0},
+{0},
+{"shufps", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"shufpd", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7685},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"cmpxchg8b", {3, 0, 0, 0}, {0, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 1, 3, 0, 0},
+{"cmpxchg8b", {3, 0, 0, 0}, {0, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 1, 3, 0, 0},
+{"cmpxchg16b", {3, 0, 0, 0}, {0, 0, 0, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, 1, 3, 0, 7686},
+{"cmpxchg16b", {3, 0, 0, 0}, {0, 0, 0, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, 1, 3, 0, 7687},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"rdrand", {3, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 6, 5, 0, 0},
+{"rdrand", {3, 0, 0, 0}, {2, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 6, 5, 0, 0},
+{"rdrand", {3, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 6, 5, 0, 7688},
+{"rdrand", {3, 0, 0, 0}, {2, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 6, 5, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"rdseed", {3, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 7, 5, 0, 0},
+{"rdseed", {3, 0, 0, 0}, {2, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 7, 5, 0, 0},
+{"rdseed", {3, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 7, 5, 0, 7689},
+{"rdseed", {3, 0, 0, 0}, {2, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 7, 5, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"senduipi", {3, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 6, 5, 0, 0},
+{"senduipi", {3, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 6, 5, 0, 0},
+{"senduipi", {3, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 6, 5, 0, 0},
+{"senduipi", {3, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 6, 5, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"rdpid", {3, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 7, 5, 0, 0},
+{0},
+{"rdpid", {3, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 7, 5, 0, 0},
+{0},
+{"bswap", {4, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{"bswap", {4, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7690},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"bswap", {4, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{"bswap", {4, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7691},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"bswap", {4, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{"bswap", {4, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7692},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"bswap", {4, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{"bswap", {4, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7693},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"bswap", {4, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{"bswap", {4, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7694},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"bswap", {4, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{"bswap", {4, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7695},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"bswap", {4, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{"bswap", {4, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7696},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"bswap", {4, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{0},
+{"bswap", {4, 0, 0, 0}, {4, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7697},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"addsubpd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"addsubps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psrlw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psrlw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7698},
+{0},
+{"psrld", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psrld", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7699},
+{0},
+{"psrlq", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psrlq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7700},
+{0},
+{"paddq", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"paddq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7701},
+{0},
+{"pmullw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pmullw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7702},
+{0},
+{0},
+{0},
+{"movq", {3, 2, 0, 0}, {6, 6, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movq", {3, 2, 0, 0}, {6, 6, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"movdq2q", {2, 3, 0, 0}, {5, 6, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{0},
+{"movq2dq", {2, 3, 0, 0}, {6, 5, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{0},
+{"pmovmskb", {2, 3, 0, 0}, {3, 5, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{0},
+{"pmovmskb", {2, 3, 0, 0}, {3, 6, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 7703},
+{0},
+{0},
+{"psubusb", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psubusb", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7704},
+{0},
+{"psubusw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psubusw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7705},
+{0},
+{"pminub", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pminub", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7706},
+{0},
+{"pand", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pand", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7707},
+{0},
+{"paddusb", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"paddusb", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7708},
+{0},
+{"paddusw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"paddusw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7709},
+{0},
+{"pmaxub", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pmaxub", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7710},
+{0},
+{"pandn", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pandn", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7711},
+{0},
+{"pavgb", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"psraw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psraw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7712},
+{0},
+{"psrad", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psrad", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7713},
+{0},
+{"pavgw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pavgw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7714},
+{0},
+{"pmulhuw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pmulhuw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7715},
+{0},
+{"pmulhw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pmulhw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7716},
+{0},
+{0},
+{"cvttpd2dq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvtdq2pd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movntq", {3, 2, 0, 0}, {0, 5, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{"movntdq", {3, 2, 0, 0}, {0, 6, 0, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 7717},
+{0},
+{0},
+{0},
+{"psubsb", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psubsb", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7718},
+{0},
+{"psubsw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psubsw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7719},
+{0},
+{"pminsw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pminsw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7720},
+{0},
+{"por", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"por", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7721},
+{0},
+{"paddsb", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"paddsb", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7722},
+{0},
+{"paddsw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"paddsw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7723},
+{0},
+{"pmaxsw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pmaxsw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7724},
+{0},
+{"pxor", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pxor", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7725},
+{0},
+{"psllw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psllw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7726},
+{0},
+{"pslld", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pslld", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7727},
+{0},
+{"psllq", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psllq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7728},
+{0},
+{"pmuludq", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pmuludq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7729},
+{0},
+{"pmaddwd", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pmaddwd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7730},
+{0},
+{"psadbw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psadbw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7731},
+{0},
+{0},
+{"maskmovq", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{0},
+{"maskmovdqu", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 7732},
+{0},
+{0},
+{"psubb", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psubb", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7733},
+{0},
+{"psubw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psubw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7734},
+{0},
+{"psubd", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psubd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7735},
+{0},
+{"psubq", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psubq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7736},
+{0},
+{"paddb", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"paddb", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7737},
+{0},
+{"paddw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"paddw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7738},
+{0},
+{"paddd", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"paddd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7739},
+{0},
+{"ud01", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{"pshufb", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pshufb", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7740},
+{0},
+{"phaddw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"phaddw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7741},
+{0},
+{"phaddd", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"phaddd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7742},
+{0},
+{"phaddsw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"phaddsw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7743},
+{0},
+{"pmaddubsw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pmaddubsw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7744},
+{0},
+{"phsubw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"phsubw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7745},
+{0},
+{"phsubd", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"phsubd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7746},
+{0},
+{"phsubsw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"phsubsw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7747},
+{0},
+{"psignb", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psignb", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7748},
+{0},
+{"psignw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psignw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7749},
+{0},
+{"psignd", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psignd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7750},
+{0},
+{"pmulhrsw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pmulhrsw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7751},
+{0},
+{0},
+{"pblendvb", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"blendvps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"blendvpd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"ptest", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pabsb", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pabsb", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7752},
+{0},
+{"pabsw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pabsw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7753},
+{0},
+{"pabsd", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pabsd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7754},
+{0},
+{0},
+{"pmovsxbw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pmovsxbd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pmovsxbq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pmovsxwd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pmovsxwq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pmovsxdq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pmuldq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pcmpeqq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{"movntdqa", {2, 3, 0, 0}, {6, 0, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{"packusdw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pmovzxbw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pmovzxbd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pmovzxbq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pmovzxwd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pmovzxwq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pmovzxdq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pcmpgtq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pminsb", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pminsd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pminuw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pminud", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pmaxsb", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pmaxsd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pmaxuw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pmaxud", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pmulld", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"phminposuw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{"invpcid", {2, 3, 0, 0}, {4, 0, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{"sha1nexte", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"sha1msg1", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"sha1msg2", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"sha256rnds2", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"sha256msg1", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"sha256msg2", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{"gf2p8mulb", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"aesimc", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"aesenc", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"aesenclast", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"aesdec", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"aesdeclast", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movbe", {2, 3, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{"movbe", {2, 3, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{"movbe", {2, 3, 0, 0}, {4, 0, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 7755},
+{"movbe", {2, 3, 0, 0}, {2, 0, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"crc32", {2, 3, 0, 0}, {3, 1, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"crc32", {2, 3, 0, 0}, {4, 1, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7756},
+{0},
+{"crc32", {2, 3, 0, 0}, {3, 1, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"crc32", {2, 3, 0, 0}, {4, 1, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7757},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"movbe", {3, 2, 0, 0}, {0, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{"movbe", {3, 2, 0, 0}, {0, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{"movbe", {3, 2, 0, 0}, {0, 4, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 7758},
+{"movbe", {3, 2, 0, 0}, {0, 2, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"crc32", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"crc32", {2, 3, 0, 0}, {3, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"crc32", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7759},
+{"crc32", {2, 3, 0, 0}, {3, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"crc32", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"crc32", {2, 3, 0, 0}, {3, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"crc32", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7760},
+{"crc32", {2, 3, 0, 0}, {3, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"adcx", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"adcx", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7761},
+{"movdiri", {3, 2, 0, 0}, {0, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{"movdiri", {3, 2, 0, 0}, {0, 4, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 7762},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"roundpd", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"roundss", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 4, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"roundsd", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 8, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"blendps", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"blendpd", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pblendw", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"palignr", {2, 3, 6, 0}, {5, 5, 0, 0}, {0, 8, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"palignr", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7763},
+{0},
+{0},
+{0},
+{"pextrd", {3, 2, 6, 0}, {3, 6, 0, 0}, {4, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 8, 0},
+{"pextrq", {3, 2, 6, 0}, {4, 6, 0, 0}, {8, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 8, 7764},
+{0},
+{"insertps", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 4, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{"pinsrd", {2, 3, 6, 0}, {6, 3, 0, 0}, {0, 4, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pinsrq", {2, 3, 6, 0}, {6, 4, 0, 0}, {0, 8, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7765},
+{0},
+{"dpps", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"dppd", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"mpsadbw", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pclmulqdq", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pcmpestrm", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pcmpestri", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pcmpistrm", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"pcmpistri", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"sha1rnds4", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{"gf2p8affineqb", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"gf2p8affineinvqb", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"aeskeygenassist", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"hreset", {6, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0xc0, 0x0}, 1, -1, 0, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vmovups", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovups", {2, 3, 0, 0}, {7, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovups", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovups", {2, 3, 0, 0}, {7, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovupd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovupd", {2, 3, 0, 0}, {7, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovupd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovupd", {2, 3, 0, 0}, {7, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovss", {2, 3, 0, 0}, {6, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{"vmovss", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{0},
+{0},
+{0},
+{"vmovsd", {2, 3, 0, 0}, {6, 0, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{"vmovsd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{0},
+{0},
+{0},
+{"vmovups", {3, 2, 0, 0}, {6, 6, 0, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovups", {3, 2, 0, 0}, {7, 7, 0, 0}, {32, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovups", {3, 2, 0, 0}, {6, 6, 0, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovups", {3, 2, 0, 0}, {7, 7, 0, 0}, {32, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovupd", {3, 2, 0, 0}, {6, 6, 0, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovupd", {3, 2, 0, 0}, {7, 7, 0, 0}, {32, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovupd", {3, 2, 0, 0}, {6, 6, 0, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovupd", {3, 2, 0, 0}, {7, 7, 0, 0}, {32, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovss", {3, 2, 0, 0}, {0, 6, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{"vmovss", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{0},
+{0},
+{0},
+{"vmovsd", {3, 2, 0, 0}, {0, 6, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{"vmovsd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{0},
+{0},
+{0},
+{"vmovlps", {2, 5, 3, 0}, {6, 6, 0, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{"vmovhlps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{0},
+{0},
+{0},
+{"vmovlpd", {2, 5, 3, 0}, {6, 6, 0, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vmovsldup", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovsldup", {2, 3, 0, 0}, {7, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovsldup", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovsldup", {2, 3, 0, 0}, {7, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovddup", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovddup", {2, 3, 0, 0}, {7, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovddup", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovddup", {2, 3, 0, 0}, {7, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovlps", {3, 2, 0, 0}, {0, 6, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vmovlpd", {3, 2, 0, 0}, {0, 6, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vunpcklps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vunpcklpsymm1", {2, 3, 0, 0}, {7, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vunpcklpd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vunpcklpd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vunpckhps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vunpckhps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vunpckhpd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vunpckhpd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vmovhps", {2, 5, 3, 0}, {6, 6, 0, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{"vmovlhps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{0},
+{0},
+{0},
+{"vmovhpd", {2, 5, 3, 0}, {6, 6, 0, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vmovshdup", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovshdup", {2, 3, 0, 0}, {7, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovshdup", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovshdup", {2, 3, 0, 0}, {7, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vmovhps", {3, 2, 0, 0}, {0, 6, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vmovhpd", {3, 2, 0, 0}, {0, 6, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vmovaps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovaps", {2, 3, 0, 0}, {7, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovapd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovapd", {2, 3, 0, 0}, {7, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vmovaps", {3, 2, 0, 0}, {6, 6, 0, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovaps", {3, 2, 0, 0}, {7, 7, 0, 0}, {32, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovapd", {3, 2, 0, 0}, {6, 6, 0, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovapd", {3, 2, 0, 0}, {7, 7, 0, 0}, {32, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vcvtsi2ss", {2, 5, 3, 0}, {6, 6, 3, 0}, {0, 0, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vcvtsi2ss", {2, 5, 3, 0}, {6, 6, 4, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{"vcvtsi2sd", {2, 5, 3, 0}, {6, 6, 3, 0}, {0, 0, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vcvtsi2sd", {2, 5, 3, 0}, {6, 6, 4, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{"vmovntps", {3, 2, 0, 0}, {0, 6, 0, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{"vmovntps", {3, 2, 0, 0}, {0, 7, 0, 0}, {32, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vmovntpd", {3, 2, 0, 0}, {0, 6, 0, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{"vmovntpd", {3, 2, 0, 0}, {0, 7, 0, 0}, {32, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vcvttss2si", {2, 3, 0, 0}, {3, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vcvttss2si", {2, 3, 0, 0}, {4, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{"vcvttsd2si", {2, 3, 0, 0}, {3, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vcvttsd2si", {2, 3, 0, 0}, {4, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vcvtss2si", {2, 3, 0, 0}, {3, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vcvtss2si", {2, 3, 0, 0}, {4, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{"vcvtsd2si", {2, 3, 0, 0}, {3, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vcvtsd2si", {2, 3, 0, 0}, {4, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{"vucomiss", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{"vucomisd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vcomiss", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{"vcomisd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vmovmskps", {2, 3, 0, 0}, {3, 6, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{0},
+{"vmovmskps", {2, 3, 0, 0}, {3, 7, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vmovmskpd", {2, 3, 0, 0}, {3, 6, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{0},
+{"vmovmskpd", {2, 3, 0, 0}, {3, 7, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vsqrtps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vsqrtps", {2, 3, 0, 0}, {7, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vsqrtpd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vsqrtpd", {2, 3, 0, 0}, {7, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vsqrtss", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{"vsqrtsd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{"vrsqrtps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vrsqrtps", {2, 3, 0, 0}, {7, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vrsqrtss", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{"vrcpps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vrcpps", {2, 3, 0, 0}, {7, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vrcpss", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{"vandps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vandps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vandpd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vandpd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vandnps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vandnps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vandnpd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vandnpd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vorps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vorps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vorpd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vorpd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vxorps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vxorps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vxorpd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vxorpd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vaddps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vaddps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vaddpd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vaddpd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vaddss", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{"vaddsd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{"vmulps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmulps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmulpd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmulpd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmulss", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{"vmulsd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{"vcvtps2pd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vcvtps2pd", {2, 3, 0, 0}, {7, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vcvtpd2ps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vcvtpd2ps", {2, 3, 0, 0}, {6, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vcvtss2sd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{"vcvtsd2ss", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vcvtps2dq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vcvtps2dq", {2, 3, 0, 0}, {7, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vcvttps2dq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vcvttps2dq", {2, 3, 0, 0}, {7, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vsubps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vsubps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vsubpd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vsubpd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vsubss", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{"vsubsd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{"vminps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vminps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vminpd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vminpd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vminss", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{"vminsd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{"vdivps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vdivps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vdivpd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vdivpd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vdivss", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{"vdivsd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{"vmaxps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmaxps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmaxpd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmaxpd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmaxss", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{"vmaxsd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpunpcklbw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpunpcklbw", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpunpcklwd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpunpcklwd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpunpckldq", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpunpckldq", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpacksswb", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpacksswb", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpcmpgtb", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpcmpgtb", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpcmpgtw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpcmpgtw", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpcmpgtd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpcmpgtd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpackuswb", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpackuswb", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpunpckhbw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpunpckhbw", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpunpckhwd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpunpckhwd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpunpckhdq", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpunpckhdq", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpackssdw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpackssdw", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpunpcklqdq", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpunpcklqdq", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpunpckhqdq", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpunpckhqdq", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vmovd", {2, 3, 0, 0}, {6, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vmovq", {2, 3, 0, 0}, {6, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vmovdqa", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovdqa", {2, 3, 0, 0}, {7, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovdqu", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovdqu", {2, 3, 0, 0}, {7, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpshufd", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpshufd", {2, 3, 6, 0}, {7, 7, 0, 0}, {0, 32, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpshufhw", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpshufhw", {2, 3, 6, 0}, {7, 7, 0, 0}, {0, 32, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpshuflw", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpshuflw", {2, 3, 6, 0}, {7, 7, 0, 0}, {0, 32, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsrlw", {5, 3, 6, 0}, {6, 6, 0, 0}, {0, 0, 1, 0}, {0x0, 0x0}, 0, 2, 5, 0, 0},
+{0},
+{"vpsrlw", {5, 3, 6, 0}, {7, 7, 0, 0}, {0, 0, 1, 0}, {0x0, 0x0}, 0, 2, 5, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsraw", {5, 3, 6, 0}, {6, 6, 0, 0}, {0, 0, 1, 0}, {0x0, 0x0}, 0, 4, 5, 0, 0},
+{0},
+{"vpsraw", {5, 3, 6, 0}, {7, 7, 0, 0}, {0, 0, 1, 0}, {0x0, 0x0}, 0, 4, 5, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsllw", {5, 3, 6, 0}, {6, 6, 0, 0}, {0, 0, 1, 0}, {0x0, 0x0}, 0, 6, 5, 0, 0},
+{0},
+{"vpsllw", {5, 3, 6, 0}, {7, 7, 0, 0}, {0, 0, 1, 0}, {0x0, 0x0}, 0, 6, 5, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsrld", {5, 3, 6, 0}, {6, 6, 0, 0}, {0, 0, 1, 0}, {0x0, 0x0}, 0, 2, 5, 0, 0},
+{0},
+{"vpsrld", {5, 3, 6, 0}, {7, 7, 0, 0}, {0, 0, 1, 0}, {0x0, 0x0}, 0, 2, 5, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsrad", {5, 3, 6, 0}, {6, 6, 0, 0}, {0, 0, 1, 0}, {0x0, 0x0}, 0, 4, 5, 0, 0},
+{0},
+{"vpsrad", {5, 3, 6, 0}, {7, 7, 0, 0}, {0, 0, 1, 0}, {0x0, 0x0}, 0, 4, 5, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpslld", {5, 3, 6, 0}, {6, 6, 0, 0}, {0, 0, 1, 0}, {0x0, 0x0}, 0, 6, 5, 0, 0},
+{0},
+{"vpslld", {5, 3, 6, 0}, {7, 7, 0, 0}, {0, 0, 1, 0}, {0x0, 0x0}, 0, 6, 5, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsrlq", {5, 3, 6, 0}, {6, 6, 0, 0}, {0, 0, 1, 0}, {0x0, 0x0}, 0, 2, 5, 0, 0},
+{0},
+{"vpsrlq", {5, 3, 6, 0}, {7, 7, 0, 0}, {0, 0, 1, 0}, {0x0, 0x0}, 0, 2, 5, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsrldq", {5, 3, 6, 0}, {6, 6, 0, 0}, {0, 0, 1, 0}, {0x0, 0x0}, 0, 3, 5, 0, 0},
+{0},
+{"vpsrldq", {5, 3, 6, 0}, {7, 7, 0, 0}, {0, 0, 1, 0}, {0x0, 0x0}, 0, 3, 5, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsllq", {5, 3, 6, 0}, {6, 6, 0, 0}, {0, 0, 1, 0}, {0x0, 0x0}, 0, 6, 5, 0, 0},
+{0},
+{"vpsllq", {5, 3, 6, 0}, {7, 7, 0, 0}, {0, 0, 1, 0}, {0x0, 0x0}, 0, 6, 5, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpslldq", {5, 3, 6, 0}, {6, 6, 0, 0}, {0, 0, 1, 0}, {0x0, 0x0}, 0, 7, 5, 0, 0},
+{0},
+{"vpslldq", {5, 3, 6, 0}, {7, 7, 0, 0}, {0, 0, 1, 0}, {0x0, 0x0}, 0, 7, 5, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpcmpeqb", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpcmpeqb", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpcmpeqw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpcmpeqw", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpcmpeqd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpcmpeqd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vzeroupper", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{"vzeroall", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vhaddpd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vhaddpd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vhaddps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vhaddps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vhsubpd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vhsubpd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vhsubps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vhsubps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vmovd", {3, 2, 0, 0}, {3, 6, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vmovq", {3, 2, 0, 0}, {4, 6, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{"vmovq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vmovdqa", {3, 2, 0, 0}, {6, 6, 0, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovdqa", {3, 2, 0, 0}, {7, 7, 0, 0}, {32, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovdqu", {3, 2, 0, 0}, {6, 6, 0, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmovdqu", {3, 2, 0, 0}, {7, 7, 0, 0}, {32, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vldmxcsr", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 2, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vstmxcsr", {3, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 3, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vcmpps", {2, 5, 3, 6}, {6, 6, 6, 0}, {0, 0, 16, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vcmpps", {2, 5, 3, 6}, {7, 7, 7, 0}, {0, 0, 32, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vcmppd", {2, 5, 3, 6}, {6, 6, 6, 0}, {0, 0, 16, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vcmppd", {2, 5, 3, 6}, {7, 7, 7, 0}, {0, 0, 32, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vcmpss", {2, 5, 3, 6}, {6, 6, 6, 0}, {0, 0, 4, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{"vcmpsd", {2, 5, 3, 6}, {6, 6, 6, 0}, {0, 0, 8, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpextrw", {2, 3, 6, 0}, {3, 6, 0, 0}, {0, 0, 1, 0}, {0x0, 0x0}, 0, -1, 5, 8, 0},
+{0},
+{0},
+{0},
+{"vshufps", {2, 5, 3, 6}, {6, 6, 6, 0}, {0, 0, 16, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vshufps", {2, 5, 3, 6}, {7, 7, 7, 0}, {0, 0, 32, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vshufpd", {2, 5, 3, 6}, {6, 6, 6, 0}, {0, 0, 16, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vshufpd", {2, 5, 3, 6}, {7, 7, 7, 0}, {0, 0, 32, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vaddsubpd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vaddsubpd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vaddsubps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vaddsubps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsrlw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpsrlw", {2, 5, 3, 0}, {7, 7, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsrld", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpsrld", {2, 5, 3, 0}, {7, 7, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsrlq", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpsrlq", {2, 5, 3, 0}, {7, 7, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpaddq", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpaddq", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmullw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpmullw", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vmovq", {3, 2, 0, 0}, {6, 6, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmovmskb", {2, 3, 0, 0}, {3, 6, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{0},
+{"vpmovmskb", {2, 3, 0, 0}, {3, 7, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsubusb", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpsubusb", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsubusw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpsubusw", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpminub", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpminub", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpand", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpand", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpaddusb", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpaddusb", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpaddusw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpaddusw", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmaxub", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpmaxub", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpandn", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpandn", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpavgb", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpavgb", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsraw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpsraw", {2, 5, 3, 0}, {7, 7, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsrad", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpsrad", {2, 5, 3, 0}, {7, 7, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpavgw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpavgw", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmulhuw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpmulhuw", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmulhw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpmulhw", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vcvttpd2dq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vcvttpd2dq", {2, 3, 0, 0}, {6, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vcvtdq2pd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vcvtdq2pd", {2, 3, 0, 0}, {7, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vmovntdq", {3, 2, 0, 0}, {0, 6, 0, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{"vmovntdq", {3, 2, 0, 0}, {0, 7, 0, 0}, {32, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsubsb", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpsubsb", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsubsw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpsubsw", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpminsw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpminsw", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpor", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpor", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpaddsb", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpaddsb", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpaddsw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpaddsw", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmaxsw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpmaxsw", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpxor", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpxor", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vlddqu", {2, 3, 0, 0}, {6, 0, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{"vlddqu", {2, 3, 0, 0}, {7, 0, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsllw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpsllw", {2, 5, 3, 0}, {7, 7, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpslld", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpslld", {2, 5, 3, 0}, {7, 7, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsllq", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpsllq", {2, 5, 3, 0}, {7, 7, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmuludq", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpmuludq", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmaddwd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpmaddwd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsadbw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpsadbw", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vmaskmovdqu", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsubb", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpsubb", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsubw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpsubw", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsubd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpsubd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsubq", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpsubq", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpaddb", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpaddb", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpaddw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpaddw", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpaddd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpaddd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpshufb", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpshufb", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vphaddw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vphaddw", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vphaddd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vphaddd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vphaddsw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vphaddsw", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmaddubsw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpmaddubsw", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vphsubw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vphsubw", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vphsubd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vphsubd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vphsubsw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vphsubsw", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsignb", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpsignb", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsignw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpsignw", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsignd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpsignd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmulhrsw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpmulhrsw", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpermilps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpermilps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpermilpd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpermilpd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vtestps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vtestps", {2, 3, 0, 0}, {7, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vtestpd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vtestpd", {2, 3, 0, 0}, {7, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vcvtph2ps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vcvtph2ps", {2, 3, 0, 0}, {7, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpermps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vptest", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vptest", {2, 3, 0, 0}, {7, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vbroadcastss", {2, 3, 0, 0}, {6, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{"vbroadcastss", {2, 3, 0, 0}, {7, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{"vbroadcastss", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{0},
+{"vbroadcastss", {2, 3, 0, 0}, {7, 6, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vbroadcastsd", {2, 3, 0, 0}, {7, 0, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{"vbroadcastsd", {2, 3, 0, 0}, {7, 6, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vbroadcastf128", {2, 3, 0, 0}, {7, 0, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpabsb", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpabsb", {2, 3, 0, 0}, {7, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpabsw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpabsw", {2, 3, 0, 0}, {7, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpabsd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpabsd", {2, 3, 0, 0}, {7, 7, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmovsxbw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpmovsxbw", {2, 3, 0, 0}, {7, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmovsxbd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpmovsxbd", {2, 3, 0, 0}, {7, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmovsxbq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpmovsxbq", {2, 3, 0, 0}, {7, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmovsxwd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpmovsxwd", {2, 3, 0, 0}, {7, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmovsxwq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpmovsxwq", {2, 3, 0, 0}, {7, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmovsxdq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpmovsxdq", {2, 3, 0, 0}, {7, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmuldq", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpmuldq", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpcmpeqq", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpcmpeqq", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vmovntdqa", {2, 3, 0, 0}, {6, 0, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{"vmovntdqa", {2, 3, 0, 0}, {7, 0, 0, 0}, {0, 32, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpackusdw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpackusdw", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vmaskmovps", {2, 5, 3, 0}, {6, 6, 0, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{"vmaskmovps", {2, 5, 3, 0}, {7, 7, 0, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vmaskmovpd", {2, 5, 3, 0}, {6, 6, 0, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{"vmaskmovpd", {2, 5, 3, 0}, {7, 7, 0, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vmaskmovps", {3, 5, 2, 0}, {0, 6, 6, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{"vmaskmovps", {3, 5, 2, 0}, {0, 7, 7, 0}, {32, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vmaskmovpd", {3, 5, 2, 0}, {0, 6, 6, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{"vmaskmovpd", {3, 5, 2, 0}, {0, 7, 7, 0}, {32, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmovzxbw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpmovzxbw", {2, 3, 0, 0}, {7, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmovzxbd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpmovzxbd", {2, 3, 0, 0}, {7, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmovzxbq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpmovzxbq", {2, 3, 0, 0}, {7, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmovzxwd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpmovzxwd", {2, 3, 0, 0}, {7, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmovzxwq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpmovzxwq", {2, 3, 0, 0}, {7, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmovzxdq", {2, 3, 0, 0}, {7, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpermd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpcmpgtq", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpcmpgtq", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpminsb", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpminsb", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpminsd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpminsd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpminuw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpminuw", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpminud", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpminud", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmaxsb", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpmaxsb", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmaxsd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpmaxsd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmaxuw", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpmaxuw", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmaxud", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpmaxud", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmulld", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpmulld", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vphminposuw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsrlvd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vpsrlvq", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vpsrlvd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vpsrlvq", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"vpsravd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpsravd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpsllvd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vpsllvq", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vpsllvd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vpsllvq", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"tilerelease", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xc0, 0x0}, 1, -1, 0, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpdpbusd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpdpbusd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpdpbusds", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpdpbusds", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpdpwssd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpdpwssd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpdpwssds", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpdpwssds", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpbroadcastd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpbroadcastd", {2, 3, 0, 0}, {7, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpbroadcastq", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpbroadcastq", {2, 3, 0, 0}, {7, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vbroadcasti128", {2, 3, 0, 0}, {7, 0, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpbroadcastb", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpbroadcastb", {2, 3, 0, 0}, {7, 6, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpbroadcastw", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpbroadcastw", {2, 3, 0, 0}, {7, 6, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmaskmovd", {2, 5, 3, 0}, {6, 6, 0, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{"vpmaskmovq", {2, 5, 3, 0}, {6, 6, 0, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{"vpmaskmovd", {2, 5, 3, 0}, {7, 7, 0, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{"vpmaskmovq", {2, 5, 3, 0}, {7, 7, 0, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpmaskmovd", {3, 5, 2, 0}, {0, 6, 6, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{"vpmaskmovq", {3, 5, 2, 0}, {0, 6, 6, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{"vpmaskmovd", {3, 5, 2, 0}, {0, 7, 7, 0}, {32, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{"vpmaskmovq", {3, 5, 2, 0}, {0, 7, 7, 0}, {32, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vfmaddsub132ps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmaddsub132pd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmaddsub132ps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmaddsub132pd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"vfmsubadd132ps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmsubadd132pd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmsubadd132ps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmsubadd132pd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"vfmadd132ps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmadd132pd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmadd132ps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmadd132pd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"vfmadd132ss", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmadd132sd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vfmsub132ps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmsub132pd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmsub132ps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmsub132pd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"vfmsub132ss", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmsub132sd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vfnmadd132ps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfnmadd132pd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfnmadd132ps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfnmadd132pd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"vfnmadd132ss", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfnmadd132sd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vfnmsub132ps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfnmsub132pd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfnmsub132ps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfnmsub132pd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"vfnmsub132ss", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfnmsub132sd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vfmaddsub213ps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmaddsub213pd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmaddsub213ps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmaddsub213pd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"vfmsubadd213ps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmsubadd213pd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmsubadd213ps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmsubadd213pd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"vfmadd213ps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmadd213pd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmadd213ps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmadd213pd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"vfmadd213ss", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmadd213sd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vfmsub213ps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmsub213pd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmsub213ps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmsub213pd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"vfmsub213ss", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmsub213sd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vfnmadd213ps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfnmadd213pd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfnmadd213ps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfnmadd213pd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"vfnmadd213ss", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfnmadd213sd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vfnmsub213ps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfnmsub213pd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfnmsub213ps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfnmsub213pd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"vfnmsub213ss", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfnmsub213sd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vfmaddsub231ps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmaddsub231pd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmaddsub231ps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmaddsub231pd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"vfmsubadd231ps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmsubadd231pd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmsubadd231ps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmsubadd231pd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"vfmadd231ps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmadd231pd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmadd231ps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmadd231pd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"vfmadd231ss", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmadd231sd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vfmsub231ps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmsub231pd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmsub231ps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmsub231pd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"vfmsub231ss", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfmsub231sd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vfnmadd231ps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfnmadd231pd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfnmadd231ps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfnmadd231pd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"vfnmadd231ss", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfnmadd231sd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vfnmsub231ps", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfnmsub231pd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfnmsub231ps", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfnmsub231pd", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"vfnmsub231ss", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vfnmsub231sd", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vgf2p8mulb", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vgf2p8mulb", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vaesimc", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vaesenc", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vaesenc", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vaesenclast", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vaesenclast", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vaesdec", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vaesdec", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vaesdeclast", {2, 5, 3, 0}, {6, 6, 6, 0}, {0, 0, 16, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vaesdeclast", {2, 5, 3, 0}, {7, 7, 7, 0}, {0, 0, 32, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"andn", {2, 5, 3, 0}, {3, 3, 3, 0}, {0, 0, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"andn", {2, 5, 3, 0}, {4, 4, 4, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"blsr", {5, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, 1, 1, 0, 0},
+{"blsr", {5, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, 1, 1, 0, 0},
+{0},
+{0},
+{"blsmsk", {5, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 0},
+{"blsmsk", {5, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 0},
+{0},
+{0},
+{"blsi", {5, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, 3, 1, 0, 0},
+{"blsi", {5, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, 3, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"bzhi", {2, 3, 5, 0}, {3, 3, 3, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"bzhi", {2, 3, 5, 0}, {4, 4, 4, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"pext", {2, 5, 3, 0}, {3, 3, 3, 0}, {0, 0, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pext", {2, 5, 3, 0}, {4, 4, 4, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{"pdep", {2, 5, 3, 0}, {3, 3, 3, 0}, {0, 0, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pdep", {2, 5, 3, 0}, {4, 4, 4, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"mulx", {2, 5, 3, 0}, {3, 3, 3, 0}, {0, 0, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"mulx", {2, 5, 3, 0}, {4, 4, 4, 0}, {0, 0, 8, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{"bextr", {2, 3, 5, 0}, {3, 3, 3, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"bextr", {2, 3, 5, 0}, {4, 4, 4, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{"shlx", {2, 3, 5, 0}, {3, 3, 3, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"shlx", {2, 3, 5, 0}, {4, 4, 4, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{"sarx", {2, 3, 5, 0}, {3, 3, 3, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"sarx", {2, 3, 5, 0}, {4, 4, 4, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{"shrx", {2, 3, 5, 0}, {3, 3, 3, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"shrx", {2, 3, 5, 0}, {4, 4, 4, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpermq", {2, 3, 6, 0}, {7, 7, 0, 0}, {0, 32, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpermpd", {2, 3, 6, 0}, {7, 7, 0, 0}, {0, 32, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"vpblendd", {2, 5, 3, 6}, {6, 6, 6, 0}, {0, 0, 16, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpblendd", {2, 5, 3, 6}, {7, 7, 7, 0}, {0, 0, 32, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpermilps", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpermilps", {2, 3, 6, 0}, {7, 7, 0, 0}, {0, 32, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpermilpd", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpermilpd", {2, 3, 6, 0}, {7, 7, 0, 0}, {0, 32, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vperm2f128", {2, 5, 3, 6}, {7, 7, 7, 0}, {0, 0, 32, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vroundps", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vroundps", {2, 3, 6, 0}, {7, 7, 0, 0}, {0, 32, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vroundpd", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vroundpd", {2, 3, 6, 0}, {7, 7, 0, 0}, {0, 32, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vroundss", {2, 5, 3, 6}, {6, 6, 6, 0}, {0, 0, 4, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vroundsd", {2, 5, 3, 6}, {6, 6, 6, 0}, {0, 0, 8, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vblendps", {2, 5, 3, 6}, {6, 6, 6, 0}, {0, 0, 16, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vblendps", {2, 5, 3, 6}, {7, 7, 7, 0}, {0, 0, 32, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vblendpd", {2, 5, 3, 6}, {6, 6, 6, 0}, {0, 0, 16, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vblendpd", {2, 5, 3, 6}, {7, 7, 7, 0}, {0, 0, 32, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpblendw", {2, 5, 3, 6}, {6, 6, 6, 0}, {0, 0, 16, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpblendw", {2, 5, 3, 6}, {7, 7, 7, 0}, {0, 0, 32, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpalignr", {2, 5, 3, 6}, {6, 6, 6, 0}, {0, 0, 16, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpalignr", {2, 5, 3, 6}, {7, 7, 7, 0}, {0, 0, 32, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpextrd", {3, 2, 6, 0}, {3, 6, 0, 0}, {4, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 8, 0},
+{"vpextrq", {3, 2, 6, 0}, {4, 6, 0, 0}, {8, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 8, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vinsertf128", {2, 5, 3, 6}, {7, 7, 6, 0}, {0, 0, 16, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vextractf128", {3, 2, 6, 0}, {6, 7, 0, 0}, {16, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vcvtps2ph", {3, 2, 6, 0}, {6, 6, 0, 0}, {8, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vcvtps2ph", {3, 2, 6, 0}, {6, 7, 0, 0}, {16, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vinsertps", {2, 5, 3, 6}, {6, 6, 6, 0}, {0, 0, 4, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpinsrd", {2, 5, 3, 6}, {6, 6, 3, 0}, {0, 0, 4, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"vpinsrq", {2, 5, 3, 6}, {6, 6, 4, 0}, {0, 0, 8, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vinserti128", {2, 5, 3, 6}, {7, 7, 6, 0}, {0, 0, 16, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vextracti128", {3, 2, 6, 0}, {6, 7, 0, 0}, {16, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vdpps", {2, 5, 3, 6}, {6, 6, 6, 0}, {0, 0, 16, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vdpps", {2, 5, 3, 6}, {7, 7, 7, 0}, {0, 0, 32, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vdppd", {2, 5, 3, 6}, {6, 6, 6, 0}, {0, 0, 16, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vmpsadbw", {2, 5, 3, 6}, {6, 6, 6, 0}, {0, 0, 16, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vmpsadbw", {2, 5, 3, 6}, {7, 7, 7, 0}, {0, 0, 32, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpclmulqdq", {2, 5, 3, 6}, {6, 6, 6, 0}, {0, 0, 16, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpclmulqdq", {2, 5, 3, 6}, {7, 7, 7, 0}, {0, 0, 32, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vperm2i128", {2, 5, 3, 6}, {7, 7, 7, 0}, {0, 0, 32, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vblendvps", {2, 5, 3, 7}, {6, 6, 6, 6}, {0, 0, 16, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vblendvps", {2, 5, 3, 7}, {7, 7, 7, 7}, {0, 0, 32, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vblendvpd", {2, 5, 3, 7}, {6, 6, 6, 6}, {0, 0, 16, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vblendvpd", {2, 5, 3, 7}, {7, 7, 7, 7}, {0, 0, 32, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpblendvb", {2, 5, 3, 7}, {6, 6, 6, 6}, {0, 0, 16, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vpblendvb", {2, 5, 3, 7}, {7, 7, 7, 7}, {0, 0, 32, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpcmpestrm", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpcmpestri", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpcmpistrm", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vpcmpistri", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vgf2p8affineqb", {2, 5, 3, 6}, {6, 6, 6, 0}, {0, 0, 16, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vgf2p8affineqb", {2, 5, 3, 6}, {7, 7, 7, 0}, {0, 0, 32, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{0},
+{"vgf2p8affineinvqb", {2, 5, 3, 6}, {6, 6, 6, 0}, {0, 0, 16, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{"vgf2p8affineinvqb", {2, 5, 3, 6}, {7, 7, 7, 0}, {0, 0, 32, 1}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{0},
+{"vaeskeygenassist", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{0},
+{0},
+{0},
+{"add", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"add", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"add", {1, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"or", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"or", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"or", {1, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"adc", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"adc", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"adc", {1, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"sbb", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"sbb", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"sbb", {1, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"and", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"and", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"and", {1, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"sub", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"sub", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"sub", {1, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"xor", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"xor", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"xor", {1, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"cmp", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmp", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmp", {1, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"movsxd", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"push", {6, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"imul", {2, 3, 6, 0}, {3, 3, 0, 0}, {0, 4, 4, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"imul", {2, 3, 6, 0}, {3, 3, 0, 0}, {0, 4, 1, 0}, {0x0, 0x0}, 0, -1, 1, 8, 0},
+{"insd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"insd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"outsd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"outsd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"outsd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"outsd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"jc", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7179},
+{"jnae", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"jnb", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7181},
+{"jnc", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"jz", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"jnz", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"jna", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"jnbe", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"jpe", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"jpo", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"jnge", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"jnl", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"jng", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"jnle", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"add", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 4, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"or", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 4, 0, 0}, {0x0, 0x0}, 0, 1, 1, 0, 0},
+{"adc", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 4, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 0},
+{"sbb", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 4, 0, 0}, {0x0, 0x0}, 0, 3, 1, 0, 0},
+{"and", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 4, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{"sub", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 4, 0, 0}, {0x0, 0x0}, 0, 5, 1, 0, 0},
+{"xor", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 4, 0, 0}, {0x0, 0x0}, 0, 6, 1, 0, 0},
+{"cmp", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 4, 0, 0}, {0x0, 0x0}, 0, 7, 1, 0, 0},
+{"add", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 0, 1, 8, 0},
+{"or", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 1, 1, 8, 0},
+{"adc", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 2, 1, 8, 0},
+{"sbb", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 3, 1, 8, 0},
+{"and", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 8, 0},
+{"sub", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 5, 1, 8, 0},
+{"xor", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 6, 1, 8, 0},
+{"cmp", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 7, 1, 8, 0},
+{"test", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"xchg", {2, 3, 0, 0}, {1, 1, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"xchg", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"xchg", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"xchg", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7213},
+{"xchg", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7214},
+{"xchg", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"xchg", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"mov", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"mov", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"lea", {2, 3, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{"xchg", {1, 4, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7220},
+{"xchg", {4, 1, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {1, 4, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7222},
+{"xchg", {4, 1, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {4, 4, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7224},
+{"nop", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7225},
+{"xchg", {1, 4, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7226},
+{"xchg", {4, 1, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {1, 4, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7228},
+{"xchg", {4, 1, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {4, 4, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7232},
+{"xchg", {1, 4, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7233},
+{"xchg", {4, 1, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {4, 4, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7238},
+{"xchg", {1, 4, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7239},
+{"xchg", {4, 1, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {4, 4, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7244},
+{"xchg", {1, 4, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7245},
+{"xchg", {4, 1, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {4, 4, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7250},
+{"xchg", {1, 4, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7251},
+{"xchg", {4, 1, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {4, 4, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7256},
+{"xchg", {1, 4, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7257},
+{"xchg", {4, 1, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {4, 4, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7262},
+{"xchg", {1, 4, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7263},
+{"xchg", {4, 1, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {4, 4, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7268},
+{"xchg", {1, 4, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7269},
+{"xchg", {4, 1, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {4, 4, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7274},
+{"xchg", {1, 4, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 7275},
+{"xchg", {4, 1, 0, 0}, {3, 3, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"xchg", {4, 1, 0, 0}, {2, 2, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"cwde", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"cwde", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"cdqe", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7280},
+{"cwde", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"cdq", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"cdq", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"cqo", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7284},
+{"cdq", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"wait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"wait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"wait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"wait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"wait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"wait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"wait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"finit", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xdb, 0xe3}, 2, -1, 0, 0, 7293},
+{"fstsw", {1, 0, 0, 0}, {2, 0, 0, 0}, {0, 0, 0, 0}, {0xdf, 0xe0}, 2, -1, 0, 0, 7294},
+{"fwait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7295},
+{"wait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"wait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"wait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"wait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"wait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"wait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"wait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"wait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"wait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"pushfq", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"popfq", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"movsd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"movsd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"movsq", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7309},
+{"movsd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"cmpsd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"cmpsd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"cmpsq", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7313},
+{"cmpsd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"test", {1, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"stosd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"stosd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"stosq", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7318},
+{"stosd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"lodsd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"lodsd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"lodsd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"lodsd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"lodsq", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7324},
+{"lodsd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"lodsq", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7326},
+{"lodsd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"rep", {1, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"scasd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"scasd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"scasq", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7331},
+{"scasd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"mov", {4, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"mov", {4, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"mov", {4, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"mov", {4, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"mov", {4, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"mov", {4, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"mov", {4, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"mov", {4, 6, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"shl", {3, 6, 0, 0}, {1, 0, 0, 0}, {1, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{"rol", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 0, 1, 8, 0},
+{"ror", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 1, 1, 8, 0},
+{"rcl", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 2, 1, 8, 0},
+{"rcr", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 3, 1, 8, 0},
+{"shl", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 8, 0},
+{"shl", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 8, 0},
+{"shl", {3, 6, 0, 0}, {4, 0, 0, 0}, {8, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 8, 7348},
+{"sal", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 8, 7349},
+{"shl", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 8, 0},
+{"shl", {3, 6, 0, 0}, {2, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 8, 0},
+{"shr", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 5, 1, 8, 0},
+{"sar", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 7, 1, 8, 0},
+{"mov", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 4, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"mov", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 4, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"enter", {6, 0, 0, 0}, {0, 0, 0, 0}, {2, 0, 0, 0}, {0x1, 0x0}, 1, -1, 0, 0, 7356},
+{"enter", {6, 6, 0, 0}, {0, 0, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"iretd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"iret", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7359},
+{"iretd", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"shl", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{"rol", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"ror", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 1, 1, 0, 0},
+{"rcl", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 0},
+{"rcr", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 3, 1, 0, 0},
+{"shl", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{"shl", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{"shl", {3, 0, 0, 0}, {4, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 7368},
+{"sal", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 7369},
+{"shl", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{"shl", {3, 0, 0, 0}, {2, 0, 0, 0}, {2, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{"shr", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 5, 1, 0, 0},
+{"sar", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 7, 1, 0, 0},
+{"shl", {3, 1, 0, 0}, {1, 1, 0, 0}, {1, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{"rol", {3, 1, 0, 0}, {3, 1, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"ror", {3, 1, 0, 0}, {3, 1, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 1, 1, 0, 0},
+{"rcl", {3, 1, 0, 0}, {3, 1, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 0},
+{"rcr", {3, 1, 0, 0}, {3, 1, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 3, 1, 0, 0},
+{"shl", {3, 1, 0, 0}, {3, 1, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{"shl", {3, 1, 0, 0}, {2, 1, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{"shl", {3, 1, 0, 0}, {4, 1, 0, 0}, {8, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 7381},
+{"sal", {3, 1, 0, 0}, {3, 1, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 7382},
+{"shl", {3, 1, 0, 0}, {3, 1, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{"shl", {3, 1, 0, 0}, {2, 1, 0, 0}, {2, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{"shr", {3, 1, 0, 0}, {3, 1, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 5, 1, 0, 0},
+{"sar", {3, 1, 0, 0}, {3, 1, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 7, 1, 0, 0},
+{"fcom", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xd1, 0x0}, 1, -1, 0, 0, 0},
+{"fcomp", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xd9, 0x0}, 1, -1, 0, 0, 0},
+{"fxch", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xc9, 0x0}, 1, -1, 0, 0, 0},
+{"fchs", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xe0, 0x0}, 1, -1, 0, 0, 7390},
+{"ftst", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xe4, 0x0}, 1, -1, 0, 0, 7391},
+{"fxam", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xe5, 0x0}, 1, -1, 0, 0, 0},
+{"fldl2e", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xea, 0x0}, 1, -1, 0, 0, 7393},
+{"fldl2t", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xe9, 0x0}, 1, -1, 0, 0, 7394},
+{"fldlg2", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xec, 0x0}, 1, -1, 0, 0, 7395},
+{"fldln2", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xed, 0x0}, 1, -1, 0, 0, 7396},
+{"fldpi", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xeb, 0x0}, 1, -1, 0, 0, 7397},
+{"fldz", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xee, 0x0}, 1, -1, 0, 0, 0},
+{"fdecstp", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf6, 0x0}, 1, -1, 0, 0, 7399},
+{"fincstp", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf7, 0x0}, 1, -1, 0, 0, 7400},
+{"fpatan", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf3, 0x0}, 1, -1, 0, 0, 7401},
+{"fprem1", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf5, 0x0}, 1, -1, 0, 0, 7402},
+{"fptan", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf2, 0x0}, 1, -1, 0, 0, 7403},
+{"fxtract", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf4, 0x0}, 1, -1, 0, 0, 7404},
+{"fyl2x", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf1, 0x0}, 1, -1, 0, 0, 0},
+{"fprem", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf8, 0x0}, 1, -1, 0, 0, 7406},
+{"frndint", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xfc, 0x0}, 1, -1, 0, 0, 7407},
+{"fscale", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xfd, 0x0}, 1, -1, 0, 0, 7408},
+{"fsin", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xfe, 0x0}, 1, -1, 0, 0, 7409},
+{"fsincos", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xfb, 0x0}, 1, -1, 0, 0, 7410},
+{"fsqrt", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xfa, 0x0}, 1, -1, 0, 0, 7411},
+{"fyl2xp1", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf9, 0x0}, 1, -1, 0, 0, 0},
+{"fninit1", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xe3, 0x0}, 1, -1, 0, 0, 0},
+{"fucom", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xe1, 0x0}, 1, -1, 0, 0, 0},
+{"fucomp", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xe9, 0x0}, 1, -1, 0, 0, 0},
+{"faddp", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xc1, 0x0}, 1, -1, 0, 0, 0},
+{"fmulp", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xc9, 0x0}, 1, -1, 0, 0, 0},
+{"fsubrp", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xe1, 0x0}, 1, -1, 0, 0, 0},
+{"fsubp", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xe9, 0x0}, 1, -1, 0, 0, 0},
+{"fdivrp", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf1, 0x0}, 1, -1, 0, 0, 0},
+{"fdivp", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf9, 0x0}, 1, -1, 0, 0, 0},
+{"jrcxz", {8, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"test", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 4, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"not", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 2, 1, 0, 0},
+{"neg", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 3, 1, 0, 0},
+{"mul", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{"imul", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 5, 1, 0, 0},
+{"div", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 6, 1, 0, 0},
+{"idiv", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 7, 1, 0, 0},
+{"inc", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 0, 1, 0, 0},
+{"dec", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 1, 1, 0, 0},
+{"monitor", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xc8, 0x0}, 1, -1, 0, 0, 7432},
+{"mwait", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xc9, 0x0}, 1, -1, 0, 0, 7433},
+{"stac", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xcb, 0x0}, 1, -1, 0, 0, 0},
+{"xgetbv", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xd0, 0x0}, 1, -1, 0, 0, 7435},
+{"xsetbv", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xd1, 0x0}, 1, -1, 0, 0, 7436},
+{"xtest", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xd6, 0x0}, 1, -1, 0, 0, 0},
+{"serialize", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xe8, 0x0}, 1, -1, 0, 0, 7438},
+{"wrpkru", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xef, 0x0}, 1, -1, 0, 0, 0},
+{"swapgs", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf8, 0x0}, 1, -1, 0, 0, 0},
+{"xsusldtrk", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xe8, 0x0}, 1, -1, 0, 0, 0},
+{"setssbsy", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xe8, 0x0}, 1, -1, 0, 0, 7442},
+{"stui", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xef, 0x0}, 1, -1, 0, 0, 7443},
+{"testui", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xed, 0x0}, 1, -1, 0, 0, 7444},
+{"uiret", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xec, 0x0}, 1, -1, 0, 0, 0},
+{"movups", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movups", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movups", {3, 2, 0, 0}, {6, 6, 0, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movlps", {2, 3, 0, 0}, {6, 0, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{"movlps", {3, 2, 0, 0}, {0, 6, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{"unpcklps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"unpckhps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movhps", {2, 3, 0, 0}, {6, 0, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{"movhps", {3, 2, 0, 0}, {0, 6, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{"endbr64", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xfa, 0x0}, 1, -1, 0, 0, 0},
+{"movaps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movaps", {3, 2, 0, 0}, {6, 6, 0, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvtpi2ps", {2, 3, 0, 0}, {6, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvtpi2ps", {2, 3, 0, 0}, {6, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvtpi2ps", {2, 3, 0, 0}, {6, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvtpi2ps", {2, 3, 0, 0}, {6, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvtsi2sd", {2, 3, 0, 0}, {6, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvtsi2ss", {2, 3, 0, 0}, {6, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movntps", {3, 2, 0, 0}, {0, 6, 0, 0}, {16, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{"cvttps2pi", {2, 3, 0, 0}, {5, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvttps2pi", {2, 3, 0, 0}, {5, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvttps2pi", {2, 3, 0, 0}, {5, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvttps2pi", {2, 3, 0, 0}, {5, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvttsd2si", {2, 3, 0, 0}, {3, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvttss2si", {2, 3, 0, 0}, {3, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvtps2pi", {2, 3, 0, 0}, {5, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvtps2pi", {2, 3, 0, 0}, {5, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvtps2pi", {2, 3, 0, 0}, {5, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvtps2pi", {2, 3, 0, 0}, {5, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvtsd2si", {2, 3, 0, 0}, {3, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvtss2si", {2, 3, 0, 0}, {3, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"ucomiss", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"comiss", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovo", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovno", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovc", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7481},
+{"cmovnae", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovc", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7483},
+{"cmovnae", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovc", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7485},
+{"cmovnae", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7486},
+{"cmovb", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7487},
+{"cmovc", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7488},
+{"cmovnae", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovc", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7490},
+{"cmovnae", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovnb", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7492},
+{"cmovnc", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovnb", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7494},
+{"cmovnc", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovnb", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7496},
+{"cmovnc", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7497},
+{"cmovae", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7498},
+{"cmovnb", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7499},
+{"cmovnc", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovnb", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7501},
+{"cmovnc", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovz", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovz", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovz", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7505},
+{"cmove", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7506},
+{"cmovz", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovz", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovnz", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovnz", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovnz", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7511},
+{"cmovne", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7512},
+{"cmovnz", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovnz", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovna", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovna", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovna", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7517},
+{"cmovbe", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7518},
+{"cmovna", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovna", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovnbe", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovnbe", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovnbe", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7523},
+{"cmova", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7524},
+{"cmovnbe", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovnbe", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovs", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovns", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovpe", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovpe", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovpe", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7531},
+{"cmovp", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7532},
+{"cmovpe", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovpe", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovpo", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovpo", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovpo", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7537},
+{"cmovnp", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7538},
+{"cmovpo", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovpo", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovnge", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovnge", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovnge", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7543},
+{"cmovl", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7544},
+{"cmovnge", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovnge", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovnl", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovnl", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovnl", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7549},
+{"cmovge", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7550},
+{"cmovnl", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovnl", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovng", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovng", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovng", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7555},
+{"cmovle", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7556},
+{"cmovng", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovng", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovnle", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovnle", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovnle", {2, 3, 0, 0}, {4, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7561},
+{"cmovg", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7562},
+{"cmovnle", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmovnle", {2, 3, 0, 0}, {2, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movmskps", {2, 3, 0, 0}, {3, 6, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{"sqrtps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"andps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"andnps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"orps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"xorps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"addps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"mulps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cvtps2pd", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"subps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"minps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"divps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"maxps", {2, 3, 0, 0}, {6, 6, 0, 0}, {0, 16, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"punpcklbw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"punpcklwd", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"punpckldq", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"packsswb", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pcmpgtb", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pcmpgtw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pcmpgtd", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"packuswb", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"punpckhbw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"punpckhwd", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"punpckhdq", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"packssdw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movd", {2, 3, 0, 0}, {5, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movd", {2, 3, 0, 0}, {5, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movd", {2, 3, 0, 0}, {6, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7592},
+{"movq", {2, 3, 0, 0}, {5, 4, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7593},
+{"movd", {2, 3, 0, 0}, {5, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movd", {2, 3, 0, 0}, {6, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movq", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pshufw", {2, 3, 6, 0}, {5, 5, 0, 0}, {0, 8, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psrlw", {3, 6, 0, 0}, {5, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, 2, 5, 0, 0},
+{"psraw", {3, 6, 0, 0}, {5, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, 4, 5, 0, 0},
+{"psllw", {3, 6, 0, 0}, {5, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, 6, 5, 0, 0},
+{"psrld", {3, 6, 0, 0}, {5, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, 2, 5, 0, 0},
+{"psrad", {3, 6, 0, 0}, {5, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, 4, 5, 0, 0},
+{"pslld", {3, 6, 0, 0}, {5, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, 6, 5, 0, 0},
+{"psrlq", {3, 6, 0, 0}, {5, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, 2, 5, 0, 0},
+{"psllq", {3, 6, 0, 0}, {5, 0, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, 6, 5, 0, 0},
+{"pcmpeqb", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pcmpeqw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pcmpeqd", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movd", {3, 2, 0, 0}, {3, 5, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movd", {3, 2, 0, 0}, {3, 5, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movd", {3, 2, 0, 0}, {3, 6, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7611},
+{"movq", {3, 2, 0, 0}, {4, 5, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7612},
+{"movd", {3, 2, 0, 0}, {3, 5, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movd", {3, 2, 0, 0}, {3, 6, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movq", {3, 2, 0, 0}, {5, 5, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"jc", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7616},
+{"jnae", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"jnb", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 7618},
+{"jnc", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"jz", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"jnz", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"jna", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"jnbe", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"jpe", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"jpo", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"jnge", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"jnl", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"jng", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"jnle", {8, 0, 0, 0}, {0, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 0, 0},
+{"setc", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7630},
+{"setnae", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"setnb", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 7632},
+{"setnc", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"setz", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"setnz", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"setna", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"setnbe", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"setpe", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"setpo", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"setnge", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"setnl", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"setng", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"setnle", {3, 0, 0, 0}, {1, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"bt", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"shld", {3, 2, 6, 0}, {3, 3, 0, 0}, {4, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 8, 0},
+{"shld", {3, 2, 1, 0}, {3, 3, 1, 0}, {4, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"bts", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"shrd", {3, 2, 6, 0}, {3, 3, 0, 0}, {4, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 8, 0},
+{"shrd", {3, 2, 1, 0}, {3, 3, 1, 0}, {4, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"mfence", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf0, 0x0}, 1, -1, 0, 0, 0},
+{"mfence", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf0, 0x0}, 1, -1, 0, 0, 0},
+{"mfence", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf0, 0x0}, 1, -1, 0, 0, 0},
+{"mfence", {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0xf0, 0x0}, 1, -1, 0, 0, 0},
+{"clflush", {3, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 7, 3, 0, 0},
+{"clflush", {3, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 7, 3, 0, 0},
+{"clflush", {3, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 7, 3, 0, 0},
+{"clflush", {3, 0, 0, 0}, {0, 0, 0, 0}, {1, 0, 0, 0}, {0x0, 0x0}, 0, 7, 3, 0, 0},
+{"rdfsbase", {3, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 0, 5, 0, 0},
+{"rdgsbase", {3, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 1, 5, 0, 0},
+{"wrfsbase", {3, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 2, 5, 0, 0},
+{"wrgsbase", {3, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 3, 5, 0, 0},
+{"ptwrite", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{"ptwrite", {3, 0, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, 4, 1, 0, 0},
+{"incsspd", {3, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 5, 5, 0, 0},
+{"imul", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmpxchg", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"btr", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movzx", {2, 3, 0, 0}, {3, 1, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movzx", {2, 3, 0, 0}, {3, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"popcnt", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"bt", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 4, 1, 8, 0},
+{"bts", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 5, 1, 8, 0},
+{"btr", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 6, 1, 8, 0},
+{"btc", {3, 6, 0, 0}, {3, 0, 0, 0}, {4, 1, 0, 0}, {0x0, 0x0}, 0, 7, 1, 8, 0},
+{"btc", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"bsf", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"tzcnt", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"bsr", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"lzcnt", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movsx", {2, 3, 0, 0}, {3, 1, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movsx", {2, 3, 0, 0}, {3, 2, 0, 0}, {0, 2, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"xadd", {3, 2, 0, 0}, {3, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmpps", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movnti", {3, 2, 0, 0}, {0, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{"pextrw", {2, 3, 6, 0}, {3, 5, 0, 0}, {0, 0, 1, 0}, {0x0, 0x0}, 0, -1, 5, 8, 0},
+{"shufps", {2, 3, 6, 0}, {6, 6, 0, 0}, {0, 16, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"cmpxchg8b", {3, 0, 0, 0}, {0, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 1, 3, 0, 0},
+{"cmpxchg8b", {3, 0, 0, 0}, {0, 0, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, 1, 3, 0, 0},
+{"rdrand", {3, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 6, 5, 0, 0},
+{"rdseed", {3, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, 7, 5, 0, 0},
+{"bswap", {4, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"bswap", {4, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"bswap", {4, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"bswap", {4, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"bswap", {4, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"bswap", {4, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"bswap", {4, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"bswap", {4, 0, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 0, 4, 0},
+{"psrlw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psrld", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psrlq", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"paddq", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pmullw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pmovmskb", {2, 3, 0, 0}, {3, 5, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{"psubusb", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psubusw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pminub", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pand", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"paddusb", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"paddusw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pmaxub", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pandn", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psraw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psrad", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pavgw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pmulhuw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pmulhw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movntq", {3, 2, 0, 0}, {0, 5, 0, 0}, {8, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{"psubsb", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psubsw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pminsw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"por", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"paddsb", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"paddsw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pmaxsw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pxor", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psllw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pslld", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psllq", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pmuludq", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pmaddwd", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psadbw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"maskmovq", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 0, 0, 0}, {0x0, 0x0}, 0, -1, 5, 0, 0},
+{"psubb", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psubw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psubd", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psubq", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"paddb", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"paddw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"paddd", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pshufb", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"phaddw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"phaddd", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"phaddsw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pmaddubsw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"phsubw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"phsubd", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"phsubsw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psignb", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psignw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"psignd", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pmulhrsw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pabsb", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pabsw", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pabsd", {2, 3, 0, 0}, {5, 5, 0, 0}, {0, 8, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movbe", {2, 3, 0, 0}, {3, 0, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{"crc32", {2, 3, 0, 0}, {3, 1, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"crc32", {2, 3, 0, 0}, {3, 1, 0, 0}, {0, 1, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movbe", {3, 2, 0, 0}, {0, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{"crc32", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"crc32", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"adcx", {2, 3, 0, 0}, {3, 3, 0, 0}, {0, 4, 0, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"movdiri", {3, 2, 0, 0}, {0, 3, 0, 0}, {4, 0, 0, 0}, {0x0, 0x0}, 0, -1, 3, 0, 0},
+{"palignr", {2, 3, 6, 0}, {5, 5, 0, 0}, {0, 8, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+{"pextrd", {3, 2, 6, 0}, {3, 6, 0, 0}, {4, 0, 1, 0}, {0x0, 0x0}, 0, -1, 1, 8, 0},
+{"pinsrd", {2, 3, 6, 0}, {6, 3, 0, 0}, {0, 4, 1, 0}, {0x0, 0x0}, 0, -1, 1, 0, 0},
+};
+
+static const DecodeKey DECODE_KEYS[] = {
+    {1, 1, 0x50, 0, 0x0}, {3, 4, 0x50, 0, 0x3}, {11, 1, 0x50, 0, 0x0}, {13, 4, 0x50, 0, 0x3},
+    {21, 1, 0x50, 0, 0x0}, {23, 4, 0x50, 0, 0x3}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {31, 1, 0x50, 0, 0x0}, {33, 4, 0x50, 0, 0x3}, {41, 1, 0x50, 0, 0x0}, {43, 4, 0x50, 0, 0x3},
+    {51, 1, 0x50, 0, 0x0}, {53, 4, 0x50, 0, 0x3}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {61, 1, 0x50, 0, 0x0}, {63, 4, 0x50, 0, 0x3}, {71, 1, 0x50, 0, 0x0}, {73, 4, 0x50, 0, 0x3},
+    {81, 1, 0x50, 0, 0x0}, {83, 4, 0x50, 0, 0x3}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {91, 1, 0x50, 0, 0x0}, {93, 4, 0x50, 0, 0x3}, {101, 1, 0x50, 0, 0x0}, {103, 4, 0x50, 0, 0x3},
+    {111, 1, 0x50, 0, 0x0}, {113, 4, 0x50, 0, 0x3}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {121, 1, 0x50, 0, 0x0}, {123, 4, 0x50, 0, 0x3}, {131, 1, 0x50, 0, 0x0}, {133, 4, 0x50, 0, 0x3},
+    {141, 1, 0x50, 0, 0x0}, {143, 4, 0x50, 0, 0x3}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {151, 1, 0x50, 0, 0x0}, {153, 4, 0x50, 0, 0x3}, {161, 1, 0x50, 0, 0x0}, {163, 4, 0x50, 0, 0x3},
+    {171, 1, 0x50, 0, 0x0}, {173, 4, 0x50, 0, 0x3}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {181, 1, 0x50, 0, 0x0}, {183, 4, 0x50, 0, 0x3}, {191, 1, 0x50, 0, 0x0}, {193, 4, 0x50, 0, 0x3},
+    {201, 1, 0x50, 0, 0x0}, {203, 4, 0x50, 0, 0x3}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {211, 1, 0x50, 0, 0x0}, {213, 4, 0x50, 0, 0x3}, {221, 1, 0x50, 0, 0x0}, {223, 4, 0x50, 0, 0x3},
+    {231, 1, 0x50, 0, 0x0}, {233, 4, 0x50, 0, 0x3}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {241, 2, 0x50, 0, 0x1}, {245, 2, 0x50, 0, 0x1}, {249, 2, 0x50, 0, 0x1}, {253, 2, 0x50, 0, 0x1},
+    {257, 2, 0x50, 0, 0x1}, {261, 2, 0x50, 0, 0x1}, {265, 2, 0x50, 0, 0x1}, {269, 2, 0x50, 0, 0x1},
+    {273, 2, 0x50, 0, 0x1}, {277, 2, 0x50, 0, 0x1}, {281, 2, 0x50, 0, 0x1}, {285, 2, 0x50, 0, 0x1},
+    {289, 2, 0x50, 0, 0x1}, {293, 2, 0x50, 0, 0x1}, {297, 2, 0x50, 0, 0x1}, {301, 2, 0x50, 0, 0x1},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {305, 4, 0x50, 0, 0x3},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {313, 1, 0x50, 0, 0x0}, {315, 4, 0x50, 0, 0x3}, {323, 1, 0x50, 0, 0x0}, {325, 4, 0x50, 0, 0x3},
+    {333, 1, 0x50, 0, 0x0}, {335, 2, 0xe4, 0, 0x1}, {343, 2, 0x90, 0, 0x2}, {349, 4, 0xe4, 0, 0x3},
+    {365, 1, 0x50, 0, 0x0}, {367, 1, 0x50, 0, 0x0}, {369, 1, 0x50, 0, 0x0}, {371, 1, 0x50, 0, 0x0},
+    {373, 1, 0x50, 0, 0x0}, {375, 1, 0x50, 0, 0x0}, {377, 1, 0x50, 0, 0x0}, {379, 1, 0x50, 0, 0x0},
+    {381, 1, 0x50, 0, 0x0}, {383, 1, 0x50, 0, 0x0}, {385, 1, 0x50, 0, 0x0}, {387, 1, 0x50, 0, 0x0},
+    {389, 1, 0x50, 0, 0x0}, {391, 1, 0x50, 0, 0x0}, {393, 1, 0x50, 0, 0x0}, {395, 1, 0x50, 0, 0x0},
+    {397, 8, 0x50, 1, 0x0}, {413, 32, 0x50, 4, 0x3}, {0, 0, 0x0, 0, 0x0}, {477, 32, 0x50, 4, 0x3},
+    {541, 1, 0x50, 0, 0x0}, {543, 4, 0x50, 0, 0x3}, {551, 1, 0x50, 0, 0x0}, {553, 4, 0x50, 0, 0x3},
+    {561, 1, 0x50, 0, 0x0}, {563, 4, 0x50, 0, 0x3}, {571, 1, 0x50, 0, 0x0}, {573, 4, 0x50, 0, 0x3},
+    {0, 0, 0x0, 0, 0x0}, {581, 8, 0x50, 0, 0xb}, {0, 0, 0x0, 0, 0x0}, {597, 16, 0x50, 2, 0x1},
+    {629, 8, 0x90, 0, 0x13}, {653, 4, 0x50, 0, 0x3}, {661, 4, 0x50, 0, 0x3}, {669, 4, 0x50, 0, 0x3},
+    {677, 4, 0x50, 0, 0x3}, {685, 4, 0x50, 0, 0x3}, {693, 4, 0x50, 0, 0x3}, {701, 4, 0x50, 0, 0x3},
+    {709, 2, 0xa4, 0, 0x2}, {715, 2, 0xa4, 0, 0x2}, {0, 0, 0x0, 0, 0x0}, {721, 16, 0x50, 2, 0x8},
+    {753, 1, 0x50, 0, 0x0}, {755, 1, 0x50, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {757, 1, 0x50, 0, 0x0}, {759, 2, 0xa4, 0, 0x2}, {765, 1, 0x50, 0, 0x0}, {767, 2, 0xa4, 0, 0x2},
+    {773, 1, 0x50, 0, 0x0}, {775, 4, 0x50, 0, 0x3}, {783, 1, 0x50, 0, 0x0}, {785, 2, 0xa4, 0, 0x2},
+    {791, 2, 0x90, 0, 0x2}, {797, 4, 0xe4, 0, 0x3}, {813, 1, 0x50, 0, 0x0}, {815, 2, 0xa4, 0, 0x2},
+    {821, 1, 0x50, 0, 0x0}, {823, 1, 0x50, 0, 0x0}, {825, 1, 0x50, 0, 0x0}, {827, 1, 0x50, 0, 0x0},
+    {829, 1, 0x50, 0, 0x0}, {831, 1, 0x50, 0, 0x0}, {833, 1, 0x50, 0, 0x0}, {835, 1, 0x50, 0, 0x0},
+    {837, 4, 0x50, 0, 0x3}, {845, 4, 0x50, 0, 0x3}, {853, 4, 0x50, 0, 0x3}, {861, 4, 0x50, 0, 0x3},
+    {869, 4, 0x50, 0, 0x3}, {877, 4, 0x50, 0, 0x3}, {885, 4, 0x50, 0, 0x3}, {893, 4, 0x50, 0, 0x3},
+    {901, 8, 0x50, 1, 0x0}, {917, 32, 0x50, 4, 0x3}, {981, 1, 0x50, 0, 0x0}, {983, 1, 0x50, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {985, 16, 0x50, 2, 0x8}, {1017, 64, 0x50, 8, 0xb},
+    {1145, 16, 0x50, 2, 0x8}, {1177, 1, 0x50, 0, 0x0}, {1179, 1, 0x50, 0, 0x0}, {1181, 1, 0x50, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {1183, 2, 0x50, 0, 0x2},
+    {1187, 8, 0x50, 1, 0x0}, {1203, 32, 0x50, 4, 0x3}, {1267, 8, 0x50, 1, 0x0}, {1283, 32, 0x50, 4, 0x3},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {1347, 2, 0x50, 0, 0x2},
+    {1351, 16, 0x50, 2, 0x8}, {1383, 16, 0x50, 2, 0x8}, {1415, 16, 0x50, 2, 0x8}, {1447, 16, 0x50, 2, 0x8},
+    {1479, 16, 0x50, 2, 0x8}, {1511, 16, 0x50, 2, 0x8}, {1543, 16, 0x50, 2, 0x8}, {1575, 16, 0x50, 2, 0x8},
+    {1607, 1, 0x50, 0, 0x0}, {1609, 1, 0x50, 0, 0x0}, {1611, 1, 0x50, 0, 0x0}, {1613, 1, 0x50, 0, 0x0},
+    {1615, 1, 0x50, 0, 0x0}, {1617, 2, 0x50, 0, 0x1}, {1621, 1, 0x50, 0, 0x0}, {1623, 2, 0x50, 0, 0x1},
+    {1627, 1, 0x50, 0, 0x0}, {1629, 1, 0x50, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {1631, 1, 0x50, 0, 0x0},
+    {1633, 1, 0x50, 0, 0x0}, {1635, 2, 0x50, 0, 0x1}, {1639, 1, 0x50, 0, 0x0}, {1641, 2, 0x50, 0, 0x1},
+    {1645, 1, 0x50, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {1647, 1, 0x50, 0, 0x0}, {1649, 1, 0x50, 0, 0x0}, {1651, 8, 0x50, 1, 0x0}, {1667, 32, 0x50, 4, 0x3},
+    {1731, 1, 0x50, 0, 0x0}, {1733, 1, 0x50, 0, 0x0}, {1735, 1, 0x50, 0, 0x0}, {1737, 1, 0x50, 0, 0x0},
+    {1739, 1, 0x50, 0, 0x0}, {1741, 1, 0x50, 0, 0x0}, {1743, 8, 0x50, 1, 0x0}, {1759, 32, 0x50, 4, 0x3},
+    {1823, 8, 0x50, 1, 0x0}, {1839, 16, 0x90, 2, 0x8}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {1887, 1, 0x50, 0, 0x0}, {1889, 1, 0x50, 0, 0x0}, {1891, 2, 0x50, 0, 0x2},
+    {1895, 1, 0x50, 0, 0x0}, {1897, 1, 0x90, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {1900, 1, 0x50, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {1902, 16, 0x50, 2, 0x8}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {1934, 2, 0xe4, 0, 0x8}, {1942, 1, 0xe4, 0, 0x0}, {1946, 2, 0xe4, 0, 0x8}, {1954, 2, 0xa4, 0, 0x8},
+    {1960, 1, 0xa4, 0, 0x0}, {1963, 1, 0xa4, 0, 0x0}, {1966, 2, 0xe4, 0, 0x8}, {1974, 2, 0xa4, 0, 0x8},
+    {1980, 16, 0x50, 2, 0x8}, {0, 0, 0x0, 0, 0x0}, {2012, 2, 0x90, 0, 0x1}, {2018, 4, 0x90, 0, 0x9},
+    {2030, 16, 0x50, 2, 0x8}, {0, 0, 0x0, 0, 0x0}, {2062, 16, 0x40, 2, 0x8}, {2094, 16, 0x50, 2, 0x1},
+    {0, 0, 0x0, 0, 0x0}, {2126, 2, 0x50, 0, 0x1}, {0, 0, 0x0, 0, 0x0}, {2130, 4, 0x50, 0, 0x9},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {2138, 1, 0xa4, 0, 0x0}, {2141, 1, 0xa4, 0, 0x0}, {2144, 4, 0xe4, 0, 0x3}, {2160, 2, 0xa4, 0, 0x8},
+    {2166, 4, 0xe4, 0, 0x3}, {2182, 4, 0xe4, 0, 0x3}, {2198, 1, 0xa4, 0, 0x0}, {2201, 1, 0xa4, 0, 0x0},
+    {2204, 1, 0x50, 0, 0x0}, {2206, 1, 0x50, 0, 0x0}, {2208, 1, 0x50, 0, 0x0}, {2210, 1, 0x50, 0, 0x0},
+    {2212, 1, 0x50, 0, 0x0}, {2214, 2, 0x50, 0, 0x2}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {2218, 4, 0x50, 0, 0x3}, {2226, 4, 0x50, 0, 0x3}, {2234, 4, 0x50, 0, 0x3}, {2242, 4, 0x50, 0, 0x3},
+    {2250, 4, 0x50, 0, 0x3}, {2258, 4, 0x50, 0, 0x3}, {2266, 4, 0x50, 0, 0x3}, {2274, 4, 0x50, 0, 0x3},
+    {2282, 4, 0x50, 0, 0x3}, {2290, 4, 0x50, 0, 0x3}, {2298, 4, 0x50, 0, 0x3}, {2306, 4, 0x50, 0, 0x3},
+    {2314, 4, 0x50, 0, 0x3}, {2322, 4, 0x50, 0, 0x3}, {2330, 4, 0x50, 0, 0x3}, {2338, 4, 0x50, 0, 0x3},
+    {2346, 2, 0xa4, 0, 0x8}, {2352, 1, 0xe4, 0, 0x0}, {2356, 1, 0x90, 0, 0x0}, {2359, 1, 0x90, 0, 0x0},
+    {2362, 1, 0xa4, 0, 0x0}, {2365, 1, 0xa4, 0, 0x0}, {2368, 1, 0xa4, 0, 0x0}, {2371, 1, 0xa4, 0, 0x0},
+    {2374, 1, 0xe4, 0, 0x0}, {2378, 1, 0xe4, 0, 0x0}, {2382, 1, 0xe4, 0, 0x0}, {2386, 1, 0x84, 0, 0x0},
+    {2389, 1, 0xe4, 0, 0x0}, {2393, 1, 0xe4, 0, 0x0}, {2397, 1, 0xe4, 0, 0x0}, {2401, 1, 0xe4, 0, 0x0},
+    {2405, 1, 0xa4, 0, 0x0}, {2408, 1, 0xa4, 0, 0x0}, {2411, 1, 0xa4, 0, 0x0}, {2414, 1, 0xa4, 0, 0x0},
+    {2417, 1, 0xa4, 0, 0x0}, {2420, 1, 0xa4, 0, 0x0}, {2423, 1, 0xa4, 0, 0x0}, {2426, 1, 0xa4, 0, 0x0},
+    {2429, 1, 0xa4, 0, 0x0}, {2432, 1, 0xa4, 0, 0x0}, {2435, 1, 0xa4, 0, 0x0}, {2438, 1, 0xa4, 0, 0x0},
+    {2441, 1, 0x4, 0, 0x0}, {2443, 1, 0x4, 0, 0x0}, {2445, 4, 0xa4, 0, 0x3}, {2457, 1, 0xe4, 0, 0x0},
+    {2461, 1, 0xe4, 0, 0x0}, {2465, 16, 0xa4, 2, 0x8}, {2513, 16, 0xa4, 2, 0x8}, {2561, 16, 0xa4, 2, 0x8},
+    {2609, 1, 0xa4, 0, 0x0}, {2612, 1, 0xa4, 0, 0x0}, {2615, 1, 0xa4, 0, 0x0}, {2618, 1, 0x50, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {2620, 1, 0x24, 0, 0x0}, {2623, 1, 0x24, 0, 0x0}, {2626, 4, 0xe4, 0, 0x3}, {2642, 1, 0xe4, 0, 0x0},
+    {2646, 1, 0x50, 0, 0x0}, {2648, 1, 0x50, 0, 0x0}, {2650, 1, 0x50, 0, 0x0}, {2652, 1, 0x50, 0, 0x0},
+    {2654, 1, 0x50, 0, 0x0}, {2656, 1, 0x50, 0, 0x0}, {2658, 1, 0x50, 0, 0x0}, {2660, 1, 0x50, 0, 0x0},
+    {2662, 1, 0x50, 0, 0x0}, {2664, 1, 0x50, 0, 0x0}, {2666, 1, 0x50, 0, 0x0}, {2668, 1, 0x50, 0, 0x0},
+    {2670, 1, 0x50, 0, 0x0}, {2672, 1, 0x50, 0, 0x0}, {2674, 1, 0x50, 0, 0x0}, {2676, 1, 0x50, 0, 0x0},
+    {2678, 1, 0x50, 0, 0x0}, {2680, 1, 0x50, 0, 0x0}, {2682, 1, 0x50, 0, 0x0}, {2684, 1, 0x50, 0, 0x0},
+    {2686, 1, 0x50, 0, 0x0}, {2688, 1, 0x50, 0, 0x0}, {2690, 1, 0x50, 0, 0x0}, {2692, 1, 0x50, 0, 0x0},
+    {2694, 1, 0x50, 0, 0x0}, {2696, 1, 0x50, 0, 0x0}, {2698, 1, 0x50, 0, 0x0}, {2700, 1, 0x50, 0, 0x0},
+    {2702, 1, 0x50, 0, 0x0}, {2704, 1, 0x50, 0, 0x0}, {2706, 1, 0x50, 0, 0x0}, {2708, 1, 0x50, 0, 0x0},
+    {2710, 1, 0x50, 0, 0x0}, {2712, 1, 0x50, 0, 0x0}, {2714, 1, 0x50, 0, 0x0}, {2716, 4, 0x50, 0, 0x3},
+    {2724, 4, 0x50, 0, 0x3}, {2732, 4, 0x50, 0, 0x3}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {2740, 1, 0x50, 0, 0x0}, {2742, 1, 0x50, 0, 0x0}, {2744, 1, 0x50, 0, 0x0}, {2746, 4, 0x50, 0, 0x3},
+    {2754, 4, 0x50, 0, 0x3}, {2762, 4, 0x50, 0, 0x3}, {2770, 64, 0xe4, 8, 0xb}, {3026, 4, 0x50, 0, 0x3},
+    {3034, 1, 0x50, 0, 0x0}, {3036, 4, 0x50, 0, 0x3}, {0, 0, 0x0, 0, 0x0}, {3044, 4, 0x50, 0, 0x3},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {3052, 4, 0x50, 0, 0x3}, {3060, 2, 0x50, 0, 0x2},
+    {3064, 4, 0x40, 0, 0x3}, {3072, 2, 0x50, 0, 0x1}, {3076, 32, 0x50, 4, 0x3}, {3140, 4, 0x50, 0, 0x3},
+    {3148, 4, 0x90, 0, 0x3}, {3160, 4, 0x90, 0, 0x3}, {3172, 4, 0x50, 0, 0x3}, {3180, 2, 0x50, 0, 0x2},
+    {3184, 1, 0x50, 0, 0x0}, {3186, 4, 0x50, 0, 0x3}, {3194, 1, 0xe4, 0, 0x0}, {3198, 8, 0x50, 0, 0xb},
+    {0, 0, 0x0, 0, 0x0}, {3214, 2, 0xa4, 0, 0x8}, {3220, 1, 0xa4, 0, 0x0}, {3223, 64, 0x90, 8, 0xb},
+    {3415, 4, 0x50, 0, 0x3}, {3423, 4, 0x50, 0, 0x3}, {3431, 4, 0x50, 0, 0x3}, {3439, 4, 0x50, 0, 0x3},
+    {3447, 4, 0x50, 0, 0x3}, {3455, 4, 0x50, 0, 0x3}, {3463, 4, 0x50, 0, 0x3}, {3471, 4, 0x50, 0, 0x3},
+    {3479, 1, 0x24, 0, 0x0}, {3482, 1, 0xa4, 0, 0x0}, {3485, 1, 0xa4, 0, 0x0}, {3488, 1, 0xa4, 0, 0x0},
+    {3491, 1, 0xa4, 0, 0x0}, {3494, 1, 0xa4, 0, 0x0}, {3497, 2, 0xe4, 0, 0x8}, {3505, 2, 0xa4, 0, 0x8},
+    {3511, 1, 0xa4, 0, 0x0}, {3514, 1, 0xa4, 0, 0x0}, {3517, 1, 0xa4, 0, 0x0}, {3520, 1, 0xa4, 0, 0x0},
+    {3523, 1, 0xa4, 0, 0x0}, {3526, 1, 0xa4, 0, 0x0}, {3529, 1, 0xa4, 0, 0x0}, {3532, 1, 0xa4, 0, 0x0},
+    {3535, 1, 0x50, 0, 0x0}, {3537, 1, 0xa4, 0, 0x0}, {3540, 1, 0xa4, 0, 0x0}, {3543, 1, 0xa4, 0, 0x0},
+    {3546, 1, 0xa4, 0, 0x0}, {3549, 1, 0xa4, 0, 0x0}, {3552, 1, 0x84, 0, 0x0}, {3555, 2, 0xa4, 0, 0x8},
+    {3561, 1, 0xa4, 0, 0x0}, {3564, 1, 0xa4, 0, 0x0}, {3567, 1, 0xa4, 0, 0x0}, {3570, 1, 0xa4, 0, 0x0},
+    {3573, 1, 0xa4, 0, 0x0}, {3576, 1, 0xa4, 0, 0x0}, {3579, 1, 0xa4, 0, 0x0}, {3582, 1, 0xa4, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {3585, 1, 0xa4, 0, 0x0}, {3588, 1, 0xa4, 0, 0x0}, {3591, 1, 0xa4, 0, 0x0},
+    {3594, 1, 0xa4, 0, 0x0}, {3597, 1, 0xa4, 0, 0x0}, {3600, 1, 0xa4, 0, 0x0}, {3603, 2, 0xa4, 0, 0x8},
+    {3609, 1, 0xa4, 0, 0x0}, {3612, 1, 0xa4, 0, 0x0}, {3615, 1, 0xa4, 0, 0x0}, {3618, 1, 0xa4, 0, 0x0},
+    {3621, 1, 0xa4, 0, 0x0}, {3624, 1, 0xa4, 0, 0x0}, {3627, 1, 0xa4, 0, 0x0}, {3630, 2, 0x50, 0, 0x1},
+    {3634, 1, 0xa4, 0, 0x0}, {3637, 1, 0xa4, 0, 0x0}, {3640, 1, 0xa4, 0, 0x0}, {3643, 1, 0xa4, 0, 0x0},
+    {3646, 1, 0xa4, 0, 0x0}, {3649, 1, 0xa4, 0, 0x0}, {3652, 1, 0xa4, 0, 0x0}, {3655, 1, 0xa4, 0, 0x0},
+    {3658, 1, 0xa4, 0, 0x0}, {3661, 1, 0xa4, 0, 0x0}, {3664, 1, 0xa4, 0, 0x0}, {3667, 1, 0xa4, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {3670, 1, 0x4, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {3672, 1, 0x4, 0, 0x0}, {3674, 1, 0x4, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {3676, 1, 0x4, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {3678, 1, 0xa4, 0, 0x0}, {3681, 1, 0xa4, 0, 0x0}, {3684, 1, 0xa4, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {3687, 1, 0x4, 0, 0x0}, {3689, 1, 0x4, 0, 0x0}, {3691, 1, 0x4, 0, 0x0}, {3693, 1, 0x4, 0, 0x0},
+    {3695, 1, 0x4, 0, 0x0}, {3697, 1, 0x4, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {3699, 1, 0x4, 0, 0x0}, {3701, 1, 0x4, 0, 0x0}, {3703, 2, 0x4, 0, 0x8}, {3707, 1, 0x4, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {3709, 1, 0x4, 0, 0x0}, {3711, 1, 0x4, 0, 0x0}, {3713, 1, 0x4, 0, 0x0}, {3715, 1, 0x4, 0, 0x0},
+    {3717, 1, 0x4, 0, 0x0}, {3719, 1, 0x4, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {3721, 1, 0x4, 0, 0x0},
+    {3723, 1, 0x4, 0, 0x0}, {3725, 1, 0x4, 0, 0x0}, {3727, 1, 0x4, 0, 0x0}, {3729, 1, 0x4, 0, 0x0},
+    {3731, 1, 0x4, 0, 0x0}, {3733, 1, 0x4, 0, 0x0}, {3735, 1, 0x4, 0, 0x0}, {3737, 1, 0x4, 0, 0x0},
+    {3739, 1, 0x4, 0, 0x0}, {3741, 1, 0x4, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {3743, 2, 0x4, 0, 0x8}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {3747, 1, 0x50, 0, 0x0}, {3749, 1, 0x50, 0, 0x0}, {3751, 1, 0x50, 0, 0x0}, {3753, 1, 0x50, 0, 0x0},
+    {3755, 1, 0x50, 0, 0x0}, {3757, 1, 0x50, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {3759, 1, 0x4, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {3761, 1, 0x4, 0, 0x0},
+    {3763, 1, 0x4, 0, 0x0}, {3765, 1, 0x4, 0, 0x0}, {3767, 1, 0x4, 0, 0x0}, {3769, 1, 0x4, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {3771, 8, 0x90, 0, 0xb}, {3795, 8, 0x90, 0, 0xb}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {3819, 2, 0x4, 0, 0x2}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {3823, 8, 0x50, 0, 0xb}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {3839, 1, 0x4, 0, 0x0}, {3841, 1, 0x4, 0, 0x0}, {3843, 1, 0x4, 0, 0x0},
+    {3845, 1, 0x4, 0, 0x0}, {3847, 1, 0x4, 0, 0x0}, {3849, 1, 0x4, 0, 0x0}, {3851, 1, 0xa4, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {3854, 2, 0x4, 0, 0x2}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {3858, 1, 0x4, 0, 0x0}, {3860, 2, 0x4, 0, 0x2}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {3864, 1, 0x4, 0, 0x0}, {3866, 1, 0x4, 0, 0x0}, {3868, 1, 0x4, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {3870, 1, 0x4, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {3872, 1, 0x4, 0, 0x0}, {3874, 1, 0x4, 0, 0x0}, {3876, 1, 0x4, 0, 0x0}, {3878, 1, 0x4, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {3880, 1, 0x50, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {3882, 1, 0x4, 0, 0x0}, {3884, 1, 0x4, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {3886, 1, 0x4, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {3888, 16, 0x40, 2, 0x8}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {3920, 8, 0xe4, 0, 0xe}, {3952, 8, 0xe4, 0, 0xe}, {3984, 8, 0xe4, 0, 0xe}, {4016, 8, 0xa4, 0, 0xe},
+    {4040, 4, 0xa4, 0, 0x6}, {4052, 4, 0xa4, 0, 0x6}, {4064, 8, 0xe4, 0, 0xe}, {4096, 8, 0xa4, 0, 0xe},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {4120, 4, 0xa4, 0, 0x6}, {4132, 4, 0xa4, 0, 0x6}, {4144, 4, 0x90, 0, 0x6}, {4156, 8, 0xa4, 0, 0xe},
+    {4180, 4, 0x90, 0, 0x6}, {4192, 4, 0x90, 0, 0x6}, {4204, 4, 0xa4, 0, 0x6}, {4216, 4, 0xa4, 0, 0x6},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {4228, 8, 0xa4, 0, 0xe}, {4252, 4, 0xe4, 0, 0x6}, {4268, 4, 0x64, 0, 0x6}, {4280, 4, 0x64, 0, 0x6},
+    {4292, 4, 0xa4, 0, 0x6}, {4304, 4, 0xa4, 0, 0x6}, {4316, 4, 0xa4, 0, 0x6}, {4328, 4, 0xa4, 0, 0x6},
+    {4340, 4, 0xe4, 0, 0x6}, {4356, 4, 0xe4, 0, 0x6}, {4372, 4, 0xe4, 0, 0x6}, {4388, 4, 0x24, 0, 0x6},
+    {4400, 4, 0xe4, 0, 0x6}, {4416, 4, 0xe4, 0, 0x6}, {4432, 4, 0xe4, 0, 0x6}, {4448, 4, 0xe4, 0, 0x6},
+    {4464, 4, 0x4, 0, 0x6}, {4472, 4, 0x4, 0, 0x6}, {4480, 4, 0x4, 0, 0x6}, {4488, 4, 0x4, 0, 0x6},
+    {4496, 4, 0x4, 0, 0x6}, {4504, 4, 0x4, 0, 0x6}, {4512, 4, 0x4, 0, 0x6}, {4520, 4, 0x4, 0, 0x6},
+    {4528, 4, 0x4, 0, 0x6}, {4536, 4, 0x4, 0, 0x6}, {4544, 4, 0x4, 0, 0x6}, {4552, 4, 0x4, 0, 0x6},
+    {4560, 4, 0x4, 0, 0x6}, {4568, 4, 0x4, 0, 0x6}, {4576, 4, 0x4, 0, 0x6}, {4584, 4, 0x24, 0, 0x6},
+    {4596, 4, 0xe4, 0, 0x6}, {4612, 64, 0x4, 8, 0xe}, {4740, 64, 0x4, 8, 0xe}, {4868, 64, 0x4, 8, 0xe},
+    {4996, 4, 0x4, 0, 0x6}, {5004, 4, 0x4, 0, 0x6}, {5012, 4, 0x4, 0, 0x6}, {5020, 4, 0x54, 0, 0x6},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {5028, 4, 0x84, 0, 0x6}, {5040, 4, 0x84, 0, 0x6}, {5052, 4, 0x24, 0, 0x6}, {5064, 4, 0x24, 0, 0x6},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {5076, 64, 0x54, 8, 0xe}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {5204, 4, 0xe4, 0, 0x6}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {5220, 8, 0x4, 0, 0xe}, {5236, 4, 0xa4, 0, 0x6}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {5248, 4, 0x84, 0, 0x6}, {5260, 4, 0x4, 0, 0x6}, {5268, 4, 0x4, 0, 0x6}, {5276, 4, 0x4, 0, 0x6},
+    {5284, 4, 0x4, 0, 0x6}, {5292, 4, 0x4, 0, 0x6}, {5300, 4, 0x4, 0, 0x6}, {5308, 8, 0x4, 0, 0xe},
+    {5324, 4, 0x4, 0, 0x6}, {5332, 4, 0x4, 0, 0x6}, {5340, 4, 0x4, 0, 0x6}, {5348, 4, 0x4, 0, 0x6},
+    {5356, 4, 0x4, 0, 0x6}, {5364, 4, 0x4, 0, 0x6}, {5372, 4, 0x4, 0, 0x6}, {5380, 4, 0x4, 0, 0x6},
+    {5388, 4, 0x4, 0, 0x6}, {5396, 4, 0x4, 0, 0x6}, {5404, 4, 0x4, 0, 0x6}, {5412, 4, 0x4, 0, 0x6},
+    {5420, 4, 0x4, 0, 0x6}, {5428, 4, 0x4, 0, 0x6}, {5436, 4, 0x24, 0, 0x6}, {5448, 8, 0x4, 0, 0xe},
+    {5464, 4, 0x4, 0, 0x6}, {5472, 4, 0x4, 0, 0x6}, {5480, 4, 0x4, 0, 0x6}, {5488, 4, 0x4, 0, 0x6},
+    {5496, 4, 0x4, 0, 0x6}, {5504, 4, 0x4, 0, 0x6}, {5512, 4, 0x4, 0, 0x6}, {5520, 4, 0x4, 0, 0x6},
+    {5528, 8, 0x40, 0, 0xe}, {5544, 4, 0x4, 0, 0x6}, {5552, 4, 0x4, 0, 0x6}, {5560, 4, 0x4, 0, 0x6},
+    {5568, 4, 0x4, 0, 0x6}, {5576, 4, 0x4, 0, 0x6}, {5584, 4, 0x4, 0, 0x6}, {5592, 8, 0x4, 0, 0xe},
+    {5608, 4, 0x4, 0, 0x6}, {5616, 4, 0x4, 0, 0x6}, {5624, 4, 0x4, 0, 0x6}, {5632, 4, 0x4, 0, 0x6},
+    {5640, 4, 0x4, 0, 0x6}, {5648, 4, 0x4, 0, 0x6}, {5656, 4, 0x4, 0, 0x6}, {0, 0, 0x0, 0, 0x0},
+    {5664, 4, 0x4, 0, 0x6}, {5672, 4, 0x4, 0, 0x6}, {5680, 4, 0x4, 0, 0x6}, {5688, 4, 0x4, 0, 0x6},
+    {5696, 4, 0x4, 0, 0x6}, {5704, 4, 0x4, 0, 0x6}, {5712, 4, 0x4, 0, 0x6}, {5720, 4, 0x4, 0, 0x6},
+    {5728, 4, 0x4, 0, 0x6}, {5736, 4, 0x4, 0, 0x6}, {5744, 4, 0x4, 0, 0x6}, {5752, 4, 0x4, 0, 0x6},
+    {5760, 4, 0x4, 0, 0x6}, {5768, 4, 0x4, 0, 0x6}, {5776, 4, 0x4, 0, 0x6}, {5784, 4, 0x4, 0, 0x6},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {5792, 4, 0x4, 0, 0x6},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {5800, 4, 0x4, 0, 0x6}, {5808, 4, 0x4, 0, 0x6},
+    {5816, 8, 0x4, 0, 0xe}, {5832, 8, 0x4, 0, 0xe}, {5848, 8, 0x4, 0, 0xe}, {0, 0, 0x0, 0, 0x0},
+    {5864, 4, 0x4, 0, 0x6}, {5872, 4, 0x4, 0, 0x6}, {5880, 4, 0x4, 0, 0x6}, {0, 0, 0x0, 0, 0x0},
+    {5888, 4, 0x4, 0, 0x6}, {5896, 4, 0x4, 0, 0x6}, {5904, 4, 0x4, 0, 0x6}, {5912, 4, 0x4, 0, 0x6},
+    {5920, 4, 0x4, 0, 0x6}, {5928, 4, 0x4, 0, 0x6}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {5936, 4, 0x4, 0, 0x6}, {5944, 4, 0x4, 0, 0x6}, {5952, 8, 0x4, 0, 0xe}, {5968, 4, 0x4, 0, 0x6},
+    {5976, 8, 0x4, 0, 0xe}, {5992, 8, 0x4, 0, 0xe}, {6008, 8, 0x4, 0, 0xe}, {6024, 8, 0x4, 0, 0xe},
+    {6040, 4, 0x4, 0, 0x6}, {6048, 4, 0x4, 0, 0x6}, {6056, 4, 0x4, 0, 0x6}, {6064, 4, 0x4, 0, 0x6},
+    {6072, 4, 0x4, 0, 0x6}, {6080, 4, 0x4, 0, 0x6}, {6088, 4, 0x4, 0, 0x6}, {6096, 4, 0x4, 0, 0x6},
+    {6104, 4, 0x4, 0, 0x6}, {6112, 4, 0x4, 0, 0x6}, {6120, 4, 0x4, 0, 0x6}, {6128, 4, 0x4, 0, 0x6},
+    {6136, 4, 0x4, 0, 0x6}, {6144, 4, 0x4, 0, 0x6}, {6152, 4, 0x4, 0, 0x6}, {6160, 4, 0x4, 0, 0x6},
+    {6168, 4, 0x4, 0, 0x6}, {6176, 4, 0x4, 0, 0x6}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {6184, 4, 0x4, 0, 0x6}, {6192, 4, 0x4, 0, 0x6}, {6200, 4, 0x4, 0, 0x6},
+    {0, 0, 0x0, 0, 0x0}, {6208, 64, 0x54, 8, 0xe}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {6336, 4, 0x4, 0, 0x6}, {6344, 4, 0x4, 0, 0x6}, {6352, 4, 0x4, 0, 0x6}, {6360, 4, 0x4, 0, 0x6},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {6368, 4, 0x4, 0, 0x6}, {6376, 4, 0x4, 0, 0x6}, {6384, 8, 0x4, 0, 0xe}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {6400, 4, 0x4, 0, 0x6}, {6408, 4, 0x4, 0, 0x6}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {6416, 8, 0x4, 0, 0xe}, {0, 0, 0x0, 0, 0x0}, {6432, 8, 0x4, 0, 0xe}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {6448, 4, 0x4, 0, 0x6}, {6456, 4, 0x4, 0, 0x6},
+    {6464, 4, 0x4, 0, 0x6}, {6472, 4, 0x4, 0, 0x6}, {6480, 4, 0x4, 0, 0x6}, {6488, 4, 0x4, 0, 0x6},
+    {6496, 4, 0x4, 0, 0x6}, {6504, 4, 0x4, 0, 0x6}, {6512, 4, 0x4, 0, 0x6}, {6520, 4, 0x4, 0, 0x6},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {6528, 4, 0x4, 0, 0x6}, {6536, 4, 0x4, 0, 0x6},
+    {6544, 4, 0x4, 0, 0x6}, {6552, 4, 0x4, 0, 0x6}, {6560, 4, 0x4, 0, 0x6}, {6568, 4, 0x4, 0, 0x6},
+    {6576, 4, 0x4, 0, 0x6}, {6584, 4, 0x4, 0, 0x6}, {6592, 4, 0x4, 0, 0x6}, {6600, 4, 0x4, 0, 0x6},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {6608, 4, 0x4, 0, 0x6}, {6616, 4, 0x4, 0, 0x6},
+    {6624, 4, 0x4, 0, 0x6}, {6632, 4, 0x4, 0, 0x6}, {6640, 4, 0x4, 0, 0x6}, {6648, 4, 0x4, 0, 0x6},
+    {6656, 4, 0x4, 0, 0x6}, {6664, 4, 0x4, 0, 0x6}, {6672, 4, 0x4, 0, 0x6}, {6680, 4, 0x4, 0, 0x6},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {6688, 4, 0x4, 0, 0x6},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {6696, 4, 0x4, 0, 0x6},
+    {6704, 4, 0x4, 0, 0x6}, {6712, 4, 0x4, 0, 0x6}, {6720, 4, 0x4, 0, 0x6}, {6728, 4, 0x4, 0, 0x6},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {6736, 4, 0x54, 0, 0x6}, {6744, 32, 0x54, 4, 0x6},
+    {0, 0, 0x0, 0, 0x0}, {6808, 4, 0xe4, 0, 0x6}, {6824, 4, 0x40, 0, 0x6}, {6832, 4, 0xe4, 0, 0x6},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {6848, 4, 0x4, 0, 0x6}, {6856, 4, 0x4, 0, 0x6}, {6864, 4, 0x4, 0, 0x6}, {0, 0, 0x0, 0, 0x0},
+    {6872, 4, 0x4, 0, 0x6}, {6880, 4, 0x4, 0, 0x6}, {6888, 4, 0x4, 0, 0x6}, {0, 0, 0x0, 0, 0x0},
+    {6896, 4, 0x4, 0, 0x6}, {6904, 4, 0x4, 0, 0x6}, {6912, 4, 0x4, 0, 0x6}, {6920, 4, 0x4, 0, 0x6},
+    {6928, 4, 0x4, 0, 0x6}, {6936, 4, 0x4, 0, 0x6}, {6944, 4, 0x4, 0, 0x6}, {6952, 4, 0x4, 0, 0x6},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {6960, 4, 0x4, 0, 0x6}, {0, 0, 0x0, 0, 0x0},
+    {6968, 4, 0x4, 0, 0x6}, {6976, 4, 0x4, 0, 0x6}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {6984, 4, 0x4, 0, 0x6}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {6992, 4, 0x4, 0, 0x6}, {7000, 4, 0x4, 0, 0x6}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {7008, 4, 0x4, 0, 0x6}, {7016, 4, 0x4, 0, 0x6}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {7024, 4, 0x4, 0, 0x6}, {7032, 4, 0x4, 0, 0x6}, {7040, 4, 0x4, 0, 0x6}, {0, 0, 0x0, 0, 0x0},
+    {7048, 4, 0x4, 0, 0x6}, {0, 0, 0x0, 0, 0x0}, {7056, 4, 0x4, 0, 0x6}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {7064, 4, 0x4, 0, 0x6}, {7072, 4, 0x4, 0, 0x6},
+    {7080, 4, 0x4, 0, 0x6}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {7088, 4, 0x4, 0, 0x6}, {7096, 4, 0x4, 0, 0x6}, {7104, 4, 0x4, 0, 0x6}, {7112, 4, 0x4, 0, 0x6},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {7120, 4, 0x4, 0, 0x6}, {7128, 4, 0x4, 0, 0x6},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {7136, 4, 0x4, 0, 0x6},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+    {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0}, {0, 0, 0x0, 0, 0x0},
+};
+static const uint8_t DECODE_STATE_INDEX[32][32] = {
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1},
+    {0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1},
+    {0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3},
+    {0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1},
+    {0, 1, 0, 1, 2, 3, 2, 3, 0, 1, 0, 1, 2, 3, 2, 3, 0, 1, 0, 1, 2, 3, 2, 3, 0, 1, 0, 1, 2, 3, 2, 3},
+    {0, 0, 1, 1, 2, 2, 3, 3, 0, 0, 1, 1, 2, 2, 3, 3, 0, 0, 1, 1, 2, 2, 3, 3, 0, 0, 1, 1, 2, 2, 3, 3},
+    {0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1},
+    {0, 1, 0, 1, 0, 1, 0, 1, 2, 3, 2, 3, 2, 3, 2, 3, 0, 1, 0, 1, 0, 1, 0, 1, 2, 3, 2, 3, 2, 3, 2, 3},
+    {0, 0, 1, 1, 0, 0, 1, 1, 2, 2, 3, 3, 2, 2, 3, 3, 0, 0, 1, 1, 0, 0, 1, 1, 2, 2, 3, 3, 2, 2, 3, 3},
+    {0, 1, 2, 3, 0, 1, 2, 3, 4, 5, 6, 7, 4, 5, 6, 7, 0, 1, 2, 3, 0, 1, 2, 3, 4, 5, 6, 7, 4, 5, 6, 7},
+    {0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3},
+    {0, 1, 0, 1, 2, 3, 2, 3, 4, 5, 4, 5, 6, 7, 6, 7, 0, 1, 0, 1, 2, 3, 2, 3, 4, 5, 4, 5, 6, 7, 6, 7},
+    {0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+    {0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3},
+    {0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 2, 2, 3, 3, 2, 2, 3, 3, 2, 2, 3, 3, 2, 2, 3, 3},
+    {0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 4, 5, 6, 7, 4, 5, 6, 7, 4, 5, 6, 7, 4, 5, 6, 7},
+    {0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 2, 2, 2, 2, 3, 3, 3, 3},
+    {0, 1, 0, 1, 2, 3, 2, 3, 0, 1, 0, 1, 2, 3, 2, 3, 4, 5, 4, 5, 6, 7, 6, 7, 4, 5, 4, 5, 6, 7, 6, 7},
+    {0, 0, 1, 1, 2, 2, 3, 3, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 4, 4, 5, 5, 6, 6, 7, 7},
+    {0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 8, 9, 10, 11, 12, 13, 14, 15},
+    {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3},
+    {0, 1, 0, 1, 0, 1, 0, 1, 2, 3, 2, 3, 2, 3, 2, 3, 4, 5, 4, 5, 4, 5, 4, 5, 6, 7, 6, 7, 6, 7, 6, 7},
+    {0, 0, 1, 1, 0, 0, 1, 1, 2, 2, 3, 3, 2, 2, 3, 3, 4, 4, 5, 5, 4, 4, 5, 5, 6, 6, 7, 7, 6, 6, 7, 7},
+    {0, 1, 2, 3, 0, 1, 2, 3, 4, 5, 6, 7, 4, 5, 6, 7, 8, 9, 10, 11, 8, 9, 10, 11, 12, 13, 14, 15, 12, 13, 14, 15},
+    {0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7},
+    {0, 1, 0, 1, 2, 3, 2, 3, 4, 5, 4, 5, 6, 7, 6, 7, 8, 9, 8, 9, 10, 11, 10, 11, 12, 13, 12, 13, 14, 15, 14, 15},
+    {0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31},
+};
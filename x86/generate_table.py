@@ -16,6 +16,8 @@ typedef enum {
     TOK_ADD = '+',
     TOK_COMMA = ',',
     TOK_COLON = ':',
+    TOK_EQUAL = '=',
+    TOK_AT = '@',
     TOK_OPENING_BRACKET = '[',
     TOK_CLOSING_BRACKET = ']',
     TOK_INSTRUCTION = 256,
@@ -192,6 +194,7 @@ class Instruction:
         self.op1 = 0
         self.op2 = 0
         self.op3 = 0
+        self.op4 = 0
 
     def to_c_struct(self): 
         begin = "{" 
@@ -261,7 +264,7 @@ def parse_opcode(op):
         if chunk[0] == "/":
             try:
                 if chunk[1].isdigit():
-                   digit = int(chunk[1]) 
+                   digit = int(chunk[1:])
                 elif chunk[1] == "r":
                     r |= MODRM_CONTAINS_REG_AND_MEM
                 elif chunk[1:] == 'is4':
@@ -529,6 +532,25 @@ def check_operand(nmemonic, op):
 
 
 
+def operand_enum_name(op_type):
+    op_name = op_type
+    if "/" in op_name:
+        op_name = op_name.replace("/", "")
+    elif chr(0x2013) in op_name:
+        op_name = op_name.replace(chr(0x2013), "")
+    elif op_name == "ST(i)":
+        op_name = op_name = "STI"
+    return "OPERAND_" + op_name.upper()
+
+
+def write_operand_enum(output_file):
+    output_file.write("typedef enum {\n")
+    for op_type in operand_types:
+        output_file.write(operand_enum_name(op_type) + " = " + str(operand_types[op_type]) + ",\n")
+    output_file.write("}OperandType;\n")
+
+
+
 class ParsedOperands:
     def __init__(self, nmemonic: str, op1: int, op2: int, op3: int, op4: int):
         self.nmemonic = nmemonic
@@ -606,6 +628,466 @@ def parse_operands(desc):
 
 
 
+DECODE_OUTPUT_FILE_NAME = "decode_table.h"
+
+MANDATORY_PREFIXES = [0x66, 0xF2, 0xF3]
+
+# the decoder looks up the variants of an opcode byte in one of these maps
+DECODE_MAP_LEGACY = 0
+DECODE_MAP_VEX = 4
+DECODE_MAP_COUNT = 8
+
+# where the decoder finds each operand
+DECODE_ROLE_NONE = 0
+DECODE_ROLE_FIXED = 1   # implied by the opcode (AL, CL, DX...)
+DECODE_ROLE_REG = 2     # reg field of modrm
+DECODE_ROLE_RM = 3      # r/m field of modrm, either a register or memory
+DECODE_ROLE_OPCODE = 4  # low 3 bits of the last opcode byte
+DECODE_ROLE_VVVV = 5    # vvvv field of the vex prefix
+DECODE_ROLE_IMM = 6
+DECODE_ROLE_IS4 = 7     # register in the upper 4 bits of the immediate byte
+DECODE_ROLE_REL = 8     # branch offset from the end of the instruction
+
+FIXED_OPERANDS = ["AL", "CL", "AX", "DX", "EAX", "RAX", "ES", "CS", "SS", "DS", "FS", "GS"]
+IMMEDIATE_OPERANDS = ["imm8", "imm16", "imm32", "imm64", "signed"]
+RELATIVE_OPERANDS = ["rel8", "rel16", "rel32", "l8", "l16", "l32", "l64"]
+MEMORY_OPERANDS = ["mem_any", "m8", "m16", "m32", "m64", "m128", "m256", "m80", "m",
+                   "r/m8", "r/m16", "r/m32", "r/m64", "mm/m32", "mm/m64",
+                   "xmm/m8", "xmm/m16", "xmm/m32", "xmm/m64", "xmm/m128", "ymm/m256"]
+
+
+def operand_is(op, names):
+    return any(op == operand_types[name] for name in names)
+
+
+# the instruction table doesn't have the operand encoding column of the intel manual
+# so it is worked out from the opcode and the operand types
+def operand_roles(instr, ops, reg_in_opcode):
+    is_vex = (instr.r & (TWO_BYTE_VEX | THREE_BYTE_VEX)) != 0
+    roles = [DECODE_ROLE_NONE] * 4
+    regs = []
+    for i, op in enumerate(ops):
+        if op == 0:
+            continue
+        if operand_is(op, FIXED_OPERANDS):
+            roles[i] = DECODE_ROLE_FIXED
+        elif operand_is(op, IMMEDIATE_OPERANDS):
+            roles[i] = DECODE_ROLE_IMM
+        elif operand_is(op, RELATIVE_OPERANDS):
+            roles[i] = DECODE_ROLE_REL
+        elif i == 3 and is_vex and instr.ib == INSTR_OP4_IS_REG:
+            roles[i] = DECODE_ROLE_IS4
+        else:
+            regs.append(i)
+
+    if len(regs) == 0:
+        return roles
+    if reg_in_opcode:
+        roles[regs[0]] = DECODE_ROLE_OPCODE
+        for i in regs[1:]:
+            roles[i] = DECODE_ROLE_RM
+        return roles
+
+    memory = [operand_is(ops[i], MEMORY_OPERANDS) for i in regs]
+    if len(regs) == 1:
+        order = [DECODE_ROLE_RM]
+    elif instr.digit != -1:
+        order = [DECODE_ROLE_VVVV, DECODE_ROLE_RM] if is_vex else [DECODE_ROLE_RM, DECODE_ROLE_REG]
+    elif len(regs) == 2:
+        order = [DECODE_ROLE_RM, DECODE_ROLE_REG] if memory[0] else [DECODE_ROLE_REG, DECODE_ROLE_RM]
+    elif memory[0]:
+        order = [DECODE_ROLE_RM, DECODE_ROLE_VVVV, DECODE_ROLE_REG]
+    elif memory[1] and not memory[2]:
+        order = [DECODE_ROLE_REG, DECODE_ROLE_RM, DECODE_ROLE_VVVV]
+    else:
+        order = [DECODE_ROLE_REG, DECODE_ROLE_VVVV, DECODE_ROLE_RM]
+    for i, role in zip(regs, order):
+        roles[i] = role
+    return roles
+
+
+# flags of a decode variant
+DECODE_OPERAND_SIZE_16 = 0x1
+DECODE_OPERAND_SIZE_32 = 0x2
+DECODE_REG_IN_OPCODE = 0x4
+DECODE_SIGN_EXTEND = 0x8    # the immediate is smaller than the operands
+
+# what the variant needs from the modrm byte
+DECODE_MODRM = 0x1
+DECODE_MODRM_MEMORY = 0x2   # the r/m operand can only be memory
+DECODE_MODRM_REGISTER = 0x4 # the r/m operand can only be a register
+
+# the prefix classes the variants of an opcode are split by, the vex pp is used as it is
+DECODE_CLASS_NONE = 0
+DECODE_CLASS_66 = 1
+DECODE_CLASS_F2 = 2
+DECODE_CLASS_F3 = 3
+
+# bits of the decoder state the variants of an opcode are split by as well
+DECODE_MATCH_SIZE_16 = 0x1  # there is a 66 prefix
+DECODE_MATCH_REX_W = 0x2
+DECODE_MATCH_VEX_L = 0x4
+DECODE_MATCH_MOD_3 = 0x8    # the byte after the opcode has mod 3
+DECODE_MATCH_XCHG = 0x10    # 90 with rex.b or 66 is xchg, not nop
+DECODE_MATCH_STATES = 0x20  # every combination of the bits above
+
+# the decoder indexes its register name tables with these
+DECODE_REGS = ["NONE", "8", "16", "32", "64", "MM", "XMM", "YMM", "ST", "SEGMENT"]
+REGISTER_CLASSES = {
+    "8": ["r8", "r/m8", "AL", "CL"],
+    "16": ["r16", "r/m16", "AX", "DX"],
+    "32": ["r32", "r/m32", "EAX"],
+    "64": ["r64", "r/m64", "RAX"],
+    "MM": ["mm", "mm/m32", "mm/m64"],
+    "XMM": ["xmm", "xmm/m8", "xmm/m16", "xmm/m32", "xmm/m64", "xmm/m128"],
+    "YMM": ["ymm", "ymm/m256"],
+    "ST": ["ST(i)"],
+    "SEGMENT": ["ES", "CS", "SS", "DS", "FS", "GS"],
+}
+MEMORY_SIZES = {
+    1: ["m8", "r/m8", "xmm/m8"],
+    2: ["m16", "r/m16", "xmm/m16"],
+    4: ["m32", "r/m32", "xmm/m32", "mm/m32"],
+    8: ["m64", "r/m64", "xmm/m64", "mm/m64"],
+    10: ["m80"],
+    16: ["m128", "xmm/m128"],
+    32: ["m256", "ymm/m256"],
+}
+IMMEDIATE_SIZES = {"imm8": 1, "imm16": 2, "imm32": 4, "imm64": 8}
+FIXED_REGISTER_INDEX = {"CL": 1, "DX": 2, "ES": 0, "CS": 1, "SS": 2, "DS": 3, "FS": 4, "GS": 5}
+MEMORY_ONLY_OPERANDS = ["mem_any", "m8", "m16", "m32", "m64", "m128", "m256", "m80", "m"]
+RM_OPERANDS = ["r/m8", "r/m16", "r/m32", "r/m64"]
+REGISTER_ONLY_OPERANDS = ["reg", "r8", "r16", "r32", "r64", "mm", "xmm", "ymm", "ST(i)"]
+
+
+def register_class(op, rex):
+    if op == operand_types["reg"]:
+        return DECODE_REGS.index("64" if rex & 0x8 else "32")
+    for name, ops in REGISTER_CLASSES.items():
+        if operand_is(op, ops):
+            return DECODE_REGS.index(name)
+    return 0
+
+
+# setcc r/m8 has neither /r nor a digit in instructions.dat
+def has_modrm(instr, ops):
+    return (instr.r & MODRM_CONTAINS_REG_AND_MEM) or instr.digit != -1 or any(operand_is(op, RM_OPERANDS) for op in ops)
+
+
+# register classes, sizes and modrm needs of the operands so the decoder doesn't have to work them out
+def operand_details(instr, ops, roles, rex):
+    regs = [register_class(op, rex) for op in ops]
+    sizes = [0] * 4
+    modrm = DECODE_MODRM if has_modrm(instr, ops) else 0
+    flags = 0
+    operand_bytes = {"8": 1, "16": 2, "32": 4, "64": 8}.get(DECODE_REGS[regs[0]], 0)
+    for i, (op, role) in enumerate(zip(ops, roles)):
+        if role == DECODE_ROLE_RM:
+            sizes[i] = next((size for size, names in MEMORY_SIZES.items() if operand_is(op, names)), 0)
+            if operand_is(op, MEMORY_ONLY_OPERANDS):
+                modrm |= DECODE_MODRM_MEMORY
+            elif operand_is(op, REGISTER_ONLY_OPERANDS):
+                modrm |= DECODE_MODRM_REGISTER
+        elif role == DECODE_ROLE_FIXED:
+            sizes[i] = next((index for name, index in FIXED_REGISTER_INDEX.items() if op == operand_types[name]), 0)
+        elif role in (DECODE_ROLE_IMM, DECODE_ROLE_REL):
+            sizes[i] = next((size for name, size in IMMEDIATE_SIZES.items() if op == operand_types[name]), 0)
+            if sizes[i] == 0:
+                sizes[i] = instr.ib if instr.ib > 0 else 1
+            if role == DECODE_ROLE_IMM and sizes[i] < operand_bytes:
+                flags |= DECODE_SIGN_EXTEND
+        elif role == DECODE_ROLE_IS4:
+            sizes[i] = 1
+    return regs, sizes, modrm, flags
+
+decode_struct = """
+//the prefixes, rex.w and vex bits of a variant are in its DECODE_KEYS bucket, not here
+typedef struct {
+    const char* mnemonic;
+    uint8_t role[4];
+    uint8_t regs[4];         //DECODE_REGS_ class of the register operands
+    uint8_t size[4];         //bytes of the memory operands and immediates, index of the fixed registers
+    uint8_t extra[2];        //opcode bytes that follow the byte the table is indexed with
+    uint8_t extra_count;
+    int8_t digit;
+    uint8_t modrm;
+    uint8_t flags;
+    uint16_t next;           //the next variant of the same bucket, 0 after the last
+} DecodeVariant;
+
+//where the buckets of an opcode are, see DECODE_VARIANTS
+typedef struct {
+    uint16_t first;
+    uint16_t class_step;     //buckets between two class slots
+    uint8_t classes;         //class slot of each prefix class, 2 bits each from DECODE_CLASS_NONE up
+    uint8_t reg_step;        //buckets between two modrm.reg values, 0 if the opcode isn't split by it
+    uint8_t state_mask;      //DECODE_MATCH_ bits the opcode is split by
+} DecodeKey;
+"""
+
+decode_macros = f"""
+#define DECODE_MAP_LEGACY {DECODE_MAP_LEGACY}
+#define DECODE_MAP_VEX {DECODE_MAP_VEX}
+#define DECODE_MAP_COUNT {DECODE_MAP_COUNT}
+#define DECODE_OPERAND_SIZE_16 {hex(DECODE_OPERAND_SIZE_16)}
+#define DECODE_OPERAND_SIZE_32 {hex(DECODE_OPERAND_SIZE_32)}
+#define DECODE_REG_IN_OPCODE {hex(DECODE_REG_IN_OPCODE)}
+#define DECODE_SIGN_EXTEND {hex(DECODE_SIGN_EXTEND)}
+#define DECODE_MODRM {hex(DECODE_MODRM)}
+#define DECODE_MODRM_MEMORY {hex(DECODE_MODRM_MEMORY)}
+#define DECODE_MODRM_REGISTER {hex(DECODE_MODRM_REGISTER)}
+#define DECODE_CLASS_NONE {DECODE_CLASS_NONE}
+#define DECODE_CLASS_66 {DECODE_CLASS_66}
+#define DECODE_CLASS_F2 {DECODE_CLASS_F2}
+#define DECODE_CLASS_F3 {DECODE_CLASS_F3}
+#define DECODE_MATCH_SIZE_16 {hex(DECODE_MATCH_SIZE_16)}
+#define DECODE_MATCH_REX_W {hex(DECODE_MATCH_REX_W)}
+#define DECODE_MATCH_VEX_L {hex(DECODE_MATCH_VEX_L)}
+#define DECODE_MATCH_MOD_3 {hex(DECODE_MATCH_MOD_3)}
+#define DECODE_MATCH_XCHG {hex(DECODE_MATCH_XCHG)}
+""" + "".join(f"#define DECODE_REGS_{name} {i}\n" for i, name in enumerate(DECODE_REGS)) + f"""#define DECODE_ROLE_NONE {DECODE_ROLE_NONE}
+#define DECODE_ROLE_FIXED {DECODE_ROLE_FIXED}
+#define DECODE_ROLE_REG {DECODE_ROLE_REG}
+#define DECODE_ROLE_RM {DECODE_ROLE_RM}
+#define DECODE_ROLE_OPCODE {DECODE_ROLE_OPCODE}
+#define DECODE_ROLE_VVVV {DECODE_ROLE_VVVV}
+#define DECODE_ROLE_IMM {DECODE_ROLE_IMM}
+#define DECODE_ROLE_IS4 {DECODE_ROLE_IS4}
+#define DECODE_ROLE_REL {DECODE_ROLE_REL}
+"""
+
+
+def operand_size_flags(instr):
+    # a 16 bit operand needs the 66 prefix (crc32 r32, r/m16 too), otherwise the first general purpose operand decides
+    sizes = {16: ["r16", "r/m16", "AX"], 32: ["r32", "r/m32", "EAX"], 64: ["r64", "r/m64", "RAX"], 8: ["r8", "r/m8", "AL"]}
+    if any(operand_is(op, sizes[16]) for op in [instr.op1, instr.op2, instr.op3]):
+        return DECODE_OPERAND_SIZE_16
+    for op in [instr.op1, instr.op2, instr.op3]:
+        for size, names in sizes.items():
+            if any(op == operand_types[name] for name in names):
+                if size == 16:
+                    return DECODE_OPERAND_SIZE_16
+                return DECODE_OPERAND_SIZE_32 if size != 8 else 0
+    return 0
+
+
+# splits the opcode bytes into the map, the byte the table is indexed with and the bytes after it
+def decode_key(instr):
+    ops = list(instr.opcode)
+    prefix = 0
+    if instr.r & (TWO_BYTE_VEX | THREE_BYTE_VEX):
+        vex_map = instr.rex >> 8
+        return 0, DECODE_MAP_VEX + (vex_map if vex_map != 0 else 1), ops[0], ops[1:]
+
+    if len(ops) > 1 and ops[0] in MANDATORY_PREFIXES:
+        prefix = ops[0]
+        ops = ops[1:]
+    decode_map = DECODE_MAP_LEGACY
+    if len(ops) > 1 and ops[0] == 0x0F:
+        decode_map += 1
+        ops = ops[1:]
+        if len(ops) > 1 and ops[0] in [0x38, 0x3A]:
+            decode_map += 2 if ops[0] == 0x3A else 1
+            ops = ops[1:]
+    return prefix, decode_map, ops[0], ops[1:]
+
+
+# writes the variants of every instruction indexed by map and opcode byte for the disassembler
+# the register of +r and +i opcodes is part of the opcode so those variants are listed under all 8 bytes
+def write_decode_table(sorted_instructions, instructions):
+    keys = {}
+    serial = 0
+    for name in sorted_instructions:
+        for index, instr in enumerate(instructions[name]):
+            ops = [instr.op1, instr.op2, instr.op3, instr.op4]
+            if operand_types["unsupported"] in ops or len(instr.opcode) == 0:
+                continue
+            prefix, decode_map, opcode, extra = decode_key(instr)
+            if len(extra) > 2:
+                continue
+            flags = operand_size_flags(instr)
+            reg_in_opcode = (instr.r & ADD_REG_TO_OPCODE) or operand_types["ST(i)"] in ops
+            if reg_in_opcode:
+                flags |= DECODE_REG_IN_OPCODE
+            rex = 0 if instr.r & (TWO_BYTE_VEX | THREE_BYTE_VEX) else instr.rex
+            vex = instr.rex & 0xFF if instr.r & (TWO_BYTE_VEX | THREE_BYTE_VEX) else 0
+
+            roles = operand_roles(instr, ops, reg_in_opcode)
+            # the memory operands of string instructions like movs are implied, the forms without operands decode them
+            if not has_modrm(instr, ops) and (DECODE_ROLE_REG in roles or DECODE_ROLE_RM in roles):
+                continue
+            regs, sizes, modrm, operand_flags = operand_details(instr, ops, roles, rex)
+            entry = (name.lower(), ops, roles, prefix, extra, instr.digit, regs, sizes, modrm, rex, vex, flags | operand_flags)
+            # the most specific variants are checked first
+            order = (prefix == 0, -len(extra), (rex & 0x8) == 0, serial)
+            serial += 1
+            opcodes = [opcode]
+            if reg_in_opcode and len(extra) == 0:
+                opcodes = [opcode + i for i in range(8)]
+            for op in opcodes:
+                keys.setdefault((decode_map, op), []).append((order, entry))
+
+    # r/m16 only needs the 66 prefix when the same opcode also has a 32 bit form (verw and lldt don't)
+    for variants in keys.values():
+        sizes = set((e[3], tuple(e[4]), e[5]) for _, e in variants if e[11] & DECODE_OPERAND_SIZE_32)
+        for i, (order, e) in enumerate(variants):
+            if e[11] & DECODE_OPERAND_SIZE_16 and (e[3], tuple(e[4]), e[5]) not in sizes:
+                variants[i] = (order, e[:11] + (e[11] & ~DECODE_OPERAND_SIZE_16,))
+
+    with open(DECODE_OUTPUT_FILE_NAME, "w") as output_file:
+        output_file.write("/* Generated by generate_table.py from instructions.dat, don't include it with nmemonics.h */\n")
+        output_file.write("#pragma once\n#include <stdint.h>\n\n")
+        write_operand_enum(output_file)
+        output_file.write(instr_packing_macros)
+        output_file.write(decode_macros)
+        output_file.write(decode_struct)
+        write_decode_keys(output_file, keys)
+
+
+# the DECODE_MATCH_ bits a variant depends on and the values it needs them to have
+# the first opcode byte after the one the table is indexed with is read as the modrm, so its mod is matched like one
+def variant_match(entry, is_vex, opcode):
+    name, ops, roles, prefix, extra, digit, regs, sizes, modrm, rex, vex, flags = entry
+    mask, match = 0, 0
+    if is_vex:
+        mask |= DECODE_MATCH_REX_W | DECODE_MATCH_VEX_L
+        match |= (DECODE_MATCH_REX_W if vex & 0x80 else 0) | (DECODE_MATCH_VEX_L if vex & 0x4 else 0)
+    else:
+        # the 66 of an sse instruction isn't an operand size
+        if prefix != 0x66 and flags & (DECODE_OPERAND_SIZE_16 | DECODE_OPERAND_SIZE_32):
+            mask |= DECODE_MATCH_SIZE_16
+            match |= DECODE_MATCH_SIZE_16 if flags & DECODE_OPERAND_SIZE_16 else 0
+        if rex & 0x8:
+            mask |= DECODE_MATCH_REX_W
+            match |= DECODE_MATCH_REX_W
+        if opcode == 0x90 and ops[0] == operand_types["NOP"]:
+            mask |= DECODE_MATCH_XCHG
+    if len(extra) > 0:
+        mask |= DECODE_MATCH_MOD_3
+        match |= DECODE_MATCH_MOD_3 if extra[0] >> 6 == 3 else 0
+    elif modrm & (DECODE_MODRM_MEMORY | DECODE_MODRM_REGISTER):
+        mask |= DECODE_MATCH_MOD_3
+        match |= DECODE_MATCH_MOD_3 if modrm & DECODE_MODRM_REGISTER else 0
+    return mask, match
+
+
+# the fields of a variant the decoder reads once its bucket is found, variants that only differ in the others are the same to it
+def decoded_variant(entry):
+    name, ops, roles, prefix, extra, digit, regs, sizes, modrm, rex, vex, flags = entry
+    return name, tuple(roles), tuple(regs), tuple(sizes), tuple(extra), digit, modrm, flags & (DECODE_REG_IN_OPCODE | DECODE_SIGN_EXTEND)
+
+
+# the prefix classes (none, 66, f2, f3 or the vex pp) and modrm.reg values a variant can be decoded with
+def variant_keys(entry, is_vex):
+    name, ops, roles, prefix, extra, digit, regs, sizes, modrm, rex, vex, flags = entry
+    if is_vex:
+        classes = [vex & 0x3]
+    else:
+        classes = {0x66: [DECODE_CLASS_66], 0xF2: [DECODE_CLASS_F2], 0xF3: [DECODE_CLASS_F3]}.get(prefix, [DECODE_CLASS_NONE, DECODE_CLASS_66])
+    if len(extra) > 0:
+        # a register in the low bits of the next opcode byte leaves its reg bits alone
+        assert not (flags & DECODE_REG_IN_OPCODE and len(extra) == 1 and extra[0] & 7)
+        reg_values = [(extra[0] >> 3) & 7]
+    else:
+        reg_values = [digit] if digit != -1 and modrm & DECODE_MODRM else range(8)
+    return classes, reg_values
+
+
+# the bits of state that are in mask, packed together, so the used states of an opcode's buckets are next to each other
+def state_index(mask, state):
+    index, bit = 0, 0
+    for i in range(8):
+        if mask & (1 << i):
+            index |= ((state >> i) & 1) << bit
+            bit += 1
+    return index
+
+
+# narrows the variants of an opcode down to the ones its prefix class, modrm.reg and DECODE_MATCH_ state can match, in the same order
+# prefix classes with the same variants share their buckets, and an opcode is only split by reg if that separates its variants
+def write_decode_keys(output_file, keys):
+    opcode_keys = [(0, 0, 0, 0, 0)] * (DECODE_MAP_COUNT * 256)
+    # the variants of every bucket, bucket 0 is the empty one of the opcodes without variants
+    bucket_lists = [[]]
+    for decode_map in range(DECODE_MAP_COUNT):
+        for opcode in range(256):
+            variants = [entry for _, entry in sorted(keys.get((decode_map, opcode), []), key=lambda e: e[0])]
+            if not variants:
+                continue
+            is_vex = decode_map >= DECODE_MAP_VEX
+            matches = [variant_match(entry, is_vex, opcode) for entry in variants]
+            state_mask = 0
+            for mask, _ in matches:
+                state_mask |= mask
+            states = [state for state in range(DECODE_MATCH_STATES) if state & state_mask == state]
+            lists = {}
+            for i, entry in enumerate(variants):
+                classes, reg_values = variant_keys(entry, is_vex)
+                mask, match = matches[i]
+                for decode_class in classes:
+                    for reg in reg_values:
+                        for state in states:
+                            if state & mask == match:
+                                lists.setdefault((decode_class, reg, state), []).append(decoded_variant(entry))
+
+            by_reg = any(lists.get((c, r, t)) != lists.get((c, 0, t)) for c in range(4) for r in range(8) for t in states)
+            slots = []
+            classes = 0
+            for decode_class in range(4):
+                variants_of_class = [lists.get((decode_class, r, t)) for r in range(8) for t in states]
+                if variants_of_class not in [v for _, v in slots]:
+                    slots.append((decode_class, variants_of_class))
+                classes |= [v for _, v in slots].index(variants_of_class) << (decode_class * 2)
+            reg_step = len(states) if by_reg else 0
+            opcode_keys[decode_map * 256 + opcode] = (len(bucket_lists), len(states) * (8 if by_reg else 1), classes, reg_step, state_mask)
+            for decode_class, _ in slots:
+                for reg in (range(8) if by_reg else [0]):
+                    for state in states:
+                        # a variant that reads the same as one before it in the bucket can't match where that one didn't
+                        bucket = []
+                        for variant in lists.get((decode_class, reg, state), []):
+                            if variant not in bucket:
+                                bucket.append(variant)
+                        bucket_lists.append(bucket)
+    # the first variant of bucket i is DECODE_VARIANTS[i] and the others come after all the buckets, so the decoder goes
+    # from the bucket straight to its variant, a variant in more than one bucket is written once for each
+    slots = [bucket[0] if bucket else None for bucket in bucket_lists]
+    nexts = [0] * len(slots)
+    for i, bucket in enumerate(bucket_lists):
+        previous = i
+        for variant in bucket[1:]:
+            nexts[previous] = len(slots)
+            previous = len(slots)
+            slots.append(variant)
+            nexts.append(0)
+    assert len(slots) < 0x10000
+
+    output_file.write("// the first variant of a bucket is DECODE_VARIANTS[bucket], the bucket of an opcode is\n")
+    output_file.write("// first + class slot * class_step + modrm.reg * reg_step + DECODE_STATE_INDEX[state_mask][state] of its DECODE_KEYS\n")
+    output_file.write("static const DecodeVariant DECODE_VARIANTS[] = {\n")
+    for i, variant in enumerate(slots):
+        # the mnemonic of an empty bucket is NULL
+        if variant is None:
+            output_file.write("{0},\n")
+            continue
+        name, roles, regs, sizes, extra, digit, modrm, flags = variant
+        padded = list(extra) + [0] * (2 - len(extra))
+        arrays = ", ".join("{" + ", ".join(str(v) for v in values) + "}" for values in (roles, regs, sizes))
+        output_file.write(f"{{\"{name}\", {arrays}, {{{hex(padded[0])}, {hex(padded[1])}}}, {len(extra)}, {digit}, {modrm}, {flags}, {nexts[i]}}},\n")
+    output_file.write("};\n\n")
+
+    output_file.write("static const DecodeKey DECODE_KEYS[] = {\n")
+    for i in range(0, len(opcode_keys), 4):
+        output_file.write("    " + ", ".join("{%d, %d, %s, %d, %s}" % (first, class_step, hex(classes), reg_step, hex(mask))
+                                            for first, class_step, classes, reg_step, mask in opcode_keys[i:i + 4]) + ",\n")
+    output_file.write("};\n")
+    # indexed with the state_mask of the opcode and the state
+    output_file.write(f"static const uint8_t DECODE_STATE_INDEX[{DECODE_MATCH_STATES}][{DECODE_MATCH_STATES}] = {{\n")
+    for mask in range(DECODE_MATCH_STATES):
+        output_file.write("    {" + ", ".join(str(state_index(mask, state)) for state in range(DECODE_MATCH_STATES)) + "},\n")
+    output_file.write("};\n")
+
+
 with open("instructions.dat", "r") as f:
     instructions = {}
     op_code_table = []
@@ -655,6 +1137,7 @@ with open("instructions.dat", "r") as f:
                 parsed_instruction.op1 = parsed_operands.op1 
                 parsed_instruction.op2 = parsed_operands.op2
                 parsed_instruction.op3 = parsed_operands.op3
+                parsed_instruction.op4 = parsed_operands.op4
  
                 try:
                     instructions[parsed_operands.nmemonic].append(parsed_instruction)
@@ -667,21 +1150,9 @@ with open("instructions.dat", "r") as f:
                                 
     operand_enum = []
     
-    gperf_input_file.write("typedef enum {\n")
     for op_type in operand_types:
-        op_name = op_type
-        if "/" in op_name:
-            op_name = op_name.replace("/", "")
-        elif chr(0x2013) in op_name:
-            op_name = op_name.replace(chr(0x2013), "")
-        elif op_name == "ST(i)":
-            op_name = op_name = "STI"
-
-        field_name = "OPERAND_" + op_name.upper()
-        operand_enum.append(field_name)
-        gperf_input_file.write(field_name + " = " + str(operand_types[op_type]) + ",\n")
-
-    gperf_input_file.write("}OperandType;\n")
+        operand_enum.append(operand_enum_name(op_type))
+    write_operand_enum(gperf_input_file)
 
     gperf_input_file.write(instr_struct)
     gperf_input_file.write(instr_packing_macros)
@@ -714,6 +1185,8 @@ with open("instructions.dat", "r") as f:
 
     gperf_input_file.write("};\n")
     gperf_input_file.write(f"#define INSTRUCTION_TABLE_SIZE {instruction_table_size}\n")
+
+    write_decode_table(sorted_instructions, instructions)
     gperf_input_file.write("%}\n")
 
     # write the gperf output
@@ -144,6 +144,8 @@ typedef enum {
     TOK_ADD = '+',
     TOK_COMMA = ',',
     TOK_COLON = ':',
+    TOK_EQUAL = '=',
+    TOK_AT = '@',
     TOK_OPENING_BRACKET = '[',
     TOK_CLOSING_BRACKET = ']',
     TOK_INSTRUCTION = 256,
@@ -196,6 +198,8 @@ const char* token_to_string(TokenType type){
     case TOK_ADD: return "TOK_ADD";
     case TOK_COMMA: return "TOK_COMMA";
     case TOK_COLON: return "TOK_COLON";
+    case TOK_EQUAL: return "TOK_EQUAL";
+    case TOK_AT: return "TOK_AT";
     case TOK_OPENING_BRACKET: return "TOK_OPENING_BRACKET";
     case TOK_CLOSING_BRACKET: return "TOK_CLOSING_BRACKET";
     case TOK_INSTRUCTION: return "TOK_INSTRUCTION";
@@ -414,7 +418,7 @@ static const Instruction INSTRUCTION_TABLE[] = {
 {(uint16_t)0x48, (OperandType)14, (OperandType)26, (OperandType)0, {0x13,0x00,0x00,0x00}, 1, -1, -1, 5},
 {(uint16_t)0x2, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
 {(uint16_t)0x0, (OperandType)13, (OperandType)25, (OperandType)0, {0x66,0xf,0x38,0xf6}, 4, -1, -1, 5},
-{(uint16_t)0x40, (OperandType)14, (OperandType)26, (OperandType)0, {0x66,0xf,0x38,0xf6}, 4, -1, -1, 5},
+{(uint16_t)0x48, (OperandType)14, (OperandType)26, (OperandType)0, {0x66,0xf,0x38,0xf6}, 4, -1, -1, 5},
 {(uint16_t)0x16, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
 {(uint16_t)0x0, (OperandType)248, (OperandType)27, (OperandType)0, {0x4,0x00,0x00,0x00}, 1, -1, 1, 4},
 {(uint16_t)0x0, (OperandType)250, (OperandType)28, (OperandType)0, {0x5,0x00,0x00,0x00}, 1, -1, 2, 4},
@@ -588,7 +592,7 @@ static const Instruction INSTRUCTION_TABLE[] = {
 {(uint16_t)0x0, (OperandType)255, (OperandType)0, (OperandType)0, {0xff,0x00,0x00,0x00}, 1, 3, -1, 4},
 {(uint16_t)0x48, (OperandType)255, (OperandType)0, (OperandType)0, {0xff,0x00,0x00,0x00}, 1, 3, -1, 4},
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
-{(uint16_t)0x0, (OperandType)0, (OperandType)0, (OperandType)0, {0x98,0x00,0x00,0x00}, 1, -1, -1, 4},
+{(uint16_t)0x0, (OperandType)0, (OperandType)0, (OperandType)0, {0x66,0x98,0x00,0x00}, 2, -1, -1, 4},
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
 {(uint16_t)0x0, (OperandType)0, (OperandType)0, (OperandType)0, {0x99,0x00,0x00,0x00}, 1, -1, -1, 4},
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
@@ -780,7 +784,7 @@ static const Instruction INSTRUCTION_TABLE[] = {
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
 {(uint16_t)0x0, (OperandType)42, (OperandType)46, (OperandType)27, {0xf3,0xf,0xc2,0x00}, 3, -1, 1, 5},
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
-{(uint16_t)0x0, (OperandType)0, (OperandType)0, (OperandType)0, {0xa7,0x00,0x00,0x00}, 1, -1, -1, 4},
+{(uint16_t)0x0, (OperandType)0, (OperandType)0, (OperandType)0, {0x66,0xa7,0x00,0x00}, 2, -1, -1, 4},
 {(uint16_t)0x5, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
 {(uint16_t)0x0, (OperandType)23, (OperandType)11, (OperandType)0, {0xf,0xb0,0x00,0x00}, 2, -1, -1, 5},
 {(uint16_t)0x40, (OperandType)23, (OperandType)11, (OperandType)0, {0xf,0xb0,0x00,0x00}, 2, -1, -1, 5},
@@ -853,7 +857,7 @@ static const Instruction INSTRUCTION_TABLE[] = {
 {(uint16_t)0x0, (OperandType)13, (OperandType)46, (OperandType)0, {0xf3,0xf,0x2c,0x00}, 3, -1, -1, 5},
 {(uint16_t)0x48, (OperandType)14, (OperandType)46, (OperandType)0, {0xf3,0xf,0x2c,0x00}, 3, -1, -1, 5},
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
-{(uint16_t)0x0, (OperandType)0, (OperandType)0, (OperandType)0, {0x99,0x00,0x00,0x00}, 1, -1, -1, 4},
+{(uint16_t)0x0, (OperandType)0, (OperandType)0, (OperandType)0, {0x66,0x99,0x00,0x00}, 2, -1, -1, 4},
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
 {(uint16_t)0x0, (OperandType)0, (OperandType)0, (OperandType)0, {0x98,0x00,0x00,0x00}, 1, -1, -1, 4},
 {(uint16_t)0x5, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
@@ -1199,9 +1203,9 @@ static const Instruction INSTRUCTION_TABLE[] = {
 {(uint16_t)0x0, (OperandType)25, (OperandType)0, (OperandType)0, {0xff,0x00,0x00,0x00}, 1, 0, -1, 4},
 {(uint16_t)0x48, (OperandType)26, (OperandType)0, (OperandType)0, {0xff,0x00,0x00,0x00}, 1, 0, -1, 4},
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
-{(uint16_t)0x0, (OperandType)13, (OperandType)0, (OperandType)0, {0xf3,0xf,0xae,0x00}, 3, 0, -1, 4},
+{(uint16_t)0x0, (OperandType)13, (OperandType)0, (OperandType)0, {0xf3,0xf,0xae,0x00}, 3, 5, -1, 4},
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
-{(uint16_t)0x48, (OperandType)14, (OperandType)0, (OperandType)0, {0xf3,0xf,0xae,0x00}, 3, 0, -1, 4},
+{(uint16_t)0x48, (OperandType)14, (OperandType)0, (OperandType)0, {0xf3,0xf,0xae,0x00}, 3, 5, -1, 4},
 {(uint16_t)0x3, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
 {(uint16_t)0x0, (OperandType)16, (OperandType)251, (OperandType)0, {0x6c,0x00,0x00,0x00}, 1, -1, -1, 4},
 {(uint16_t)0x0, (OperandType)17, (OperandType)251, (OperandType)0, {0x6d,0x00,0x00,0x00}, 1, -1, -1, 4},
@@ -1213,7 +1217,7 @@ static const Instruction INSTRUCTION_TABLE[] = {
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
 {(uint16_t)0x0, (OperandType)42, (OperandType)46, (OperandType)27, {0x66,0xf,0x3a,0x21}, 4, -1, 1, 5},
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
-{(uint16_t)0x0, (OperandType)0, (OperandType)0, (OperandType)0, {0x6d,0x00,0x00,0x00}, 1, -1, -1, 4},
+{(uint16_t)0x0, (OperandType)0, (OperandType)0, (OperandType)0, {0x66,0x6d,0x00,0x00}, 2, -1, -1, 4},
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
 {(uint16_t)0x0, (OperandType)0, (OperandType)0, (OperandType)0, {0xf,0x8,0x00,0x00}, 2, -1, -1, 4},
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
@@ -1379,7 +1383,7 @@ static const Instruction INSTRUCTION_TABLE[] = {
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
 {(uint16_t)0x48, (OperandType)0, (OperandType)0, (OperandType)0, {0xad,0x00,0x00,0x00}, 1, -1, -1, 4},
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
-{(uint16_t)0x0, (OperandType)0, (OperandType)0, (OperandType)0, {0xad,0x00,0x00,0x00}, 1, -1, -1, 4},
+{(uint16_t)0x0, (OperandType)0, (OperandType)0, (OperandType)0, {0x66,0xad,0x00,0x00}, 2, -1, -1, 4},
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
 {(uint16_t)0x0, (OperandType)1, (OperandType)0, (OperandType)0, {0xe2,0x00,0x00,0x00}, 1, -1, 1, 4},
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
@@ -1567,7 +1571,7 @@ static const Instruction INSTRUCTION_TABLE[] = {
 {(uint16_t)0x0, (OperandType)42, (OperandType)18, (OperandType)0, {0xf3,0xf,0x10,0x00}, 3, -1, -1, 5},
 {(uint16_t)0x0, (OperandType)46, (OperandType)42, (OperandType)0, {0xf3,0xf,0x11,0x00}, 3, -1, -1, 5},
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
-{(uint16_t)0x0, (OperandType)0, (OperandType)0, (OperandType)0, {0xa5,0x00,0x00,0x00}, 1, -1, -1, 4},
+{(uint16_t)0x0, (OperandType)0, (OperandType)0, (OperandType)0, {0x66,0xa5,0x00,0x00}, 2, -1, -1, 4},
 {(uint16_t)0x5, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
 {(uint16_t)0x0, (OperandType)12, (OperandType)23, (OperandType)0, {0xf,0xbe,0x00,0x00}, 2, -1, -1, 5},
 {(uint16_t)0x0, (OperandType)13, (OperandType)23, (OperandType)0, {0xf,0xbe,0x00,0x00}, 2, -1, -1, 5},
@@ -1670,7 +1674,7 @@ static const Instruction INSTRUCTION_TABLE[] = {
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
 {(uint16_t)0x0, (OperandType)0, (OperandType)0, (OperandType)0, {0x6f,0x00,0x00,0x00}, 1, -1, -1, 4},
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
-{(uint16_t)0x0, (OperandType)0, (OperandType)0, (OperandType)0, {0x6f,0x00,0x00,0x00}, 1, -1, -1, 4},
+{(uint16_t)0x0, (OperandType)0, (OperandType)0, (OperandType)0, {0x66,0x6f,0x00,0x00}, 2, -1, -1, 4},
 {(uint16_t)0x2, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
 {(uint16_t)0x0, (OperandType)41, (OperandType)40, (OperandType)0, {0xf,0x38,0x1c,0x00}, 3, -1, -1, 5},
 {(uint16_t)0x0, (OperandType)42, (OperandType)48, (OperandType)0, {0x66,0xf,0x38,0x1c}, 4, -1, -1, 5},
@@ -2307,7 +2311,7 @@ static const Instruction INSTRUCTION_TABLE[] = {
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
 {(uint16_t)0x48, (OperandType)0, (OperandType)0, (OperandType)0, {0xaf,0x00,0x00,0x00}, 1, -1, -1, 4},
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
-{(uint16_t)0x0, (OperandType)0, (OperandType)0, (OperandType)0, {0xaf,0x00,0x00,0x00}, 1, -1, -1, 4},
+{(uint16_t)0x0, (OperandType)0, (OperandType)0, (OperandType)0, {0x66,0xaf,0x00,0x00}, 2, -1, -1, 4},
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
 {(uint16_t)0x0, (OperandType)10, (OperandType)0, (OperandType)0, {0xf3,0xf,0xc7,0x00}, 3, 6, -1, 4},
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
@@ -2517,7 +2521,7 @@ static const Instruction INSTRUCTION_TABLE[] = {
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
 {(uint16_t)0x48, (OperandType)0, (OperandType)0, (OperandType)0, {0xab,0x00,0x00,0x00}, 1, -1, -1, 4},
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
-{(uint16_t)0x0, (OperandType)0, (OperandType)0, (OperandType)0, {0xab,0x00,0x00,0x00}, 1, -1, -1, 4},
+{(uint16_t)0x0, (OperandType)0, (OperandType)0, (OperandType)0, {0x66,0xab,0x00,0x00}, 2, -1, -1, 4},
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
 {(uint16_t)0x0, (OperandType)24, (OperandType)0, (OperandType)0, {0xf,0x0,0x00,0x00}, 2, 1, -1, 4},
 {(uint16_t)0x0, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
@@ -2728,8 +2732,8 @@ static const Instruction INSTRUCTION_TABLE[] = {
 {(uint16_t)0x301, (OperandType)47, (OperandType)42, (OperandType)27, {0x1d,0x00,0x00,0x00}, 1, -1, 1, 17},
 {(uint16_t)0x305, (OperandType)48, (OperandType)43, (OperandType)27, {0x1d,0x00,0x00,0x00}, 1, -1, 1, 17},
 {(uint16_t)0x2, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
-{(uint16_t)0x3, (OperandType)13, (OperandType)47, (OperandType)0, {0x2d,0x1,0x00,0x00}, 2, -1, -1, 17},
-{(uint16_t)0x83, (OperandType)14, (OperandType)47, (OperandType)0, {0x2d,0x1,0x00,0x00}, 2, -1, -1, 17},
+{(uint16_t)0x3, (OperandType)13, (OperandType)47, (OperandType)0, {0x2d,0x00,0x00,0x00}, 1, -1, -1, 17},
+{(uint16_t)0x83, (OperandType)14, (OperandType)47, (OperandType)0, {0x2d,0x00,0x00,0x00}, 1, -1, -1, 17},
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
 {(uint16_t)0x3, (OperandType)42, (OperandType)42, (OperandType)47, {0x5a,0x00,0x00,0x00}, 1, -1, -1, 9},
 {(uint16_t)0x2, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
@@ -2741,8 +2745,8 @@ static const Instruction INSTRUCTION_TABLE[] = {
 {(uint16_t)0x1, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
 {(uint16_t)0x2, (OperandType)42, (OperandType)42, (OperandType)46, {0x5a,0x00,0x00,0x00}, 1, -1, -1, 9},
 {(uint16_t)0x2, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
-{(uint16_t)0x2, (OperandType)13, (OperandType)46, (OperandType)0, {0x2d,0x1,0x00,0x00}, 2, -1, -1, 17},
-{(uint16_t)0x82, (OperandType)14, (OperandType)46, (OperandType)0, {0x2d,0x1,0x00,0x00}, 2, -1, -1, 17},
+{(uint16_t)0x2, (OperandType)13, (OperandType)46, (OperandType)0, {0x2d,0x00,0x00,0x00}, 1, -1, -1, 17},
+{(uint16_t)0x82, (OperandType)14, (OperandType)46, (OperandType)0, {0x2d,0x00,0x00,0x00}, 1, -1, -1, 17},
 {(uint16_t)0x2, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
 {(uint16_t)0x1, (OperandType)42, (OperandType)48, (OperandType)0, {0xe6,0x00,0x00,0x00}, 1, -1, -1, 9},
 {(uint16_t)0x5, (OperandType)42, (OperandType)49, (OperandType)0, {0xe6,0x00,0x00,0x00}, 1, -1, -1, 9},
@@ -2750,11 +2754,11 @@ static const Instruction INSTRUCTION_TABLE[] = {
 {(uint16_t)0x2, (OperandType)42, (OperandType)48, (OperandType)0, {0x5b,0x00,0x00,0x00}, 1, -1, -1, 9},
 {(uint16_t)0x6, (OperandType)43, (OperandType)49, (OperandType)0, {0x5b,0x00,0x00,0x00}, 1, -1, -1, 9},
 {(uint16_t)0x2, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
-{(uint16_t)0x3, (OperandType)13, (OperandType)47, (OperandType)0, {0x2c,0x1,0x00,0x00}, 2, -1, -1, 17},
-{(uint16_t)0x83, (OperandType)14, (OperandType)47, (OperandType)0, {0x2c,0x1,0x00,0x00}, 2, -1, -1, 17},
+{(uint16_t)0x3, (OperandType)13, (OperandType)47, (OperandType)0, {0x2c,0x00,0x00,0x00}, 1, -1, -1, 17},
+{(uint16_t)0x83, (OperandType)14, (OperandType)47, (OperandType)0, {0x2c,0x00,0x00,0x00}, 1, -1, -1, 17},
 {(uint16_t)0x2, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
-{(uint16_t)0x2, (OperandType)13, (OperandType)46, (OperandType)0, {0x2c,0x1,0x00,0x00}, 2, -1, -1, 17},
-{(uint16_t)0x82, (OperandType)14, (OperandType)46, (OperandType)0, {0x2c,0x1,0x00,0x00}, 2, -1, -1, 17},
+{(uint16_t)0x2, (OperandType)13, (OperandType)46, (OperandType)0, {0x2c,0x00,0x00,0x00}, 1, -1, -1, 17},
+{(uint16_t)0x82, (OperandType)14, (OperandType)46, (OperandType)0, {0x2c,0x00,0x00,0x00}, 1, -1, -1, 17},
 {(uint16_t)0x2, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
 {(uint16_t)0x1, (OperandType)42, (OperandType)42, (OperandType)48, {0x5e,0x00,0x00,0x00}, 1, -1, -1, 9},
 {(uint16_t)0x5, (OperandType)43, (OperandType)43, (OperandType)49, {0x5e,0x00,0x00,0x00}, 1, -1, -1, 9},
@@ -3176,7 +3180,7 @@ static const Instruction INSTRUCTION_TABLE[] = {
 {(uint16_t)0x1, (OperandType)42, (OperandType)42, (OperandType)48, {0xed,0x00,0x00,0x00}, 1, -1, -1, 9},
 {(uint16_t)0x5, (OperandType)43, (OperandType)43, (OperandType)49, {0xed,0x00,0x00,0x00}, 1, -1, -1, 9},
 {(uint16_t)0x2, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
-{(uint16_t)0x0, (OperandType)42, (OperandType)42, (OperandType)48, {0xdc,0x00,0x00,0x00}, 1, -1, -1, 9},
+{(uint16_t)0x1, (OperandType)42, (OperandType)42, (OperandType)48, {0xdc,0x00,0x00,0x00}, 1, -1, -1, 9},
 {(uint16_t)0x5, (OperandType)43, (OperandType)43, (OperandType)49, {0xdc,0x00,0x00,0x00}, 1, -1, -1, 9},
 {(uint16_t)0x2, (OperandType)0, (OperandType)0, (OperandType)0, {0x0,0x0,0x0,0x0}, 4, 0, 0, 0},
 {(uint16_t)0x1, (OperandType)42, (OperandType)42, (OperandType)48, {0xdd,0x00,0x00,0x00}, 1, -1, -1, 9},